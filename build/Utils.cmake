@@ -59,6 +59,9 @@ function(executorch_print_configuration_summary)
   message(STATUS "  EXECUTORCH_BUILD_EXTENSION_DATA_LOADER : "
                  "${EXECUTORCH_BUILD_EXTENSION_DATA_LOADER}"
   )
+  message(STATUS "  EXECUTORCH_BUILD_EXTENSION_FLAT_TENSOR : "
+                 "${EXECUTORCH_BUILD_EXTENSION_FLAT_TENSOR}"
+  )
   message(STATUS "  EXECUTORCH_BUILD_EXTENSION_MODULE      : "
                  "${EXECUTORCH_BUILD_EXTENSION_MODULE}"
   )
@@ -125,6 +128,12 @@ function(executorch_print_configuration_summary)
     STATUS
       "  EXECUTORCH_BUILD_CPUINFO               : ${EXECUTORCH_BUILD_CPUINFO}"
   )
+  message(STATUS "  EXECUTORCH_PORTABLE_USE_THREADPOOL     : "
+                 "${EXECUTORCH_PORTABLE_USE_THREADPOOL}"
+  )
+  message(STATUS "  EXECUTORCH_QUANTIZED_USE_THREADPOOL    : "
+                 "${EXECUTORCH_QUANTIZED_USE_THREADPOOL}"
+  )
 
 endfunction()
 
@@ -214,6 +214,7 @@ EventTracerEntry ETDumpGen::start_profiling(
     prof_entry.chain_id = chain_id;
     prof_entry.debug_handle = debug_handle;
   }
+  push_perf_counters();
   prof_entry.start_time = et_pal_current_ticks();
   return prof_entry;
 }
@@ -236,6 +237,7 @@ EventTracerEntry ETDumpGen::start_profiling_delegate(
   prof_entry.event_id = delegate_debug_index == static_cast<unsigned int>(-1)
       ? create_string_entry(name)
       : delegate_debug_index;
+  push_perf_counters();
   prof_entry.start_time = et_pal_current_ticks();
   return prof_entry;
 }
@@ -245,6 +247,8 @@ void ETDumpGen::end_profiling_delegate(
     const void* metadata,
     size_t metadata_len) {
   et_timestamp_t end_time = et_pal_current_ticks();
+  PerfCounterSample end_counters;
+  perf_counters_.read(&end_counters);
   check_ready_to_add_events();
 
   // Start building the ProfileEvent entry.
@@ -267,6 +271,7 @@ void ETDumpGen::end_profiling_delegate(
   flatbuffers_uint8_vec_ref_t vec_ref = flatbuffers_uint8_vec_create_pe(
       builder_, (const uint8_t*)metadata, metadata_len);
   etdump_ProfileEvent_delegate_debug_metadata_add(builder_, vec_ref);
+  pop_perf_counters(end_counters);
   etdump_ProfileEvent_ref_t id = etdump_ProfileEvent_end(builder_);
   etdump_RunData_events_push_start(builder_);
   etdump_Event_profile_event_add(builder_, id);
@@ -425,6 +430,8 @@ void ETDumpGen::log_intermediate_output_delegate_helper(
 
 void ETDumpGen::end_profiling(EventTracerEntry prof_entry) {
   et_timestamp_t end_time = et_pal_current_ticks();
+  PerfCounterSample end_counters;
+  perf_counters_.read(&end_counters);
   ET_CHECK_MSG(
       prof_entry.delegate_event_id_type == DelegateDebugIdType::kNone,
       "Delegate events must use end_profiling_delegate to mark the end of a delegate profiling event.");
@@ -438,6 +445,7 @@ void ETDumpGen::end_profiling(EventTracerEntry prof_entry) {
   if (prof_entry.event_id != -1) {
     etdump_ProfileEvent_name_add(builder_, prof_entry.event_id);
   }
+  pop_perf_counters(end_counters);
   etdump_ProfileEvent_ref_t id = etdump_ProfileEvent_end(builder_);
   etdump_RunData_events_push_start(builder_);
   etdump_Event_profile_event_add(builder_, id);
@@ -501,6 +509,53 @@ void ETDumpGen::set_debug_buffer(Span<uint8_t> buffer) {
   debug_buffer_ = buffer;
 }
 
+bool ETDumpGen::enable_perf_counters() {
+  perf_counter_depth_ = 0;
+  return perf_counters_.open();
+}
+
+void ETDumpGen::disable_perf_counters() {
+  perf_counters_.close();
+  perf_counter_depth_ = 0;
+}
+
+void ETDumpGen::push_perf_counters() {
+  if (!perf_counters_.is_open()) {
+    return;
+  }
+  if (perf_counter_depth_ < kMaxPerfCounterDepth) {
+    perf_counters_.read(&perf_counter_stack_[perf_counter_depth_]);
+  }
+  ++perf_counter_depth_;
+}
+
+// Must be called while a ProfileEvent table is being built.
+void ETDumpGen::pop_perf_counters(const PerfCounterSample& end_sample) {
+  if (!perf_counters_.is_open() || perf_counter_depth_ == 0) {
+    return;
+  }
+  --perf_counter_depth_;
+  if (perf_counter_depth_ >= kMaxPerfCounterDepth) {
+    return;
+  }
+  const PerfCounterSample& start_sample =
+      perf_counter_stack_[perf_counter_depth_];
+  if (start_sample.num_counters == 0 ||
+      start_sample.num_counters != end_sample.num_counters) {
+    // One of the reads failed; keep the timing data only.
+    return;
+  }
+  etdump_ProfileEvent_perf_counters_start(builder_);
+  for (size_t i = 0; i < end_sample.num_counters; ++i) {
+    etdump_ProfileEvent_perf_counters_push_create(
+        builder_,
+        static_cast<etdump_PerfCounterType_enum_t>(
+            perf_counters_.counter_type(i)),
+        end_sample.values[i] - start_sample.values[i]);
+  }
+  etdump_ProfileEvent_perf_counters_end(builder_);
+}
+
 size_t ETDumpGen::copy_tensor_to_debug_buffer(exec_aten::Tensor tensor) {
   if (tensor.nbytes() == 0) {
     return static_cast<size_t>(-1);
@@ -10,6 +10,7 @@
 
 #include <cstdint>
 
+#include <executorch/devtools/etdump/perf_counters.h>
 #include <executorch/runtime/core/event_tracer.h>
 #include <executorch/runtime/core/span.h>
 #include <executorch/runtime/platform/platform.h>
@@ -137,6 +138,27 @@ class ETDumpGen : public ::executorch::runtime::EventTracer {
       ::executorch::runtime::DebugHandle delegate_debug_index,
       const double& output) override;
   void set_debug_buffer(::executorch::runtime::Span<uint8_t> buffer);
+
+  /**
+   * Capture hardware performance counters (cycles, instructions, cache misses
+   * and branch misses) around every profiling event that is started and ended
+   * through this ETDumpGen, including operator and delegate events. The
+   * per-event deltas are stored in ProfileEvent.perf_counters.
+   *
+   * @returns true if at least one counter could be opened. If perf events are
+   * not available on this platform this returns false and profiling events
+   * keep being logged with timestamps only.
+   */
+  bool enable_perf_counters();
+
+  /// Stop capturing hardware performance counters.
+  void disable_perf_counters();
+
+  /// Returns true if hardware performance counters are being captured.
+  bool perf_counters_enabled() const {
+    return perf_counters_.is_open();
+  }
+
   ETDumpResult get_etdump_data();
   size_t get_num_blocks();
   bool is_static_etdump();
@@ -154,6 +176,8 @@ class ETDumpGen : public ::executorch::runtime::EventTracer {
   void check_ready_to_add_events();
   int64_t create_string_entry(const char* name);
   size_t copy_tensor_to_debug_buffer(exec_aten::Tensor tensor);
+  void push_perf_counters();
+  void pop_perf_counters(const PerfCounterSample& end_sample);
 
   /**
    * Templated helper function used to log various types of intermediate output.
@@ -172,6 +196,15 @@ class ETDumpGen : public ::executorch::runtime::EventTracer {
   int bundled_input_index_ = -1;
   State state_ = State::Init;
   struct internal::ETDumpStaticAllocator alloc_;
+
+  // Profiling events are started and ended in LIFO order by the RAII scopes
+  // in the runtime, so the counter values at the start of each open event are
+  // kept on a small fixed-size stack. Events nested deeper than this are
+  // logged without counters.
+  static constexpr size_t kMaxPerfCounterDepth = 16;
+  PerfCounterGroup perf_counters_;
+  PerfCounterSample perf_counter_stack_[kMaxPerfCounterDepth];
+  size_t perf_counter_depth_ = 0;
 };
 
 } // namespace etdump
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/devtools/etdump/perf_counters.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif // defined(__linux__)
+
+namespace executorch {
+namespace etdump {
+
+#if defined(__linux__)
+
+namespace {
+
+uint64_t perf_config_for_type(PerfCounterType type) {
+  switch (type) {
+    case PerfCounterType::kCycles:
+      return PERF_COUNT_HW_CPU_CYCLES;
+    case PerfCounterType::kInstructions:
+      return PERF_COUNT_HW_INSTRUCTIONS;
+    case PerfCounterType::kCacheMisses:
+      return PERF_COUNT_HW_CACHE_MISSES;
+    case PerfCounterType::kBranchMisses:
+      return PERF_COUNT_HW_BRANCH_MISSES;
+  }
+  return PERF_COUNT_HW_CPU_CYCLES;
+}
+
+int open_counter(PerfCounterType type, int group_fd) {
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = perf_config_for_type(type);
+  // The leader starts disabled and the whole group is enabled at once so
+  // that all counters cover the same interval.
+  attr.disabled = group_fd == -1 ? 1 : 0;
+  // Excluding the kernel and hypervisor keeps this usable with the default
+  // perf_event_paranoid level and matches what kernels actually control.
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP;
+  return static_cast<int>(syscall(
+      SYS_perf_event_open,
+      &attr,
+      /*pid=*/0,
+      /*cpu=*/-1,
+      group_fd,
+      /*flags=*/0));
+}
+
+} // namespace
+
+PerfCounterGroup::~PerfCounterGroup() {
+  close();
+}
+
+bool PerfCounterGroup::open() {
+  if (is_open()) {
+    return true;
+  }
+  for (size_t i = 0; i < kNumPerfCounterTypes; ++i) {
+    const PerfCounterType type = static_cast<PerfCounterType>(i);
+    const int group_fd = num_counters_ == 0 ? -1 : fds_[0];
+    const int fd = open_counter(type, group_fd);
+    if (fd < 0) {
+      // Not every PMU exposes every generic event; skip the ones we can't
+      // get rather than giving up on the whole group.
+      continue;
+    }
+    fds_[num_counters_] = fd;
+    types_[num_counters_] = type;
+    ++num_counters_;
+  }
+  if (num_counters_ == 0) {
+    return false;
+  }
+  if (ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP) != 0 ||
+      ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) != 0) {
+    close();
+    return false;
+  }
+  return true;
+}
+
+void PerfCounterGroup::close() {
+  if (num_counters_ > 0) {
+    ioctl(fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+  }
+  // Close members before the group leader.
+  for (size_t i = num_counters_; i > 0; --i) {
+    ::close(fds_[i - 1]);
+    fds_[i - 1] = -1;
+  }
+  num_counters_ = 0;
+}
+
+bool PerfCounterGroup::read(PerfCounterSample* sample) const {
+  sample->num_counters = 0;
+  if (!is_open()) {
+    return false;
+  }
+  // With PERF_FORMAT_GROUP the layout is { nr, values[nr] }, with values in
+  // the order the counters were added to the group.
+  uint64_t buf[1 + kNumPerfCounterTypes];
+  const ssize_t nread = ::read(fds_[0], buf, sizeof(buf));
+  if (nread < static_cast<ssize_t>(sizeof(uint64_t)) ||
+      buf[0] != num_counters_) {
+    return false;
+  }
+  for (size_t i = 0; i < num_counters_; ++i) {
+    sample->values[i] = buf[1 + i];
+  }
+  sample->num_counters = num_counters_;
+  return true;
+}
+
+#else // !defined(__linux__)
+
+PerfCounterGroup::~PerfCounterGroup() {}
+
+bool PerfCounterGroup::open() {
+  // perf_event_open is Linux-only; callers fall back to timestamps.
+  return false;
+}
+
+void PerfCounterGroup::close() {}
+
+bool PerfCounterGroup::read(PerfCounterSample* sample) const {
+  sample->num_counters = 0;
+  return false;
+}
+
+#endif // defined(__linux__)
+
+} // namespace etdump
+} // namespace executorch
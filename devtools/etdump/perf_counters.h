@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace executorch {
+namespace etdump {
+
+/// Hardware performance counters that can be captured around profiling
+/// events. These values are serialized into ETDump and should not be changed.
+enum class PerfCounterType : uint8_t {
+  kCycles = 0,
+  kInstructions = 1,
+  kCacheMisses = 2,
+  kBranchMisses = 3,
+};
+
+/// Number of entries in PerfCounterType.
+constexpr size_t kNumPerfCounterTypes = 4;
+
+/**
+ * Raw counter values read from a PerfCounterGroup at a single point in time.
+ * Only the first `num_counters` entries of `values` are valid, and entry i
+ * corresponds to `PerfCounterGroup::counter_type(i)`.
+ */
+struct PerfCounterSample {
+  uint64_t values[kNumPerfCounterTypes];
+  size_t num_counters;
+};
+
+/**
+ * A group of hardware performance counters backed by perf_event_open(2) that
+ * counts events for the calling thread in user space.
+ *
+ * All counters are opened as a single group so that they are scheduled onto
+ * the PMU together and can be read with one syscall. Counters that the host
+ * does not support are skipped; if none of them can be opened (non-Linux
+ * platforms, missing PMU in a VM, or a restrictive perf_event_paranoid
+ * setting) open() fails and callers should fall back to timestamps only.
+ *
+ * Work done on other threads, e.g. by a threadpool used inside a kernel, is
+ * not counted.
+ */
+class PerfCounterGroup final {
+ public:
+  PerfCounterGroup() = default;
+  ~PerfCounterGroup();
+
+  PerfCounterGroup(const PerfCounterGroup&) = delete;
+  PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+  PerfCounterGroup(PerfCounterGroup&&) = delete;
+  PerfCounterGroup& operator=(PerfCounterGroup&&) = delete;
+
+  /**
+   * Opens and enables the counter group. Calling this on an already open
+   * group is a no-op.
+   *
+   * @returns true if at least one counter is available.
+   */
+  bool open();
+
+  /// Disables and closes all counters in the group.
+  void close();
+
+  /// Returns true if the group has at least one open counter.
+  bool is_open() const {
+    return num_counters_ > 0;
+  }
+
+  /// Returns the number of counters that were successfully opened.
+  size_t num_counters() const {
+    return num_counters_;
+  }
+
+  /// Returns the type of the i'th open counter.
+  PerfCounterType counter_type(size_t i) const {
+    return types_[i];
+  }
+
+  /**
+   * Reads the current value of every open counter into `sample`.
+   *
+   * @returns true on success. On failure `sample->num_counters` is set to 0.
+   */
+  bool read(PerfCounterSample* sample) const;
+
+ private:
+  int fds_[kNumPerfCounterTypes] = {-1, -1, -1, -1};
+  PerfCounterType types_[kNumPerfCounterTypes] = {};
+  size_t num_counters_ = 0;
+};
+
+} // namespace etdump
+} // namespace executorch
@@ -94,12 +94,14 @@ def define_common_targets():
             srcs = [
                 "etdump_flatcc.cpp",
                 "emitter.cpp",
+                "perf_counters.cpp",
             ],
             headers = [
                 "emitter.h",
             ],
             exported_headers = [
                 "etdump_flatcc.h",
+                "perf_counters.h",
             ],
             deps = [
                 "//executorch/runtime/platform:platform",
@@ -685,6 +685,77 @@ TEST_F(ProfilerETDumpTest, LogDelegateEvents) {
   }
 }
 
+TEST_F(ProfilerETDumpTest, PerfCounters) {
+  for (size_t i = 0; i < 2; i++) {
+    // Perf events may be unavailable on the test host (non-Linux, VMs without
+    // a PMU, restrictive perf_event_paranoid). In that case profiling must
+    // keep working with timestamps only.
+    bool counters_enabled = etdump_gen[i]->enable_perf_counters();
+    EXPECT_EQ(counters_enabled, etdump_gen[i]->perf_counters_enabled());
+
+    etdump_gen[i]->create_event_block("test_block");
+    EventTracerEntry outer = etdump_gen[i]->start_profiling("outer", 0, 1);
+    EventTracerEntry inner = etdump_gen[i]->start_profiling("inner", 0, 2);
+    volatile uint64_t sum = 0;
+    for (uint64_t j = 0; j < 10000; ++j) {
+      sum = sum + j;
+    }
+    etdump_gen[i]->end_profiling(inner);
+    etdump_gen[i]->end_profiling(outer);
+    EventTracerEntry delegate_entry = etdump_gen[i]->start_profiling_delegate(
+        "delegate_event", static_cast<torch::executor::DebugHandle>(-1));
+    etdump_gen[i]->end_profiling_delegate(delegate_entry, nullptr, 0);
+    // Events logged after counters are disabled only carry timestamps.
+    etdump_gen[i]->disable_perf_counters();
+    EXPECT_FALSE(etdump_gen[i]->perf_counters_enabled());
+    EventTracerEntry after = etdump_gen[i]->start_profiling("after", 0, 3);
+    etdump_gen[i]->end_profiling(after);
+
+    ETDumpResult result = etdump_gen[i]->get_etdump_data();
+    ASSERT_TRUE(result.buf != nullptr);
+    ASSERT_TRUE(result.size != 0);
+
+    size_t size = 0;
+    void* buf = flatbuffers_read_size_prefix(result.buf, &size);
+    etdump_ETDump_table_t etdump = etdump_ETDump_as_root_with_identifier(
+        buf, etdump_ETDump_file_identifier);
+    etdump_RunData_vec_t run_data_vec = etdump_ETDump_run_data(etdump);
+    etdump_Event_vec_t event_vec =
+        etdump_RunData_events(etdump_RunData_vec_at(run_data_vec, 0));
+    ASSERT_EQ(etdump_Event_vec_len(event_vec), 4);
+
+    // Events are serialized in the order in which they ended.
+    for (size_t j = 0; j < 3; ++j) {
+      etdump_ProfileEvent_table_t profile_event =
+          etdump_Event_profile_event(etdump_Event_vec_at(event_vec, j));
+      etdump_PerfCounter_vec_t counters =
+          etdump_ProfileEvent_perf_counters(profile_event);
+      if (!counters_enabled) {
+        EXPECT_EQ(etdump_PerfCounter_vec_len(counters), 0);
+        continue;
+      }
+      ASSERT_GT(etdump_PerfCounter_vec_len(counters), 0);
+      for (size_t k = 0; k < etdump_PerfCounter_vec_len(counters); ++k) {
+        etdump_PerfCounter_table_t counter =
+            etdump_PerfCounter_vec_at(counters, k);
+        EXPECT_LE(
+            etdump_PerfCounter_counter_type(counter),
+            etdump_PerfCounterType_BranchMisses);
+      }
+    }
+    etdump_ProfileEvent_table_t after_event =
+        etdump_Event_profile_event(etdump_Event_vec_at(event_vec, 3));
+    EXPECT_EQ(
+        etdump_PerfCounter_vec_len(
+            etdump_ProfileEvent_perf_counters(after_event)),
+        0);
+
+    if (!etdump_gen[i]->is_static_etdump()) {
+      free(result.buf);
+    }
+  }
+}
+
 TEST_F(ProfilerETDumpTest, WriteAfterGetETDumpData) {
   for (size_t i = 0; i < 2; i++) {
     for (size_t j = 0; j < 2; j++) {
@@ -298,6 +298,8 @@ class Event:
     Args:
         name: Name of the profiling `Event`, empty if no profiling event.
         perf_data: Performance data associated with the event retrived from the runtime (available attributes: p10, p50, p90, avg, min and max).
+        perf_counters: Hardware performance counter data associated with the event, keyed by counter name (e.g. "Cycles", "Instructions").
+            Only populated if counters were enabled on the runtime ETDumpGen and supported by the platform.
         op_type: List of op types corresponding to the event.
         delegate_debug_identifier: Supplemental identifier used in combination with instruction id.
         debug_handles: Debug handles in the model graph to which this event is correlated.
@@ -318,6 +320,7 @@ class Event:
 
     name: str
     perf_data: Optional[PerfData] = None
+    perf_counters: Dict[str, PerfData] = dataclasses.field(default_factory=dict)
     op_types: List[str] = dataclasses.field(default_factory=list)
     delegate_debug_identifier: Optional[Union[int, str]] = None
     debug_handles: Optional[Union[int, Sequence[int]]] = None
@@ -522,6 +525,7 @@ class Event:
             delegate_debug_identifier
             is_delegated_op
             perf_data
+            perf_counters
             delegate_debug_metadatas
         """
 
@@ -530,6 +534,7 @@ class Event:
 
         # Fill out fields from profile event
         data = []
+        counter_data: Dict[str, List[float]] = OrderedDict()
         delegate_debug_metadatas = []
         for event in events:
             if (profile_events := event.profile_events) is not None:
@@ -571,6 +576,10 @@ class Event:
                     )
 
                 data.append(scaled_time)
+                for perf_counter in profile_event.perf_counters or []:
+                    counter_data.setdefault(perf_counter.counter_type, []).append(
+                        float(perf_counter.value)
+                    )
                 delegate_debug_metadatas.append(
                     profile_event.delegate_debug_metadata
                     if profile_event.delegate_debug_metadata
@@ -580,6 +589,8 @@ class Event:
         # Update fields
         if len(data) > 0:
             ret_event.perf_data = PerfData(data)
+        for counter_type, values in counter_data.items():
+            ret_event.perf_counters[counter_type] = PerfData(values)
         if any(delegate_debug_metadatas):
             ret_event._delegate_debug_metadatas = delegate_debug_metadatas
 
@@ -682,7 +693,10 @@ class EventBlock:
     reference_output: Optional[ProgramOutput] = None
 
     def to_dataframe(
-        self, include_units: bool = False, include_delegate_debug_data: bool = False
+        self,
+        include_units: bool = False,
+        include_delegate_debug_data: bool = False,
+        include_perf_counters: bool = False,
     ) -> pd.DataFrame:
         """
         Converts the EventBlock into a DataFrame with each row being an event instance
@@ -693,6 +707,7 @@ class EventBlock:
         Args:
             include_units: Whether headers should include units (default false)
             include_delegate_debug_data: Whether to show the delegate debug data
+            include_perf_counters: Whether to show the average of each hardware performance counter
 
         Returns:
             A pandas DataFrame containing the data of each Event instance in this EventBlock.
@@ -731,6 +746,21 @@ class EventBlock:
             if any(not data.empty for data in delegate_data):
                 df = pd.concat([df, pd.DataFrame(delegate_data)], axis=1)
 
+        # Add hardware performance counter columns
+        if include_perf_counters:
+            counter_data = [
+                pd.Series(
+                    {
+                        f"{counter_type} (avg)": data.avg
+                        for counter_type, data in event.perf_counters.items()
+                    },
+                    dtype="float64",
+                )
+                for event in self.events
+            ]
+            if any(not data.empty for data in counter_data):
+                df = pd.concat([df, pd.DataFrame(counter_data)], axis=1)
+
         return df
 
     @staticmethod
@@ -1124,11 +1154,13 @@ class Inspector:
         self,
         include_units: bool = True,
         include_delegate_debug_data: bool = False,
+        include_perf_counters: bool = False,
     ) -> pd.DataFrame:
         """
         Args:
             include_units: Whether headers should include units (default true)
             include_delegate_debug_data: Whether to include delegate debug metadata (default false)
+            include_perf_counters: Whether to include hardware performance counter averages (default false)
 
         Returns:
             Returns a pandas DataFrame of the Events in each EventBlock in the inspector, with each row representing an Event.
@@ -1138,6 +1170,7 @@ class Inspector:
             event_block.to_dataframe(
                 include_units=include_units,
                 include_delegate_debug_data=include_delegate_debug_data,
+                include_perf_counters=include_perf_counters,
             )
             for event_block in self.event_blocks
         ]
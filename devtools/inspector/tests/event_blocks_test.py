@@ -397,6 +397,63 @@ class TestEventBlock(unittest.TestCase):
         self.assertEqual(len(blocks[1].events[0].debug_data), 1)
         self.assertEqual(len(blocks[1].events[1].debug_data), 0)
 
+    def test_gen_from_etdump_perf_counters(self) -> None:
+        """
+        Test that hardware performance counters logged with ProfileEvents are
+        aggregated per counter type across runs, and are absent for events
+        that were profiled with timestamps only.
+        """
+        run_data = []
+        for cycles, instructions in ((100, 400), (300, 800)):
+            profile_event = TestEventBlock._gen_sample_profile_event(
+                name="profile_1", instruction_id=1, time=(0, 1)
+            )
+            profile_event.perf_counters = [
+                flatcc.PerfCounter(
+                    counter_type=flatcc.PerfCounterType.CYCLES.value, value=cycles
+                ),
+                flatcc.PerfCounter(
+                    counter_type=flatcc.PerfCounterType.INSTRUCTIONS.value,
+                    value=instructions,
+                ),
+            ]
+            timing_only_event = TestEventBlock._gen_sample_profile_event(
+                name="profile_2", instruction_id=2, time=(1, 2)
+            )
+            run_data.append(
+                flatcc.RunData(
+                    name="signature_a",
+                    bundled_input_index=-1,
+                    allocators=[],
+                    events=[
+                        flatcc.Event(
+                            allocation_event=None,
+                            debug_event=None,
+                            profile_event=profile_event,
+                        ),
+                        flatcc.Event(
+                            allocation_event=None,
+                            debug_event=None,
+                            profile_event=timing_only_event,
+                        ),
+                    ],
+                )
+            )
+        etdump = ETDumpFlatCC(version=0, run_data=run_data)
+        blocks: List[EventBlock] = EventBlock._gen_from_etdump(etdump)
+
+        self.assertEqual(len(blocks), 1)
+        self.assertEqual(len(blocks[0].events), 2)
+        perf_counters = blocks[0].events[0].perf_counters
+        self.assertEqual(list(perf_counters.keys()), ["Cycles", "Instructions"])
+        self.assertEqual(perf_counters["Cycles"].raw, [100.0, 300.0])
+        self.assertEqual(perf_counters["Instructions"].avg, 600.0)
+        self.assertEqual(blocks[0].events[1].perf_counters, {})
+
+        df = blocks[0].to_dataframe(include_perf_counters=True)
+        self.assertIn("Cycles (avg)", df.columns)
+        self.assertEqual(df["Cycles (avg)"][0], 200.0)
+
     def test_gen_from_etdump_inconsistent_debug_data(self) -> None:
         """
         Make sure AssertionError is thrown when intermediate outputs are different across
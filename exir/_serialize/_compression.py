@@ -0,0 +1,208 @@
+# Copyright (c) Meta Platforms, Inc. and affiliates.
+# All rights reserved.
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+# pyre-strict
+
+"""Chunked segment compression, matching SegmentCompression in program.fbs."""
+
+from typing import List, Tuple
+
+from executorch.exir._serialize._cord import Cord
+from executorch.exir.schema import SegmentCompression
+
+try:
+    # pyre-ignore[21]: Optional dependency.
+    import lz4.block as _lz4_block
+except ImportError:
+    _lz4_block = None
+
+# Uncompressed bytes per chunk. Large enough that chunk boundaries barely hurt
+# the compression ratio, small enough that a multi-GB segment splits into
+# plenty of chunks to decompress in parallel.
+DEFAULT_CHUNK_SIZE: int = 1 << 20
+
+# LZ4 block format constants; see
+# https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+_MIN_MATCH = 4
+# The last 5 bytes of a block are always literals.
+_LAST_LITERALS = 5
+# The last match must start at least 12 bytes before the end of the block.
+_MF_LIMIT = 12
+_MAX_OFFSET = 0xFFFF
+
+
+def _append_length(out: bytearray, length: int) -> None:
+    """Appends the extra bytes of a length whose 4-bit token field is 15."""
+    length -= 15
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+
+def _append_sequence(
+    out: bytearray, literals: memoryview, offset: int, match_length: int
+) -> None:
+    """Appends a sequence; match_length is 0 for the final literals-only one."""
+    lit_len = len(literals)
+    match_code = match_length - _MIN_MATCH if match_length else 0
+    out.append((min(lit_len, 15) << 4) | min(match_code, 15))
+    if lit_len >= 15:
+        _append_length(out, lit_len)
+    out += literals
+    if match_length:
+        out += offset.to_bytes(2, "little")
+        if match_code >= 15:
+            _append_length(out, match_code)
+
+
+def _lz4_compress_block(data: bytes) -> bytes:
+    """Compresses data into a single LZ4 block.
+
+    Uses the lz4 package when it is installed. The pure-Python fallback does a
+    greedy search for 4-byte matches; it produces valid but larger blocks, and
+    is slow enough that installing lz4 (`pip install executorch[lz4]`) is
+    recommended for large programs.
+    """
+    if _lz4_block is not None:
+        return _lz4_block.compress(data, store_size=False)
+
+    src = memoryview(data)
+    n = len(data)
+    out = bytearray()
+    # Most recent position of each 4-byte sequence.
+    last_seen = {}
+    anchor = 0
+    i = 0
+    while i <= n - _MF_LIMIT:
+        key = data[i : i + _MIN_MATCH]
+        candidate = last_seen.get(key)
+        last_seen[key] = i
+        if candidate is None or i - candidate > _MAX_OFFSET:
+            i += 1
+            continue
+        match_length = _MIN_MATCH
+        max_length = n - _LAST_LITERALS - i
+        while (
+            match_length < max_length
+            and data[candidate + match_length] == data[i + match_length]
+        ):
+            match_length += 1
+        _append_sequence(out, src[anchor:i], i - candidate, match_length)
+        i += match_length
+        anchor = i
+    _append_sequence(out, src[anchor:], 0, 0)
+    return bytes(out)
+
+
+def _read_length(data: bytes, pos: int, length: int) -> Tuple[int, int]:
+    """Reads the extra bytes of a length; returns (length, new pos)."""
+    if length == 15:
+        while True:
+            byte = data[pos]
+            pos += 1
+            length += byte
+            if byte != 255:
+                break
+    return length, pos
+
+
+def _lz4_decompress_block(data: bytes, uncompressed_size: int) -> bytes:
+    """Decompresses a single LZ4 block of known uncompressed size."""
+    if _lz4_block is not None:
+        return _lz4_block.decompress(data, uncompressed_size=uncompressed_size)
+
+    out = bytearray()
+    pos = 0
+    while True:
+        token = data[pos]
+        pos += 1
+        lit_len, pos = _read_length(data, pos, token >> 4)
+        out += data[pos : pos + lit_len]
+        pos += lit_len
+        if pos >= len(data):
+            break
+        offset = int.from_bytes(data[pos : pos + 2], "little")
+        pos += 2
+        if offset == 0 or offset > len(out):
+            raise ValueError(f"Invalid LZ4 match offset {offset}")
+        match_length, pos = _read_length(data, pos, token & 15)
+        match_length += _MIN_MATCH
+        start = len(out) - offset
+        if offset >= match_length:
+            out += out[start : start + match_length]
+        else:
+            # The match overlaps the data it produces.
+            for k in range(match_length):
+                out.append(out[start + k])
+    if len(out) != uncompressed_size:
+        raise ValueError(
+            f"LZ4 block decompressed to {len(out)} bytes, expected {uncompressed_size}"
+        )
+    return bytes(out)
+
+
+def compress_segment(
+    data: bytes, compression: SegmentCompression, chunk_size: int
+) -> Tuple[Cord, List[int]]:
+    """Compresses segment data in independent chunks.
+
+    Args:
+        data: The uncompressed segment data.
+        compression: The codec to use. Must not be NONE.
+        chunk_size: Uncompressed bytes per chunk; the last chunk may be smaller.
+
+    Returns:
+        A tuple of (compressed data, compressed size of each chunk). Chunks that
+        do not get smaller are stored as-is, so a chunk is stored as-is exactly
+        when its compressed size equals its uncompressed size.
+    """
+    if compression != SegmentCompression.LZ4:
+        raise ValueError(f"Unsupported segment compression {compression}")
+    if chunk_size <= 0:
+        raise ValueError(f"chunk_size must be positive, got {chunk_size}")
+    compressed = Cord()
+    chunk_sizes: List[int] = []
+    for start in range(0, len(data), chunk_size):
+        chunk = data[start : start + chunk_size]
+        block = _lz4_compress_block(chunk)
+        if len(block) >= len(chunk):
+            block = chunk
+        compressed.append(block)
+        chunk_sizes.append(len(block))
+    return compressed, chunk_sizes
+
+
+def decompress_segment(
+    data: bytes,
+    compression: SegmentCompression,
+    uncompressed_size: int,
+    chunk_size: int,
+    compressed_chunk_sizes: List[int],
+) -> bytes:
+    """Reverses compress_segment()."""
+    if compression != SegmentCompression.LZ4:
+        raise ValueError(f"Unsupported segment compression {compression}")
+    if sum(compressed_chunk_sizes) != len(data):
+        raise ValueError(
+            f"Chunk sizes add up to {sum(compressed_chunk_sizes)}, "
+            + f"but the segment has {len(data)} bytes"
+        )
+    out = bytearray()
+    pos = 0
+    for compressed_size in compressed_chunk_sizes:
+        chunk_uncompressed_size = min(chunk_size, uncompressed_size - len(out))
+        chunk = data[pos : pos + compressed_size]
+        pos += compressed_size
+        if compressed_size == chunk_uncompressed_size:
+            out += chunk
+        else:
+            out += _lz4_decompress_block(chunk, chunk_uncompressed_size)
+    if len(out) != uncompressed_size:
+        raise ValueError(
+            f"Segment decompressed to {len(out)} bytes, expected {uncompressed_size}"
+        )
+    return bytes(out)
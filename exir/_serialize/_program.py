@@ -11,8 +11,13 @@ import json
 import re
 
 from dataclasses import dataclass
-from typing import ClassVar, List, Literal, Optional, Tuple
+from typing import ClassVar, List, Literal, Optional, Set, Tuple
 
+from executorch.exir._serialize._compression import (
+    compress_segment,
+    decompress_segment,
+    DEFAULT_CHUNK_SIZE,
+)
 from executorch.exir._serialize._cord import Cord
 from executorch.exir._serialize._dataclass import _DataclassEncoder, _json_to_dataclass
 from executorch.exir._serialize._flatbuffer import (
@@ -28,6 +33,7 @@ from executorch.exir.schema import (
     DataLocation,
     DataSegment,
     Program,
+    SegmentCompression,
     SubsegmentOffsets,
 )
 from executorch.exir.tensor import ALIGNMENT
@@ -350,6 +356,8 @@ def serialize_pte_binary(
     segment_alignment: int = 128,
     constant_tensor_alignment: Optional[int] = None,
     delegate_alignment: Optional[int] = None,
+    segment_compression: SegmentCompression = SegmentCompression.NONE,
+    compression_chunk_size: int = DEFAULT_CHUNK_SIZE,
 ) -> Cord:
     """Returns the runtime binary representation of the given Program.
 
@@ -369,6 +377,15 @@ def serialize_pte_binary(
         delegate_alignment: If provided, the minimum alignment of delegate data
             in the program. Must be a power of 2. If not provided, uses the
             value in the schema file.
+        segment_compression: How to compress the constant and delegate
+            segments. The runtime needs a DecompressingDataLoader to load
+            compressed segments, whose alignment must satisfy
+            constant_tensor_alignment and delegate_alignment since the data no
+            longer comes from the aligned file offsets. Mutable data segments
+            are never compressed, since they are loaded piecewise.
+        compression_chunk_size: The uncompressed size of the chunks that
+            compressed segments are split into. The runtime can decompress
+            chunks in parallel.
     Returns:
         The serialized form of the Program, ready for execution by the runtime.
     """
@@ -383,6 +400,8 @@ def serialize_pte_binary(
 
     # Store extracted segment data; this may be constant data or delegate data.
     segments: List[Cord] = []
+    # Indices of the segments in `segments` that must not be compressed.
+    uncompressed_segments: Set[int] = set()
 
     constant_segment_data, constant_segment_offsets = _extract_constant_segment(
         program.constant_buffer, tensor_alignment=constant_tensor_alignment
@@ -415,6 +434,7 @@ def serialize_pte_binary(
                 ),
             ]
             # Add to the aggregate segments cord.
+            uncompressed_segments.add(len(segments))
             segments.append(mutable_segment_data)
 
     if extract_delegate_segments:
@@ -424,17 +444,29 @@ def serialize_pte_binary(
     # each segment begins at the required alignment.
     # Update program.segments with the offsets to each segment.
     segments_data = Cord()
-    for data in segments:
+    for i, data in enumerate(segments):
         prev_end = (
             (program.segments[-1].offset + program.segments[-1].size)
             if program.segments
             else 0
         )
-        program.segments.append(
-            DataSegment(
-                offset=_aligned_size(prev_end, segment_alignment), size=len(data)
-            )
+        segment = DataSegment(
+            offset=_aligned_size(prev_end, segment_alignment), size=len(data)
         )
+        if (
+            segment_compression != SegmentCompression.NONE
+            and i not in uncompressed_segments
+            and len(data) > 0
+        ):
+            data, chunk_sizes = compress_segment(
+                bytes(data), segment_compression, compression_chunk_size
+            )
+            segment.compression = segment_compression
+            segment.uncompressed_size = segment.size
+            segment.chunk_size = compression_chunk_size
+            segment.compressed_chunk_sizes = chunk_sizes
+            segment.size = len(data)
+        program.segments.append(segment)
         # Add to aggregate segments cord with padding.
         padding_length = _padding_required(len(segments_data), segment_alignment)
         if padding_length > 0:
@@ -529,7 +561,16 @@ def _restore_segments(program: Program, segment_data: bytes) -> Program:
             raise ValueError(
                 f"Segment {i} {segment} overflows data length {len(segment_data)}"
             )
-        segments.append(segment_data[segment.offset : segment.offset + segment.size])
+        data = segment_data[segment.offset : segment.offset + segment.size]
+        if segment.compression != SegmentCompression.NONE:
+            data = decompress_segment(
+                data,
+                segment.compression,
+                segment.uncompressed_size,
+                segment.chunk_size,
+                segment.compressed_chunk_sizes or [],
+            )
+        segments.append(data)
 
     # Find and replace the Program's references to these segments, inlining the
     # data.
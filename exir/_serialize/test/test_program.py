@@ -34,6 +34,7 @@ from executorch.exir.schema import (
     DataSegment,
     ExecutionPlan,
     Program,
+    SegmentCompression,
     SubsegmentOffsets,
 )
 from executorch.exir.tests.common import get_test_program
@@ -591,6 +592,49 @@ class TestProgram(unittest.TestCase):
         program2 = deserialize_pte_binary(pte_data)
         self.assert_programs_equal(program, program2)
 
+    def test_round_trip_with_compressed_segments(self) -> None:
+        # Create a program with delegate blobs that compress well, and one that
+        # doesn't.
+        program = get_test_program()
+        incompressible = bytes((i * 131 + 7) % 251 for i in range(100))
+        blobs = (
+            self.gen_blob_data(1000, b"\x10\x11\x01"),
+            self.gen_blob_data(250, b"\x20\x22\x02"),
+            incompressible,
+        )
+        add_delegate_data(program, program.execution_plan[0], blobs)
+
+        pte_data = bytes(
+            serialize_pte_binary(
+                program,
+                extract_delegate_segments=True,
+                segment_alignment=SEGMENT_ALIGNMENT,
+                segment_compression=SegmentCompression.LZ4,
+                compression_chunk_size=300,
+            )
+        )
+
+        program_with_segments = _json_to_program(_program_flatbuffer_to_json(pte_data))
+        segment_table: List[DataSegment] = program_with_segments.segments
+        self.assertEqual(len(segment_table), len(blobs))
+        for segment, blob in zip(segment_table, blobs):
+            self.assertEqual(segment.compression, SegmentCompression.LZ4)
+            self.assertEqual(segment.uncompressed_size, len(blob))
+            self.assertEqual(segment.chunk_size, 300)
+            self.assertEqual(
+                len(segment.compressed_chunk_sizes), (len(blob) + 299) // 300
+            )
+            self.assertEqual(sum(segment.compressed_chunk_sizes), segment.size)
+        # Repetitive data should shrink; the incompressible chunk is stored
+        # as-is.
+        self.assertLess(segment_table[0].size, len(blobs[0]))
+        self.assertLess(segment_table[1].size, len(blobs[1]))
+        self.assertEqual(segment_table[2].size, len(blobs[2]))
+
+        # The segments should decompress back to the original data.
+        program2 = deserialize_pte_binary(pte_data)
+        self.assert_programs_equal(program, program2)
+
     def test_no_constants(self) -> None:
         program = get_test_program()
         # Insert placeholder for non-const tensors.
@@ -14,6 +14,7 @@ from executorch.exir.dynamic_shape import DynamicMemoryPlanningMode
 from executorch.exir.pass_manager import PassType
 from executorch.exir.passes import MemoryPlanningPass, ToOutVarPass
 from executorch.exir.passes.sym_shape_eval_pass import ConstraintBasedSymShapeEvalPass
+from executorch.exir.schema import SegmentCompression
 from executorch.exir.tracer import ExirDynamoConfig
 from torch.fx._compatibility import compatibility
 
@@ -80,6 +81,11 @@ class ExecutorchBackendConfig:
     # be a power of 2. If not provided, uses the value in the schema file.
     delegate_alignment: Optional[int] = None
 
+    # How to compress the constant and delegate segments, which requires
+    # extract_delegate_segments to compress delegate data. Programs with
+    # compressed segments must be loaded through a DecompressingDataLoader.
+    segment_compression: SegmentCompression = SegmentCompression.NONE
+
     # A single sym shape eval pass can be defined for all the programs in the
     # EdgeProgramManager or can be defined per program.
     sym_shape_eval_pass: Union[PassType, Dict[str, PassType]] = (
@@ -89,3 +95,10 @@ class ExecutorchBackendConfig:
     # If set to true, view_copy operations will be converted to lightweight
     # view operations in the ET runtime
     remove_view_copy: bool = True
+
+    # If set to true, mutable buffers are emitted as method state: each one is
+    # named after its fully qualified name and serialized with its value at
+    # export time, which the runtime loads into it when the method is loaded
+    # and again when the state is reset. Otherwise their initial contents are
+    # undefined.
+    emit_mutable_buffer_state: bool = False
@@ -111,6 +111,7 @@ def emit_program(
     methods: Union[ExportedProgram, Dict[str, ExportedProgram]],
     emit_stacktrace: bool = False,
     prim_getters: Optional[Dict[str, Any]] = None,
+    emit_mutable_buffer_state: bool = False,
 ) -> EmitterOutput:
     """
     Given a exported program, it returns the program in the format
@@ -122,6 +123,9 @@ def emit_program(
             ExportedPrograms.
         emit_stacktrace: Flag to enable emission of a stacktrace for each
            instruction for debugging purposes
+        prim_getters: Methods to emit that return the given constants.
+        emit_mutable_buffer_state: Flag to emit the names and initial values of
+           mutable buffers, so that the runtime can manage them as method state
 
     Return:
         The program in a Python class which mimics the flatbuffer schema
@@ -156,6 +160,7 @@ def emit_program(
             operator_cache={},
             delegate_cache={},
             emit_stacktrace=emit_stacktrace,
+            emit_mutable_buffer_state=emit_mutable_buffer_state,
         )
 
         gm = _remove_non_user_outputs(exported_program)
@@ -62,6 +62,7 @@ from executorch.exir.schema import (
     DoubleList,
     EValue,
     ExecutionPlan,
+    ExtraTensorInfo,
     FreeCall,
     Instruction,
     Int,
@@ -73,6 +74,7 @@ from executorch.exir.schema import (
     Operator,
     OptionalTensorList,
     ScalarType,
+    ShapeSpecializedMemoryPlan,
     String,
     Tensor,
     TensorList,
@@ -135,6 +137,7 @@ class _EmitterState:
     operator_cache: Dict[Tuple[str, str], int]
     delegate_cache: Dict[bytes, int]
     emit_stacktrace: bool
+    emit_mutable_buffer_state: bool = False
 
     spec2id_dict: Dict[TensorSpec, int] = field(default_factory=dict)
 
@@ -328,8 +331,14 @@ class _Emitter(torch.fx.Interpreter):
             ExportErrorType.NOT_SUPPORTED, f"Unknown list type: {val_type}"
         )
 
-    def _tensor_spec_to_evalue(self, spec: TensorSpec) -> EValue:
-        """Constructs an EValue from the given TensorSpec."""
+    def _tensor_spec_to_evalue(
+        self, spec: TensorSpec, mutable_buffer_fqn: Optional[str] = None
+    ) -> EValue:
+        """Constructs an EValue from the given TensorSpec.
+
+        If mutable_buffer_fqn is set, the tensor is the mutable buffer of that
+        name, and its storage is serialized as its initial state.
+        """
 
         allocation_info = None
         buffer_idx = 0
@@ -365,9 +374,16 @@ class _Emitter(torch.fx.Interpreter):
                     )
                 )
 
-        if spec.const:
+        if mutable_buffer_fqn is not None:
+            self._internal_assert_emitter(
+                allocation_info is not None and spec.storage is not None,
+                self.node,
+                f"Mutable buffer {mutable_buffer_fqn} needs to be memory planned and have storage to emit its state",
+            )
+
+        if spec.const or mutable_buffer_fqn is not None:
             # Tensor with a blob we need to serialize. May not actually be constant at runtime
-            # if it's a weight with an associated gradient
+            # if it's a weight with an associated gradient, or a mutable buffer
             spec_array_type = (
                 ctypes.c_char * typing.cast(torch.UntypedStorage, spec.storage).nbytes()
             )
@@ -419,7 +435,12 @@ class _Emitter(torch.fx.Interpreter):
                 )
 
         # For constant tensors, allocation_info = None.
-        return EValue(make_tensor_value(buffer_idx, allocation_info, spec))
+        tensor = make_tensor_value(buffer_idx, allocation_info, spec)
+        if mutable_buffer_fqn is not None:
+            tensor.extra_tensor_info = ExtraTensorInfo(
+                fully_qualified_name=mutable_buffer_fqn
+            )
+        return EValue(tensor)
 
     def _get_list_tuple_jit_type(
         self, val: Union[Tuple[_Argument], List[_Argument]]
@@ -1473,6 +1494,8 @@ class _TopLevelEmitter(_Emitter):
         self.exported_program = exported_program
 
         self.inputs: List[int] = []
+        # The spec of each input in `inputs`, if it is a tensor.
+        self.input_specs: List[Optional[TensorSpec]] = []
         self.outputs: List[int] = []
         self.given_mutable_buffer_warning = False
 
@@ -1508,7 +1531,10 @@ class _TopLevelEmitter(_Emitter):
             # if the buffer is mutated then record that
             if fqn in self.exported_program.graph_signature.buffers_to_mutate.values():
                 is_mutable_buffer = True
-                if not self.given_mutable_buffer_warning:
+                if (
+                    not self.given_mutable_buffer_warning
+                    and not self.emitter_state.emit_mutable_buffer_state
+                ):
                     warnings.warn(
                         "Mutation on a buffer in the model is detected. ExecuTorch assumes "
                         "buffers that are mutated in the graph have a meaningless initial state, "
@@ -1539,9 +1565,12 @@ class _TopLevelEmitter(_Emitter):
         """
         spec = self.node.meta["spec"]
         is_user_input = True
+        mutable_buffer_fqn = None
 
         if isinstance(target, str) and isinstance(spec, TensorSpec):
             fqn, is_mutable_buffer = self._find_fqn_for_placeholder(target, spec)
+            if is_mutable_buffer and self.emitter_state.emit_mutable_buffer_state:
+                mutable_buffer_fqn = fqn
 
             # From the fqn find the corresponding tensor
             real_tensor = None
@@ -1580,7 +1609,7 @@ class _TopLevelEmitter(_Emitter):
             spec.const = not (is_user_input or is_mutable_buffer)
 
         evalue = (
-            self._tensor_spec_to_evalue(spec)
+            self._tensor_spec_to_evalue(spec, mutable_buffer_fqn)
             if isinstance(spec, TensorSpec)
             else self._constant_to_evalue(spec, None)
         )
@@ -1589,6 +1618,7 @@ class _TopLevelEmitter(_Emitter):
         # Only user inputs should remain as inputs.
         if is_user_input:
             self.inputs.append(value.id)
+            self.input_specs.append(spec if isinstance(spec, TensorSpec) else None)
 
         return value
 
@@ -1620,6 +1650,42 @@ class _TopLevelEmitter(_Emitter):
                     assert isinstance(arg, _AbstractValue)
                 self.outputs.append(arg.id)
 
+    def _emit_shape_specialized_memory_plans(
+        self,
+    ) -> Optional[List[ShapeSpecializedMemoryPlan]]:
+        """Converts the ShapeBucketPlans from memory planning, if any."""
+        bucket_plans = self.module.meta.get("shape_specialized_memory_plans")
+        if not bucket_plans:
+            return None
+        plans = []
+        for bucket_plan in bucket_plans:
+            input_max_sizes = []
+            for spec in self.input_specs:
+                if spec is not None:
+                    input_max_sizes.extend(
+                        bucket_plan.input_max_sizes.get(spec, spec.shape)
+                    )
+            value_indices = []
+            allocations = []
+            allocation_nbytes = []
+            for spec, (mem_id, mem_offset, nbytes) in bucket_plan.allocations.items():
+                # Specs of tensors that were optimized away were never emitted.
+                if spec not in self.emitter_state.spec2id_dict:
+                    continue
+                value_indices.append(self.emitter_state.spec2id(spec))
+                allocations.append(make_allocation_info(mem_id, mem_offset))
+                allocation_nbytes.append(nbytes)
+            plans.append(
+                ShapeSpecializedMemoryPlan(
+                    input_max_sizes=input_max_sizes,
+                    non_const_buffer_sizes=bucket_plan.bufsizes,
+                    value_indices=value_indices,
+                    allocations=allocations,
+                    allocation_nbytes=allocation_nbytes,
+                )
+            )
+        return plans
+
     def plan(self) -> ExecutionPlan:
         """Returns the execution plan emitted from this entry point."""
         return ExecutionPlan(
@@ -1639,4 +1705,5 @@ class _TopLevelEmitter(_Emitter):
                 self.module.meta["non_const_buffer_sizes"],
             ),
             container_meta_type=self.container_meta_type,
+            shape_specialized_memory_plans=self._emit_shape_specialized_memory_plans(),
         )
@@ -1620,6 +1620,44 @@ class TestEmit(unittest.TestCase):
         self.assertEqual(executorch_module(torch.zeros(1))[0], torch.zeros(1))
         self.assertEqual(executorch_module(torch.zeros(1))[0], torch.zeros(1) + 1)
 
+    def test_mutable_buffer_state(self) -> None:
+        class MutableStateModule(torch.nn.Module):
+            def __init__(self):
+                super().__init__()
+                self.register_buffer("state", torch.full((2,), 3.0))
+
+            def forward(self, x):
+                y = x + self.state
+                self.state.add_(1)
+                return y
+
+        model = to_edge(
+            export(
+                MutableStateModule(),
+                (torch.zeros(2),),
+            )
+        ).to_executorch(ExecutorchBackendConfig(emit_mutable_buffer_state=True))
+        program = model.executorch_program
+        state = program.execution_plan[0].values[0].val
+        self.assertIsNotNone(state.allocation_info)
+        # The initial value goes in the mutable data, and the name with it.
+        self.assertGreater(state.data_buffer_idx, 0)
+        self.assertEqual(state.extra_tensor_info.fully_qualified_name, "state")
+        mutable_data = model._emitter_output.mutable_data
+        self.assertEqual(
+            mutable_data[state.data_buffer_idx].storage,
+            torch.full((2,), 3.0).numpy().tobytes(),
+        )
+
+        # The runtime loads the initial value instead of leaving it undefined.
+        executorch_module = _load_for_executorch_from_buffer(model.buffer)
+        self.assertTrue(
+            torch.allclose(executorch_module(torch.zeros(2))[0], torch.full((2,), 3.0))
+        )
+        self.assertTrue(
+            torch.allclose(executorch_module(torch.zeros(2))[0], torch.full((2,), 4.0))
+        )
+
     def test_infinity_in_model(self) -> None:
         class InfinityMaskModel(nn.Module):
             def __init__(self):
@@ -12,8 +12,21 @@ import operator
 import typing
 from collections import defaultdict
 from dataclasses import dataclass
-from typing import Any, Callable, Dict, Iterable, List, Optional, Set, Tuple, Union
-
+from typing import (
+    Any,
+    Callable,
+    Dict,
+    Iterable,
+    List,
+    Mapping,
+    Optional,
+    Sequence,
+    Set,
+    Tuple,
+    Union,
+)
+
+import sympy
 import torch
 from executorch.exir import memory
 from executorch.exir.control_flow import while_loop as exir_while
@@ -27,6 +40,7 @@ from torch import fx
 from torch.export.exported_program import ExportGraphSignature
 from torch.fx import Node
 from torch.utils._pytree import tree_flatten
+from torch.utils._sympy.value_ranges import bound_sympy, ValueRanges
 
 REGISTERED_ALGOS: Dict[str, Callable[..., List[int]]] = {}
 
@@ -557,6 +571,7 @@ def greedy(
     # Don't do assertion in collect_specs_from_nodes if we have already encountered
     # and ignored some to_out_variant errors.
     do_assertion = not getattr(graph_module, "encounter_to_out_var_failure", False)
+    preplanned_specs = getattr(graph_module, "preplanned_specs", set())
     # For each tensor, pick the available shared object with closest size to
     # the tensor. If there are no available shared object left, create a new
     # one.
@@ -567,6 +582,8 @@ def greedy(
         ignore_graph_input=not alloc_graph_input,
         ignore_graph_output=not alloc_graph_output,
     ):
+        if spec in preplanned_specs:
+            continue
         if spec.mem_id is None:
             spec.mem_id = 1
         spec.realign(alignment)
@@ -623,12 +640,15 @@ def naive(
         bufsizes = [0, 0]
 
     bufsizes = typing.cast(List[int], bufsizes)
+    preplanned_specs = getattr(graph_module, "preplanned_specs", set())
     for spec in collect_specs_from_nodes(
         graph_module.graph.nodes,
         graph_signature,
         ignore_graph_input=not alloc_graph_input,
         ignore_graph_output=not alloc_graph_output,
     ):
+        if spec in preplanned_specs:
+            continue
         # assume a single memory layer which has mem_id 1
         if spec.mem_id is None:
             spec.mem_id = 1
@@ -784,3 +804,270 @@ def apply_algo(
     graph_module.meta.update({"non_const_buffer_sizes": bufsizes})
 
     return bufsizes
+
+
+@dataclass
+class ShapeBucketPlan:
+    """
+    A memory plan for the graph when its inputs are no larger than a shape
+    bucket. Emitted as a schema.ShapeSpecializedMemoryPlan.
+    """
+
+    # Max shape of each user input, for inputs that are tensors.
+    input_max_sizes: Dict[TensorSpec, List[int]]
+    # Buffer sizes of the plan, indexed like the graph's non_const_buffer_sizes.
+    bufsizes: List[int]
+    # (mem_id, mem_offset, nbytes) of every tensor the plan places, which
+    # excludes the planned graph inputs and mutable buffers. Those keep their
+    # placement from the main plan, so their contents survive switching plans.
+    # nbytes is the size of the tensor at the bucket's largest sizes.
+    allocations: Dict[TensorSpec, Tuple[int, int, int]]
+
+
+def _get_user_input_specs(
+    graph_module: torch.fx.GraphModule,
+    graph_signature: Optional[ExportGraphSignature] = None,
+) -> Dict[str, TensorSpec]:
+    user_inputs = set(graph_signature.user_inputs) if graph_signature else None
+    specs = {}
+    for node in graph_module.graph.nodes:
+        if node.op != "placeholder":
+            continue
+        if user_inputs is not None and node.name not in user_inputs:
+            continue
+        spec = node.meta.get("spec")
+        if isinstance(spec, TensorSpec):
+            specs[node.name] = spec
+    return specs
+
+
+def _get_bucket_symbol_ranges(
+    graph_module: torch.fx.GraphModule,
+    input_specs: Dict[str, TensorSpec],
+    bucket: Mapping[str, Sequence[int]],
+) -> Dict[sympy.Symbol, ValueRanges]:  # pyre-ignore[24]
+    """
+    Returns the value ranges of the shape symbols, narrowed so that the inputs
+    named in `bucket` are no larger than the given sizes.
+    """
+    symbol_ranges = dict(graph_module.meta.get("symbol_ranges", {}))
+    for name, max_sizes in bucket.items():
+        if name not in input_specs:
+            raise RuntimeError(
+                f"Shape bucket {dict(bucket)} names {name}, which is not a tensor "
+                f"input of the graph. Tensor inputs: {list(input_specs.keys())}"
+            )
+        spec = input_specs[name]
+        if len(max_sizes) != len(spec.shape):
+            raise RuntimeError(
+                f"Shape bucket gives {len(max_sizes)} sizes for input {name} of "
+                f"rank {len(spec.shape)}"
+            )
+        symbolic_shape = spec.symbolic_shape or spec.shape
+        for dim, (upper, expr, max_size) in enumerate(
+            zip(spec.shape, symbolic_shape, max_sizes)
+        ):
+            if max_size >= upper:
+                continue
+            if not isinstance(expr, sympy.Symbol) or expr not in symbol_ranges:
+                raise RuntimeError(
+                    f"Dimension {dim} of input {name} is {expr}, which is not a "
+                    f"dynamic dimension of its own, so a shape bucket cannot bound "
+                    f"it to {max_size}"
+                )
+            old_range = symbol_ranges[expr]
+            if max_size < old_range.lower:
+                raise RuntimeError(
+                    f"Shape bucket bounds dimension {dim} of input {name} to "
+                    f"{max_size}, below its lower bound {old_range.lower}"
+                )
+            symbol_ranges[expr] = ValueRanges(
+                old_range.lower, min(old_range.upper, max_size)
+            )
+    return symbol_ranges
+
+
+def _get_bucket_shape(
+    spec: TensorSpec,
+    symbol_ranges: Dict[sympy.Symbol, ValueRanges],  # pyre-ignore[24]
+) -> List[int]:
+    if spec.symbolic_shape is None:
+        return list(spec.shape)
+    return [
+        min(upper, int(bound_sympy(expr, symbol_ranges).upper))
+        for upper, expr in zip(spec.shape, spec.symbolic_shape)
+    ]
+
+
+def _cover_bufsizes(bufsizes: List[int], min_bufsizes: List[int]) -> List[int]:
+    """
+    Returns bufsizes grown where needed to be no smaller than min_bufsizes.
+    """
+    padded = bufsizes + [0] * (len(min_bufsizes) - len(bufsizes))
+    return [
+        max(size, min_bufsizes[mem_id]) if mem_id < len(min_bufsizes) else size
+        for mem_id, size in enumerate(padded)
+    ]
+
+
+def apply_algo_with_shape_buckets(
+    algo: Callable[
+        [torch.fx.GraphModule, int, Optional[ExportGraphSignature], bool, bool],
+        List[int],
+    ],
+    graph_module: torch.fx.GraphModule,
+    alignment: int,
+    shape_buckets: Sequence[Mapping[str, Sequence[int]]],
+    graph_signature: Optional[ExportGraphSignature] = None,
+    alloc_graph_input: bool = True,
+    alloc_graph_output: bool = True,
+) -> List[int]:
+    """
+    Like apply_algo(), but also plans memory for each of `shape_buckets`. A
+    bucket maps names of user inputs to their largest sizes in the bucket; the
+    sizes of the other tensors follow from their symbolic shapes. The plans
+    are stored in graph_module.meta["shape_specialized_memory_plans"] as
+    ShapeBucketPlans, leaving out buckets that would not need less memory than
+    the main plan.
+
+    The planned graph inputs and mutable buffers are placed at the start of
+    each buffer, ahead of everything else, in the main plan and in all bucket
+    plans, so the runtime can switch plans without moving them.
+    """
+    if any(
+        True
+        for _ in itertools.chain(
+            get_cond_nodes(graph_module),
+            get_while_nodes(graph_module),
+            get_map_nodes(graph_module),
+        )
+    ):
+        raise RuntimeError(
+            "Shape-specialized memory plans are not supported for graphs with "
+            "control flow"
+        )
+
+    do_assertion = not getattr(graph_module, "encounter_to_out_var_failure", False)
+
+    def collect_planned_specs() -> List[TensorSpec]:
+        return list(
+            collect_specs_from_nodes(
+                graph_module.graph.nodes,
+                graph_signature,
+                do_assertion=do_assertion,
+                ignore_graph_input=not alloc_graph_input,
+                ignore_graph_output=not alloc_graph_output,
+            )
+        )
+
+    input_specs = get_input_specs(graph_module)
+    preplanned_specs = [spec for spec in collect_planned_specs() if spec in input_specs]
+    input_bufsizes = [0, 0]
+    for spec in preplanned_specs:
+        if spec.mem_id is None:
+            spec.mem_id = 1
+        if spec.mem_id >= len(input_bufsizes):
+            input_bufsizes.extend([0] * (spec.mem_id - len(input_bufsizes) + 1))
+        spec.realign(alignment)
+        spec.mem_offset = input_bufsizes[spec.mem_id]
+        input_bufsizes[spec.mem_id] += spec.allocated_memory
+    preplanned_offsets = {spec: spec.mem_offset for spec in preplanned_specs}
+
+    graph_module.preplanned_specs = set(preplanned_specs)
+    try:
+        graph_module.input_mem_buffer_sizes = list(input_bufsizes)
+        bufsizes = apply_algo(
+            algo,
+            graph_module,
+            alignment,
+            graph_signature,
+            alloc_graph_input,
+            alloc_graph_output,
+        )
+        # The algorithm only accounts for the inputs in the buffers it places
+        # other tensors in.
+        bufsizes = _cover_bufsizes(bufsizes, input_bufsizes)
+        for spec, offset in preplanned_offsets.items():
+            internal_assert(
+                spec.mem_offset == offset,
+                f"Memory planning algorithm moved preplanned input {spec.debug()}",
+            )
+
+        specs = [spec for spec in collect_planned_specs() if spec not in input_specs]
+        saved_fields = {
+            spec: (
+                spec.mem_id,
+                spec.mem_obj_id,
+                spec.mem_offset,
+                list(spec.lifetime),
+                list(spec.shape),
+            )
+            for spec in specs
+        }
+        user_input_specs = _get_user_input_specs(graph_module, graph_signature)
+        plans = []
+        for bucket in shape_buckets:
+            symbol_ranges = _get_bucket_symbol_ranges(
+                graph_module, user_input_specs, bucket
+            )
+            # apply_algo() inserted free calls, so the lifetimes need updating.
+            update_all_tensors_lifetime(graph_module, graph_signature)
+            for spec in specs:
+                spec.shape = _get_bucket_shape(spec, symbol_ranges)
+                spec.mem_obj_id = None
+                spec.mem_offset = None
+            graph_module.input_mem_buffer_sizes = list(input_bufsizes)
+            bucket_bufsizes = _cover_bufsizes(
+                algo(
+                    graph_module,
+                    alignment,
+                    graph_signature,
+                    alloc_graph_input,
+                    alloc_graph_output,
+                ),
+                input_bufsizes,
+            )
+            allocations = {
+                spec: (
+                    typing.cast(int, spec.mem_id),
+                    typing.cast(int, spec.mem_offset),
+                    spec.nbytes(),
+                )
+                for spec in specs
+            }
+            # Restore the main plan.
+            for spec, fields in saved_fields.items():
+                (
+                    spec.mem_id,
+                    spec.mem_obj_id,
+                    spec.mem_offset,
+                    spec.lifetime,
+                    spec.shape,
+                ) = fields
+
+            if _cover_bufsizes(bufsizes, bucket_bufsizes) != bufsizes or sum(
+                bucket_bufsizes[1:]
+            ) >= sum(bufsizes[1:]):
+                logging.info(
+                    f"Skipping memory plan for shape bucket {dict(bucket)}: it needs "
+                    f"buffers of {bucket_bufsizes}, the main plan needs {bufsizes}"
+                )
+                continue
+            plans.append(
+                ShapeBucketPlan(
+                    input_max_sizes={
+                        spec: _get_bucket_shape(spec, symbol_ranges)
+                        for spec in user_input_specs.values()
+                    },
+                    bufsizes=bucket_bufsizes,
+                    allocations=allocations,
+                )
+            )
+    finally:
+        del graph_module.preplanned_specs
+        del graph_module.input_mem_buffer_sizes
+
+    graph_module.meta.update(
+        {"non_const_buffer_sizes": bufsizes, "shape_specialized_memory_plans": plans}
+    )
+    return bufsizes
@@ -6,7 +6,7 @@
 
 import logging
 import warnings
-from typing import Callable, List, Optional
+from typing import Callable, List, Mapping, Optional, Sequence
 
 import torch
 from executorch.exir.error import internal_assert
@@ -14,6 +14,7 @@ from executorch.exir.memory import alloc
 from executorch.exir.memory_planning import (
     _is_out_var_node,
     apply_algo,
+    apply_algo_with_shape_buckets,
     get_node_tensor_specs,
     greedy,
     Verifier,
@@ -32,18 +33,28 @@ class MemoryPlanningPass(PassBase):
         alloc_graph_input: bool = True,
         alloc_graph_output: bool = True,
         alignment: int = ALIGNMENT,
+        shape_buckets: Optional[Sequence[Mapping[str, Sequence[int]]]] = None,
     ) -> None:
         r"""
         alloc_graph_input/alloc_graph_output will have 4 different combinations
         to control if the memory planning algorithm need allocate memory for
         the graph input/output. The default behavior is the algorithm will allocate
         memory for both graph input and output.
+
+        shape_buckets requests extra memory plans for dynamic-shaped graphs, one
+        per bucket, which the runtime picks from based on the shapes of the
+        inputs it executes with. Each bucket maps the names of user inputs to
+        their largest sizes in the bucket, e.g. [{"tokens": [1, 32]},
+        {"tokens": [1, 128]}]; inputs a bucket leaves out keep their upper
+        bounds. Only dimensions that are a shape symbol of their own can be
+        bounded.
         """
         self.memory_planning_algo = memory_planning_algo
         self.allow_lifetime_and_storage_overlap = allow_lifetime_and_storage_overlap
         self.alloc_graph_input = alloc_graph_input
         self.alloc_graph_output = alloc_graph_output
         self.alignment = alignment
+        self.shape_buckets = shape_buckets
 
     def _set_alloc_node_spec(self, graph_module: torch.fx.GraphModule) -> None:
         """
@@ -101,14 +112,25 @@ class MemoryPlanningPass(PassBase):
         # customized fields. Using the graph_module object to convey information across
         # passes/stages is quite natural and avoid yet another 'context' data structure
         # to do the job.
-        _ = apply_algo(
-            self.memory_planning_algo,
-            graph_module,
-            self.alignment,
-            graph_signature,
-            self.alloc_graph_input,
-            self.alloc_graph_output,
-        )
+        if self.shape_buckets:
+            _ = apply_algo_with_shape_buckets(
+                self.memory_planning_algo,
+                graph_module,
+                self.alignment,
+                self.shape_buckets,
+                graph_signature,
+                self.alloc_graph_input,
+                self.alloc_graph_output,
+            )
+        else:
+            _ = apply_algo(
+                self.memory_planning_algo,
+                graph_module,
+                self.alignment,
+                graph_signature,
+                self.alloc_graph_input,
+                self.alloc_graph_output,
+            )
 
         # TODO: make the verifier do the work recursively to handle
         # control flow
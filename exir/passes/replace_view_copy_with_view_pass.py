@@ -8,7 +8,7 @@
 
 import copy
 import logging
-from typing import Any, List, Tuple
+from typing import Any, List, Optional, Tuple
 
 import torch
 from executorch.exir import memory
@@ -86,6 +86,7 @@ class _ViewSpec(TensorSpec):
             "stride",
             "dim_order",
             "shape_dynamism",
+            "symbolic_shape",
             "nbytes",  # method
             "allocated_memory",  # property
             "is_dynamic_shape_tensor",  # property
@@ -150,6 +151,7 @@ class _ViewSpec(TensorSpec):
         self.shape_dynamism: TensorShapeDynamism = determine_tensor_dynanism(
             torch.Size(self.shape)
         )
+        self.symbolic_shape: Optional[List[Any]] = None
 
         # Check compatibility with base on creation
         if self.shape_dynamism != base.shape_dynamism:
@@ -260,11 +260,16 @@ class ConstraintBasedSymShapeEvalPass(PassBase):
     formula. We should convert those symbolic formula to concrete value for
     static/upperbound tensors so we can properly do memory planning for them.
 
+    The symbolic sizes are kept in TensorSpec.symbolic_shape, and the value
+    ranges of their symbols in graph_module.meta["symbol_ranges"], so that
+    memory planning can evaluate the sizes for smaller shape buckets.
+
     Not inherited from ExportPass since we simply need a way to iterate through
     every node's output. PassBase is easier for that purpose.
     """
 
     def call(self, graph_module: GraphModule):
+        symbol_ranges = {}
         for subgm in graph_module.modules():
             if not isinstance(subgm, GraphModule):
                 continue
@@ -284,6 +289,16 @@ class ConstraintBasedSymShapeEvalPass(PassBase):
                                 "Please use export's constrain_as_size() or constrain_as_value() apis and set a concrete upper bound to resolve this."
                             )
 
+                        if any(isinstance(s, torch.SymInt) for s in spec.shape):
+                            spec.symbolic_shape = [
+                                s.node.expr if isinstance(s, torch.SymInt) else s
+                                for s in spec.shape
+                            ]
+                            for s in spec.shape:
+                                if isinstance(s, torch.SymInt):
+                                    symbol_ranges.update(s.node.shape_env.var_to_range)
                         spec.shape = concrete_shape
                         spec.stride = concrete_stride  # pyre-ignore[8]: Attribute `stride` declared in class `TensorSpec` has type `Tuple[int]` but is used as type `List[int]`
+        if symbol_ranges:
+            graph_module.meta["symbol_ranges"] = symbol_ranges
         return PassResult(graph_module, True)
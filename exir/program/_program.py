@@ -1406,6 +1406,7 @@ class ExecutorchProgramManager:
             self._execution_programs,
             backend_config.emit_stacktrace,
             self._config_methods,
+            backend_config.emit_mutable_buffer_state,
         )
 
         # Serialize emitter output, ready to be written to a file.
@@ -1416,6 +1417,7 @@ class ExecutorchProgramManager:
             segment_alignment=backend_config.segment_alignment,
             constant_tensor_alignment=backend_config.constant_tensor_alignment,
             delegate_alignment=backend_config.delegate_alignment,
+            segment_compression=backend_config.segment_compression,
         )
         self._buffer: Optional[bytes] = None
 
@@ -43,6 +43,15 @@ class TensorShapeDynamism(IntEnum):
     DYNAMIC_UNBOUND = 2
 
 
+class TensorDataLocation(IntEnum):
+    """
+    Check program.fbs for explanations of this enum.
+    """
+
+    SEGMENT = 0
+    EXTERNAL = 1
+
+
 @dataclass
 class ExtraTensorInfo:
     """
@@ -51,6 +60,7 @@ class ExtraTensorInfo:
 
     mutable_data_segments_idx: Optional[int] = None
     fully_qualified_name: Optional[str] = None
+    location: TensorDataLocation = TensorDataLocation.SEGMENT
 
 
 @dataclass
@@ -255,6 +265,18 @@ class Operator:
     overload: str
 
 
+@dataclass
+class ShapeSpecializedMemoryPlan:
+    # Concatenated max sizes of the tensor inputs, in the order of
+    # ExecutionPlan.inputs.
+    input_max_sizes: List[int]
+    non_const_buffer_sizes: List[int]
+    value_indices: List[int]
+    allocations: List[AllocationDetails]
+    # Bytes each tensor takes at the plan's largest sizes.
+    allocation_nbytes: List[int]
+
+
 @dataclass
 class ExecutionPlan:
     name: str
@@ -270,12 +292,24 @@ class ExecutionPlan:
     # Runtime should use the len(constant_buffer) as the ground truch of
     # constant memory buffer size, and ignore non_const_buffer_sizes[0].
     non_const_buffer_sizes: List[int]
+    # Alternative memory plans for smaller inputs, see
+    # MemoryPlanningPass(shape_buckets=...).
+    shape_specialized_memory_plans: Optional[List[ShapeSpecializedMemoryPlan]] = None
+
+
+class SegmentCompression(IntEnum):
+    NONE = 0
+    LZ4 = 1
 
 
 @dataclass
 class DataSegment:
     offset: int
     size: int
+    compression: SegmentCompression = SegmentCompression.NONE
+    uncompressed_size: int = 0
+    chunk_size: int = 0
+    compressed_chunk_sizes: Optional[List[int]] = None
 
 
 @dataclass
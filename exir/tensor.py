@@ -13,7 +13,7 @@ import copy
 
 import math
 import typing
-from typing import Dict, List, Optional, Tuple, Union
+from typing import Any, Dict, List, Optional, Tuple, Union
 
 import executorch.exir.schema as schema
 import torch
@@ -146,6 +146,11 @@ class TensorSpec:
         self.is_sparse = is_sparse
         self.init_mem_planning_fields()
         self.shape_dynamism: TensorShapeDynamism = determine_tensor_dynanism(self.shape)
+        # For dynamic-shaped tensors, the sympy expressions (or ints) of the
+        # sizes, recorded by ConstraintBasedSymShapeEvalPass before it replaces
+        # `shape` with upper bounds. Lets memory planning re-evaluate the sizes
+        # under tighter bounds on the input symbols.
+        self.symbolic_shape: Optional[List[Any]] = None
 
     @property
     def allocated_memory(self) -> int:
@@ -47,7 +47,7 @@ from torch.ao.quantization.quantize_fx import (
     _convert_to_reference_decomposed_fx,
     prepare_fx,
 )
-from torch.export import export
+from torch.export import Dim, export
 from torch.export.exported_program import ExportGraphSignature
 from torch.fx import Graph, GraphModule, Node
 from torch.nn import functional as F
@@ -593,3 +593,60 @@ class TestMisc(unittest.TestCase):
             num_placeholders,
             5,
         )
+
+    def test_shape_specialized_memory_plans(self) -> None:
+        class DynamicModel(torch.nn.Module):
+            def forward(self, x: torch.Tensor) -> torch.Tensor:
+                y = x * 2
+                return torch.cat((y, y)) + 1
+
+        program = to_edge(
+            export(
+                DynamicModel(),
+                (torch.randn(4, 8),),
+                dynamic_shapes=({0: Dim("dim0_x", max=64)},),
+            )
+        ).to_executorch(
+            config=ExecutorchBackendConfig(
+                memory_planning_pass=MemoryPlanningPass(
+                    shape_buckets=[{"x": [4, 8]}, {"x": [16, 8]}, {"x": [64, 8]}]
+                ),
+            )
+        )
+        graph_module = program.exported_program().graph_module
+        bufsizes = graph_module.meta["non_const_buffer_sizes"]
+        plans = graph_module.meta["shape_specialized_memory_plans"]
+
+        # The last bucket covers the upper bound, so it needs no plan of its own.
+        self.assertEqual(len(plans), 2)
+        self.assertLess(sum(plans[0].bufsizes), sum(plans[1].bufsizes))
+        self.assertLess(sum(plans[1].bufsizes), sum(bufsizes))
+
+        # The input is placed first, sized for the upper bound, and no plan
+        # moves it.
+        x_spec = next(
+            node.meta["spec"]
+            for node in graph_module.graph.nodes
+            if node.op == "placeholder"
+        )
+        self.assertEqual(x_spec.mem_offset, 0)
+        self.assertEqual(x_spec.shape, [64, 8])
+        for plan in plans:
+            self.assertNotIn(x_spec, plan.allocations)
+            for mem_id, mem_offset, nbytes in plan.allocations.values():
+                self.assertEqual(mem_id, 1)
+                self.assertGreaterEqual(mem_offset, x_spec.allocated_memory)
+                self.assertGreater(nbytes, 0)
+
+        execution_plan = program.executorch_program.execution_plan[0]
+        emitted_plans = execution_plan.shape_specialized_memory_plans
+        self.assertIsNotNone(emitted_plans)
+        self.assertEqual(
+            [plan.input_max_sizes for plan in emitted_plans], [[4, 8], [16, 8]]
+        )
+        self.assertEqual(
+            [plan.non_const_buffer_sizes for plan in emitted_plans],
+            [plan.bufsizes for plan in plans],
+        )
+        for plan in emitted_plans:
+            self.assertEqual(len(plan.allocation_nbytes), len(plan.allocations))
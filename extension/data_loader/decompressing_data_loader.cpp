@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/extension/data_loader/decompressing_data_loader.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <executorch/runtime/core/error.h>
+#include <executorch/runtime/platform/log.h>
+
+#ifdef ET_USE_THREADPOOL
+#include <executorch/extension/parallel/thread_parallel.h>
+#include <executorch/extension/threadpool/threadpool.h>
+#endif
+
+using executorch::runtime::DataLoader;
+using executorch::runtime::Error;
+using executorch::runtime::FreeableBuffer;
+using executorch::runtime::Result;
+
+namespace executorch {
+namespace extension {
+
+namespace {
+
+using Compression = DataLoader::SegmentInfo::Compression;
+
+// See https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+constexpr size_t kLZ4MinMatch = 4;
+
+/**
+ * Reads the extra bytes of an LZ4 literal or match length whose 4-bit token
+ * field is 15. Returns false if the input ends first.
+ */
+bool read_lz4_length(const uint8_t** ip, const uint8_t* end, size_t* length) {
+  uint8_t byte = 0;
+  do {
+    if (*ip >= end) {
+      return false;
+    }
+    byte = *(*ip)++;
+    *length += byte;
+  } while (byte == 255);
+  return true;
+}
+
+/**
+ * Decompresses an LZ4 block into exactly `dst_size` bytes. Returns false if
+ * the block is malformed or does not decompress to that size.
+ */
+bool lz4_decompress_block(
+    const uint8_t* src,
+    size_t src_size,
+    uint8_t* dst,
+    size_t dst_size) {
+  const uint8_t* ip = src;
+  const uint8_t* const src_end = src + src_size;
+  uint8_t* op = dst;
+  uint8_t* const dst_end = dst + dst_size;
+  while (ip < src_end) {
+    const uint8_t token = *ip++;
+
+    size_t literal_length = token >> 4;
+    if (literal_length == 15 &&
+        !read_lz4_length(&ip, src_end, &literal_length)) {
+      return false;
+    }
+    if (literal_length > static_cast<size_t>(src_end - ip) ||
+        literal_length > static_cast<size_t>(dst_end - op)) {
+      return false;
+    }
+    std::memcpy(op, ip, literal_length);
+    ip += literal_length;
+    op += literal_length;
+    if (ip == src_end) {
+      // The last sequence only has literals.
+      break;
+    }
+
+    if (src_end - ip < 2) {
+      return false;
+    }
+    const size_t offset = ip[0] | (static_cast<size_t>(ip[1]) << 8);
+    ip += 2;
+    if (offset == 0 || offset > static_cast<size_t>(op - dst)) {
+      return false;
+    }
+    size_t match_length = token & 15;
+    if (match_length == 15 && !read_lz4_length(&ip, src_end, &match_length)) {
+      return false;
+    }
+    match_length += kLZ4MinMatch;
+    if (match_length > static_cast<size_t>(dst_end - op)) {
+      return false;
+    }
+    // The match may overlap the bytes it produces, repeating the last
+    // `offset` bytes. Copy in pieces that never overlap; each piece doubles
+    // the distance to the source, so long runs take few copies.
+    const uint8_t* const match = op - offset;
+    uint8_t* const match_end = op + match_length;
+    while (op < match_end) {
+      const size_t n = std::min<size_t>(op - match, match_end - op);
+      std::memcpy(op, match, n);
+      op += n;
+    }
+  }
+  return op == dst_end;
+}
+
+/**
+ * FreeableBuffer::FreeFn-compatible callback.
+ *
+ * `context` is actually a ptrdiff_t value (not a pointer) that contains the
+ * offset in bytes between `data` and the actual pointer to free.
+ */
+void FreeSegment(void* context, void* data, ET_UNUSED size_t size) {
+  ptrdiff_t offset = reinterpret_cast<ptrdiff_t>(context);
+  ET_DCHECK_MSG(offset >= 0, "Unexpected offset %ld", (long int)offset);
+  std::free(static_cast<uint8_t*>(data) - offset);
+}
+
+static bool is_power_of_2(size_t value) {
+  return value > 0 && (value & ~(value - 1)) == value;
+}
+
+} // namespace
+
+Result<DecompressingDataLoader> DecompressingDataLoader::from(
+    const DataLoader* loader,
+    size_t num_threads,
+    size_t alignment) {
+  ET_CHECK_OR_RETURN_ERROR(
+      is_power_of_2(alignment),
+      InvalidArgument,
+      "Alignment %zu is not a power of 2",
+      alignment);
+  return DecompressingDataLoader(loader, num_threads, alignment);
+}
+
+Error DecompressingDataLoader::decompress_into(
+    size_t offset,
+    size_t size,
+    const SegmentInfo& segment_info,
+    void* buffer) const {
+  const Compression& compression = *segment_info.compression;
+  ET_CHECK_OR_RETURN_ERROR(
+      compression.codec == Compression::Codec::LZ4,
+      NotSupported,
+      "Segment %zu uses unknown compression %u",
+      segment_info.segment_index,
+      static_cast<unsigned int>(compression.codec));
+  const size_t chunk_size = compression.chunk_size;
+  const size_t num_chunks = compression.num_chunks;
+  ET_CHECK_OR_RETURN_ERROR(
+      chunk_size > 0 &&
+          num_chunks ==
+              (compression.uncompressed_size + chunk_size - 1) / chunk_size,
+      InvalidArgument,
+      "Segment %zu: %zu chunks of %zu bytes can't hold %zu bytes",
+      segment_info.segment_index,
+      num_chunks,
+      chunk_size,
+      compression.uncompressed_size);
+
+  // Find where each chunk starts in the compressed data.
+  std::vector<size_t> chunk_offsets(num_chunks + 1);
+  for (size_t i = 0; i < num_chunks; ++i) {
+    chunk_offsets[i + 1] =
+        chunk_offsets[i] + compression.compressed_chunk_sizes[i];
+  }
+  ET_CHECK_OR_RETURN_ERROR(
+      chunk_offsets[num_chunks] == size,
+      InvalidArgument,
+      "Segment %zu: chunk sizes add up to %zu, not %zu",
+      segment_info.segment_index,
+      chunk_offsets[num_chunks],
+      size);
+
+  DataLoader::SegmentInfo compressed_info = segment_info;
+  compressed_info.compression = nullptr;
+  Result<FreeableBuffer> compressed =
+      loader_->load(offset, size, compressed_info);
+  if (!compressed.ok()) {
+    return compressed.error();
+  }
+  const uint8_t* src = static_cast<const uint8_t*>(compressed->data());
+  uint8_t* dst = static_cast<uint8_t*>(buffer);
+
+  // Hand out chunks to the workers one at a time, so that workers that get
+  // chunks which are cheap to decompress take on more of them.
+  std::atomic<size_t> next_chunk(0);
+  std::atomic<bool> failed(false);
+  auto decompress_chunks = [&]() {
+    for (size_t i = next_chunk++; i < num_chunks && !failed; i = next_chunk++) {
+      const size_t src_size = chunk_offsets[i + 1] - chunk_offsets[i];
+      const size_t dst_offset = i * chunk_size;
+      const size_t dst_size =
+          std::min(chunk_size, compression.uncompressed_size - dst_offset);
+      if (src_size == dst_size) {
+        // The chunk did not compress, so it is stored as-is.
+        std::memcpy(dst + dst_offset, src + chunk_offsets[i], dst_size);
+      } else if (!lz4_decompress_block(
+                     src + chunk_offsets[i],
+                     src_size,
+                     dst + dst_offset,
+                     dst_size)) {
+        failed = true;
+      }
+    }
+  };
+#ifdef ET_USE_THREADPOOL
+  size_t num_workers =
+      ::executorch::extension::threadpool::get_threadpool()->get_thread_count();
+  if (num_threads_ > 0) {
+    num_workers = std::min(num_workers, num_threads_);
+  }
+  num_workers = std::min(num_workers, num_chunks);
+  if (num_workers > 1) {
+    // One task per worker; each one pulls chunks until none are left.
+    ::executorch::extension::parallel_for(
+        0, num_workers, /*grain_size=*/1, [&](int64_t begin, int64_t end) {
+          for (int64_t i = begin; i < end; ++i) {
+            decompress_chunks();
+          }
+        });
+  } else {
+    decompress_chunks();
+  }
+#else
+  decompress_chunks();
+#endif
+  ET_CHECK_OR_RETURN_ERROR(
+      !failed,
+      InvalidProgram,
+      "Segment %zu: compressed data is corrupt",
+      segment_info.segment_index);
+  return Error::Ok;
+}
+
+Result<FreeableBuffer> DecompressingDataLoader::load(
+    size_t offset,
+    size_t size,
+    const DataLoader::SegmentInfo& segment_info) const {
+  if (segment_info.compression == nullptr) {
+    return loader_->load(offset, size, segment_info);
+  }
+  const size_t uncompressed_size = segment_info.compression->uncompressed_size;
+
+  // Don't bother allocating/freeing for empty segments.
+  if (uncompressed_size == 0) {
+    return FreeableBuffer(nullptr, 0, /*free_fn=*/nullptr);
+  }
+
+  // Allocate memory for the FreeableBuffer.
+  size_t alloc_size = uncompressed_size;
+  if (alignment_ > alignof(std::max_align_t)) {
+    // malloc() will align to smaller values, but we must manually align to
+    // larger values.
+    alloc_size += alignment_;
+  }
+  void* buffer = std::malloc(alloc_size);
+  if (buffer == nullptr) {
+    ET_LOG(
+        Error,
+        "Decompressing segment %zu: malloc(%zu) failed",
+        segment_info.segment_index,
+        alloc_size);
+    return Error::MemoryAllocationFailed;
+  }
+  const uintptr_t addr = reinterpret_cast<uintptr_t>(buffer);
+  void* aligned_buffer =
+      reinterpret_cast<void*>((addr + alignment_ - 1) & ~(alignment_ - 1));
+
+  Error err = decompress_into(offset, size, segment_info, aligned_buffer);
+  if (err != Error::Ok) {
+    // Free `buffer`, which is what malloc() gave us, not `aligned_buffer`.
+    std::free(buffer);
+    return err;
+  }
+
+  // Pass the offset to the real buffer as context, so that FreeSegment can
+  // find the pointer to free.
+  return FreeableBuffer(
+      aligned_buffer,
+      uncompressed_size,
+      FreeSegment,
+      /*free_fn_context=*/
+      reinterpret_cast<void*>(
+          reinterpret_cast<intptr_t>(aligned_buffer) -
+          reinterpret_cast<intptr_t>(buffer)));
+}
+
+Result<size_t> DecompressingDataLoader::size() const {
+  return loader_->size();
+}
+
+Error DecompressingDataLoader::load_into(
+    size_t offset,
+    size_t size,
+    const SegmentInfo& segment_info,
+    void* buffer) const {
+  if (segment_info.compression == nullptr) {
+    return loader_->load_into(offset, size, segment_info, buffer);
+  }
+  return decompress_into(offset, size, segment_info, buffer);
+}
+
+} // namespace extension
+} // namespace executorch
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <executorch/runtime/core/data_loader.h>
+#include <executorch/runtime/core/freeable_buffer.h>
+#include <executorch/runtime/core/result.h>
+#include <executorch/runtime/platform/compiler.h>
+
+namespace executorch {
+namespace extension {
+
+/**
+ * A DataLoader that decompresses compressed program segments as it loads
+ * them, and passes all other loads through to another DataLoader.
+ *
+ * Compressed segments are read in one piece from the wrapped loader and their
+ * chunks are decompressed into a buffer allocated with `malloc()`. When built
+ * with ET_USE_THREADPOOL, the chunks are split across the extension
+ * threadpool; otherwise they are decompressed on the calling thread.
+ * For a program that is larger than the page cache or stored on slow disks,
+ * reading less data can outweigh the decompression time; for a program that
+ * is already cached, an uncompressed program loaded with MmapDataLoader is
+ * faster.
+ */
+class DecompressingDataLoader final : public executorch::runtime::DataLoader {
+ public:
+  /**
+   * Creates a new DecompressingDataLoader that wraps another DataLoader.
+   *
+   * @param[in] loader The DataLoader to read the program from. Must outlive
+   *     the returned instance.
+   * @param[in] num_threads The maximum number of threadpool threads to
+   *     decompress with. Zero uses all of them.
+   * @param[in] alignment Alignment in bytes of decompressed segments. Must be
+   *     a power of two, and at least the tensor and delegate data alignment
+   *     that the program was serialized with.
+   *
+   * @returns A new DecompressingDataLoader on success.
+   * @retval Error::InvalidArgument `alignment` is not a power of two.
+   */
+  static executorch::runtime::Result<DecompressingDataLoader> from(
+      const executorch::runtime::DataLoader* loader,
+      size_t num_threads = 0,
+      size_t alignment = alignof(std::max_align_t));
+
+  DecompressingDataLoader(DecompressingDataLoader&&) noexcept = default;
+
+  ET_NODISCARD
+  executorch::runtime::Result<executorch::runtime::FreeableBuffer> load(
+      size_t offset,
+      size_t size,
+      const DataLoader::SegmentInfo& segment_info) const override;
+
+  ET_NODISCARD executorch::runtime::Result<size_t> size() const override;
+
+  ET_NODISCARD executorch::runtime::Error load_into(
+      size_t offset,
+      size_t size,
+      const SegmentInfo& segment_info,
+      void* buffer) const override;
+
+ private:
+  DecompressingDataLoader(
+      const executorch::runtime::DataLoader* loader,
+      size_t num_threads,
+      size_t alignment)
+      : loader_(loader), num_threads_(num_threads), alignment_(alignment) {}
+
+  /// Decompresses the `size` bytes at `offset` into `buffer`, which has room
+  /// for `segment_info.compression->uncompressed_size` bytes.
+  ET_NODISCARD executorch::runtime::Error decompress_into(
+      size_t offset,
+      size_t size,
+      const SegmentInfo& segment_info,
+      void* buffer) const;
+
+  // Not safely copyable.
+  DecompressingDataLoader(const DecompressingDataLoader&) = delete;
+  DecompressingDataLoader& operator=(const DecompressingDataLoader&) = delete;
+  DecompressingDataLoader& operator=(DecompressingDataLoader&&) = delete;
+
+  const executorch::runtime::DataLoader* loader_;
+  size_t num_threads_;
+  size_t alignment_;
+};
+
+} // namespace extension
+} // namespace executorch
@@ -1,5 +1,12 @@
 load("@fbsource//xplat/executorch/build:runtime_wrapper.bzl", "runtime")
 
+def data_loader_use_threadpool():
+    """Whether DecompressingDataLoader decompresses across the threadpool.
+
+    Off by default, like portable_use_threadpool() for the portable kernels.
+    """
+    return native.read_config("executorch", "data_loader_use_threadpool", "false") == "true"
+
 def define_common_targets():
     """Defines targets that should be shared between fbcode and xplat.
 
@@ -82,3 +89,23 @@ def define_common_targets():
             "//executorch/runtime/core:core",
         ],
     )
+
+    runtime.cxx_library(
+        name = "decompressing_data_loader",
+        srcs = ["decompressing_data_loader.cpp"],
+        exported_headers = ["decompressing_data_loader.h"],
+        visibility = [
+            "//executorch/test/...",
+            "//executorch/runtime/executor/test/...",
+            "//executorch/extension/data_loader/test/...",
+            "@EXECUTORCH_CLIENTS",
+        ],
+        exported_deps = [
+            "//executorch/runtime/core:core",
+        ],
+        # The threadpool target exports -DET_USE_THREADPOOL.
+        deps = [
+            "//executorch/extension/parallel:thread_parallel",
+            "//executorch/extension/threadpool:threadpool",
+        ] if data_loader_use_threadpool() else [],
+    )
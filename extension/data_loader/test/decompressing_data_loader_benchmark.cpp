@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+/**
+ * Compares the time to load every segment of a program serialized without
+ * compression, through MmapDataLoader, against the same program serialized
+ * with segment_compression, through DecompressingDataLoader. Mapped pages are
+ * touched so that both sides pay for reading the data. Each side is timed
+ * with the file in the page cache ("warm") and after asking the kernel to
+ * drop it ("cold").
+ * Usage: decompressing_data_loader_benchmark <uncompressed.pte>
+ *     <compressed.pte> [iterations] [num_threads]
+ */
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <executorch/extension/data_loader/decompressing_data_loader.h>
+#include <executorch/extension/data_loader/file_data_loader.h>
+#include <executorch/extension/data_loader/mmap_data_loader.h>
+#include <executorch/runtime/platform/runtime.h>
+#include <executorch/schema/extended_header.h>
+#include <executorch/schema/program_generated.h>
+
+namespace {
+
+using executorch::extension::DecompressingDataLoader;
+using executorch::extension::FileDataLoader;
+using executorch::extension::MmapDataLoader;
+using executorch::runtime::DataLoader;
+using executorch::runtime::Error;
+using executorch::runtime::ExtendedHeader;
+using executorch::runtime::FreeableBuffer;
+using executorch::runtime::Result;
+using Compression = DataLoader::SegmentInfo::Compression;
+
+struct Segment {
+  size_t offset;
+  size_t size;
+  Compression compression;
+  bool compressed;
+  std::vector<uint64_t> chunk_sizes;
+};
+
+/// Reads the segment table of the program at `path`.
+std::vector<Segment> read_segments(const char* path) {
+  Result<FileDataLoader> loader = FileDataLoader::from(path);
+  ET_CHECK_MSG(loader.ok(), "Failed to open %s", path);
+  Result<FreeableBuffer> head = loader->load(
+      0,
+      ExtendedHeader::kNumHeadBytes,
+      DataLoader::SegmentInfo(DataLoader::SegmentInfo::Type::Program));
+  ET_CHECK_MSG(head.ok(), "Failed to read %s", path);
+  Result<ExtendedHeader> eh = ExtendedHeader::Parse(head->data(), head->size());
+  ET_CHECK_MSG(eh.ok(), "%s has no extended header", path);
+  Result<FreeableBuffer> program_data = loader->load(
+      0,
+      eh->program_size,
+      DataLoader::SegmentInfo(DataLoader::SegmentInfo::Type::Program));
+  ET_CHECK_MSG(program_data.ok(), "Failed to read %s", path);
+  const executorch_flatbuffer::Program* program =
+      executorch_flatbuffer::GetProgram(program_data->data());
+
+  std::vector<Segment> segments;
+  if (program->segments() == nullptr) {
+    return segments;
+  }
+  for (const executorch_flatbuffer::DataSegment* s : *program->segments()) {
+    Segment segment = {};
+    segment.offset = eh->segment_base_offset + s->offset();
+    segment.size = s->size();
+    segment.compressed =
+        s->compression() != executorch_flatbuffer::SegmentCompression::NONE;
+    if (segment.compressed) {
+      segment.chunk_sizes.assign(
+          s->compressed_chunk_sizes()->begin(),
+          s->compressed_chunk_sizes()->end());
+      segment.compression.codec = Compression::Codec::LZ4;
+      segment.compression.uncompressed_size = s->uncompressed_size();
+      segment.compression.chunk_size = s->chunk_size();
+      segment.compression.num_chunks = segment.chunk_sizes.size();
+    }
+    segments.push_back(std::move(segment));
+  }
+  // Point into the vectors only once they have stopped moving.
+  for (Segment& segment : segments) {
+    segment.compression.compressed_chunk_sizes = segment.chunk_sizes.data();
+  }
+  return segments;
+}
+
+/// Loads every segment and returns the number of bytes loaded.
+size_t load_segments(
+    const DataLoader& loader,
+    const std::vector<Segment>& segments) {
+  size_t total = 0;
+  volatile uint8_t sink = 0;
+  for (size_t i = 0; i < segments.size(); ++i) {
+    const Segment& segment = segments[i];
+    DataLoader::SegmentInfo info(DataLoader::SegmentInfo::Type::Backend, i);
+    if (segment.compressed) {
+      info.compression = &segment.compression;
+    }
+    Result<FreeableBuffer> data =
+        loader.load(segment.offset, segment.size, info);
+    ET_CHECK_MSG(data.ok(), "Failed to load segment %zu", i);
+    // Fault in mapped pages.
+    const uint8_t* bytes = static_cast<const uint8_t*>(data->data());
+    for (size_t j = 0; j < data->size(); j += 4096) {
+      sink = sink + bytes[j];
+    }
+    total += data->size();
+  }
+  return total;
+}
+
+/// Asks the kernel to drop the cached pages of `path`.
+void evict(const char* path) {
+  int fd = ::open(path, O_RDONLY);
+  ET_CHECK_MSG(fd >= 0, "Failed to open %s", path);
+  ::fdatasync(fd);
+  ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+  ::close(fd);
+}
+
+void time_it(
+    const char* name,
+    const char* path,
+    int iterations,
+    bool cold,
+    const DataLoader& loader,
+    const std::vector<Segment>& segments) {
+  size_t bytes = load_segments(loader, segments); // Warm up.
+  double seconds = 0;
+  for (int i = 0; i < iterations; ++i) {
+    if (cold) {
+      evict(path);
+    }
+    const auto start = std::chrono::steady_clock::now();
+    bytes = load_segments(loader, segments);
+    seconds += std::chrono::duration<double>(
+                   std::chrono::steady_clock::now() - start)
+                   .count();
+  }
+  seconds /= iterations;
+  printf(
+      "%-24s %-4s %10.3f ms %8.2f GB/s\n",
+      name,
+      cold ? "cold" : "warm",
+      seconds * 1e3,
+      bytes / seconds * 1e-9);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    fprintf(
+        stderr,
+        "Usage: %s <uncompressed.pte> <compressed.pte> [iterations] "
+        "[num_threads]\n",
+        argv[0]);
+    return 1;
+  }
+  executorch::runtime::runtime_init();
+  const char* uncompressed_path = argv[1];
+  const char* compressed_path = argv[2];
+  const int iterations = argc > 3 ? std::atoi(argv[3]) : 10;
+  const size_t num_threads = argc > 4 ? std::atoi(argv[4]) : 0;
+
+  const std::vector<Segment> uncompressed = read_segments(uncompressed_path);
+  const std::vector<Segment> compressed = read_segments(compressed_path);
+  size_t file_bytes = 0;
+  for (const Segment& segment : uncompressed) {
+    file_bytes += segment.size;
+  }
+  size_t compressed_bytes = 0;
+  for (const Segment& segment : compressed) {
+    compressed_bytes += segment.size;
+  }
+  printf(
+      "%zu segments, %zu bytes uncompressed, %zu bytes compressed\n",
+      uncompressed.size(),
+      file_bytes,
+      compressed_bytes);
+
+  Result<MmapDataLoader> mmap_loader = MmapDataLoader::from(
+      uncompressed_path, MmapDataLoader::MlockConfig::NoMlock);
+  ET_CHECK_MSG(mmap_loader.ok(), "Failed to map %s", uncompressed_path);
+  Result<FileDataLoader> file_loader = FileDataLoader::from(compressed_path);
+  ET_CHECK_MSG(file_loader.ok(), "Failed to open %s", compressed_path);
+  Result<DecompressingDataLoader> decompressing_loader =
+      DecompressingDataLoader::from(&file_loader.get(), num_threads);
+  ET_CHECK(decompressing_loader.ok());
+
+  for (bool cold : {false, true}) {
+    time_it(
+        "MmapDataLoader",
+        uncompressed_path,
+        iterations,
+        cold,
+        mmap_loader.get(),
+        uncompressed);
+    time_it(
+        "DecompressingDataLoader",
+        compressed_path,
+        iterations,
+        cold,
+        decompressing_loader.get(),
+        compressed);
+  }
+  return 0;
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/extension/data_loader/decompressing_data_loader.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <executorch/extension/data_loader/buffer_data_loader.h>
+#include <executorch/runtime/core/result.h>
+#include <executorch/runtime/platform/runtime.h>
+
+using namespace ::testing;
+using executorch::extension::BufferDataLoader;
+using executorch::extension::DecompressingDataLoader;
+using executorch::runtime::DataLoader;
+using executorch::runtime::Error;
+using executorch::runtime::FreeableBuffer;
+using executorch::runtime::Result;
+
+using Compression = DataLoader::SegmentInfo::Compression;
+
+namespace {
+
+// `"hello world " * 100 + "xyz"` compressed into an LZ4 block.
+const uint8_t kHelloBlock[] = {
+    0xcf, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64,
+    0x20, 0x0c, 0x00, 0xff, 0xff, 0xff, 0xff, 0x93, 0x50, 0x64, 0x20, 0x78,
+    0x79, 0x7a,
+};
+
+std::string hello_data() {
+  std::string data;
+  for (int i = 0; i < 100; ++i) {
+    data += "hello world ";
+  }
+  return data + "xyz";
+}
+
+/// Builds a segment whose chunks alternate between kHelloBlock and raw bytes,
+/// followed by a short raw chunk.
+class SegmentBuilder {
+ public:
+  explicit SegmentBuilder(size_t num_full_chunks) {
+    const std::string hello = hello_data();
+    for (size_t i = 0; i < num_full_chunks; ++i) {
+      if (i % 2 == 0) {
+        append(kHelloBlock, sizeof(kHelloBlock));
+        uncompressed_ += hello;
+      } else {
+        std::string raw(hello.size(), '\0');
+        for (size_t j = 0; j < raw.size(); ++j) {
+          raw[j] = static_cast<char>((i * 31 + j * 7) & 0xff);
+        }
+        append(raw.data(), raw.size());
+        uncompressed_ += raw;
+      }
+    }
+    const char tail[] = "tail";
+    append(tail, sizeof(tail) - 1);
+    uncompressed_ += "tail";
+
+    compression_.codec = Compression::Codec::LZ4;
+    compression_.uncompressed_size = uncompressed_.size();
+    compression_.chunk_size = hello.size();
+    compression_.compressed_chunk_sizes = chunk_sizes_.data();
+    compression_.num_chunks = chunk_sizes_.size();
+  }
+
+  DataLoader::SegmentInfo segment_info() const {
+    DataLoader::SegmentInfo info(
+        DataLoader::SegmentInfo::Type::Constant, /*segment_index=*/0);
+    info.compression = &compression_;
+    return info;
+  }
+
+  std::vector<uint8_t> compressed_;
+  std::string uncompressed_;
+  std::vector<uint64_t> chunk_sizes_;
+  Compression compression_;
+
+ private:
+  void append(const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    compressed_.insert(compressed_.end(), bytes, bytes + size);
+    chunk_sizes_.push_back(size);
+  }
+};
+
+} // namespace
+
+class DecompressingDataLoaderTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Since these tests cause ET_LOG to be called, the PAL must be initialized
+    // first.
+    executorch::runtime::runtime_init();
+  }
+};
+
+TEST_F(DecompressingDataLoaderTest, UncompressedLoadsPassThrough) {
+  uint8_t data[256];
+  for (int i = 0; i < sizeof(data); ++i) {
+    data[i] = i;
+  }
+  BufferDataLoader bdl(data, sizeof(data));
+  Result<DecompressingDataLoader> loader = DecompressingDataLoader::from(&bdl);
+  ASSERT_EQ(loader.error(), Error::Ok);
+
+  Result<size_t> size = loader->size();
+  ASSERT_EQ(size.error(), Error::Ok);
+  EXPECT_EQ(*size, sizeof(data));
+
+  Result<FreeableBuffer> fb = loader->load(
+      /*offset=*/16,
+      /*size=*/8,
+      DataLoader::SegmentInfo(DataLoader::SegmentInfo::Type::Program));
+  ASSERT_EQ(fb.error(), Error::Ok);
+  EXPECT_EQ(fb->size(), 8);
+  EXPECT_EQ(0, std::memcmp(fb->data(), &data[16], 8));
+}
+
+TEST_F(DecompressingDataLoaderTest, DecompressesChunks) {
+  for (size_t num_threads : {1, 3, 8}) {
+    SegmentBuilder segment(/*num_full_chunks=*/5);
+    BufferDataLoader bdl(
+        segment.compressed_.data(), segment.compressed_.size());
+    Result<DecompressingDataLoader> loader = DecompressingDataLoader::from(
+        &bdl, num_threads, /*alignment=*/256);
+    ASSERT_EQ(loader.error(), Error::Ok);
+
+    Result<FreeableBuffer> fb = loader->load(
+        /*offset=*/0, segment.compressed_.size(), segment.segment_info());
+    ASSERT_EQ(fb.error(), Error::Ok);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(fb->data()) % 256, 0);
+    ASSERT_EQ(fb->size(), segment.uncompressed_.size());
+    EXPECT_EQ(
+        0, std::memcmp(fb->data(), segment.uncompressed_.data(), fb->size()));
+  }
+}
+
+TEST_F(DecompressingDataLoaderTest, LoadIntoDecompresses) {
+  SegmentBuilder segment(/*num_full_chunks=*/3);
+  BufferDataLoader bdl(segment.compressed_.data(), segment.compressed_.size());
+  Result<DecompressingDataLoader> loader =
+      DecompressingDataLoader::from(&bdl, /*num_threads=*/2);
+  ASSERT_EQ(loader.error(), Error::Ok);
+
+  std::vector<uint8_t> buffer(segment.uncompressed_.size());
+  Error err = loader->load_into(
+      /*offset=*/0,
+      segment.compressed_.size(),
+      segment.segment_info(),
+      buffer.data());
+  ASSERT_EQ(err, Error::Ok);
+  EXPECT_EQ(
+      0,
+      std::memcmp(buffer.data(), segment.uncompressed_.data(), buffer.size()));
+}
+
+TEST_F(DecompressingDataLoaderTest, CorruptDataFails) {
+  SegmentBuilder segment(/*num_full_chunks=*/1);
+  // Point the first match before the start of the output.
+  segment.compressed_[13] = 0x40;
+  BufferDataLoader bdl(segment.compressed_.data(), segment.compressed_.size());
+  Result<DecompressingDataLoader> loader = DecompressingDataLoader::from(&bdl);
+  ASSERT_EQ(loader.error(), Error::Ok);
+
+  Result<FreeableBuffer> fb = loader->load(
+      /*offset=*/0, segment.compressed_.size(), segment.segment_info());
+  EXPECT_EQ(fb.error(), Error::InvalidProgram);
+}
+
+TEST_F(DecompressingDataLoaderTest, MismatchedChunkSizesFail) {
+  SegmentBuilder segment(/*num_full_chunks=*/2);
+  BufferDataLoader bdl(segment.compressed_.data(), segment.compressed_.size());
+  Result<DecompressingDataLoader> loader = DecompressingDataLoader::from(&bdl);
+  ASSERT_EQ(loader.error(), Error::Ok);
+
+  // The chunk sizes no longer add up to the segment size.
+  Result<FreeableBuffer> fb = loader->load(
+      /*offset=*/0, segment.compressed_.size() - 1, segment.segment_info());
+  EXPECT_EQ(fb.error(), Error::InvalidArgument);
+
+  // Too few chunks for the uncompressed size.
+  segment.compression_.num_chunks -= 1;
+  Result<FreeableBuffer> fb2 = loader->load(
+      /*offset=*/0, segment.compressed_.size(), segment.segment_info());
+  EXPECT_EQ(fb2.error(), Error::InvalidArgument);
+}
+
+TEST_F(DecompressingDataLoaderTest, BadAlignmentFails) {
+  uint8_t data[16] = {};
+  BufferDataLoader bdl(data, sizeof(data));
+  Result<DecompressingDataLoader> loader =
+      DecompressingDataLoader::from(&bdl, /*num_threads=*/1, /*alignment=*/3);
+  EXPECT_EQ(loader.error(), Error::InvalidArgument);
+}
@@ -59,3 +59,29 @@ def define_common_targets():
             "//executorch/extension/data_loader:mmap_data_loader",
         ],
     )
+
+    runtime.cxx_test(
+        name = "decompressing_data_loader_test",
+        srcs = [
+            "decompressing_data_loader_test.cpp",
+        ],
+        deps = [
+            "//executorch/extension/data_loader:buffer_data_loader",
+            "//executorch/extension/data_loader:decompressing_data_loader",
+        ],
+    )
+
+    runtime.cxx_binary(
+        name = "decompressing_data_loader_benchmark",
+        srcs = [
+            "decompressing_data_loader_benchmark.cpp",
+        ],
+        deps = [
+            "//executorch/extension/data_loader:decompressing_data_loader",
+            "//executorch/extension/data_loader:file_data_loader",
+            "//executorch/extension/data_loader:mmap_data_loader",
+            "//executorch/runtime/platform:platform",
+            "//executorch/schema:extended_header",
+            "//executorch/schema:program",
+        ],
+    )
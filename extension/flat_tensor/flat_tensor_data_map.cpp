@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/extension/flat_tensor/flat_tensor_data_map.h>
+
+#include <cinttypes>
+#include <cstring>
+#include <utility>
+
+#include <executorch/extension/flat_tensor/flat_tensor_generated.h>
+#include <executorch/runtime/core/span.h>
+#include <executorch/runtime/platform/log.h>
+
+using executorch::runtime::DataLoader;
+using executorch::runtime::Error;
+using executorch::runtime::FreeableBuffer;
+using executorch::runtime::Result;
+using executorch::runtime::Span;
+using executorch::runtime::TensorLayout;
+
+namespace executorch {
+namespace extension {
+
+namespace {
+
+DataLoader::SegmentInfo external_segment_info(
+    const flat_tensor::TensorMetadata* tensor) {
+  return DataLoader::SegmentInfo(
+      DataLoader::SegmentInfo::Type::External,
+      tensor->segment_index(),
+      tensor->fully_qualified_name()->c_str());
+}
+
+Result<TensorLayout> create_layout(const flat_tensor::TensorMetadata* tensor) {
+  const auto* sizes = tensor->dim_sizes();
+  const auto* dim_order = tensor->dim_order();
+  return TensorLayout::create(
+      Span<const int32_t>(sizes->data(), sizes->size()),
+      Span<const uint8_t>(dim_order->data(), dim_order->size()),
+      static_cast<executorch::aten::ScalarType>(tensor->scalar_type()));
+}
+
+} // namespace
+
+/* static */ Result<FlatTensorDataMap> FlatTensorDataMap::load(
+    DataLoader* loader) {
+  Result<FreeableBuffer> head = loader->load(
+      /*offset=*/0,
+      FlatTensorHeader::kNumHeadBytes,
+      DataLoader::SegmentInfo(DataLoader::SegmentInfo::Type::External));
+  if (!head.ok()) {
+    return head.error();
+  }
+  Result<FlatTensorHeader> header =
+      FlatTensorHeader::Parse(head->data(), head->size());
+  if (!header.ok()) {
+    ET_LOG(
+        Error,
+        "Failed to parse FlatTensor header: 0x%" PRIx32,
+        static_cast<uint32_t>(header.error()));
+    return Error::InvalidExternalData;
+  }
+  // Done with the head.
+  head->Free();
+
+  Result<FreeableBuffer> flat_tensor_data = loader->load(
+      header->flatbuffer_offset,
+      header->flatbuffer_size,
+      DataLoader::SegmentInfo(DataLoader::SegmentInfo::Type::External));
+  if (!flat_tensor_data.ok()) {
+    return flat_tensor_data.error();
+  }
+
+  // The flatbuffer comes from outside of the program, so check all of it
+  // before trusting any offsets in it. It only holds metadata, so this is
+  // cheap next to loading the tensors.
+  ET_CHECK_OR_RETURN_ERROR(
+      flat_tensor::FlatTensorBufferHasIdentifier(flat_tensor_data->data()),
+      InvalidExternalData,
+      "FlatTensor identifier '%.4s' != expected '%s'",
+      flatbuffers::GetBufferIdentifier(flat_tensor_data->data()),
+      flat_tensor::FlatTensorIdentifier());
+  flatbuffers::Verifier verifier(
+      reinterpret_cast<const uint8_t*>(flat_tensor_data->data()),
+      flat_tensor_data->size());
+  ET_CHECK_OR_RETURN_ERROR(
+      flat_tensor::VerifyFlatTensorBuffer(verifier),
+      InvalidExternalData,
+      "FlatTensor verification failed");
+  const flat_tensor::FlatTensor* flat_tensor =
+      flat_tensor::GetFlatTensor(flat_tensor_data->data());
+  ET_CHECK_OR_RETURN_ERROR(
+      flat_tensor->tensors() != nullptr && flat_tensor->segments() != nullptr,
+      InvalidExternalData,
+      "FlatTensor is missing tensors or segments");
+  for (const flat_tensor::TensorMetadata* tensor : *flat_tensor->tensors()) {
+    ET_CHECK_OR_RETURN_ERROR(
+        tensor->fully_qualified_name() != nullptr &&
+            tensor->dim_sizes() != nullptr && tensor->dim_order() != nullptr,
+        InvalidExternalData,
+        "FlatTensor has a tensor without a name, sizes or dim order");
+  }
+
+  return FlatTensorDataMap(
+      header.get(), std::move(flat_tensor_data.get()), flat_tensor, loader);
+}
+
+Result<const flat_tensor::TensorMetadata*> FlatTensorDataMap::find_tensor(
+    const char* key) const {
+  for (const flat_tensor::TensorMetadata* tensor : *flat_tensor_->tensors()) {
+    if (std::strcmp(tensor->fully_qualified_name()->c_str(), key) == 0) {
+      return tensor;
+    }
+  }
+  return Error::NotFound;
+}
+
+Error FlatTensorDataMap::get_data_range(
+    const flat_tensor::TensorMetadata* tensor,
+    size_t* offset,
+    size_t* size) const {
+  const char* key = tensor->fully_qualified_name()->c_str();
+  Result<TensorLayout> layout = create_layout(tensor);
+  if (!layout.ok()) {
+    return layout.error();
+  }
+  const auto* segments = flat_tensor_->segments();
+  ET_CHECK_OR_RETURN_ERROR(
+      tensor->segment_index() < segments->size(),
+      InvalidExternalData,
+      "Tensor %s: segment index %" PRIu32 " >= %" PRIu32,
+      key,
+      tensor->segment_index(),
+      segments->size());
+  const flat_tensor::DataSegment* segment =
+      segments->Get(tensor->segment_index());
+  ET_CHECK_OR_RETURN_ERROR(
+      tensor->offset() <= segment->size() &&
+          layout->nbytes() <= segment->size() - tensor->offset(),
+      InvalidExternalData,
+      "Tensor %s: %zu bytes at offset %" PRIu64
+      " overflow segment of %" PRIu64 " bytes",
+      key,
+      layout->nbytes(),
+      tensor->offset(),
+      segment->size());
+  *offset = header_.segment_base_offset + segment->offset() + tensor->offset();
+  *size = layout->nbytes();
+  return Error::Ok;
+}
+
+Result<TensorLayout> FlatTensorDataMap::get_metadata(const char* key) const {
+  Result<const flat_tensor::TensorMetadata*> tensor = find_tensor(key);
+  if (!tensor.ok()) {
+    return tensor.error();
+  }
+  return create_layout(tensor.get());
+}
+
+Result<FreeableBuffer> FlatTensorDataMap::get_data(const char* key) const {
+  Result<const flat_tensor::TensorMetadata*> tensor = find_tensor(key);
+  if (!tensor.ok()) {
+    return tensor.error();
+  }
+  size_t offset = 0;
+  size_t size = 0;
+  Error err = get_data_range(tensor.get(), &offset, &size);
+  if (err != Error::Ok) {
+    return err;
+  }
+  return loader_->load(offset, size, external_segment_info(tensor.get()));
+}
+
+Error FlatTensorDataMap::load_data_into(
+    const char* key,
+    void* buffer,
+    size_t size) const {
+  Result<const flat_tensor::TensorMetadata*> tensor = find_tensor(key);
+  if (!tensor.ok()) {
+    return tensor.error();
+  }
+  size_t offset = 0;
+  size_t nbytes = 0;
+  Error err = get_data_range(tensor.get(), &offset, &nbytes);
+  if (err != Error::Ok) {
+    return err;
+  }
+  ET_CHECK_OR_RETURN_ERROR(
+      size >= nbytes,
+      InvalidArgument,
+      "Buffer of %zu bytes is too small for the %zu bytes of %s",
+      size,
+      nbytes,
+      key);
+  return loader_->load_into(
+      offset, nbytes, external_segment_info(tensor.get()), buffer);
+}
+
+Result<size_t> FlatTensorDataMap::get_num_keys() const {
+  return flat_tensor_->tensors()->size();
+}
+
+Result<const char*> FlatTensorDataMap::get_key(size_t index) const {
+  ET_CHECK_OR_RETURN_ERROR(
+      index < flat_tensor_->tensors()->size(),
+      InvalidArgument,
+      "Key index %zu >= %" PRIu32,
+      index,
+      flat_tensor_->tensors()->size());
+  return flat_tensor_->tensors()->Get(index)->fully_qualified_name()->c_str();
+}
+
+} // namespace extension
+} // namespace executorch
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <executorch/extension/flat_tensor/flat_tensor_header.h>
+#include <executorch/runtime/core/data_loader.h>
+#include <executorch/runtime/core/error.h>
+#include <executorch/runtime/core/freeable_buffer.h>
+#include <executorch/runtime/core/named_data_map.h>
+#include <executorch/runtime/core/result.h>
+#include <executorch/runtime/core/tensor_layout.h>
+#include <executorch/runtime/platform/compiler.h>
+
+// Forward declare flatbuffer types. This is a public header and must not
+// include the generated flatbuffer header.
+namespace flat_tensor {
+struct FlatTensor;
+struct TensorMetadata;
+} // namespace flat_tensor
+
+namespace executorch {
+namespace extension {
+
+/**
+ * A NamedDataMap that reads tensors from a .ptd file in the FlatTensor
+ * format.
+ *
+ * Only the small FlatTensor flatbuffer is read up front. Tensor data is
+ * loaded from the DataLoader on request, so when the loader is an
+ * MmapDataLoader, get_data() returns pages mapped straight from the file.
+ * Every Method, and every process, that maps the same file shares one copy of
+ * those pages in the page cache, so programs that share base weights only
+ * cost memory for their own data.
+ */
+class FlatTensorDataMap final : public executorch::runtime::NamedDataMap {
+ public:
+  /**
+   * Creates a new FlatTensorDataMap from a .ptd file.
+   *
+   * @param[in] loader The DataLoader to read the file from. Must outlive the
+   *     returned instance and any buffers it returns.
+   *
+   * @returns A new FlatTensorDataMap on success.
+   * @retval Error::InvalidExternalData The file is not a valid .ptd file.
+   */
+  ET_NODISCARD static executorch::runtime::Result<FlatTensorDataMap> load(
+      executorch::runtime::DataLoader* loader);
+
+  ET_NODISCARD executorch::runtime::Result<executorch::runtime::TensorLayout>
+  get_metadata(const char* key) const override;
+
+  ET_NODISCARD
+  executorch::runtime::Result<executorch::runtime::FreeableBuffer> get_data(
+      const char* key) const override;
+
+  ET_NODISCARD executorch::runtime::Error
+  load_data_into(const char* key, void* buffer, size_t size) const override;
+
+  ET_NODISCARD executorch::runtime::Result<size_t> get_num_keys()
+      const override;
+
+  ET_NODISCARD executorch::runtime::Result<const char*> get_key(
+      size_t index) const override;
+
+  FlatTensorDataMap(FlatTensorDataMap&&) noexcept = default;
+
+  ~FlatTensorDataMap() override = default;
+
+ private:
+  FlatTensorDataMap(
+      const FlatTensorHeader& header,
+      executorch::runtime::FreeableBuffer&& flat_tensor_data,
+      const flat_tensor::FlatTensor* flat_tensor,
+      executorch::runtime::DataLoader* loader)
+      : header_(header),
+        flat_tensor_data_(std::move(flat_tensor_data)),
+        flat_tensor_(flat_tensor),
+        loader_(loader) {}
+
+  /// Returns the metadata of the tensor named `key`, or NotFound.
+  executorch::runtime::Result<const flat_tensor::TensorMetadata*>
+  find_tensor(const char* key) const;
+
+  /**
+   * Returns the offset in the file and the size of the data of `tensor`,
+   * after checking that it lies within its segment.
+   */
+  executorch::runtime::Error get_data_range(
+      const flat_tensor::TensorMetadata* tensor,
+      size_t* offset,
+      size_t* size) const;
+
+  // Not copyable or assignable.
+  FlatTensorDataMap(const FlatTensorDataMap& rhs) = delete;
+  FlatTensorDataMap& operator=(FlatTensorDataMap&& rhs) noexcept = delete;
+  FlatTensorDataMap& operator=(const FlatTensorDataMap& rhs) = delete;
+
+  /// Where the flatbuffer and the segment data live in the file.
+  const FlatTensorHeader header_;
+
+  /// Serialized flat_tensor flatbuffer data.
+  executorch::runtime::FreeableBuffer flat_tensor_data_;
+
+  /// The root of the flatbuffer, pointing into flat_tensor_data_.
+  const flat_tensor::FlatTensor* flat_tensor_;
+
+  /// Used to load the tensor data on request.
+  executorch::runtime::DataLoader* loader_;
+};
+
+} // namespace extension
+} // namespace executorch
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <executorch/runtime/core/result.h>
+
+namespace executorch {
+namespace extension {
+
+/**
+ * The header embedded in a .ptd file, which says where the FlatTensor
+ * flatbuffer and the segment data that follows it live in the file.
+ *
+ * Like the .pte ExtendedHeader, it sits in the padding after the flatbuffer
+ * root offset and file identifier. All fields are little-endian:
+ *
+ *   [0, 4)    magic "FH01"
+ *   [4, 8)    uint32 header length, counting from the magic
+ *   [8, 16)   uint64 flatbuffer_offset
+ *   [16, 24)  uint64 flatbuffer_size
+ *   [24, 32)  uint64 segment_base_offset
+ *   [32, 40)  uint64 segment_data_size
+ */
+struct FlatTensorHeader {
+  /**
+   * To find the header, callers should provide at least this many bytes of the
+   * head of the .ptd file.
+   */
+  static constexpr size_t kNumHeadBytes = 64;
+
+  /// The offset into the .ptd file where the header begins.
+  static constexpr size_t kHeaderOffset = 8;
+
+  /**
+   * The magic bytes that identify the header. The compatibility-preserving
+   * way to change the header is to increase its length field and add new
+   * fields at the end.
+   */
+  static constexpr size_t kMagicSize = 4;
+  static constexpr char kMagic[kMagicSize] = {'F', 'H', '0', '1'};
+
+  /**
+   * Looks for and parses a FlatTensorHeader in the provided data.
+   *
+   * @param[in] data The head of the .ptd file, starting at offset 0.
+   * @param[in] size Length of `data` in bytes. Must be >= kNumHeadBytes or this
+   *     call will fail.
+   *
+   * @returns The header if it was found and is valid.
+   * @retval Error::InvalidArgument `size` is too small.
+   * @retval Error::NotFound The magic bytes are not present.
+   * @retval Error::InvalidExternalData The header is corrupt.
+   */
+  static runtime::Result<FlatTensorHeader> Parse(const void* data, size_t size);
+
+  /// The offset of the FlatTensor flatbuffer data in the file.
+  uint64_t flatbuffer_offset;
+
+  /// The size in bytes of the FlatTensor flatbuffer data.
+  uint64_t flatbuffer_size;
+
+  /// The offset in the file that DataSegment offsets are relative to.
+  uint64_t segment_base_offset;
+
+  /// The size in bytes of all segment data, starting at segment_base_offset.
+  uint64_t segment_data_size;
+};
+
+} // namespace extension
+} // namespace executorch
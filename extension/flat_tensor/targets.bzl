@@ -0,0 +1,87 @@
+load("@fbsource//xplat/executorch/build:runtime_wrapper.bzl", "runtime")
+
+FLAT_TENSOR_HEADER = "flat_tensor_generated.h"
+SCALAR_TYPE_HEADER = "scalar_type_generated.h"
+
+def define_common_targets():
+    """Defines targets that should be shared between fbcode and xplat.
+
+    The directory containing this targets.bzl file should also contain both
+    TARGETS and BUCK files that call this function.
+    """
+
+    runtime.genrule(
+        name = "generate_flat_tensor_schema",
+        srcs = [
+            "flat_tensor.fbs",
+            "scalar_type.fbs",
+        ],
+        # flatc takes an output directory, not a file; see
+        # //executorch/schema:generate_program.
+        outs = {
+            FLAT_TENSOR_HEADER: [FLAT_TENSOR_HEADER],
+            SCALAR_TYPE_HEADER: [SCALAR_TYPE_HEADER],
+        },
+        default_outs = [FLAT_TENSOR_HEADER],
+        cmd = " ".join([
+            "$(exe {})".format(runtime.external_dep_location("flatc")),
+            "--cpp",
+            "--cpp-std c++11",
+            "--gen-mutable",
+            "--scoped-enums",
+            "-o ${OUT}",
+            "${SRCS}",
+            # Let our infra know that the files were generated.
+            " ".join([
+                "&& echo // @" + "generated >> ${OUT}/" + header
+                for header in [FLAT_TENSOR_HEADER, SCALAR_TYPE_HEADER]
+            ]),
+        ]),
+        visibility = [],  # Private
+    )
+
+    # Header-only library with the generated flat_tensor schema headers.
+    runtime.cxx_library(
+        name = "flat_tensor_schema",
+        srcs = [],
+        visibility = [
+            # Keep the flatbuffer types an implementation detail.
+            "//executorch/extension/flat_tensor/...",
+        ],
+        exported_headers = {
+            FLAT_TENSOR_HEADER: ":generate_flat_tensor_schema[{}]".format(FLAT_TENSOR_HEADER),
+            SCALAR_TYPE_HEADER: ":generate_flat_tensor_schema[{}]".format(SCALAR_TYPE_HEADER),
+        },
+        exported_external_deps = ["flatbuffers-api"],
+    )
+
+    runtime.cxx_library(
+        name = "flat_tensor_header",
+        srcs = ["flat_tensor_header.cpp"],
+        exported_headers = ["flat_tensor_header.h"],
+        visibility = [
+            "//executorch/extension/flat_tensor/...",
+        ],
+        exported_deps = [
+            "//executorch/runtime/core:core",
+        ],
+    )
+
+    runtime.cxx_library(
+        name = "flat_tensor_data_map",
+        srcs = ["flat_tensor_data_map.cpp"],
+        exported_headers = ["flat_tensor_data_map.h"],
+        visibility = [
+            "//executorch/...",
+            "@EXECUTORCH_CLIENTS",
+        ],
+        deps = [
+            ":flat_tensor_schema",
+            "//executorch/runtime/platform:platform",
+        ],
+        exported_deps = [
+            ":flat_tensor_header",
+            "//executorch/runtime/core:core",
+            "//executorch/runtime/core:named_data_map",
+        ],
+    )
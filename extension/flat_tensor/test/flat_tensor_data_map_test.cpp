@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/extension/flat_tensor/flat_tensor_data_map.h>
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <executorch/extension/data_loader/buffer_data_loader.h>
+#include <executorch/extension/flat_tensor/flat_tensor_generated.h>
+#include <executorch/runtime/platform/runtime.h>
+
+using namespace ::testing;
+using executorch::extension::FlatTensorDataMap;
+using executorch::extension::FlatTensorHeader;
+using executorch::extension::BufferDataLoader;
+using executorch::runtime::Error;
+using executorch::runtime::FreeableBuffer;
+using executorch::runtime::Result;
+using executorch::runtime::TensorLayout;
+
+namespace {
+
+/// Writes `value` into `data` in little-endian order.
+template <typename T>
+void PutLE(uint8_t* data, T value) {
+  for (size_t i = 0; i < sizeof(T); ++i) {
+    data[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+/**
+ * Builds a .ptd file holding two float tensors: "linear.weight" of size (2, 3)
+ * and "linear.bias" of size (2), both in segment 0.
+ *
+ * The file is laid out as [head][flatbuffer][segment data]. The header in the
+ * head points at the other two parts.
+ */
+std::vector<uint8_t> CreatePtdFile() {
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<int32_t> weight_sizes = {2, 3};
+  std::vector<uint8_t> weight_dim_order = {0, 1};
+  std::vector<int32_t> bias_sizes = {2};
+  std::vector<uint8_t> bias_dim_order = {0};
+  std::vector<flatbuffers::Offset<flat_tensor::TensorMetadata>> tensors = {
+      flat_tensor::CreateTensorMetadataDirect(
+          builder,
+          "linear.weight",
+          executorch_flatbuffer::ScalarType::FLOAT,
+          &weight_sizes,
+          &weight_dim_order,
+          /*segment_index=*/0,
+          /*offset=*/0),
+      flat_tensor::CreateTensorMetadataDirect(
+          builder,
+          "linear.bias",
+          executorch_flatbuffer::ScalarType::FLOAT,
+          &bias_sizes,
+          &bias_dim_order,
+          /*segment_index=*/0,
+          /*offset=*/32),
+  };
+  std::vector<flatbuffers::Offset<flat_tensor::DataSegment>> segments = {
+      flat_tensor::CreateDataSegment(builder, /*offset=*/0, /*size=*/40),
+  };
+  builder.Finish(
+      flat_tensor::CreateFlatTensorDirect(
+          builder,
+          /*version=*/0,
+          /*tensor_alignment=*/16,
+          &tensors,
+          &segments),
+      flat_tensor::FlatTensorIdentifier());
+
+  const size_t flatbuffer_offset = FlatTensorHeader::kNumHeadBytes;
+  const size_t flatbuffer_size = builder.GetSize();
+  const size_t segment_base_offset =
+      (flatbuffer_offset + flatbuffer_size + 15) & ~size_t(15);
+  const size_t segment_data_size = 40;
+
+  std::vector<uint8_t> file(segment_base_offset + segment_data_size);
+  uint8_t* header = file.data() + FlatTensorHeader::kHeaderOffset;
+  std::memcpy(header, FlatTensorHeader::kMagic, FlatTensorHeader::kMagicSize);
+  PutLE<uint32_t>(header + 4, 40);
+  PutLE<uint64_t>(header + 8, flatbuffer_offset);
+  PutLE<uint64_t>(header + 16, flatbuffer_size);
+  PutLE<uint64_t>(header + 24, segment_base_offset);
+  PutLE<uint64_t>(header + 32, segment_data_size);
+  std::memcpy(
+      file.data() + flatbuffer_offset,
+      builder.GetBufferPointer(),
+      flatbuffer_size);
+
+  float* data = reinterpret_cast<float*>(file.data() + segment_base_offset);
+  for (int i = 0; i < 6; ++i) {
+    data[i] = i + 1; // linear.weight
+  }
+  data[8] = 10; // linear.bias
+  data[9] = 20;
+  return file;
+}
+
+} // namespace
+
+class FlatTensorDataMapTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Since these tests cause ET_LOG to be called, the PAL must be initialized
+    // first.
+    executorch::runtime::runtime_init();
+    file_ = CreatePtdFile();
+    loader_ = std::make_unique<BufferDataLoader>(file_.data(), file_.size());
+  }
+
+  std::vector<uint8_t> file_;
+  std::unique_ptr<BufferDataLoader> loader_;
+};
+
+TEST_F(FlatTensorDataMapTest, LoadsKeys) {
+  Result<FlatTensorDataMap> data_map = FlatTensorDataMap::load(loader_.get());
+  ASSERT_EQ(data_map.error(), Error::Ok);
+
+  Result<size_t> num_keys = data_map->get_num_keys();
+  ASSERT_EQ(num_keys.error(), Error::Ok);
+  EXPECT_EQ(num_keys.get(), 2);
+  EXPECT_STREQ(data_map->get_key(0).get(), "linear.weight");
+  EXPECT_STREQ(data_map->get_key(1).get(), "linear.bias");
+  EXPECT_EQ(data_map->get_key(2).error(), Error::InvalidArgument);
+}
+
+TEST_F(FlatTensorDataMapTest, GetMetadata) {
+  Result<FlatTensorDataMap> data_map = FlatTensorDataMap::load(loader_.get());
+  ASSERT_EQ(data_map.error(), Error::Ok);
+
+  Result<TensorLayout> layout = data_map->get_metadata("linear.weight");
+  ASSERT_EQ(layout.error(), Error::Ok);
+  EXPECT_EQ(layout->scalar_type(), executorch::aten::ScalarType::Float);
+  ASSERT_EQ(layout->sizes().size(), 2);
+  EXPECT_EQ(layout->sizes()[0], 2);
+  EXPECT_EQ(layout->sizes()[1], 3);
+  ASSERT_EQ(layout->dim_order().size(), 2);
+  EXPECT_EQ(layout->dim_order()[1], 1);
+  EXPECT_EQ(layout->nbytes(), 6 * sizeof(float));
+
+  EXPECT_EQ(data_map->get_metadata("missing").error(), Error::NotFound);
+}
+
+TEST_F(FlatTensorDataMapTest, GetData) {
+  Result<FlatTensorDataMap> data_map = FlatTensorDataMap::load(loader_.get());
+  ASSERT_EQ(data_map.error(), Error::Ok);
+
+  Result<FreeableBuffer> weight = data_map->get_data("linear.weight");
+  ASSERT_EQ(weight.error(), Error::Ok);
+  ASSERT_EQ(weight->size(), 6 * sizeof(float));
+  const float* weight_data = static_cast<const float*>(weight->data());
+  EXPECT_EQ(weight_data[0], 1);
+  EXPECT_EQ(weight_data[5], 6);
+
+  Result<FreeableBuffer> bias = data_map->get_data("linear.bias");
+  ASSERT_EQ(bias.error(), Error::Ok);
+  ASSERT_EQ(bias->size(), 2 * sizeof(float));
+  EXPECT_EQ(static_cast<const float*>(bias->data())[1], 20);
+
+  EXPECT_EQ(data_map->get_data("missing").error(), Error::NotFound);
+}
+
+TEST_F(FlatTensorDataMapTest, LoadDataInto) {
+  Result<FlatTensorDataMap> data_map = FlatTensorDataMap::load(loader_.get());
+  ASSERT_EQ(data_map.error(), Error::Ok);
+
+  float bias[2] = {};
+  ASSERT_EQ(
+      data_map->load_data_into("linear.bias", bias, sizeof(bias)), Error::Ok);
+  EXPECT_EQ(bias[0], 10);
+  EXPECT_EQ(bias[1], 20);
+
+  // The buffer must be large enough to hold the tensor.
+  EXPECT_EQ(
+      data_map->load_data_into("linear.bias", bias, sizeof(bias) - 1),
+      Error::InvalidArgument);
+}
+
+TEST_F(FlatTensorDataMapTest, CorruptHeaderFails) {
+  // Break the magic.
+  file_[FlatTensorHeader::kHeaderOffset] = 'x';
+  EXPECT_EQ(
+      FlatTensorDataMap::load(loader_.get()).error(),
+      Error::InvalidExternalData);
+}
+
+TEST_F(FlatTensorDataMapTest, CorruptFlatbufferFails) {
+  // Break the flatbuffer identifier, which follows the root offset.
+  file_[FlatTensorHeader::kNumHeadBytes + 4] = 'x';
+  EXPECT_EQ(
+      FlatTensorDataMap::load(loader_.get()).error(),
+      Error::InvalidExternalData);
+}
@@ -171,6 +171,17 @@ static executorch::runtime::Kernel make_boxed_kernel(
       name, WrapUnboxedIntoFunctor<FuncType>::call);
 }
 
+/// Like make_boxed_kernel() above, but for a variant of the kernel built for a
+/// specific instruction set; see executorch::runtime::KernelIsa.
+template <typename FuncType>
+static executorch::runtime::Kernel make_boxed_kernel(
+    const char* name,
+    FuncType,
+    executorch::runtime::KernelIsa isa) {
+  return executorch::runtime::Kernel(
+      name, WrapUnboxedIntoFunctor<FuncType>::call, isa);
+}
+
 } // namespace extension
 } // namespace executorch
 
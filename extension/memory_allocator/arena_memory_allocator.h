@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include <executorch/extension/memory_allocator/memory_allocator_stats.h>
+#include <executorch/runtime/core/memory_allocator.h>
+
+namespace executorch {
+namespace extension {
+
+/**
+ * A bump allocator that grows by mallocing additional chunks when it runs out
+ * of space, instead of failing like the fixed-size MemoryAllocator.
+ *
+ * This is meant for the method (runtime) allocator, whose final size is hard
+ * to guess up front. Allocations are as cheap as MemoryAllocator's until the
+ * current chunk is exhausted, and memory is only returned to the system at
+ * destruction or when the arena is consolidated.
+ *
+ * The arena learns how much memory a workload needs:
+ * - learned_size() reports a single-chunk size that fits the largest pass
+ *   seen so far. It can be persisted and passed as `initial_size` to a later
+ *   instance so that loading the same program never has to grow.
+ * - reset() coalesces multiple chunks into one chunk of learned_size(), so
+ *   the next pass runs out of a single contiguous buffer.
+ * - freeze() does the same and then stops the arena from growing, turning it
+ *   into a fixed-size allocator.
+ */
+class ArenaMemoryAllocator : public executorch::runtime::MemoryAllocator {
+ public:
+  /// Default size of each chunk obtained from the system.
+  static constexpr size_t kDefaultChunkSize = 64 * 1024;
+
+  /**
+   * Constructs a new arena.
+   *
+   * @param[in] initial_size Size of the first chunk, allocated eagerly. Pass
+   *     a previously observed learned_size() to avoid growing at all. If 0,
+   *     the first chunk is allocated on the first allocate() call.
+   * @param[in] chunk_size Minimum size of each chunk allocated when the arena
+   *     needs to grow.
+   */
+  explicit ArenaMemoryAllocator(
+      size_t initial_size = 0,
+      size_t chunk_size = kDefaultChunkSize)
+      : MemoryAllocator(0, nullptr), chunk_size_(chunk_size) {
+    if (initial_size > 0) {
+      add_chunk(initial_size);
+    }
+  }
+
+  ~ArenaMemoryAllocator() override {
+    release_chunks();
+  }
+
+  ArenaMemoryAllocator(const ArenaMemoryAllocator&) = delete;
+  ArenaMemoryAllocator& operator=(const ArenaMemoryAllocator&) = delete;
+  ArenaMemoryAllocator(ArenaMemoryAllocator&&) = delete;
+  ArenaMemoryAllocator& operator=(ArenaMemoryAllocator&&) = delete;
+
+  void* allocate(size_t size, size_t alignment = kDefaultAlignment) override {
+    if (!isPowerOf2(alignment)) {
+      ET_LOG(Error, "Alignment %zu is not a power of 2", alignment);
+      return nullptr;
+    }
+
+    uint8_t* start = fit(size, alignment);
+    // Move on to chunks that were retained by an earlier reset().
+    while (start == nullptr && chunk_index_ + 1 < chunks_.size()) {
+      select_chunk(chunk_index_ + 1);
+      start = fit(size, alignment);
+    }
+    if (start == nullptr) {
+      if (frozen_) {
+        ET_LOG(
+            Error,
+            "Frozen arena exhausted: %zuB requested, %zuB reserved",
+            size,
+            stats_.bytes_reserved);
+        return nullptr;
+      }
+      // The chunk must be able to hold the request after aligning its start.
+      if (!add_chunk(std::max(chunk_size_, size + alignment))) {
+        return nullptr;
+      }
+      start = fit(size, alignment);
+    }
+
+    EXECUTORCH_TRACK_ALLOCATION(prof_id(), start + size - cur_);
+    stats_.bytes_in_use += static_cast<size_t>(start + size - cur_);
+    stats_.peak_bytes_in_use =
+        std::max(stats_.peak_bytes_in_use, stats_.bytes_in_use);
+    stats_.num_allocations++;
+    // Budget for worst-case padding so that learned_size() is independent of
+    // where the chunk happens to start.
+    pass_size_ += size + alignment - 1;
+    learned_size_ = std::max(learned_size_, pass_size_);
+    cur_ = start + size;
+    return start;
+  }
+
+  /**
+   * Makes all previously allocated memory available again. If the last pass
+   * needed more than one chunk, the chunks are replaced by a single chunk of
+   * learned_size().
+   */
+  void reset() override {
+    if (chunks_.size() > 1) {
+      consolidate();
+    }
+    select_chunk(0);
+    stats_.bytes_in_use = 0;
+    pass_size_ = 0;
+  }
+
+  /**
+   * Consolidates the arena into a single chunk of learned_size() and prevents
+   * it from growing further. Any memory previously returned by allocate() is
+   * invalidated, as with reset().
+   */
+  void freeze() {
+    consolidate();
+    select_chunk(0);
+    stats_.bytes_in_use = 0;
+    pass_size_ = 0;
+    frozen_ = true;
+  }
+
+  /// Returns true if freeze() has been called.
+  bool is_frozen() const {
+    return frozen_;
+  }
+
+  /**
+   * Returns the size of a single chunk that can serve the largest sequence
+   * of allocations seen between resets, regardless of alignment padding.
+   */
+  size_t learned_size() const {
+    return learned_size_;
+  }
+
+  /// Returns usage statistics for this arena.
+  const MemoryAllocatorStats& stats() const {
+    return stats_;
+  }
+
+ private:
+  struct Chunk {
+    uint8_t* data;
+    size_t size;
+  };
+
+  // Returns an aligned pointer to `size` bytes in the current chunk, or
+  // nullptr if they don't fit.
+  uint8_t* fit(size_t size, size_t alignment) {
+    if (cur_ == nullptr) {
+      return nullptr;
+    }
+    uint8_t* start = alignPointer(cur_, alignment);
+    if (start + size > end_) {
+      return nullptr;
+    }
+    return start;
+  }
+
+  bool add_chunk(size_t size) {
+    uint8_t* data = static_cast<uint8_t*>(std::malloc(size));
+    if (data == nullptr) {
+      ET_LOG(Error, "Failed to allocate %zuB arena chunk", size);
+      return false;
+    }
+    chunks_.push_back({data, size});
+    stats_.bytes_reserved += size;
+    stats_.num_system_allocations++;
+    select_chunk(chunks_.size() - 1);
+    return true;
+  }
+
+  void select_chunk(size_t index) {
+    chunk_index_ = index;
+    if (index < chunks_.size()) {
+      cur_ = chunks_[index].data;
+      end_ = chunks_[index].data + chunks_[index].size;
+    } else {
+      cur_ = nullptr;
+      end_ = nullptr;
+    }
+  }
+
+  void consolidate() {
+    if (chunks_.size() == 1 && chunks_[0].size >= learned_size_) {
+      return;
+    }
+    release_chunks();
+    if (learned_size_ > 0) {
+      add_chunk(learned_size_);
+    }
+  }
+
+  void release_chunks() {
+    for (const auto& chunk : chunks_) {
+      std::free(chunk.data);
+    }
+    chunks_.clear();
+    stats_.bytes_reserved = 0;
+    select_chunk(0);
+  }
+
+  const size_t chunk_size_;
+  std::vector<Chunk> chunks_;
+  size_t chunk_index_ = 0;
+  uint8_t* cur_ = nullptr;
+  uint8_t* end_ = nullptr;
+  bool frozen_ = false;
+
+  // Bytes requested since the last reset(), with worst-case padding.
+  size_t pass_size_ = 0;
+  // Largest pass_size_ seen so far.
+  size_t learned_size_ = 0;
+  MemoryAllocatorStats stats_;
+};
+
+} // namespace extension
+} // namespace executorch
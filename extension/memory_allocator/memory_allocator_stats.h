@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace executorch {
+namespace extension {
+
+/**
+ * Usage statistics reported by the growable allocators in this directory.
+ */
+struct MemoryAllocatorStats {
+  /// Number of successful allocate() calls since construction.
+  size_t num_allocations = 0;
+
+  /// Bytes currently handed out, including alignment padding. Drops back to
+  /// zero on reset().
+  size_t bytes_in_use = 0;
+
+  /// Largest value of bytes_in_use ever observed. This is the amount of
+  /// memory a workload actually needed and is preserved across reset().
+  size_t peak_bytes_in_use = 0;
+
+  /// Bytes currently obtained from the system to back allocations.
+  size_t bytes_reserved = 0;
+
+  /// Number of times the allocator had to request more memory from the
+  /// system.
+  size_t num_system_allocations = 0;
+};
+
+} // namespace extension
+} // namespace executorch
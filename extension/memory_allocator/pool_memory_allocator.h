@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include <executorch/extension/memory_allocator/memory_allocator_stats.h>
+#include <executorch/runtime/core/memory_allocator.h>
+
+namespace executorch {
+namespace extension {
+
+/**
+ * A malloc-backed allocator that recycles its blocks on reset() instead of
+ * returning them to the system.
+ *
+ * Blocks are grouped into power-of-two size classes. reset() moves every
+ * outstanding block back onto the free list of its class, so a workload that
+ * repeats the same allocation pattern between resets (like the per-instruction
+ * temp allocations of a Method) stops calling malloc()/free() once the pool is
+ * warm. Rounding to a power of two can waste up to half of each block; use
+ * stats() to see how much memory the pool actually holds.
+ *
+ * Blocks are only released at destruction or by release_free_blocks().
+ */
+class PoolMemoryAllocator : public executorch::runtime::MemoryAllocator {
+ public:
+  PoolMemoryAllocator() : MemoryAllocator(0, nullptr) {}
+
+  ~PoolMemoryAllocator() override {
+    reset();
+    release_free_blocks();
+  }
+
+  PoolMemoryAllocator(const PoolMemoryAllocator&) = delete;
+  PoolMemoryAllocator& operator=(const PoolMemoryAllocator&) = delete;
+  PoolMemoryAllocator(PoolMemoryAllocator&&) = delete;
+  PoolMemoryAllocator& operator=(PoolMemoryAllocator&&) = delete;
+
+  void* allocate(size_t size, size_t alignment = kDefaultAlignment) override {
+    if (!isPowerOf2(alignment)) {
+      ET_LOG(Error, "Alignment %zu is not a power of 2", alignment);
+      return nullptr;
+    }
+
+    // The minimum alignment that malloc() is guaranteed to provide.
+    static constexpr size_t kMallocAlignment = alignof(std::max_align_t);
+    size_t needed = size;
+    if (alignment > kMallocAlignment) {
+      needed += alignment;
+    }
+    const size_t size_class = size_class_for(needed);
+    if (size_class >= kNumSizeClasses) {
+      ET_LOG(Error, "Allocation of %zuB is too large to pool", size);
+      return nullptr;
+    }
+    const size_t block_size = kMinBlockSize << size_class;
+
+    void* block = nullptr;
+    std::vector<void*>& free_list = free_lists_[size_class];
+    if (!free_list.empty()) {
+      block = free_list.back();
+      free_list.pop_back();
+    } else {
+      if (frozen_) {
+        ET_LOG(
+            Error,
+            "Frozen pool has no free %zuB block for a %zuB request",
+            block_size,
+            size);
+        return nullptr;
+      }
+      block = std::malloc(block_size);
+      if (block == nullptr) {
+        ET_LOG(Error, "Failed to allocate %zuB pool block", block_size);
+        return nullptr;
+      }
+      stats_.bytes_reserved += block_size;
+      stats_.num_system_allocations++;
+    }
+
+    EXECUTORCH_TRACK_ALLOCATION(prof_id(), size);
+    in_use_.push_back({block, size_class});
+    stats_.bytes_in_use += block_size;
+    stats_.peak_bytes_in_use =
+        std::max(stats_.peak_bytes_in_use, stats_.bytes_in_use);
+    stats_.num_allocations++;
+    return alignPointer(block, alignment);
+  }
+
+  /// Returns every outstanding block to its free list for reuse.
+  void reset() override {
+    for (const auto& block : in_use_) {
+      free_lists_[block.size_class].push_back(block.data);
+    }
+    in_use_.clear();
+    stats_.bytes_in_use = 0;
+  }
+
+  /**
+   * Stops the pool from requesting more memory from the system. Allocations
+   * that cannot be served from a free block fail afterwards.
+   */
+  void freeze() {
+    frozen_ = true;
+  }
+
+  /// Returns true if freeze() has been called.
+  bool is_frozen() const {
+    return frozen_;
+  }
+
+  /// Returns all blocks on the free lists to the system.
+  void release_free_blocks() {
+    for (size_t i = 0; i < kNumSizeClasses; ++i) {
+      for (void* block : free_lists_[i]) {
+        std::free(block);
+        stats_.bytes_reserved -= kMinBlockSize << i;
+      }
+      free_lists_[i].clear();
+    }
+  }
+
+  /// Returns usage statistics for this pool.
+  const MemoryAllocatorStats& stats() const {
+    return stats_;
+  }
+
+ private:
+  // Smallest block handed out; smaller requests share this size class.
+  static constexpr size_t kMinBlockSize = 64;
+  // Size classes cover kMinBlockSize up to kMinBlockSize << 41 (128 TiB).
+  static constexpr size_t kNumSizeClasses = 42;
+
+  struct Block {
+    void* data;
+    size_t size_class;
+  };
+
+  // Returns the index of the smallest size class that holds `size` bytes.
+  static size_t size_class_for(size_t size) {
+    size_t size_class = 0;
+    size_t block_size = kMinBlockSize;
+    while (block_size < size && size_class < kNumSizeClasses) {
+      block_size <<= 1;
+      size_class++;
+    }
+    return size_class;
+  }
+
+  std::vector<void*> free_lists_[kNumSizeClasses];
+  std::vector<Block> in_use_;
+  bool frozen_ = false;
+  MemoryAllocatorStats stats_;
+};
+
+} // namespace extension
+} // namespace executorch
@@ -20,3 +20,44 @@ def define_common_targets():
             "@EXECUTORCH_CLIENTS",
         ],
     )
+
+    runtime.cxx_library(
+        name = "memory_allocator_stats",
+        exported_headers = [
+            "memory_allocator_stats.h",
+        ],
+        visibility = [
+            "//executorch/extension/memory_allocator/...",
+            "@EXECUTORCH_CLIENTS",
+        ],
+    )
+
+    runtime.cxx_library(
+        name = "arena_memory_allocator",
+        exported_headers = [
+            "arena_memory_allocator.h",
+        ],
+        exported_deps = [
+            ":memory_allocator_stats",
+            "//executorch/runtime/core:memory_allocator",
+        ],
+        visibility = [
+            "//executorch/extension/memory_allocator/test/...",
+            "@EXECUTORCH_CLIENTS",
+        ],
+    )
+
+    runtime.cxx_library(
+        name = "pool_memory_allocator",
+        exported_headers = [
+            "pool_memory_allocator.h",
+        ],
+        exported_deps = [
+            ":memory_allocator_stats",
+            "//executorch/runtime/core:memory_allocator",
+        ],
+        visibility = [
+            "//executorch/extension/memory_allocator/test/...",
+            "@EXECUTORCH_CLIENTS",
+        ],
+    )
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/extension/memory_allocator/arena_memory_allocator.h>
+#include <executorch/runtime/platform/runtime.h>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+using executorch::extension::ArenaMemoryAllocator;
+
+class ArenaMemoryAllocatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Since these tests cause ET_LOG to be called, the PAL must be initialized
+    // first.
+    executorch::runtime::runtime_init();
+  }
+};
+
+static bool is_aligned(const void* ptr, size_t alignment) {
+  uintptr_t addr = reinterpret_cast<uintptr_t>(ptr);
+  return addr % alignment == 0;
+}
+
+#define EXPECT_ALIGNED(ptr, alignment)        \
+  EXPECT_TRUE(is_aligned((ptr), (alignment))) \
+      << "Pointer " << (ptr) << " is not aligned to " << (alignment)
+
+TEST_F(ArenaMemoryAllocatorTest, AllocationsAreContiguousWithinAChunk) {
+  ArenaMemoryAllocator allocator(/*initial_size=*/1024);
+
+  auto* p1 = static_cast<uint8_t*>(allocator.allocate(16, 16));
+  auto* p2 = static_cast<uint8_t*>(allocator.allocate(16, 16));
+  ASSERT_NE(p1, nullptr);
+  ASSERT_NE(p2, nullptr);
+  EXPECT_EQ(p2, p1 + 16);
+  EXPECT_EQ(allocator.stats().num_system_allocations, 1);
+}
+
+TEST_F(ArenaMemoryAllocatorTest, AlignmentSmokeTest) {
+  ArenaMemoryAllocator allocator;
+
+  for (size_t alignment : {1, 2, 4, 8, 16, 32, 64, 128, 256, 4096}) {
+    void* p = allocator.allocate(3, alignment);
+    ASSERT_NE(p, nullptr);
+    EXPECT_ALIGNED(p, alignment);
+  }
+}
+
+TEST_F(ArenaMemoryAllocatorTest, BadAlignmentFails) {
+  ArenaMemoryAllocator allocator;
+
+  EXPECT_EQ(allocator.allocate(16, 0), nullptr);
+  EXPECT_EQ(allocator.allocate(16, 3), nullptr);
+  EXPECT_EQ(allocator.stats().num_allocations, 0);
+}
+
+TEST_F(ArenaMemoryAllocatorTest, GrowsWhenExhausted) {
+  ArenaMemoryAllocator allocator(/*initial_size=*/64, /*chunk_size=*/128);
+
+  EXPECT_NE(allocator.allocate(64, 1), nullptr);
+  EXPECT_EQ(allocator.stats().num_system_allocations, 1);
+
+  // Doesn't fit in the first chunk.
+  EXPECT_NE(allocator.allocate(64, 1), nullptr);
+  EXPECT_EQ(allocator.stats().num_system_allocations, 2);
+
+  // Larger than the chunk size.
+  void* big = allocator.allocate(1000, 16);
+  ASSERT_NE(big, nullptr);
+  EXPECT_ALIGNED(big, 16);
+  EXPECT_EQ(allocator.stats().num_system_allocations, 3);
+  EXPECT_GE(allocator.stats().bytes_reserved, 64 + 128 + 1000);
+}
+
+TEST_F(ArenaMemoryAllocatorTest, ResetConsolidatesToOneChunk) {
+  ArenaMemoryAllocator allocator(/*initial_size=*/0, /*chunk_size=*/64);
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_NE(allocator.allocate(48), nullptr);
+  }
+  const size_t system_allocations = allocator.stats().num_system_allocations;
+  EXPECT_GT(system_allocations, 1);
+
+  allocator.reset();
+  EXPECT_EQ(allocator.stats().bytes_in_use, 0);
+  EXPECT_EQ(allocator.stats().bytes_reserved, allocator.learned_size());
+
+  // Replaying the same pattern doesn't need to grow again.
+  const size_t after_reset = allocator.stats().num_system_allocations;
+  auto* first = static_cast<uint8_t*>(allocator.allocate(48));
+  for (int i = 1; i < 10; ++i) {
+    EXPECT_NE(allocator.allocate(48), nullptr);
+  }
+  EXPECT_EQ(allocator.stats().num_system_allocations, after_reset);
+
+  // Memory is reused after the next reset.
+  allocator.reset();
+  EXPECT_EQ(allocator.allocate(48), first);
+  EXPECT_EQ(allocator.stats().num_system_allocations, after_reset);
+}
+
+TEST_F(ArenaMemoryAllocatorTest, FrozenArenaDoesNotGrow) {
+  ArenaMemoryAllocator allocator(/*initial_size=*/0, /*chunk_size=*/32);
+
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_NE(allocator.allocate(100), nullptr);
+  }
+  allocator.freeze();
+  EXPECT_TRUE(allocator.is_frozen());
+  const size_t system_allocations = allocator.stats().num_system_allocations;
+
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_NE(allocator.allocate(100), nullptr);
+  }
+  // The learned size is exhausted and the arena can't grow.
+  EXPECT_EQ(allocator.allocate(allocator.learned_size()), nullptr);
+  EXPECT_EQ(allocator.stats().num_system_allocations, system_allocations);
+}
+
+TEST_F(ArenaMemoryAllocatorTest, LearnedSizeAvoidsGrowth) {
+  size_t learned_size = 0;
+  {
+    ArenaMemoryAllocator allocator(/*initial_size=*/0, /*chunk_size=*/16);
+    for (size_t alignment : {1, 8, 64, 16, 256}) {
+      EXPECT_NE(allocator.allocate(40, alignment), nullptr);
+    }
+    learned_size = allocator.learned_size();
+  }
+
+  ArenaMemoryAllocator allocator(learned_size, /*chunk_size=*/16);
+  for (size_t alignment : {1, 8, 64, 16, 256}) {
+    EXPECT_NE(allocator.allocate(40, alignment), nullptr);
+  }
+  EXPECT_EQ(allocator.stats().num_system_allocations, 1);
+}
+
+TEST_F(ArenaMemoryAllocatorTest, StatsTrackUsage) {
+  ArenaMemoryAllocator allocator(/*initial_size=*/1024);
+
+  allocator.allocate(100, 1);
+  allocator.allocate(28, 1);
+  EXPECT_EQ(allocator.stats().num_allocations, 2);
+  EXPECT_EQ(allocator.stats().bytes_in_use, 128);
+  EXPECT_EQ(allocator.stats().peak_bytes_in_use, 128);
+
+  allocator.reset();
+  allocator.allocate(10, 1);
+  EXPECT_EQ(allocator.stats().num_allocations, 3);
+  EXPECT_EQ(allocator.stats().bytes_in_use, 10);
+  EXPECT_EQ(allocator.stats().peak_bytes_in_use, 128);
+  EXPECT_EQ(allocator.stats().bytes_reserved, 1024);
+}
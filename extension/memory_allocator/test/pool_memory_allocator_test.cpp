@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/extension/memory_allocator/pool_memory_allocator.h>
+#include <executorch/runtime/platform/runtime.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace ::testing;
+using executorch::extension::PoolMemoryAllocator;
+
+class PoolMemoryAllocatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Since these tests cause ET_LOG to be called, the PAL must be initialized
+    // first.
+    executorch::runtime::runtime_init();
+  }
+};
+
+static bool is_aligned(const void* ptr, size_t alignment) {
+  uintptr_t addr = reinterpret_cast<uintptr_t>(ptr);
+  return addr % alignment == 0;
+}
+
+#define EXPECT_ALIGNED(ptr, alignment)        \
+  EXPECT_TRUE(is_aligned((ptr), (alignment))) \
+      << "Pointer " << (ptr) << " is not aligned to " << (alignment)
+
+TEST_F(PoolMemoryAllocatorTest, AlignmentSmokeTest) {
+  PoolMemoryAllocator allocator;
+
+  for (size_t alignment : {1, 2, 4, 8, 16, 32, 64, 128, 256, 4096}) {
+    void* p = allocator.allocate(3, alignment);
+    ASSERT_NE(p, nullptr);
+    EXPECT_ALIGNED(p, alignment);
+  }
+}
+
+TEST_F(PoolMemoryAllocatorTest, BadAlignmentFails) {
+  PoolMemoryAllocator allocator;
+
+  EXPECT_EQ(allocator.allocate(16, 0), nullptr);
+  EXPECT_EQ(allocator.allocate(16, 3), nullptr);
+}
+
+TEST_F(PoolMemoryAllocatorTest, ResetRecyclesBlocks) {
+  PoolMemoryAllocator allocator;
+  const std::vector<size_t> sizes = {16, 100, 4000, 100, 70000};
+
+  std::vector<void*> first;
+  for (size_t size : sizes) {
+    void* p = allocator.allocate(size);
+    ASSERT_NE(p, nullptr);
+    first.push_back(p);
+  }
+  const size_t system_allocations = allocator.stats().num_system_allocations;
+  EXPECT_EQ(system_allocations, sizes.size());
+
+  for (int iter = 0; iter < 3; ++iter) {
+    allocator.reset();
+    EXPECT_EQ(allocator.stats().bytes_in_use, 0);
+    std::vector<void*> again;
+    for (size_t size : sizes) {
+      void* p = allocator.allocate(size);
+      ASSERT_NE(p, nullptr);
+      again.push_back(p);
+    }
+    // Same set of blocks, no new system allocations.
+    std::vector<void*> a = first;
+    std::sort(a.begin(), a.end());
+    std::sort(again.begin(), again.end());
+    EXPECT_EQ(a, again);
+    EXPECT_EQ(allocator.stats().num_system_allocations, system_allocations);
+  }
+}
+
+TEST_F(PoolMemoryAllocatorTest, RequestsShareSizeClasses) {
+  PoolMemoryAllocator allocator;
+
+  void* p = allocator.allocate(200);
+  allocator.reset();
+  // 129..256 bytes share a size class.
+  EXPECT_EQ(allocator.allocate(150), p);
+  // A different class needs a new block.
+  EXPECT_NE(allocator.allocate(1000), nullptr);
+  EXPECT_EQ(allocator.stats().num_system_allocations, 2);
+}
+
+TEST_F(PoolMemoryAllocatorTest, FrozenPoolDoesNotGrow) {
+  PoolMemoryAllocator allocator;
+
+  EXPECT_NE(allocator.allocate(100), nullptr);
+  allocator.reset();
+  allocator.freeze();
+  EXPECT_TRUE(allocator.is_frozen());
+
+  EXPECT_NE(allocator.allocate(100), nullptr);
+  EXPECT_EQ(allocator.allocate(100), nullptr);
+  EXPECT_EQ(allocator.stats().num_system_allocations, 1);
+}
+
+TEST_F(PoolMemoryAllocatorTest, StatsTrackUsage) {
+  PoolMemoryAllocator allocator;
+
+  allocator.allocate(10);
+  allocator.allocate(100);
+  EXPECT_EQ(allocator.stats().num_allocations, 2);
+  EXPECT_EQ(allocator.stats().bytes_in_use, 64 + 128);
+  EXPECT_EQ(allocator.stats().peak_bytes_in_use, 64 + 128);
+  EXPECT_EQ(allocator.stats().bytes_reserved, 64 + 128);
+
+  allocator.reset();
+  allocator.allocate(10);
+  EXPECT_EQ(allocator.stats().bytes_in_use, 64);
+  EXPECT_EQ(allocator.stats().peak_bytes_in_use, 64 + 128);
+
+  allocator.reset();
+  allocator.release_free_blocks();
+  EXPECT_EQ(allocator.stats().bytes_reserved, 0);
+}
@@ -15,3 +15,23 @@ def define_common_targets():
             "//executorch/extension/memory_allocator:malloc_memory_allocator",
         ],
     )
+
+    runtime.cxx_test(
+        name = "arena_memory_allocator_test",
+        srcs = [
+            "arena_memory_allocator_test.cpp",
+        ],
+        deps = [
+            "//executorch/extension/memory_allocator:arena_memory_allocator",
+        ],
+    )
+
+    runtime.cxx_test(
+        name = "pool_memory_allocator_test",
+        srcs = [
+            "pool_memory_allocator_test.cpp",
+        ],
+        deps = [
+            "//executorch/extension/memory_allocator:pool_memory_allocator",
+        ],
+    )
@@ -10,7 +10,8 @@
 
 #include <executorch/extension/data_loader/file_data_loader.h>
 #include <executorch/extension/data_loader/mmap_data_loader.h>
-#include <executorch/extension/memory_allocator/malloc_memory_allocator.h>
+#include <executorch/extension/memory_allocator/arena_memory_allocator.h>
+#include <executorch/extension/memory_allocator/pool_memory_allocator.h>
 #include <executorch/runtime/platform/runtime.h>
 
 /**
@@ -42,8 +43,8 @@ Module::Module(
     std::unique_ptr<runtime::EventTracer> event_tracer)
     : file_path_(file_path),
       load_mode_(load_mode),
-      memory_allocator_(std::make_unique<MallocMemoryAllocator>()),
-      temp_allocator_(std::make_unique<MallocMemoryAllocator>()),
+      memory_allocator_(std::make_unique<ArenaMemoryAllocator>()),
+      temp_allocator_(std::make_unique<PoolMemoryAllocator>()),
       event_tracer_(std::move(event_tracer)) {
   runtime::runtime_init();
 }
@@ -56,10 +57,10 @@ Module::Module(
     : data_loader_(std::move(data_loader)),
       memory_allocator_(
           memory_allocator ? std::move(memory_allocator)
-                           : std::make_unique<MallocMemoryAllocator>()),
+                           : std::make_unique<ArenaMemoryAllocator>()),
       temp_allocator_(
           temp_allocator ? std::move(temp_allocator)
-                         : std::make_unique<MallocMemoryAllocator>()),
+                         : std::make_unique<PoolMemoryAllocator>()),
       event_tracer_(std::move(event_tracer)) {
   runtime::runtime_init();
 }
@@ -72,10 +73,10 @@ Module::Module(
     : program_(std::move(program)),
       memory_allocator_(
           memory_allocator ? std::move(memory_allocator)
-                           : std::make_unique<MallocMemoryAllocator>()),
+                           : std::make_unique<ArenaMemoryAllocator>()),
       temp_allocator_(
           temp_allocator ? std::move(temp_allocator)
-                         : std::make_unique<MallocMemoryAllocator>()),
+                         : std::make_unique<PoolMemoryAllocator>()),
       event_tracer_(std::move(event_tracer)) {
   runtime::runtime_init();
 }
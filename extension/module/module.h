@@ -56,8 +56,10 @@ class Module {
    *
    * @param[in] data_loader A DataLoader used for loading program data.
    * @param[in] memory_allocator A MemoryAllocator used for memory management.
+   * Defaults to a growable ArenaMemoryAllocator.
    * @param[in] temp_allocator A MemoryAllocator to use when allocating
-   * temporary data during kernel or delegate execution.
+   * temporary data during kernel or delegate execution. Defaults to a
+   * PoolMemoryAllocator, which recycles its blocks between instructions.
    * @param[in] event_tracer A EventTracer used for tracking and logging events.
    */
   explicit Module(
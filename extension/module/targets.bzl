@@ -22,7 +22,8 @@ def define_common_targets():
                 "@EXECUTORCH_CLIENTS",
             ],
             deps = [
-                "//executorch/extension/memory_allocator:malloc_memory_allocator",
+                "//executorch/extension/memory_allocator:arena_memory_allocator",
+                "//executorch/extension/memory_allocator:pool_memory_allocator",
                 "//executorch/extension/data_loader:file_data_loader",
                 "//executorch/extension/data_loader:mmap_data_loader",
             ],
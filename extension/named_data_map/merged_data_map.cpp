@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/extension/named_data_map/merged_data_map.h>
+
+#include <utility>
+
+#include <executorch/runtime/platform/log.h>
+
+using executorch::runtime::Error;
+using executorch::runtime::FreeableBuffer;
+using executorch::runtime::NamedDataMap;
+using executorch::runtime::Result;
+using executorch::runtime::Span;
+using executorch::runtime::TensorLayout;
+
+namespace executorch {
+namespace extension {
+
+/* static */ Result<MergedDataMap> MergedDataMap::load(
+    Span<const NamedDataMap*> data_maps) {
+  std::vector<const char*> keys;
+  std::unordered_map<std::string, const NamedDataMap*> key_to_map;
+  for (size_t i = 0; i < data_maps.size(); ++i) {
+    const NamedDataMap* data_map = data_maps[i];
+    ET_CHECK_OR_RETURN_ERROR(
+        data_map != nullptr, InvalidArgument, "Data map %zu is null", i);
+    Result<size_t> num_keys = data_map->get_num_keys();
+    if (!num_keys.ok()) {
+      return num_keys.error();
+    }
+    for (size_t j = 0; j < num_keys.get(); ++j) {
+      Result<const char*> key = data_map->get_key(j);
+      if (!key.ok()) {
+        return key.error();
+      }
+      ET_CHECK_OR_RETURN_ERROR(
+          key_to_map.emplace(key.get(), data_map).second,
+          InvalidArgument,
+          "Key %s is in more than one data map",
+          key.get());
+      keys.push_back(key.get());
+    }
+  }
+  return MergedDataMap(std::move(keys), std::move(key_to_map));
+}
+
+Result<const NamedDataMap*> MergedDataMap::find_map(const char* key) const {
+  auto it = key_to_map_.find(key);
+  if (it == key_to_map_.end()) {
+    return Error::NotFound;
+  }
+  return it->second;
+}
+
+Result<TensorLayout> MergedDataMap::get_metadata(const char* key) const {
+  Result<const NamedDataMap*> data_map = find_map(key);
+  if (!data_map.ok()) {
+    return data_map.error();
+  }
+  return data_map.get()->get_metadata(key);
+}
+
+Result<FreeableBuffer> MergedDataMap::get_data(const char* key) const {
+  Result<const NamedDataMap*> data_map = find_map(key);
+  if (!data_map.ok()) {
+    return data_map.error();
+  }
+  return data_map.get()->get_data(key);
+}
+
+Error MergedDataMap::load_data_into(const char* key, void* buffer, size_t size)
+    const {
+  Result<const NamedDataMap*> data_map = find_map(key);
+  if (!data_map.ok()) {
+    return data_map.error();
+  }
+  return data_map.get()->load_data_into(key, buffer, size);
+}
+
+Result<size_t> MergedDataMap::get_num_keys() const {
+  return keys_.size();
+}
+
+Result<const char*> MergedDataMap::get_key(size_t index) const {
+  ET_CHECK_OR_RETURN_ERROR(
+      index < keys_.size(),
+      InvalidArgument,
+      "Key index %zu >= %zu",
+      index,
+      keys_.size());
+  return keys_[index];
+}
+
+} // namespace extension
+} // namespace executorch
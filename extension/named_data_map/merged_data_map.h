@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <executorch/runtime/core/named_data_map.h>
+#include <executorch/runtime/core/span.h>
+
+namespace executorch {
+namespace extension {
+
+/**
+ * A NamedDataMap that combines the keys of several others, so that a Method
+ * can take its constants from more than one weight file; e.g. shared base
+ * weights and per-variant weights.
+ *
+ * Keys must be unique across the merged maps.
+ */
+class MergedDataMap final : public executorch::runtime::NamedDataMap {
+ public:
+  /**
+   * Creates a MergedDataMap.
+   *
+   * @param[in] data_maps The maps to merge. They must outlive the returned
+   *     instance; the array that holds them need not.
+   *
+   * @returns A new MergedDataMap on success.
+   * @retval Error::InvalidArgument A map is null, or two maps have the same
+   *     key.
+   */
+  ET_NODISCARD static executorch::runtime::Result<MergedDataMap> load(
+      executorch::runtime::Span<const executorch::runtime::NamedDataMap*>
+          data_maps);
+
+  ET_NODISCARD executorch::runtime::Result<executorch::runtime::TensorLayout>
+  get_metadata(const char* key) const override;
+
+  ET_NODISCARD
+  executorch::runtime::Result<executorch::runtime::FreeableBuffer> get_data(
+      const char* key) const override;
+
+  ET_NODISCARD executorch::runtime::Error
+  load_data_into(const char* key, void* buffer, size_t size) const override;
+
+  ET_NODISCARD executorch::runtime::Result<size_t> get_num_keys()
+      const override;
+
+  ET_NODISCARD executorch::runtime::Result<const char*> get_key(
+      size_t index) const override;
+
+  MergedDataMap(MergedDataMap&&) = default;
+
+  ~MergedDataMap() override = default;
+
+ private:
+  MergedDataMap(
+      std::vector<const char*>&& keys,
+      std::unordered_map<std::string, const executorch::runtime::NamedDataMap*>&&
+          key_to_map)
+      : keys_(std::move(keys)), key_to_map_(std::move(key_to_map)) {}
+
+  /// Returns the map that holds `key`, or NotFound.
+  executorch::runtime::Result<const executorch::runtime::NamedDataMap*>
+  find_map(const char* key) const;
+
+  // Not copyable or assignable.
+  MergedDataMap(const MergedDataMap&) = delete;
+  MergedDataMap& operator=(MergedDataMap&&) = delete;
+  MergedDataMap& operator=(const MergedDataMap&) = delete;
+
+  /// All keys of the merged maps, in order.
+  std::vector<const char*> keys_;
+
+  /// The map that holds each key.
+  std::unordered_map<std::string, const executorch::runtime::NamedDataMap*>
+      key_to_map_;
+};
+
+} // namespace extension
+} // namespace executorch
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/extension/named_data_map/merged_data_map.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <executorch/runtime/platform/runtime.h>
+
+using namespace ::testing;
+using executorch::aten::ScalarType;
+using executorch::extension::MergedDataMap;
+using executorch::runtime::Error;
+using executorch::runtime::FreeableBuffer;
+using executorch::runtime::NamedDataMap;
+using executorch::runtime::Result;
+using executorch::runtime::Span;
+using executorch::runtime::TensorLayout;
+
+namespace {
+
+/// Holds 1-D float tensors in memory.
+class InMemoryDataMap final : public NamedDataMap {
+ public:
+  struct Entry {
+    std::string key;
+    std::vector<float> data;
+    int32_t size;
+  };
+
+  explicit InMemoryDataMap(std::vector<Entry> entries)
+      : entries_(std::move(entries)) {
+    for (Entry& entry : entries_) {
+      entry.size = static_cast<int32_t>(entry.data.size());
+    }
+  }
+
+  Result<TensorLayout> get_metadata(const char* key) const override {
+    const Entry* entry = find(key);
+    if (entry == nullptr) {
+      return Error::NotFound;
+    }
+    return TensorLayout::create(
+        Span<const int32_t>(&entry->size, 1),
+        Span<const uint8_t>(kDimOrder, 1),
+        ScalarType::Float);
+  }
+
+  Result<FreeableBuffer> get_data(const char* key) const override {
+    const Entry* entry = find(key);
+    if (entry == nullptr) {
+      return Error::NotFound;
+    }
+    return FreeableBuffer(
+        entry->data.data(), entry->data.size() * sizeof(float), nullptr);
+  }
+
+  Error load_data_into(const char* key, void* buffer, size_t size)
+      const override {
+    const Entry* entry = find(key);
+    if (entry == nullptr) {
+      return Error::NotFound;
+    }
+    if (size < entry->data.size() * sizeof(float)) {
+      return Error::InvalidArgument;
+    }
+    std::memcpy(buffer, entry->data.data(), entry->data.size() * sizeof(float));
+    return Error::Ok;
+  }
+
+  Result<size_t> get_num_keys() const override {
+    return entries_.size();
+  }
+
+  Result<const char*> get_key(size_t index) const override {
+    if (index >= entries_.size()) {
+      return Error::InvalidArgument;
+    }
+    return entries_[index].key.c_str();
+  }
+
+ private:
+  static constexpr uint8_t kDimOrder[1] = {0};
+
+  const Entry* find(const char* key) const {
+    for (const Entry& entry : entries_) {
+      if (entry.key == key) {
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+  std::vector<Entry> entries_;
+};
+
+constexpr uint8_t InMemoryDataMap::kDimOrder[1];
+
+} // namespace
+
+class MergedDataMapTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Since these tests cause ET_LOG to be called, the PAL must be initialized
+    // first.
+    executorch::runtime::runtime_init();
+  }
+};
+
+TEST_F(MergedDataMapTest, LooksUpKeysInEachMap) {
+  InMemoryDataMap base({{"base.weight", {1, 2, 3}}, {"base.bias", {4}}});
+  InMemoryDataMap adapter({{"adapter.weight", {5, 6}}});
+  const NamedDataMap* maps[] = {&base, &adapter};
+  Result<MergedDataMap> merged = MergedDataMap::load(maps);
+  ASSERT_EQ(merged.error(), Error::Ok);
+
+  Result<size_t> num_keys = merged->get_num_keys();
+  ASSERT_EQ(num_keys.error(), Error::Ok);
+  EXPECT_EQ(num_keys.get(), 3);
+  EXPECT_STREQ(merged->get_key(0).get(), "base.weight");
+  EXPECT_STREQ(merged->get_key(1).get(), "base.bias");
+  EXPECT_STREQ(merged->get_key(2).get(), "adapter.weight");
+  EXPECT_EQ(merged->get_key(3).error(), Error::InvalidArgument);
+
+  Result<TensorLayout> layout = merged->get_metadata("adapter.weight");
+  ASSERT_EQ(layout.error(), Error::Ok);
+  EXPECT_EQ(layout->nbytes(), 2 * sizeof(float));
+  EXPECT_EQ(layout->sizes()[0], 2);
+
+  Result<FreeableBuffer> data = merged->get_data("base.weight");
+  ASSERT_EQ(data.error(), Error::Ok);
+  ASSERT_EQ(data->size(), 3 * sizeof(float));
+  EXPECT_EQ(static_cast<const float*>(data->data())[2], 3);
+
+  float buffer[2] = {};
+  ASSERT_EQ(
+      merged->load_data_into("adapter.weight", buffer, sizeof(buffer)),
+      Error::Ok);
+  EXPECT_EQ(buffer[0], 5);
+  EXPECT_EQ(buffer[1], 6);
+
+  EXPECT_EQ(merged->get_data("missing").error(), Error::NotFound);
+  EXPECT_EQ(merged->get_metadata("missing").error(), Error::NotFound);
+}
+
+TEST_F(MergedDataMapTest, DuplicateKeysFail) {
+  InMemoryDataMap base({{"weight", {1}}});
+  InMemoryDataMap other({{"weight", {2}}});
+  const NamedDataMap* maps[] = {&base, &other};
+  EXPECT_EQ(MergedDataMap::load(maps).error(), Error::InvalidArgument);
+}
+
+TEST_F(MergedDataMapTest, NullMapFails) {
+  InMemoryDataMap base({{"weight", {1}}});
+  const NamedDataMap* maps[] = {&base, nullptr};
+  EXPECT_EQ(MergedDataMap::load(maps).error(), Error::InvalidArgument);
+}
@@ -0,0 +1,18 @@
+load("@fbsource//xplat/executorch/build:runtime_wrapper.bzl", "runtime")
+
+def define_common_targets():
+    """Defines targets that should be shared between fbcode and xplat.
+
+    The directory containing this targets.bzl file should also contain both
+    TARGETS and BUCK files that call this function.
+    """
+
+    runtime.cxx_test(
+        name = "merged_data_map_test",
+        srcs = [
+            "merged_data_map_test.cpp",
+        ],
+        deps = [
+            "//executorch/extension/named_data_map:merged_data_map",
+        ],
+    )
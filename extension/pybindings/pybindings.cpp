@@ -8,6 +8,7 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
@@ -148,21 +149,146 @@ void setup_output_storage(
   for (size_t i = 0; i < output_storages.size(); ++i) {
     if (output_storages[i].size() == 0) {
       // Skip empty output storages, this would happen for non-tensor outputs
-      // and memory planned outputs.
+      // and memory planned outputs that the caller did not provide a buffer
+      // for.
       continue;
     }
-    Error output_status = method.set_output_data_ptr(
+    // Unlike set_output_data_ptr(), this also redirects memory planned
+    // outputs, which lets callers have them written to their own buffers.
+    Error output_status = method.bind_output(
         output_storages[i].data(), output_storages[i].size(), i);
-    // We already should be skipping non-tensor outputs, and memory planned
-    // outputs so any error is real.
+    if (output_status != Error::Ok &&
+        method.method_meta().output_tensor_meta(i)->is_memory_planned()) {
+      // Some memory planned outputs, like views and constants, can not be
+      // bound. They stay in their planned memory, and the caller copies them
+      // out of it instead.
+      continue;
+    }
+    // We already should be skipping non-tensor outputs so any error is real.
     THROW_IF_ERROR(
         output_status,
-        "set_output_data_ptr failed for output %zu with error 0x%" PRIx32,
+        "bind_output failed for output %zu with error 0x%" PRIx32,
         i,
         static_cast<uint32_t>(output_status));
   }
 }
 
+/// Returns true if `data` meets the alignment that Method requires to bind
+/// caller memory in place of a memory planned buffer.
+bool is_bindable(const void* data) {
+  return data != nullptr &&
+      reinterpret_cast<uintptr_t>(data) % Method::kIOBindingAlignment == 0;
+}
+
+/// Returns true if `python_obj` is a tensor that can be passed to or filled by
+/// a method without copying: a torch.Tensor, a NumPy array, or an object or
+/// capsule that implements the DLPack protocol.
+bool is_tensor_like(const py::handle& python_obj) {
+  const std::string& type_str = py::str(python_obj.get_type());
+  return type_str == "<class 'torch.Tensor'>" ||
+      type_str == "<class 'numpy.ndarray'>" ||
+      py::hasattr(python_obj, "__dlpack__") ||
+      PyCapsule_IsValid(python_obj.ptr(), "dltensor");
+}
+
+/// Returns an at::Tensor that shares the memory of `python_obj`, which must
+/// satisfy is_tensor_like(). `name` identifies the object in error messages.
+at::Tensor alias_tensor_like(
+    const py::handle& python_obj,
+    const std::string& name) {
+  const std::string& type_str = py::str(python_obj.get_type());
+  at::Tensor at_tensor;
+  if (type_str == "<class 'torch.Tensor'>") {
+    at_tensor = python_obj.cast<at::Tensor>();
+  } else {
+    // Let torch do the NumPy and DLPack conversions. Both alias the memory of
+    // the original object and keep it alive for as long as at_tensor.
+    auto torch = py::module_::import("torch");
+    const char* convert =
+        type_str == "<class 'numpy.ndarray'>" ? "from_numpy" : "from_dlpack";
+    at_tensor = torch.attr(convert)(python_obj).cast<at::Tensor>();
+  }
+  if (!at_tensor.device().is_cpu()) {
+    throw std::runtime_error(name + " is not a CPU tensor.");
+  }
+  // alias_etensor_to_attensor will assert on this later, so to better
+  // propogate up to python we check early and throw an exception.
+  if (!at_tensor.is_contiguous()) {
+    throw std::runtime_error(name + " is not contiguous.");
+  }
+  return at_tensor;
+}
+
+/// Returns an at::Tensor that shares the memory of `python_buffer`, after
+/// checking that it can hold output `output_idx` of `method`.
+at::Tensor alias_output_buffer(
+    const Method& method,
+    size_t output_idx,
+    const py::handle& python_buffer) {
+  const std::string name = "Output buffer " + std::to_string(output_idx);
+  auto meta = method.method_meta();
+  auto output_type = meta.output_tag(output_idx);
+  THROW_IF_ERROR(
+      output_type.error(),
+      "Failed to get output type for output %zu",
+      output_idx);
+  if (output_type.get() != Tag::Tensor) {
+    throw std::runtime_error(name + " must be None for a non-tensor output.");
+  }
+  if (!is_tensor_like(python_buffer)) {
+    throw std::runtime_error(name + " is not a tensor.");
+  }
+  const std::string& type_str = py::str(python_buffer.get_type());
+  if (type_str == "<class 'numpy.ndarray'>" &&
+      !python_buffer.attr("flags").attr("writeable").cast<bool>()) {
+    throw std::runtime_error(name + " is read-only.");
+  }
+  auto at_tensor = alias_tensor_like(python_buffer, name);
+
+  auto tensor_meta = meta.output_tensor_meta(output_idx);
+  THROW_IF_ERROR(
+      tensor_meta.error(),
+      "Failed to get output tensor meta for output %zu",
+      output_idx);
+#ifdef USE_ATEN_LIB
+  const auto type = at_tensor.scalar_type();
+#else
+  const auto type =
+      torch_to_executorch_scalar_type(at_tensor.options().dtype());
+#endif
+  if (type != tensor_meta.get().scalar_type()) {
+    throw std::runtime_error(name + " does not match the output dtype.");
+  }
+  if (at_tensor.nbytes() < tensor_meta.get().nbytes()) {
+    throw std::runtime_error(name + " is smaller than the output.");
+  }
+  return at_tensor;
+}
+
+/// Points the inputs and outputs of a method that are bound to caller memory
+/// back at the memory plan when it goes out of scope, so that no pointer from
+/// a call outlives it. Must be destroyed after the outputs have been copied.
+class IOBindingsReset final {
+ public:
+  explicit IOBindingsReset(Method& method) : method_(method) {}
+
+  ~IOBindingsReset() {
+    Error status = method_.reset_io_bindings();
+    if (status != Error::Ok) {
+      ET_LOG(
+          Error,
+          "Resetting the I/O bindings failed with error 0x%" PRIx32,
+          static_cast<uint32_t>(status));
+    }
+  }
+
+  IOBindingsReset(const IOBindingsReset&) = delete;
+  IOBindingsReset& operator=(const IOBindingsReset&) = delete;
+
+ private:
+  Method& method_;
+};
+
 class Module final {
  public:
   explicit Module(
@@ -245,21 +371,43 @@ class Module final {
   Module& operator=(Module&&) = default;
 
   /// Executes the specified method on the provided inputs and returns its
-  /// outputs.
+  /// outputs. Inputs and outputs may be left bound to the memory of `args`
+  /// and `output_storages`, until the method's reset_io_bindings() is called.
   std::vector<EValue> run_method(
       const std::string& method_name,
       const std::vector<EValue>& args,
       const std::optional<std::vector<Span<uint8_t>>>& output_storages =
           std::nullopt) {
     auto& method = get_method(method_name);
-    exec_aten::ArrayRef<EValue> input_evalue_list(args.data(), args.size());
 
-    Error set_inputs_status = method.set_inputs(input_evalue_list);
-    THROW_IF_ERROR(
-        set_inputs_status,
-        "method->set_inputs() for method '%s' failed with error 0x%" PRIx32,
-        method_name.c_str(),
-        static_cast<uint32_t>(set_inputs_status));
+    if (args.size() != method.inputs_size()) {
+      ET_LOG(
+          Error,
+          "The length of given input array (%zu) must be same as the number "
+          "of inputs in method (%zu).",
+          args.size(),
+          method.inputs_size());
+      THROW_IF_ERROR(
+          Error::InvalidArgument,
+          "method '%s' expects %zu inputs but got %zu",
+          method_name.c_str(),
+          method.inputs_size(),
+          args.size());
+    }
+    for (size_t i = 0; i < args.size(); ++i) {
+      // Point memory planned inputs at the caller's tensors instead of
+      // copying them in, unless their data is not aligned for it.
+      const bool bind = args[i].isTensor() &&
+          is_bindable(args[i].toTensor().const_data_ptr());
+      Error set_input_status =
+          bind ? method.bind_input(args[i], i) : method.set_input(args[i], i);
+      THROW_IF_ERROR(
+          set_input_status,
+          "setting input %zu for method '%s' failed with error 0x%" PRIx32,
+          i,
+          method_name.c_str(),
+          static_cast<uint32_t>(set_input_status));
+    }
 
 #ifdef USE_ATEN_LIB
     // [TLS handling] This is to workaround an assertion failure
@@ -668,7 +816,8 @@ struct PyModule final {
   py::list run_method(
       const std::string& method_name,
       const py::sequence& inputs,
-      bool clone_outputs = true) {
+      bool clone_outputs = true,
+      const py::object& output_buffers = py::none()) {
     const auto inputs_size = py::len(inputs);
     std::vector<EValue> cpp_inputs;
     cpp_inputs.reserve(inputs_size);
@@ -689,19 +838,20 @@ struct PyModule final {
     input_tensors.reserve(inputs_size);
 #endif
 
+    // Keeps the tensors that alias NumPy and DLPack inputs alive for
+    // Module->run_method.
+    std::vector<at::Tensor> input_at_tensors;
+    input_at_tensors.reserve(inputs_size);
+
     // Convert python objects into EValues.
     for (size_t i = 0; i < inputs_size; ++i) {
       auto python_input = inputs[i];
       const std::string& type_str = py::str(python_input.get_type());
-      if (type_str == "<class 'torch.Tensor'>") {
-        auto at_tensor = python_input.cast<at::Tensor>();
-        // alias_etensor_to_attensor will assert on this later, so to better
-        // propogate up to python we check early and throw an exception.
-        if (!at_tensor.is_contiguous()) {
-          auto error_msg = "Input " + std::to_string(i) + "for method " +
-              method_name + " is not contiguous.";
-          throw std::runtime_error(error_msg);
-        }
+      if (is_tensor_like(python_input)) {
+        input_at_tensors.push_back(alias_tensor_like(
+            python_input,
+            "Input " + std::to_string(i) + " for method " + method_name));
+        auto& at_tensor = input_at_tensors.back();
 
 #ifdef USE_ATEN_LIB
         EValue evalue(at_tensor);
@@ -749,7 +899,8 @@ struct PyModule final {
       }
     }
 
-    const auto& method = module_->get_method(method_name);
+    auto& method = module_->get_method(method_name);
+    IOBindingsReset reset_bindings(method);
     const auto num_outputs = method.outputs_size();
     output_storages_ = make_output_storages(method);
     std::vector<Span<uint8_t>> output_storage_spans(num_outputs);
@@ -757,15 +908,65 @@ struct PyModule final {
       output_storage_spans[i] =
           Span<uint8_t>(output_storages_[i].data(), output_storages_[i].size());
     }
+
+    // Have the method write tensor outputs straight into the caller's buffers
+    // where it can, and copy them over afterwards where it cannot.
+    std::vector<py::object> py_output_buffers;
+    std::vector<at::Tensor> output_at_tensors(num_outputs);
+    if (!output_buffers.is_none()) {
+      py_output_buffers = output_buffers.cast<std::vector<py::object>>();
+      if (py_output_buffers.size() != num_outputs) {
+        throw std::runtime_error(
+            "Expected " + std::to_string(num_outputs) + " output buffers for " +
+            method_name + " but got " +
+            std::to_string(py_output_buffers.size()));
+      }
+      for (size_t i = 0; i < num_outputs; ++i) {
+        if (py_output_buffers[i].is_none()) {
+          continue;
+        }
+        output_at_tensors[i] =
+            alias_output_buffer(method, i, py_output_buffers[i]);
+        auto& at_tensor = output_at_tensors[i];
+        if (is_bindable(at_tensor.data_ptr())) {
+          output_storage_spans[i] = Span<uint8_t>(
+              static_cast<uint8_t*>(at_tensor.data_ptr()), at_tensor.nbytes());
+        }
+      }
+    }
+
     auto outputs =
         module_->run_method(method_name, cpp_inputs, output_storage_spans);
 
-    // Retrieve outputs
-    return get_outputs_as_py_list(outputs, clone_outputs);
+    // Copy the outputs that could not be written to their buffers directly.
+    for (size_t i = 0; i < output_at_tensors.size(); ++i) {
+      auto& at_tensor = output_at_tensors[i];
+      if (!at_tensor.defined()) {
+        continue;
+      }
+      const auto& output = outputs[i].toTensor();
+      if (output.const_data_ptr() == at_tensor.data_ptr()) {
+        continue;
+      }
+      if (output.nbytes() > at_tensor.nbytes()) {
+        throw std::runtime_error(
+            "Output buffer " + std::to_string(i) + " for method " +
+            method_name + " is smaller than the output.");
+      }
+      std::memcpy(
+          at_tensor.data_ptr(), output.const_data_ptr(), output.nbytes());
+    }
+
+    // Retrieve outputs. This copies or aliases them before reset_bindings
+    // points the method away from the caller's memory.
+    return get_outputs_as_py_list(outputs, clone_outputs, py_output_buffers);
   }
 
-  py::list forward(const py::sequence& inputs, bool clone_outputs = true) {
-    return run_method("forward", inputs, clone_outputs);
+  py::list forward(
+      const py::sequence& inputs,
+      bool clone_outputs = true,
+      const py::object& output_buffers = py::none()) {
+    return run_method("forward", inputs, clone_outputs, output_buffers);
   }
 
   py::list forward_single_input(
@@ -870,12 +1071,16 @@ struct PyModule final {
 
   py::list get_outputs_as_py_list(
       const std::vector<EValue>& outputs,
-      bool clone_outputs = true) {
+      bool clone_outputs = true,
+      const std::vector<py::object>& output_buffers = {}) {
     const auto outputs_size = outputs.size();
     py::list list(outputs_size);
     for (size_t i = 0; i < outputs_size; ++i) {
       auto& v = outputs[i];
-      if (Tag::None == v.tag) {
+      if (i < output_buffers.size() && !output_buffers[i].is_none()) {
+        // Already holds the output.
+        list[i] = output_buffers[i];
+      } else if (Tag::None == v.tag) {
         list[i] = py::none();
       } else if (Tag::Int == v.tag) {
         list[i] = py::cast(v.toInt());
@@ -1062,12 +1267,14 @@ PYBIND11_MODULE(EXECUTORCH_PYTHON_MODULE_NAME, m) {
           py::arg("method_name"),
           py::arg("inputs") = py::list(),
           py::arg("clone_outputs") = true,
+          py::arg("output_buffers") = py::none(),
           call_guard)
       .def(
           "forward",
           &PyModule::forward,
           py::arg("inputs") = py::list(),
           py::arg("clone_outputs") = true,
+          py::arg("output_buffers") = py::none(),
           call_guard)
       .def("has_etdump", &PyModule::has_etdump, call_guard)
       .def(
@@ -1081,6 +1288,7 @@ PYBIND11_MODULE(EXECUTORCH_PYTHON_MODULE_NAME, m) {
           &PyModule::forward,
           py::arg("inputs") = py::list(),
           py::arg("clone_outputs") = true,
+          py::arg("output_buffers") = py::none(),
           call_guard)
       .def(
           "__call__",
@@ -27,25 +27,39 @@ class Verification(Enum):
 class ExecuTorchModule:
     """ExecuTorchModule is a Python wrapper around a C++ ExecuTorch program.
 
+    Tensor inputs may be torch tensors, NumPy arrays or DLPack tensors on the
+    CPU, and are passed to the program without copying when their data is
+    suitably aligned. ``output_buffers`` optionally gives a preallocated tensor
+    (or None) per output; the program writes tensor outputs into them and
+    returns them in place of new tensors. The program stops using the input
+    and output memory when the call returns.
+
     .. warning::
 
         This API is experimental and subject to change without notice.
     """
 
     # pyre-ignore[2, 3]: "Any" in parameter and return type annotations.
-    def __call__(self, inputs: Any, clone_outputs: bool = True) -> List[Any]: ...
+    def __call__(
+        self,
+        inputs: Any,
+        clone_outputs: bool = True,
+        output_buffers: Optional[Sequence[Any]] = None,
+    ) -> List[Any]: ...
     # pyre-ignore[2, 3]: "Any" in parameter and return type annotations.
     def run_method(
         self,
         method_name: str,
         inputs: Sequence[Any],  # pyre-ignore[2]: "Any" in parameter type annotations.
         clone_outputs: bool = True,
+        output_buffers: Optional[Sequence[Any]] = None,  # pyre-ignore[2]
     ) -> List[Any]: ...
     # pyre-ignore[2, 3]: "Any" in parameter and return type annotations.
     def forward(
         self,
         inputs: Sequence[Any],  # pyre-ignore[2]: "Any" in parameter type annotations.
         clone_outputs: bool = True,
+        output_buffers: Optional[Sequence[Any]] = None,  # pyre-ignore[2]
     ) -> List[Any]: ...
     # pyre-ignore[3]: "Any" in return type annotations.
     def plan_execute(self) -> List[Any]: ...
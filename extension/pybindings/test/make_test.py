@@ -305,6 +305,16 @@ def make_test(  # noqa: C901
             # The test module returns the state. Check that its value is correct.
             tester.assertEqual(str(torch.ones(2, 2)), str(executorch_output[1]))
 
+            # The constant output can not be bound to a buffer, so it is copied
+            # into it instead.
+            output_buffers = [torch.zeros(2, 2), torch.zeros(2, 2)]
+            executorch_output = executorch_module.forward(
+                (torch.ones(2, 2),), output_buffers=output_buffers
+            )
+            tester.assertIs(executorch_output[1], output_buffers[1])
+            tester.assertTrue(torch.allclose(expected, output_buffers[0]))
+            tester.assertTrue(torch.allclose(torch.ones(2, 2), output_buffers[1]))
+
         def test_method_meta(tester) -> None:
             exported_program, inputs = create_program(ModuleAdd())
 
@@ -382,6 +392,65 @@ def make_test(  # noqa: C901
 
                 tester.assertEqual(str(expected), str(executorch_output))
 
+        def test_numpy_and_dlpack_inputs(tester) -> None:
+            exported_program, inputs = create_program(ModuleAdd())
+            executorch_module = load_fn(exported_program.buffer)
+            expected = inputs[0] + inputs[1]
+
+            # NumPy arrays and DLPack capsules are aliased like torch tensors.
+            numpy_inputs = [t.numpy() for t in inputs]
+            executorch_output = executorch_module.forward(numpy_inputs)[0]
+            tester.assertTrue(torch.allclose(expected, executorch_output))
+
+            dlpack_inputs = [torch.utils.dlpack.to_dlpack(t) for t in inputs]
+            executorch_output = executorch_module.forward(dlpack_inputs)[0]
+            tester.assertTrue(torch.allclose(expected, executorch_output))
+
+            # Non-contiguous inputs are rejected rather than copied.
+            with tester.assertRaises(RuntimeError):
+                executorch_module.forward([t.t().numpy() for t in inputs])
+
+        def test_output_buffers(tester) -> None:
+            exported_program, inputs = create_program(ModuleAdd())
+            executorch_module = load_fn(exported_program.buffer)
+            expected = inputs[0] + inputs[1]
+
+            # The output is written to, and returned as, the given buffer.
+            output_buffer = torch.empty(2, 2)
+            executorch_output = executorch_module.forward(
+                inputs, output_buffers=[output_buffer]
+            )[0]
+            tester.assertIs(executorch_output, output_buffer)
+            tester.assertTrue(torch.allclose(expected, output_buffer))
+
+            numpy_buffer = torch.zeros(2, 2).numpy()
+            executorch_output = executorch_module.run_method(
+                "forward", inputs, output_buffers=[numpy_buffer]
+            )[0]
+            tester.assertIs(executorch_output, numpy_buffer)
+            tester.assertTrue(torch.allclose(expected, torch.from_numpy(numpy_buffer)))
+
+            # Later calls without buffers leave the earlier ones untouched.
+            executorch_output = executorch_module.forward(
+                (torch.zeros(2, 2), torch.zeros(2, 2))
+            )[0]
+            tester.assertTrue(torch.allclose(torch.zeros(2, 2), executorch_output))
+            tester.assertTrue(torch.allclose(expected, output_buffer))
+
+            # Bindings end with the call that made them, so executing the method
+            # on its current inputs does not write to the buffer either.
+            executorch_module.forward(inputs, output_buffers=[output_buffer])
+            output_buffer.zero_()
+            executorch_module.plan_execute("forward")
+            tester.assertTrue(torch.allclose(torch.zeros(2, 2), output_buffer))
+
+            with tester.assertRaises(RuntimeError):
+                executorch_module.forward(
+                    inputs, output_buffers=[torch.empty(2, 2, dtype=torch.int32)]
+                )
+            with tester.assertRaises(RuntimeError):
+                executorch_module.forward(inputs, output_buffers=[torch.empty(1)])
+
         ######### RUN TEST CASES #########
         test_e2e(tester)
         test_multiple_entry(tester)
@@ -394,5 +463,7 @@ def make_test(  # noqa: C901
         test_method_meta(tester)
         test_bad_name(tester)
         test_verification_config(tester)
+        test_numpy_and_dlpack_inputs(tester)
+        test_output_buffers(tester)
 
     return wrapper
@@ -13,6 +13,8 @@ def define_common_targets():
         deps = [
             "//executorch/extension/training/module:training_module",
             "//executorch/extension/tensor:tensor",
+            "//executorch/extension/training/optimizer:adam",
+            "//executorch/extension/training/optimizer:gradient_accumulator",
             "//executorch/extension/training/optimizer:sgd",
             "//executorch/runtime/executor:program",
             "//executorch/extension/data_loader:file_data_loader",
@@ -9,19 +9,31 @@
 #include <executorch/extension/data_loader/file_data_loader.h>
 #include <executorch/extension/tensor/tensor.h>
 #include <executorch/extension/training/module/training_module.h>
+#include <executorch/extension/training/optimizer/adam.h>
+#include <executorch/extension/training/optimizer/gradient_accumulator.h>
 #include <executorch/extension/training/optimizer/sgd.h>
 #include <gflags/gflags.h>
+#include <chrono>
 #include <random>
 
 #pragma clang diagnostic ignored \
     "-Wbraced-scalar-init" // {0} below upsets clang.
 
 using executorch::extension::FileDataLoader;
+using executorch::extension::training::optimizer::Adam;
+using executorch::extension::training::optimizer::AdamOptions;
+using executorch::extension::training::optimizer::GradientAccumulator;
 using executorch::extension::training::optimizer::SGD;
 using executorch::extension::training::optimizer::SGDOptions;
 using executorch::runtime::Error;
 using executorch::runtime::Result;
 DEFINE_string(model_path, "xor.pte", "Model serialized in flatbuffer format.");
+DEFINE_string(optimizer, "sgd", "Optimizer to train with: sgd, adam or adamw.");
+DEFINE_int32(num_epochs, 5000, "Number of optimizer steps to take.");
+DEFINE_int32(
+    accumulation_steps,
+    1,
+    "Number of samples whose gradients are averaged for each step.");
 
 int main(int argc, char** argv) {
   gflags::ParseCommandLineFlags(&argc, &argv, true);
@@ -73,8 +85,23 @@ int main(int argc, char** argv) {
     return 1;
   }
 
-  SGDOptions options{0.1};
-  SGD optimizer(param_res.get(), options);
+  std::unique_ptr<SGD> sgd;
+  std::unique_ptr<Adam> adam;
+  if (FLAGS_optimizer == "sgd") {
+    sgd = std::make_unique<SGD>(param_res.get(), SGDOptions{0.1});
+  } else if (FLAGS_optimizer == "adam") {
+    adam = std::make_unique<Adam>(param_res.get(), AdamOptions{0.01});
+  } else if (FLAGS_optimizer == "adamw") {
+    adam = std::make_unique<Adam>(param_res.get(), AdamOptions::adamw(0.01));
+  } else {
+    ET_LOG(Error, "Unknown optimizer: %s", FLAGS_optimizer.c_str());
+    return 1;
+  }
+  if (FLAGS_num_epochs <= 0 || FLAGS_accumulation_steps <= 0) {
+    ET_LOG(Error, "num_epochs and accumulation_steps must be positive");
+    return 1;
+  }
+  GradientAccumulator accumulator;
 
   // Randomness to sample the data set.
   std::default_random_engine URBG{std::random_device{}()};
@@ -82,27 +109,68 @@ int main(int argc, char** argv) {
       0, static_cast<int>(data_set.size()) - 1};
 
   // Train the model.
-  size_t num_epochs = 5000;
+  const int num_epochs = FLAGS_num_epochs;
+  const int accumulation_steps = FLAGS_accumulation_steps;
+  const auto start = std::chrono::steady_clock::now();
   for (int i = 0; i < num_epochs; i++) {
-    int index = dist(URBG);
-    auto& data = data_set[index];
-    const auto& results =
-        mod.execute_forward_backward("forward", {*data.first, *data.second});
-    if (results.error() != Error::Ok) {
-      ET_LOG(Error, "Failed to execute forward_backward");
-      return 1;
+    int index = 0;
+    float loss = 0;
+    int64_t prediction = 0;
+    for (int micro_step = 0; micro_step < accumulation_steps; micro_step++) {
+      index = dist(URBG);
+      auto& data = data_set[index];
+      const auto& results =
+          mod.execute_forward_backward("forward", {*data.first, *data.second});
+      if (results.error() != Error::Ok) {
+        ET_LOG(Error, "Failed to execute forward_backward");
+        return 1;
+      }
+      loss = results.get()[0].toTensor().const_data_ptr<float>()[0];
+      prediction = results.get()[1].toTensor().const_data_ptr<int64_t>()[0];
+      if (accumulation_steps > 1) {
+        // Average over the micro-batches.
+        Error err = accumulator.accumulate(
+            mod.named_gradients("forward").get(), 1.0 / accumulation_steps);
+        if (err != Error::Ok) {
+          ET_LOG(Error, "Failed to accumulate gradients");
+          return 1;
+        }
+      }
     }
+    auto& data = data_set[index];
     if (i % 500 == 0 || i == num_epochs - 1) {
       ET_LOG(
           Info,
           "Step %d, Loss %f, Input [%.0f, %.0f], Prediction %ld, Label %ld",
           i,
-          results.get()[0].toTensor().const_data_ptr<float>()[0],
+          loss,
           data.first->const_data_ptr<float>()[0],
           data.first->const_data_ptr<float>()[1],
-          results.get()[1].toTensor().const_data_ptr<int64_t>()[0],
+          prediction,
           data.second->const_data_ptr<int64_t>()[0]);
     }
-    optimizer.step(mod.named_gradients("forward").get());
+    auto grad_res = mod.named_gradients("forward");
+    if (grad_res.error() != Error::Ok) {
+      ET_LOG(Error, "Failed to get named gradients");
+      return 1;
+    }
+    const auto& named_gradients =
+        accumulation_steps > 1 ? accumulator.named_gradients() : grad_res.get();
+    Error err = sgd ? sgd->step(named_gradients) : adam->step(named_gradients);
+    if (err != Error::Ok) {
+      ET_LOG(Error, "Failed to take an optimizer step");
+      return 1;
+    }
+    accumulator.zero();
   }
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  ET_LOG(
+      Info,
+      "Trained %d steps with %s in %.3f s: %.1f steps/s, %.1f samples/s",
+      num_epochs,
+      FLAGS_optimizer.c_str(),
+      elapsed.count(),
+      num_epochs / elapsed.count(),
+      static_cast<double>(num_epochs) * accumulation_steps / elapsed.count());
 }
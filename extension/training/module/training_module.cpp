@@ -86,6 +86,14 @@ TrainingModule::execute_forward_backward(
 
 runtime::Result<const std::map<exec_aten::string_view, exec_aten::Tensor>>
 TrainingModule::named_parameters(const std::string& method_name) {
+  // The parameter outputs alias the method's own buffers, so the map stays
+  // valid for the lifetime of the loaded method and only needs to be built
+  // once instead of re-executing the helper methods every step.
+  auto cached = method_named_parameters_.find(method_name);
+  if (cached != method_named_parameters_.end()) {
+    return cached->second;
+  }
+
   std::map<exec_aten::string_view, exec_aten::Tensor> named_parameters;
   const std::string fqn_method_name = fqn_method_prefix + method_name;
   const std::string parameters_method_name =
@@ -121,7 +129,9 @@ TrainingModule::named_parameters(const std::string& method_name) {
     exec_aten::Tensor param = method->get_output(param_index).toTensor();
     named_parameters.insert({fqn, param});
   }
-  return named_parameters;
+  return method_named_parameters_
+      .insert({method_name, std::move(named_parameters)})
+      .first->second;
 }
 
 runtime::Result<const std::map<exec_aten::string_view, exec_aten::Tensor>>
@@ -38,7 +38,8 @@ class ET_EXPERIMENTAL TrainingModule final : executorch::extension::Module {
             std::move(memory_allocator),
             std::move(temp_allocator),
             std::move(event_tracer)),
-        method_named_gradients_({}) {}
+        method_named_gradients_({}),
+        method_named_parameters_({}) {}
 
   explicit TrainingModule(const Module&) = delete;
   TrainingModule& operator=(const Module&) = delete;
@@ -68,7 +69,8 @@ class ET_EXPERIMENTAL TrainingModule final : executorch::extension::Module {
    * parameters for.
    *
    * @returns A Result object containing a map of the fully qualified name to
-   * parameter tensor, or an error if the method is not a joint graph.
+   * parameter tensor, or an error if the method is not a joint graph. The map
+   * is built on the first call and cached for subsequent ones.
    */
   ET_EXPERIMENTAL
   runtime::Result<
@@ -96,6 +98,10 @@ class ET_EXPERIMENTAL TrainingModule final : executorch::extension::Module {
       std::string,
       std::map<executorch::aten::string_view, executorch::aten::Tensor>>
       method_named_gradients_;
+  std::unordered_map<
+      std::string,
+      std::map<executorch::aten::string_view, executorch::aten::Tensor>>
+      method_named_parameters_;
 };
 
 } // namespace training
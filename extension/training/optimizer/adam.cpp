@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/extension/training/optimizer/adam.h>
+
+#include <cmath>
+
+#include <executorch/extension/training/optimizer/optimizer_util.h>
+#include <executorch/kernels/portable/cpu/util/parallel_util.h>
+#include <executorch/runtime/core/error.h>
+
+using exec_aten::Tensor;
+using ::executorch::runtime::Error;
+
+namespace executorch {
+namespace extension {
+namespace training {
+namespace optimizer {
+
+namespace {
+
+/**
+ * Updates `param` in place with step number `step` (starting at 1) of Adam,
+ * in a single pass over its elements.
+ */
+void fused_adam_step(
+    float* param,
+    const float* grad,
+    float* exp_avg,
+    float* exp_avg_sq,
+    int64_t numel,
+    int64_t step,
+    const AdamOptions& options) {
+  const float beta1 = static_cast<float>(options.beta1());
+  const float beta2 = static_cast<float>(options.beta2());
+  const float eps = static_cast<float>(options.eps());
+  const bool decoupled = options.decoupled_weight_decay();
+  // AdamW decays the parameter directly; Adam adds the decay to the gradient.
+  const float grad_decay =
+      decoupled ? 0.0f : static_cast<float>(options.weight_decay());
+  const float param_scale = decoupled
+      ? static_cast<float>(1 - options.lr() * options.weight_decay())
+      : 1.0f;
+  // Fold the bias corrections into per-step scalars.
+  const double bias_correction1 = 1 - std::pow(options.beta1(), step);
+  const double bias_correction2 = 1 - std::pow(options.beta2(), step);
+  const float step_size = static_cast<float>(options.lr() / bias_correction1);
+  const float inv_sqrt_bias_correction2 =
+      static_cast<float>(1 / std::sqrt(bias_correction2));
+  torch::executor::native::utils::parallel_for(
+      0,
+      numel,
+      torch::executor::native::utils::kParallelGrainSize,
+      [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+          const float p = param[i] * param_scale;
+          const float g = grad[i] + grad_decay * param[i];
+          const float m = beta1 * exp_avg[i] + (1 - beta1) * g;
+          const float v = beta2 * exp_avg_sq[i] + (1 - beta2) * g * g;
+          exp_avg[i] = m;
+          exp_avg_sq[i] = v;
+          const float denom = std::sqrt(v) * inv_sqrt_bias_correction2 + eps;
+          param[i] = p - step_size * m / denom;
+        }
+      });
+}
+
+} // namespace
+
+bool AdamParamGroup::has_options() const {
+  return options_ != nullptr;
+}
+
+AdamOptions& AdamParamGroup::options() {
+  return *options_.get();
+}
+
+const AdamOptions& AdamParamGroup::options() const {
+  return *options_.get();
+}
+
+void AdamParamGroup::set_options(std::unique_ptr<AdamOptions> options) {
+  options_ = std::move(options);
+}
+
+const std::map<exec_aten::string_view, exec_aten::Tensor>&
+AdamParamGroup::named_parameters() const {
+  return named_parameters_;
+}
+
+void Adam::add_param_group(const AdamParamGroup& param_group) {
+  AdamParamGroup param_group_(param_group.named_parameters());
+  if (!param_group.has_options()) {
+    param_group_.set_options(defaults_->clone());
+  } else {
+    param_group_.set_options(param_group.options().clone());
+  }
+  // Reserve the running averages now so that step() doesn't allocate. They
+  // start at zero.
+  for (const auto& param : param_group_.named_parameters()) {
+    const void* key = param.second.unsafeGetTensorImpl();
+    if (state_.find(key) == state_.end()) {
+      state_[key] = {state_arena_.size(), 0};
+      state_arena_.resize(state_arena_.size() + 2 * param.second.numel());
+    }
+  }
+  param_groups_.emplace_back(std::move(param_group_));
+}
+
+Error Adam::step(const std::map<exec_aten::string_view, exec_aten::Tensor>&
+                     named_gradients) {
+  for (auto& group : param_groups_) {
+    const auto& options = group.options();
+    for (const auto& param : group.named_parameters()) {
+      const auto& named_gradient = named_gradients.find(param.first);
+      if (named_gradient == named_gradients.end()) {
+        continue;
+      }
+      const Tensor& p = param.second;
+      const Tensor& d_p = named_gradient->second;
+      Error err = internal::check_param_and_grad(param.first, p, d_p);
+      if (err != Error::Ok) {
+        return err;
+      }
+      ParamState& state = state_.at(p.unsafeGetTensorImpl());
+      state.step++;
+      float* exp_avg = state_arena_.data() + state.offset;
+      fused_adam_step(
+          p.mutable_data_ptr<float>(),
+          d_p.const_data_ptr<float>(),
+          exp_avg,
+          exp_avg + p.numel(),
+          p.numel(),
+          state.step,
+          options);
+    }
+  }
+  return Error::Ok;
+}
+
+} // namespace optimizer
+} // namespace training
+} // namespace extension
+} // namespace executorch
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+/**
+ * Adam and AdamW optimizers to perform on-device training. These adapt the
+ * step size of each parameter using running averages of its gradient and of
+ * the gradient's square.
+ *
+ * Like SGD, each parameter is updated in a single fused pass over its
+ * elements, split across the threadpool when built with ET_USE_THREADPOOL,
+ * and the optimizer state lives in one arena that is allocated when param
+ * groups are added, not during step().
+ */
+#pragma once
+
+#include <executorch/runtime/core/error.h>
+#include <executorch/runtime/core/exec_aten/exec_aten.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace executorch {
+namespace extension {
+namespace training {
+namespace optimizer {
+
+/**
+ * Adam optimizer options. This contains options for performing training on a
+ * param group, such as the learning rate.
+ */
+class ET_EXPERIMENTAL AdamOptions {
+ public:
+  /**
+   * Constructs a new Adam optimizer options.
+   *
+   * @param[in] lr The learning rate.
+   * @param[in] beta1 The decay rate of the running average of the gradient.
+   * @param[in] beta2 The decay rate of the running average of the squared
+   *   gradient.
+   * @param[in] eps A term added to the denominator of the update to improve
+   *   numerical stability.
+   * @param[in] weight_decay The weight decay value.
+   * @param[in] decoupled_weight_decay If false (Adam), the weight decay is
+   *   added to the gradient, so it is scaled by the adaptive step size like
+   *   the rest of it. If true (AdamW), the parameter is decayed directly by
+   *   `lr * weight_decay` before the update.
+   */
+  explicit AdamOptions(
+      double lr = 1e-3,
+      double beta1 = 0.9,
+      double beta2 = 0.999,
+      double eps = 1e-8,
+      double weight_decay = 0,
+      bool decoupled_weight_decay = false)
+      : lr_(lr),
+        beta1_(beta1),
+        beta2_(beta2),
+        eps_(eps),
+        weight_decay_(weight_decay),
+        decoupled_weight_decay_(decoupled_weight_decay) {}
+
+  /// Returns AdamW options, which decouple the weight decay.
+  static AdamOptions adamw(
+      double lr = 1e-3,
+      double beta1 = 0.9,
+      double beta2 = 0.999,
+      double eps = 1e-8,
+      double weight_decay = 1e-2) {
+    return AdamOptions(lr, beta1, beta2, eps, weight_decay, true);
+  }
+
+  std::unique_ptr<AdamOptions> clone() const {
+    return std::make_unique<AdamOptions>(*this);
+  }
+
+  double lr() const {
+    return lr_;
+  }
+
+  double beta1() const {
+    return beta1_;
+  }
+
+  double beta2() const {
+    return beta2_;
+  }
+
+  double eps() const {
+    return eps_;
+  }
+
+  double weight_decay() const {
+    return weight_decay_;
+  }
+
+  bool decoupled_weight_decay() const {
+    return decoupled_weight_decay_;
+  }
+
+ private:
+  double lr_;
+  double beta1_;
+  double beta2_;
+  double eps_;
+  double weight_decay_;
+  bool decoupled_weight_decay_;
+};
+
+/**
+ * Adam optimizer param group. This contains the parameters and the
+ * AdamOptions associated to it.
+ */
+class ET_EXPERIMENTAL AdamParamGroup {
+ public:
+  // NOTE: In order to store `AdamParamGroup` in a `std::vector`, it has
+  // to be copy-constructible.
+  AdamParamGroup(const AdamParamGroup& param_group)
+      : named_parameters_(param_group.named_parameters()),
+        options_(
+            param_group.has_options() ? param_group.options().clone()
+                                      : nullptr) {}
+  AdamParamGroup& operator=(const AdamParamGroup& param_group) {
+    this->named_parameters_ = param_group.named_parameters_;
+    this->options_ =
+        param_group.has_options() ? param_group.options().clone() : nullptr;
+    return *this;
+  }
+
+  /**
+   * Constructs an Adam param group.
+   *
+   * @param[in] named_parameters The parameters to be optimized and their fully
+   * qualified names.
+   */
+  /* implicit */ AdamParamGroup(
+      const std::map<executorch::aten::string_view, executorch::aten::Tensor>&
+          named_parameters)
+      : named_parameters_(named_parameters) {}
+  AdamParamGroup(
+      const std::map<executorch::aten::string_view, executorch::aten::Tensor>&
+          named_parameters,
+      std::unique_ptr<AdamOptions> options)
+      : named_parameters_(named_parameters), options_(std::move(options)) {}
+
+  bool has_options() const;
+  AdamOptions& options();
+  const AdamOptions& options() const;
+  void set_options(std::unique_ptr<AdamOptions> options);
+  const std::map<executorch::aten::string_view, executorch::aten::Tensor>&
+  named_parameters() const;
+
+ private:
+  std::map<executorch::aten::string_view, executorch::aten::Tensor>
+      named_parameters_;
+  std::unique_ptr<AdamOptions> options_;
+};
+
+/**
+ * Adam optimizer class. This is responsible for performing the optimization
+ * step. Use AdamOptions::adamw() for AdamW.
+ */
+class ET_EXPERIMENTAL Adam {
+ public:
+  explicit Adam(
+      const std::vector<AdamParamGroup>& param_groups,
+      AdamOptions defaults)
+      : defaults_(std::make_unique<AdamOptions>(defaults)) {
+    for (const auto& param_group : param_groups) {
+      add_param_group(param_group);
+    }
+  }
+
+  explicit Adam(
+      const std::map<executorch::aten::string_view, executorch::aten::Tensor>&
+          named_parameters,
+      AdamOptions defaults)
+      : Adam({AdamParamGroup(named_parameters)}, defaults) {}
+
+  // Adds the given param_group to the optimizer's param_group list.
+  void add_param_group(const AdamParamGroup& param_group);
+
+  /**
+   * Performs the optimization step.
+   *
+   * @param[in] named_gradients The gradients of the tensors specified by the
+   * fully qualified name. They are not modified.
+   *
+   * @returns Error::Ok on success, or Error::InvalidArgument if a parameter or
+   * its gradient is not a float tensor, or their sizes differ.
+   */
+  ::executorch::runtime::Error step(
+      const std::map<executorch::aten::string_view, executorch::aten::Tensor>&
+          named_gradients);
+
+ private:
+  /// Where the state of a parameter lives in state_arena_: the running average
+  /// of the gradient at `offset`, followed by the running average of its
+  /// square.
+  struct ParamState {
+    size_t offset;
+    /// The number of steps taken so far, for bias correction.
+    int64_t step;
+  };
+
+  std::vector<AdamParamGroup> param_groups_;
+  /// Keyed by the TensorImpl of the parameter.
+  std::unordered_map<const void*, ParamState> state_;
+  std::vector<float> state_arena_;
+  std::unique_ptr<AdamOptions> defaults_;
+};
+
+} // namespace optimizer
+} // namespace training
+} // namespace extension
+} // namespace executorch
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/extension/training/optimizer/gradient_accumulator.h>
+
+#include <algorithm>
+
+#include <executorch/extension/training/optimizer/optimizer_util.h>
+#include <executorch/kernels/portable/cpu/util/parallel_util.h>
+
+using exec_aten::Tensor;
+using ::executorch::runtime::Error;
+
+namespace executorch {
+namespace extension {
+namespace training {
+namespace optimizer {
+
+Error GradientAccumulator::allocate(
+    const std::map<exec_aten::string_view, exec_aten::Tensor>&
+        named_gradients) {
+  size_t total_numel = 0;
+  for (const auto& named_gradient : named_gradients) {
+    const Tensor& grad = named_gradient.second;
+    Error err =
+        internal::check_param_and_grad(named_gradient.first, grad, grad);
+    if (err != Error::Ok) {
+      return err;
+    }
+    total_numel += grad.numel();
+  }
+  arena_.assign(total_numel, 0.0f);
+
+  size_t offset = 0;
+  for (const auto& named_gradient : named_gradients) {
+    const Tensor& grad = named_gradient.second;
+    std::vector<exec_aten::SizesType> sizes(
+        grad.sizes().begin(), grad.sizes().end());
+    tensors_.push_back(make_tensor_ptr(
+        std::move(sizes),
+        arena_.data() + offset,
+        exec_aten::ScalarType::Float,
+        exec_aten::TensorShapeDynamism::STATIC));
+    named_gradients_.insert({named_gradient.first, *tensors_.back()});
+    offset += grad.numel();
+  }
+  return Error::Ok;
+}
+
+Error GradientAccumulator::accumulate(
+    const std::map<exec_aten::string_view, exec_aten::Tensor>& named_gradients,
+    double scale) {
+  if (named_gradients_.empty()) {
+    Error err = allocate(named_gradients);
+    if (err != Error::Ok) {
+      return err;
+    }
+  }
+  const float alpha = static_cast<float>(scale);
+  for (const auto& named_gradient : named_gradients) {
+    const auto& sum = named_gradients_.find(named_gradient.first);
+    ET_CHECK_OR_RETURN_ERROR(
+        sum != named_gradients_.end(),
+        InvalidArgument,
+        "Gradient %.*s was not in the first accumulate() call",
+        static_cast<int>(named_gradient.first.size()),
+        named_gradient.first.data());
+    Error err = internal::check_param_and_grad(
+        named_gradient.first, sum->second, named_gradient.second);
+    if (err != Error::Ok) {
+      return err;
+    }
+    float* out = sum->second.mutable_data_ptr<float>();
+    const float* grad = named_gradient.second.const_data_ptr<float>();
+    torch::executor::native::utils::parallel_for(
+        0,
+        sum->second.numel(),
+        torch::executor::native::utils::kParallelGrainSize,
+        [&](int64_t begin, int64_t end) {
+          for (int64_t i = begin; i < end; ++i) {
+            out[i] += alpha * grad[i];
+          }
+        });
+  }
+  num_accumulated_++;
+  return Error::Ok;
+}
+
+void GradientAccumulator::zero() {
+  std::fill(arena_.begin(), arena_.end(), 0.0f);
+  num_accumulated_ = 0;
+}
+
+} // namespace optimizer
+} // namespace training
+} // namespace extension
+} // namespace executorch
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+/**
+ * Sums gradients across micro-batches, so that a model can train with a
+ * larger effective batch than fits in memory for one forward_backward call.
+ */
+#pragma once
+
+#include <executorch/extension/tensor/tensor_ptr.h>
+#include <executorch/runtime/core/error.h>
+#include <executorch/runtime/core/exec_aten/exec_aten.h>
+#include <cstddef>
+#include <map>
+#include <vector>
+
+namespace executorch {
+namespace extension {
+namespace training {
+namespace optimizer {
+
+/**
+ * Accumulates named gradients into buffers of its own, since a method
+ * overwrites its gradient outputs on every execution.
+ *
+ * Typical use, with N micro-batches per optimizer step:
+ *
+ *   for (each micro-batch) {
+ *     module.execute_forward_backward("forward", inputs);
+ *     accumulator.accumulate(module.named_gradients("forward").get(), 1.0 / N);
+ *   }
+ *   optimizer.step(accumulator.named_gradients());
+ *   accumulator.zero();
+ */
+class ET_EXPERIMENTAL GradientAccumulator {
+ public:
+  GradientAccumulator() = default;
+
+  /**
+   * Adds `scale` times each gradient to the accumulated gradient of the same
+   * name.
+   *
+   * The first call allocates a buffer for each of its gradients in a single
+   * arena. Later calls may only pass gradients of those names and sizes.
+   *
+   * @param[in] named_gradients The gradients to add. The keys must outlive
+   *     this accumulator.
+   * @param[in] scale The factor to apply to the gradients, e.g. one over the
+   *     number of micro-batches to average them.
+   *
+   * @returns Error::Ok on success, or Error::InvalidArgument if a gradient is
+   * not a float tensor, or does not match the first call.
+   */
+  ::executorch::runtime::Error accumulate(
+      const std::map<executorch::aten::string_view, executorch::aten::Tensor>&
+          named_gradients,
+      double scale = 1.0);
+
+  /**
+   * Returns the accumulated gradients, to pass to an optimizer's step().
+   * Empty until the first call to accumulate().
+   */
+  const std::map<executorch::aten::string_view, executorch::aten::Tensor>&
+  named_gradients() const {
+    return named_gradients_;
+  }
+
+  /// Returns the number of accumulate() calls since the last zero().
+  size_t num_accumulated() const {
+    return num_accumulated_;
+  }
+
+  /// Zeroes the accumulated gradients, keeping their buffers.
+  void zero();
+
+ private:
+  // The tensors point into arena_, so copies would alias it.
+  GradientAccumulator(const GradientAccumulator&) = delete;
+  GradientAccumulator& operator=(const GradientAccumulator&) = delete;
+
+  /// Allocates a zeroed buffer for each of `named_gradients`.
+  ::executorch::runtime::Error allocate(
+      const std::map<executorch::aten::string_view, executorch::aten::Tensor>&
+          named_gradients);
+
+  std::vector<float> arena_;
+  std::vector<TensorPtr> tensors_;
+  std::map<executorch::aten::string_view, executorch::aten::Tensor>
+      named_gradients_;
+  size_t num_accumulated_ = 0;
+};
+
+} // namespace optimizer
+} // namespace training
+} // namespace extension
+} // namespace executorch
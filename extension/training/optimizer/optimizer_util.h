@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+/**
+ * Helpers shared by the optimizers' fused update steps.
+ */
+#pragma once
+
+#include <executorch/runtime/core/error.h>
+#include <executorch/runtime/core/exec_aten/exec_aten.h>
+
+namespace executorch {
+namespace extension {
+namespace training {
+namespace optimizer {
+namespace internal {
+
+/**
+ * Checks that an optimizer can update `param` with `grad`: the fused steps
+ * only handle float tensors, and treat both as flat arrays of the same length.
+ */
+inline ::executorch::runtime::Error check_param_and_grad(
+    executorch::aten::string_view name,
+    const executorch::aten::Tensor& param,
+    const executorch::aten::Tensor& grad) {
+  ET_CHECK_OR_RETURN_ERROR(
+      param.scalar_type() == executorch::aten::ScalarType::Float &&
+          grad.scalar_type() == executorch::aten::ScalarType::Float,
+      InvalidArgument,
+      "Parameter %.*s: only float parameters and gradients are supported",
+      static_cast<int>(name.size()),
+      name.data());
+  ET_CHECK_OR_RETURN_ERROR(
+      param.numel() == grad.numel(),
+      InvalidArgument,
+      "Parameter %.*s has %zd elements but its gradient has %zd",
+      static_cast<int>(name.size()),
+      name.data(),
+      static_cast<ssize_t>(param.numel()),
+      static_cast<ssize_t>(grad.numel()));
+  return ::executorch::runtime::Error::Ok;
+}
+
+} // namespace internal
+} // namespace optimizer
+} // namespace training
+} // namespace extension
+} // namespace executorch
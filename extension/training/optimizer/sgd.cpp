@@ -8,10 +8,11 @@
 
 #include <executorch/extension/training/optimizer/sgd.h>
 
+#include <executorch/extension/training/optimizer/optimizer_util.h>
+#include <executorch/kernels/portable/cpu/util/parallel_util.h>
 #include <executorch/runtime/core/error.h>
 
 using exec_aten::Tensor;
-using exec_aten::TensorImpl;
 using ::executorch::runtime::Error;
 
 namespace executorch {
@@ -20,34 +21,43 @@ namespace training {
 namespace optimizer {
 
 namespace {
-void add_out_hack(
-    const Tensor& a,
-    const Tensor& b,
-    const double alpha,
-    Tensor& out) {
-  auto a_ptr = a.const_data_ptr<float>();
-  auto b_ptr = b.const_data_ptr<float>();
-  auto out_ptr = out.mutable_data_ptr<float>();
-  for (size_t i = 0; i < a.numel(); ++i) {
-    out_ptr[i] = a_ptr[i] + b_ptr[i] * alpha;
-  }
-}
 
-void mul_out_hack(const Tensor& a, const double alpha, Tensor& out) {
-  auto a_ptr = a.const_data_ptr<float>();
-  auto out_ptr = out.mutable_data_ptr<float>();
-  for (size_t i = 0; i < a.numel(); ++i) {
-    out_ptr[i] = a_ptr[i] * alpha;
-  }
+/**
+ * Updates `param` in place with one SGD step, in a single pass over its
+ * elements. `momentum_buffer` is null when the group has no momentum.
+ */
+void fused_sgd_step(
+    float* param,
+    const float* grad,
+    float* momentum_buffer,
+    bool momentum_initialized,
+    int64_t numel,
+    const SGDOptions& options) {
+  const float lr = static_cast<float>(options.lr());
+  const float momentum = static_cast<float>(options.momentum());
+  const float dampening = static_cast<float>(options.dampening());
+  const float weight_decay = static_cast<float>(options.weight_decay());
+  const bool nesterov = options.nesterov();
+  torch::executor::native::utils::parallel_for(
+      0,
+      numel,
+      torch::executor::native::utils::kParallelGrainSize,
+      [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+          float d_p = grad[i] + weight_decay * param[i];
+          if (momentum_buffer != nullptr) {
+            // The first step starts the momentum at the gradient.
+            const float buf = momentum_initialized
+                ? momentum * momentum_buffer[i] + (1 - dampening) * d_p
+                : d_p;
+            momentum_buffer[i] = buf;
+            d_p = nesterov ? d_p + momentum * buf : buf;
+          }
+          param[i] -= lr * d_p;
+        }
+      });
 }
 
-void clone_out_hack(const Tensor& a, Tensor& out) {
-  auto a_ptr = a.const_data_ptr<float>();
-  auto out_ptr = out.mutable_data_ptr<float>();
-  for (size_t i = 0; i < a.numel(); ++i) {
-    out_ptr[i] = a_ptr[i];
-  }
-}
 } // namespace
 
 bool SGDParamGroup::has_options() const {
@@ -78,91 +88,57 @@ void SGD::add_param_group(const SGDParamGroup& param_group) {
   } else {
     param_group_.set_options(param_group.options().clone());
   }
+  // Reserve the momentum buffers now so that step() doesn't allocate.
+  if (param_group_.options().momentum() != 0) {
+    for (const auto& param : param_group_.named_parameters()) {
+      const void* key = param.second.unsafeGetTensorImpl();
+      if (momentum_state_.find(key) == momentum_state_.end()) {
+        momentum_state_[key] = {momentum_arena_.size(), false};
+        momentum_arena_.resize(momentum_arena_.size() + param.second.numel());
+      }
+    }
+  }
   param_groups_.emplace_back(std::move(param_group_));
 }
 
 Error SGD::step(const std::map<exec_aten::string_view, exec_aten::Tensor>&
                     named_gradients) {
   for (auto& group : param_groups_) {
-    auto& options = static_cast<SGDOptions&>(group.options());
-    auto weight_decay = options.weight_decay();
-    auto momentum = options.momentum();
-    auto dampening = options.dampening();
-    auto nesterov = options.nesterov();
-
-    for (auto param_iter = group.named_parameters().begin();
-         param_iter != group.named_parameters().end();
-         ++param_iter) {
+    const auto& options = group.options();
+    for (const auto& param : group.named_parameters()) {
       // if param name and gradient name match, run the optimizer step
-      const auto& named_gradient = named_gradients.find(param_iter->first);
-      if (named_gradient != named_gradients.end()) {
-        auto d_p = named_gradient->second;
-        auto p = param_iter->second;
-        if (weight_decay != 0) {
-          // uses weight_decay specified and adds it to the gradient
-          add_out_hack(d_p, p, weight_decay, d_p);
-        }
-        if (momentum != 0) {
-          Tensor buf(nullptr);
-          auto param_state = state_.find(p.unsafeGetTensorImpl());
-          // look for the momentum buffer for the given parameter. this is the
-          // momentum as of the previous epoch
-          if (param_state == state_.end()) {
-            // create a new momentum buffer if it doesn't exist. this memory
-            // needs to be freed when the optimizer is destroyed
-            void* buf_ptr = malloc(d_p.nbytes());
-
-#ifdef USE_ATEN_LIB
-            std::vector<int64_t> sizes(d_p.sizes().begin(), d_p.sizes().end());
-            buf = torch::from_blob(buf_ptr, sizes, d_p.scalar_type());
-#else
-            TensorImpl* buf_impl = new TensorImpl(
-                d_p.scalar_type(),
-                d_p.sizes().size(),
-                const_cast<TensorImpl::SizesType*>(d_p.sizes().data()),
-                buf_ptr,
-                const_cast<TensorImpl::DimOrderType*>(d_p.dim_order().data()));
-            buf = Tensor(buf_impl);
-#endif
-            clone_out_hack(d_p, buf);
-
-            // save the state of the momentum buffer to be reused in later
-            // epochs
-            auto state = std::make_unique<SGDParamState>(buf);
-            state_[p.unsafeGetTensorImpl()] = std::move(state);
-          } else {
-            buf = static_cast<SGDParamState&>(*param_state->second)
-                      .momentum_buffer();
-
-            // update the momentum buffer and apply dampening
-            mul_out_hack(buf, momentum, buf);
-            add_out_hack(buf, d_p, 1 - dampening, buf);
-          }
-          if (nesterov) {
-            // apply nesterov momentum
-            add_out_hack(d_p, buf, momentum, d_p);
-          } else {
-            d_p = buf;
-          }
-        }
-        // update the parameter using the gradient and learning rate
-        add_out_hack(p, d_p, -1 * options.lr(), p);
+      const auto& named_gradient = named_gradients.find(param.first);
+      if (named_gradient == named_gradients.end()) {
+        continue;
+      }
+      const Tensor& p = param.second;
+      const Tensor& d_p = named_gradient->second;
+      Error err = internal::check_param_and_grad(param.first, p, d_p);
+      if (err != Error::Ok) {
+        return err;
+      }
+      float* momentum_buffer = nullptr;
+      bool momentum_initialized = false;
+      if (options.momentum() != 0) {
+        // look for the momentum buffer for the given parameter. this is the
+        // momentum as of the previous epoch
+        MomentumState& state = momentum_state_.at(p.unsafeGetTensorImpl());
+        momentum_buffer = momentum_arena_.data() + state.offset;
+        momentum_initialized = state.initialized;
+        state.initialized = true;
       }
+      fused_sgd_step(
+          p.mutable_data_ptr<float>(),
+          d_p.const_data_ptr<float>(),
+          momentum_buffer,
+          momentum_initialized,
+          p.numel(),
+          options);
     }
   }
   return Error::Ok;
 }
 
-SGD::~SGD() {
-  for (const auto& state_kv : state_) {
-    auto state_tensor = static_cast<SGDParamState&>(*state_kv.second);
-    free(state_tensor.momentum_buffer().unsafeGetTensorImpl()->mutable_data());
-#ifndef USE_ATEN_LIB
-    delete state_tensor.momentum_buffer().unsafeGetTensorImpl();
-#endif
-  }
-}
-
 } // namespace optimizer
 } // namespace training
 } // namespace extension
@@ -13,11 +13,17 @@
  *
  * This is similar to the Lite Interpreter implementation of the SGD optimizer,
  * but without the dependency on ATen Tensors and autograd.
+ *
+ * Each parameter is updated in a single fused pass over its elements, split
+ * across the threadpool when built with ET_USE_THREADPOOL. Momentum buffers
+ * live in one arena that is allocated when param groups are added, not during
+ * step().
  */
 #pragma once
 
 #include <executorch/runtime/core/error.h>
 #include <executorch/runtime/core/exec_aten/exec_aten.h>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <unordered_map>
@@ -197,21 +203,32 @@ class ET_EXPERIMENTAL SGD {
   // Adds the given param_group to the optimizer's param_group list.
   void add_param_group(const SGDParamGroup& param_group);
 
-  ~SGD();
-
   /**
    * Performs the optimization step.
    *
    * @param[in] named_gradients The gradients of the tensors specified by the
-   * fully qualified name.
+   * fully qualified name. They are not modified.
+   *
+   * @returns Error::Ok on success, or Error::InvalidArgument if a parameter or
+   * its gradient is not a float tensor, or their sizes differ.
    */
   ::executorch::runtime::Error step(
       const std::map<executorch::aten::string_view, executorch::aten::Tensor>&
           named_gradients);
 
  private:
+  /// Where the momentum buffer of a parameter lives in momentum_arena_.
+  struct MomentumState {
+    size_t offset;
+    /// False until the first step, which initializes the buffer to the
+    /// gradient.
+    bool initialized;
+  };
+
   std::vector<SGDParamGroup> param_groups_;
-  std::unordered_map<void*, std::unique_ptr<SGDParamState>> state_;
+  /// Keyed by the TensorImpl of the parameter.
+  std::unordered_map<const void*, MomentumState> momentum_state_;
+  std::vector<float> momentum_arena_;
   std::unique_ptr<SGDOptions> defaults_;
 };
 
@@ -24,6 +24,20 @@ def define_common_targets():
         #         "//executorch/kernels/portable:generated_lib_headers",
         #     ]
 
+        runtime.cxx_library(
+            name = "optimizer_util" + aten_suffix,
+            exported_headers = [
+                "optimizer_util.h",
+            ],
+            exported_deps = [
+                "//executorch/runtime/core:core",
+                "//executorch/runtime/core/exec_aten:lib" + aten_suffix,
+            ],
+            visibility = [
+                "//executorch/extension/training/optimizer/...",
+            ],
+        )
+
         runtime.cxx_library(
             name = "sgd" + aten_suffix,
             srcs = [
@@ -32,6 +46,10 @@ def define_common_targets():
             exported_headers = [
                 "sgd.h",
             ],
+            deps = [
+                ":optimizer_util" + aten_suffix,
+                "//executorch/kernels/portable/cpu/util:parallel_util" + aten_suffix,
+            ],
             exported_deps = [
                 "//executorch/runtime/core:core",
                 "//executorch/runtime/core/exec_aten:lib" + aten_suffix,
@@ -40,3 +58,46 @@ def define_common_targets():
                 "@EXECUTORCH_CLIENTS",
             ],
         )
+
+        runtime.cxx_library(
+            name = "adam" + aten_suffix,
+            srcs = [
+                "adam.cpp",
+            ],
+            exported_headers = [
+                "adam.h",
+            ],
+            deps = [
+                ":optimizer_util" + aten_suffix,
+                "//executorch/kernels/portable/cpu/util:parallel_util" + aten_suffix,
+            ],
+            exported_deps = [
+                "//executorch/runtime/core:core",
+                "//executorch/runtime/core/exec_aten:lib" + aten_suffix,
+            ],
+            visibility = [
+                "@EXECUTORCH_CLIENTS",
+            ],
+        )
+
+        runtime.cxx_library(
+            name = "gradient_accumulator" + aten_suffix,
+            srcs = [
+                "gradient_accumulator.cpp",
+            ],
+            exported_headers = [
+                "gradient_accumulator.h",
+            ],
+            deps = [
+                ":optimizer_util" + aten_suffix,
+                "//executorch/kernels/portable/cpu/util:parallel_util" + aten_suffix,
+            ],
+            exported_deps = [
+                "//executorch/extension/tensor:tensor" + aten_suffix,
+                "//executorch/runtime/core:core",
+                "//executorch/runtime/core/exec_aten:lib" + aten_suffix,
+            ],
+            visibility = [
+                "@EXECUTORCH_CLIENTS",
+            ],
+        )
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/extension/training/optimizer/adam.h>
+#include <executorch/runtime/core/exec_aten/exec_aten.h>
+#include <executorch/runtime/core/exec_aten/testing_util/tensor_factory.h>
+#include <executorch/runtime/platform/runtime.h>
+
+#include <gtest/gtest.h>
+
+// @lint-ignore-every CLANGTIDY facebook-hte-CArray
+
+using namespace ::testing;
+using exec_aten::ScalarType;
+using exec_aten::Tensor;
+using ::executorch::extension::training::optimizer::Adam;
+using ::executorch::extension::training::optimizer::AdamOptions;
+using ::executorch::runtime::Error;
+using ::executorch::runtime::testing::TensorFactory;
+
+class AdamOptimizerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    torch::executor::runtime_init();
+  }
+};
+
+TEST_F(AdamOptimizerTest, AdamOptionsDefaultValuesTest) {
+  AdamOptions options;
+
+  EXPECT_EQ(options.lr(), 1e-3);
+  EXPECT_EQ(options.beta1(), 0.9);
+  EXPECT_EQ(options.beta2(), 0.999);
+  EXPECT_EQ(options.eps(), 1e-8);
+  EXPECT_EQ(options.weight_decay(), 0);
+  EXPECT_FALSE(options.decoupled_weight_decay());
+}
+
+TEST_F(AdamOptimizerTest, AdamWOptionsTest) {
+  AdamOptions options = AdamOptions::adamw(0.1);
+
+  EXPECT_EQ(options.lr(), 0.1);
+  EXPECT_EQ(options.weight_decay(), 1e-2);
+  EXPECT_TRUE(options.decoupled_weight_decay());
+}
+
+TEST_F(AdamOptimizerTest, AdamOptimizerSimple) {
+  TensorFactory<ScalarType::Float> tf;
+
+  std::map<exec_aten::string_view, exec_aten::Tensor> named_parameters;
+  std::map<exec_aten::string_view, exec_aten::Tensor> named_gradients;
+
+  named_parameters.insert({"param1", tf.make({1, 2}, {1, -1})});
+  named_gradients.insert({"param1", tf.make({1, 2}, {-1, 4})});
+
+  Adam optimizer(named_parameters, AdamOptions{0.1});
+
+  // With bias correction, every step of a constant gradient moves each
+  // element by lr against the sign of its gradient, whatever the gradient's
+  // magnitude.
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_EQ(optimizer.step(named_gradients), Error::Ok);
+  }
+
+  auto p1 =
+      static_cast<const float*>(named_parameters.at("param1").const_data_ptr());
+  EXPECT_NEAR(p1[0], 2.0, 1e-4);
+  EXPECT_NEAR(p1[1], -2.0, 1e-4);
+
+  // The gradients are not modified.
+  auto g1 =
+      static_cast<const float*>(named_gradients.at("param1").const_data_ptr());
+  EXPECT_EQ(g1[0], -1);
+  EXPECT_EQ(g1[1], 4);
+}
+
+TEST_F(AdamOptimizerTest, AdamOptimizerWeightDecay) {
+  TensorFactory<ScalarType::Float> tf;
+
+  std::map<exec_aten::string_view, exec_aten::Tensor> adam_parameters;
+  std::map<exec_aten::string_view, exec_aten::Tensor> adamw_parameters;
+  std::map<exec_aten::string_view, exec_aten::Tensor> named_gradients;
+
+  adam_parameters.insert({"param1", tf.make({1}, {2})});
+  adamw_parameters.insert({"param1", tf.make({1}, {2})});
+  named_gradients.insert({"param1", tf.make({1}, {0})});
+
+  // A zero gradient leaves only the weight decay. Adam adds it to the
+  // gradient, so the first step moves by lr. AdamW decays the parameter by
+  // lr * weight_decay of itself.
+  Adam adam(adam_parameters, AdamOptions(0.1, 0.9, 0.999, 1e-8, 0.5));
+  Adam adamw(adamw_parameters, AdamOptions::adamw(0.1, 0.9, 0.999, 1e-8, 0.5));
+  ASSERT_EQ(adam.step(named_gradients), Error::Ok);
+  ASSERT_EQ(adamw.step(named_gradients), Error::Ok);
+
+  EXPECT_NEAR(
+      adam_parameters.at("param1").const_data_ptr<float>()[0], 1.9, 1e-4);
+  EXPECT_NEAR(
+      adamw_parameters.at("param1").const_data_ptr<float>()[0], 1.9, 1e-4);
+}
+
+TEST_F(AdamOptimizerTest, AdamOptimizerRejectsNonFloat) {
+  TensorFactory<ScalarType::Int> tf;
+
+  std::map<exec_aten::string_view, exec_aten::Tensor> named_parameters;
+  std::map<exec_aten::string_view, exec_aten::Tensor> named_gradients;
+
+  named_parameters.insert({"param1", tf.make({1}, {1})});
+  named_gradients.insert({"param1", tf.make({1}, {1})});
+
+  Adam optimizer(named_parameters, AdamOptions{0.1});
+  EXPECT_EQ(optimizer.step(named_gradients), Error::InvalidArgument);
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/extension/training/optimizer/gradient_accumulator.h>
+#include <executorch/runtime/core/exec_aten/exec_aten.h>
+#include <executorch/runtime/core/exec_aten/testing_util/tensor_factory.h>
+#include <executorch/runtime/platform/runtime.h>
+
+#include <gtest/gtest.h>
+
+// @lint-ignore-every CLANGTIDY facebook-hte-CArray
+
+using namespace ::testing;
+using exec_aten::ScalarType;
+using exec_aten::Tensor;
+using ::executorch::extension::training::optimizer::GradientAccumulator;
+using ::executorch::runtime::Error;
+using ::executorch::runtime::testing::TensorFactory;
+
+class GradientAccumulatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    torch::executor::runtime_init();
+  }
+};
+
+TEST_F(GradientAccumulatorTest, AveragesMicroBatches) {
+  TensorFactory<ScalarType::Float> tf;
+  GradientAccumulator accumulator;
+  EXPECT_TRUE(accumulator.named_gradients().empty());
+
+  std::map<exec_aten::string_view, exec_aten::Tensor> batch1;
+  batch1.insert({"param1", tf.make({2}, {1, 2})});
+  batch1.insert({"param2", tf.make({1}, {4})});
+  std::map<exec_aten::string_view, exec_aten::Tensor> batch2;
+  batch2.insert({"param1", tf.make({2}, {3, 4})});
+  batch2.insert({"param2", tf.make({1}, {8})});
+
+  ASSERT_EQ(accumulator.accumulate(batch1, 0.5), Error::Ok);
+  ASSERT_EQ(accumulator.accumulate(batch2, 0.5), Error::Ok);
+  EXPECT_EQ(accumulator.num_accumulated(), 2);
+
+  const auto& sums = accumulator.named_gradients();
+  ASSERT_EQ(sums.size(), 2);
+  const float* p1 = sums.at("param1").const_data_ptr<float>();
+  EXPECT_EQ(sums.at("param1").numel(), 2);
+  EXPECT_FLOAT_EQ(p1[0], 2);
+  EXPECT_FLOAT_EQ(p1[1], 3);
+  EXPECT_FLOAT_EQ(sums.at("param2").const_data_ptr<float>()[0], 6);
+
+  accumulator.zero();
+  EXPECT_EQ(accumulator.num_accumulated(), 0);
+  EXPECT_EQ(p1[0], 0);
+  ASSERT_EQ(accumulator.accumulate(batch1), Error::Ok);
+  EXPECT_FLOAT_EQ(p1[1], 2);
+}
+
+TEST_F(GradientAccumulatorTest, UnknownGradientFails) {
+  TensorFactory<ScalarType::Float> tf;
+  GradientAccumulator accumulator;
+
+  std::map<exec_aten::string_view, exec_aten::Tensor> batch1;
+  batch1.insert({"param1", tf.make({1}, {1})});
+  std::map<exec_aten::string_view, exec_aten::Tensor> batch2;
+  batch2.insert({"param2", tf.make({1}, {1})});
+
+  ASSERT_EQ(accumulator.accumulate(batch1), Error::Ok);
+  EXPECT_EQ(accumulator.accumulate(batch2), Error::InvalidArgument);
+}
+
+TEST_F(GradientAccumulatorTest, SizeMismatchFails) {
+  TensorFactory<ScalarType::Float> tf;
+  GradientAccumulator accumulator;
+
+  std::map<exec_aten::string_view, exec_aten::Tensor> batch1;
+  batch1.insert({"param1", tf.make({1}, {1})});
+  std::map<exec_aten::string_view, exec_aten::Tensor> batch2;
+  batch2.insert({"param1", tf.make({2}, {1, 2})});
+
+  ASSERT_EQ(accumulator.accumulate(batch1), Error::Ok);
+  EXPECT_EQ(accumulator.accumulate(batch2), Error::InvalidArgument);
+}
@@ -7,6 +7,7 @@
  */
 
 #include <executorch/kernels/optimized/blas/CPUBlas.h>
+#include <executorch/kernels/optimized/blas/PackedGemm.h>
 
 #include <limits.h>
 
@@ -98,14 +99,14 @@ void gemm(
       c, &ldc_);
 #endif // ET_BUILD_FOR_APPLE
 #else
-  using acc_type = utils::compute_dtype<float>;
-  gemm_impl(
-      transa, transb,
+  internal::gemm_packed_<double, double>(
+      transa != TransposeType::NoTranspose,
+      transb != TransposeType::NoTranspose,
       m, n, k,
-      static_cast<const acc_type>(alpha),
+      alpha,
       a, lda,
       b, ldb,
-      static_cast<const acc_type>(beta),
+      beta,
       c, ldc);
 #endif
 }
@@ -139,14 +140,14 @@ void gemm(
 #endif // ET_BUILD_FOR_APPLE
 
 #else
-  using acc_type = utils::compute_dtype<float>;
-  gemm_impl(
-      transa, transb,
+  internal::gemm_packed_<float, float>(
+      transa != TransposeType::NoTranspose,
+      transb != TransposeType::NoTranspose,
       m, n, k,
-      static_cast<const acc_type>(alpha),
+      alpha,
       a, lda,
       b, ldb,
-      static_cast<const acc_type>(beta),
+      beta,
       c, ldc);
 #endif
 }
@@ -162,14 +163,15 @@ void gemm(
     Half *c, int64_t ldc) {
   normalize_last_dims(transa, transb, m, n, k, &lda, &ldb, &ldc);
 
-  using acc_type = utils::compute_dtype<Half>;
-  gemm_impl(
-      transa, transb,
+  // Accumulate in fp32, rounding to Half once per output element.
+  internal::gemm_packed_<Half, float>(
+      transa != TransposeType::NoTranspose,
+      transb != TransposeType::NoTranspose,
       m, n, k,
-      static_cast<const acc_type>(alpha),
+      static_cast<float>(alpha),
       a, lda,
       b, ldb,
-      static_cast<const acc_type>(beta),
+      static_cast<float>(beta),
       c, ldc);
 }
 // clang-format on
@@ -185,14 +187,32 @@ void gemm(
     BFloat16 *c, int64_t ldc) {
   normalize_last_dims(transa, transb, m, n, k, &lda, &ldb, &ldc);
 
-  using acc_type = utils::compute_dtype<BFloat16>;
-  gemm_impl(
-      transa, transb,
+#ifdef __aarch64__
+  // Matrix-vector products keep using the NEON bf16 dot product kernel.
+  if (n == 1 && transa == TransposeType::Transpose &&
+      transb == TransposeType::NoTranspose) {
+    using acc_type = utils::compute_dtype<BFloat16>;
+    gemm_impl(
+        transa, transb,
+        m, n, k,
+        static_cast<const acc_type>(alpha),
+        a, lda,
+        b, ldb,
+        static_cast<const acc_type>(beta),
+        c, ldc);
+    return;
+  }
+#endif // __aarch64__
+
+  // Accumulate in fp32, rounding to BFloat16 once per output element.
+  internal::gemm_packed_<BFloat16, float>(
+      transa != TransposeType::NoTranspose,
+      transb != TransposeType::NoTranspose,
       m, n, k,
-      static_cast<const acc_type>(alpha),
+      static_cast<float>(alpha),
       a, lda,
       b, ldb,
-      static_cast<const acc_type>(beta),
+      static_cast<float>(beta),
       c, ldc);
 }
 // clang-format on
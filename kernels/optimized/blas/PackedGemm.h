@@ -0,0 +1,492 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include <executorch/extension/parallel/thread_parallel.h>
+#include <executorch/kernels/optimized/utils/math_utils.h>
+#include <executorch/kernels/optimized/utils/unroll.h>
+#include <executorch/kernels/optimized/vec/functional.h>
+#include <executorch/kernels/optimized/vec/vec.h>
+
+/**
+ * Cache-blocked GEMM and GEMV for floating point types, following the
+ * column-major BLAS conventions of cpublas::gemm.
+ *
+ * C is split into kMC x kNC tiles that are computed independently on the
+ * extension threadpool. For each kKC-deep slice of the reduction, a task packs
+ * its kMC x kKC block of op(A) into panels of kMR rows, which stay in L2, and
+ * then packs one kKC x kNR panel of op(B) at a time, which stays in L1. A
+ * register-blocked micro-kernel multiplies an A panel by a B panel, keeping the
+ * whole kMR x kNR block of C in vector registers.
+ *
+ * Elements are converted to opmath_t while packing, so Half and BFloat16
+ * inputs are multiplied and accumulated in fp32 and C is rounded once at the
+ * end. Products with a single row or column of C are memory bound and go
+ * through a GEMV that reads op(A) once, without packing.
+ */
+
+namespace executorch {
+namespace cpublas {
+namespace internal {
+
+template <typename opmath_t>
+struct PackedGemmBlocking {
+  using Vec = ::executorch::vec::Vectorized<opmath_t>;
+  // Rows of C per micro-kernel call: two vector registers.
+  static constexpr int64_t kMR = 2 * Vec::size();
+  // Columns of C per micro-kernel call. The 2 * kNR accumulators plus the
+  // operands fit in the 16 vector registers of AVX2 (32 on NEON, where each
+  // Vectorized is a register pair).
+  static constexpr int64_t kNR = 6;
+  // Depth of one packed slice of the reduction.
+  static constexpr int64_t kKC = 128;
+  // Rows and columns of C per task. Together with the packed panels this is
+  // about 60KB of stack per task, independent of opmath_t.
+  static constexpr int64_t kMC = 64 * 4 / sizeof(opmath_t);
+  static constexpr int64_t kNC = 16 * kNR;
+  static_assert(kMC % kMR == 0, "kMC must be a multiple of kMR");
+};
+
+/**
+ * Minimum number of multiply-adds per GEMV task, so that waking worker threads
+ * is worth it.
+ */
+constexpr int64_t kGemvGrainSize = 32 * 1024;
+
+/**
+ * Packs rows [i0, i0 + mc) and columns [p0, p0 + kc) of op(A) into panels of
+ * kMR rows. Element (i, p) of a panel is stored at p * kMR + i, and rows past
+ * mc are zero.
+ */
+template <typename scalar_t, typename opmath_t>
+void gemm_pack_a(
+    bool transa,
+    const scalar_t* a,
+    int64_t lda,
+    int64_t i0,
+    int64_t mc,
+    int64_t p0,
+    int64_t kc,
+    opmath_t* dst) {
+  constexpr int64_t kMR = PackedGemmBlocking<opmath_t>::kMR;
+  for (int64_t ir = 0; ir < mc; ir += kMR) {
+    const int64_t mr = std::min(kMR, mc - ir);
+    opmath_t* panel = dst + ir * kc;
+    if (!transa) {
+      for (int64_t p = 0; p < kc; ++p) {
+        const scalar_t* src = a + (i0 + ir) + (p0 + p) * lda;
+        opmath_t* out = panel + p * kMR;
+        // Vectorized for Half and BFloat16; a plain copy loop otherwise.
+        ::executorch::vec::convert(src, out, mr);
+        std::fill(out + mr, out + kMR, opmath_t(0));
+      }
+    } else {
+      for (int64_t i = 0; i < mr; ++i) {
+        const scalar_t* src = a + p0 + (i0 + ir + i) * lda;
+        for (int64_t p = 0; p < kc; ++p) {
+          panel[p * kMR + i] = static_cast<opmath_t>(src[p]);
+        }
+      }
+      for (int64_t i = mr; i < kMR; ++i) {
+        for (int64_t p = 0; p < kc; ++p) {
+          panel[p * kMR + i] = opmath_t(0);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Packs rows [p0, p0 + kc) and columns [j0, j0 + nr) of op(B) into one panel.
+ * Element (p, j) is stored at p * kNR + j, and columns past nr are zero.
+ */
+template <typename scalar_t, typename opmath_t>
+void gemm_pack_b(
+    bool transb,
+    const scalar_t* b,
+    int64_t ldb,
+    int64_t p0,
+    int64_t kc,
+    int64_t j0,
+    int64_t nr,
+    opmath_t* dst) {
+  constexpr int64_t kNR = PackedGemmBlocking<opmath_t>::kNR;
+  if (!transb) {
+    for (int64_t j = 0; j < nr; ++j) {
+      const scalar_t* src = b + p0 + (j0 + j) * ldb;
+      for (int64_t p = 0; p < kc; ++p) {
+        dst[p * kNR + j] = static_cast<opmath_t>(src[p]);
+      }
+    }
+    for (int64_t j = nr; j < kNR; ++j) {
+      for (int64_t p = 0; p < kc; ++p) {
+        dst[p * kNR + j] = opmath_t(0);
+      }
+    }
+  } else {
+    for (int64_t p = 0; p < kc; ++p) {
+      const scalar_t* src = b + j0 + (p0 + p) * ldb;
+      opmath_t* out = dst + p * kNR;
+      ::executorch::vec::convert(src, out, nr);
+      std::fill(out + nr, out + kNR, opmath_t(0));
+    }
+  }
+}
+
+/**
+ * Computes the kMR x kNR product of a packed A panel and a packed B panel over
+ * a depth of kc, and stores it into (or, if `accumulate`, adds it to) the
+ * column-major block at `acc` with leading dimension ld_acc.
+ */
+template <typename opmath_t>
+void gemm_micro_kernel(
+    int64_t kc,
+    const opmath_t* a,
+    const opmath_t* b,
+    opmath_t* acc,
+    int64_t ld_acc,
+    bool accumulate) {
+  using Blocking = PackedGemmBlocking<opmath_t>;
+  using Vec = typename Blocking::Vec;
+  constexpr int64_t kMR = Blocking::kMR;
+  constexpr int64_t kNR = Blocking::kNR;
+
+  Vec c0[kNR];
+  Vec c1[kNR];
+  utils::ForcedUnroll<kNR>{}([&](int j) ET_INLINE_ATTRIBUTE {
+    c0[j] = Vec(opmath_t(0));
+    c1[j] = Vec(opmath_t(0));
+  });
+  for (int64_t p = 0; p < kc; ++p) {
+    const Vec a0 = Vec::loadu(a);
+    const Vec a1 = Vec::loadu(a + Vec::size());
+    utils::ForcedUnroll<kNR>{}([&](int j) ET_INLINE_ATTRIBUTE {
+      const Vec bj(b[j]);
+      c0[j] = ::executorch::vec::fmadd(a0, bj, c0[j]);
+      c1[j] = ::executorch::vec::fmadd(a1, bj, c1[j]);
+    });
+    a += kMR;
+    b += kNR;
+  }
+  utils::ForcedUnroll<kNR>{}([&](int j) ET_INLINE_ATTRIBUTE {
+    opmath_t* col = acc + j * ld_acc;
+    if (accumulate) {
+      c0[j] = c0[j] + Vec::loadu(col);
+      c1[j] = c1[j] + Vec::loadu(col + Vec::size());
+    }
+    c0[j].store(col);
+    c1[j].store(col + Vec::size());
+  });
+}
+
+/**
+ * Computes the mc x nc tile of C at (i0, j0) as
+ * C = alpha * op(A) @ op(B) + beta * C.
+ */
+template <typename scalar_t, typename opmath_t>
+void gemm_packed_tile(
+    bool transa,
+    bool transb,
+    int64_t i0,
+    int64_t mc,
+    int64_t j0,
+    int64_t nc,
+    int64_t k,
+    opmath_t alpha,
+    const scalar_t* a,
+    int64_t lda,
+    const scalar_t* b,
+    int64_t ldb,
+    opmath_t beta,
+    scalar_t* c,
+    int64_t ldc) {
+  using Blocking = PackedGemmBlocking<opmath_t>;
+  constexpr int64_t kMR = Blocking::kMR;
+  constexpr int64_t kNR = Blocking::kNR;
+  constexpr int64_t kKC = Blocking::kKC;
+  constexpr int64_t kMC = Blocking::kMC;
+  constexpr int64_t kNC = Blocking::kNC;
+
+  alignas(64) opmath_t a_pack[kMC * kKC];
+  alignas(64) opmath_t b_pack[kKC * kNR];
+  alignas(64) opmath_t acc[kMC * kNC];
+
+  for (int64_t p0 = 0; p0 < k; p0 += kKC) {
+    const int64_t kc = std::min(kKC, k - p0);
+    gemm_pack_a(transa, a, lda, i0, mc, p0, kc, a_pack);
+    for (int64_t jr = 0; jr < nc; jr += kNR) {
+      gemm_pack_b(
+          transb, b, ldb, p0, kc, j0 + jr, std::min(kNR, nc - jr), b_pack);
+      for (int64_t ir = 0; ir < mc; ir += kMR) {
+        gemm_micro_kernel(
+            kc, a_pack + ir * kc, b_pack, acc + ir + jr * kMC, kMC, p0 > 0);
+      }
+    }
+  }
+
+  for (int64_t j = 0; j < nc; ++j) {
+    const opmath_t* acc_col = acc + j * kMC;
+    scalar_t* c_col = c + i0 + (j0 + j) * ldc;
+    if (beta == opmath_t(0)) {
+      for (int64_t i = 0; i < mc; ++i) {
+        c_col[i] = static_cast<scalar_t>(alpha * acc_col[i]);
+      }
+    } else {
+      for (int64_t i = 0; i < mc; ++i) {
+        c_col[i] = static_cast<scalar_t>(
+            alpha * acc_col[i] + beta * static_cast<opmath_t>(c_col[i]));
+      }
+    }
+  }
+}
+
+/**
+ * Dot product of a contiguous row of scalar_t with a strided vector of
+ * scalar_t, computed in opmath_t.
+ */
+template <typename scalar_t, typename opmath_t>
+opmath_t gemv_dot(
+    const scalar_t* row,
+    const scalar_t* x,
+    int64_t incx,
+    int64_t k) {
+  using Vec = ::executorch::vec::Vectorized<opmath_t>;
+  constexpr int64_t kChunk = 256;
+  Vec acc0(opmath_t(0));
+  Vec acc1(opmath_t(0));
+  opmath_t tail = 0;
+  alignas(64) opmath_t row_buf[kChunk];
+  alignas(64) opmath_t x_buf[kChunk];
+  for (int64_t p0 = 0; p0 < k; p0 += kChunk) {
+    const int64_t len = std::min(kChunk, k - p0);
+    const opmath_t* r;
+    const opmath_t* v;
+    if constexpr (std::is_same<scalar_t, opmath_t>::value) {
+      r = row + p0;
+    } else {
+      for (int64_t p = 0; p < len; ++p) {
+        row_buf[p] = static_cast<opmath_t>(row[p0 + p]);
+      }
+      r = row_buf;
+    }
+    if (std::is_same<scalar_t, opmath_t>::value && incx == 1) {
+      v = reinterpret_cast<const opmath_t*>(x + p0);
+    } else {
+      for (int64_t p = 0; p < len; ++p) {
+        x_buf[p] = static_cast<opmath_t>(x[(p0 + p) * incx]);
+      }
+      v = x_buf;
+    }
+    int64_t p = 0;
+    for (; p + 2 * Vec::size() <= len; p += 2 * Vec::size()) {
+      acc0 = ::executorch::vec::fmadd(
+          Vec::loadu(r + p), Vec::loadu(v + p), acc0);
+      acc1 = ::executorch::vec::fmadd(
+          Vec::loadu(r + p + Vec::size()),
+          Vec::loadu(v + p + Vec::size()),
+          acc1);
+    }
+    for (; p < len; ++p) {
+      tail += r[p] * v[p];
+    }
+  }
+  return ::executorch::vec::vec_reduce_all<opmath_t>(
+             [](const Vec& x, const Vec& y) { return x + y; }, acc0 + acc1) +
+      tail;
+}
+
+/**
+ * y = alpha * M @ x + beta * y for an m x k matrix M, where row i of M starts
+ * at mat + i * row_stride and column p of it at mat + p * col_stride. One of
+ * the two strides is expected to be 1.
+ */
+template <typename scalar_t, typename opmath_t>
+void gemv_(
+    int64_t m,
+    int64_t k,
+    opmath_t alpha,
+    const scalar_t* mat,
+    int64_t row_stride,
+    int64_t col_stride,
+    const scalar_t* x,
+    int64_t incx,
+    opmath_t beta,
+    scalar_t* y,
+    int64_t incy) {
+  using Vec = ::executorch::vec::Vectorized<opmath_t>;
+  const auto store = [&](int64_t i, opmath_t dot) {
+    scalar_t& out = y[i * incy];
+    out = static_cast<scalar_t>(
+        beta == opmath_t(0)
+            ? alpha * dot
+            : alpha * dot + beta * static_cast<opmath_t>(out));
+  };
+
+  if (col_stride == 1) {
+    // Rows are contiguous: one dot product per output.
+    const int64_t grain = std::max<int64_t>(1, kGemvGrainSize / k);
+    ::executorch::extension::parallel_for(
+        0, m, grain, [&](int64_t begin, int64_t end) {
+          for (int64_t i = begin; i < end; ++i) {
+            store(
+                i,
+                gemv_dot<scalar_t, opmath_t>(
+                    mat + i * row_stride, x, incx, k));
+          }
+        });
+    return;
+  }
+
+  // Columns are contiguous: accumulate scaled columns over a block of rows.
+  constexpr int64_t kBlock = 256;
+  const int64_t grain = std::max<int64_t>(1, kGemvGrainSize / (kBlock * k));
+  ::executorch::extension::parallel_for(
+      0,
+      utils::divup(m, kBlock),
+      grain,
+      [&](int64_t begin, int64_t end) {
+        alignas(64) opmath_t acc[kBlock];
+        for (int64_t blk = begin; blk < end; ++blk) {
+          const int64_t i0 = blk * kBlock;
+          const int64_t len = std::min(kBlock, m - i0);
+          std::fill(acc, acc + len, opmath_t(0));
+          for (int64_t p = 0; p < k; ++p) {
+            const opmath_t xp = static_cast<opmath_t>(x[p * incx]);
+            const scalar_t* col = mat + i0 * row_stride + p * col_stride;
+            int64_t i = 0;
+            if constexpr (std::is_same<scalar_t, opmath_t>::value) {
+              if (row_stride == 1) {
+                const Vec xv(xp);
+                for (; i + Vec::size() <= len; i += Vec::size()) {
+                  ::executorch::vec::fmadd(
+                      Vec::loadu(col + i), xv, Vec::loadu(acc + i))
+                      .store(acc + i);
+                }
+              }
+            }
+            for (; i < len; ++i) {
+              acc[i] += static_cast<opmath_t>(col[i * row_stride]) * xp;
+            }
+          }
+          for (int64_t i = 0; i < len; ++i) {
+            store(i0 + i, acc[i]);
+          }
+        }
+      });
+}
+
+/**
+ * C = alpha * op(A) @ op(B) + beta * C for floating point scalar_t, with all
+ * arithmetic in opmath_t. Matches the semantics of gemm_impl, including that
+ * C is not read when beta is zero.
+ */
+template <typename scalar_t, typename opmath_t>
+void gemm_packed_(
+    bool transa,
+    bool transb,
+    int64_t m,
+    int64_t n,
+    int64_t k,
+    opmath_t alpha,
+    const scalar_t* a,
+    int64_t lda,
+    const scalar_t* b,
+    int64_t ldb,
+    opmath_t beta,
+    scalar_t* c,
+    int64_t ldc) {
+  if (m == 0 || n == 0) {
+    return;
+  }
+  if (k == 0) {
+    for (int64_t j = 0; j < n; ++j) {
+      for (int64_t i = 0; i < m; ++i) {
+        scalar_t& out = c[i + j * ldc];
+        out = beta == opmath_t(0)
+            ? scalar_t(0)
+            : static_cast<scalar_t>(beta * static_cast<opmath_t>(out));
+      }
+    }
+    return;
+  }
+
+  // op(A)(i, p) is at a + i * a_row_stride + p * a_col_stride, and similarly
+  // for op(B).
+  const int64_t a_row_stride = transa ? lda : 1;
+  const int64_t a_col_stride = transa ? 1 : lda;
+  const int64_t b_row_stride = transb ? ldb : 1;
+  const int64_t b_col_stride = transb ? 1 : ldb;
+  if (n == 1) {
+    // c[:, 0] = op(A) @ op(B)[:, 0]
+    gemv_<scalar_t, opmath_t>(
+        m,
+        k,
+        alpha,
+        a,
+        a_row_stride,
+        a_col_stride,
+        b,
+        b_row_stride,
+        beta,
+        c,
+        1);
+    return;
+  }
+  if (m == 1) {
+    // c[0, :] = op(B)^T @ op(A)[0, :]
+    gemv_<scalar_t, opmath_t>(
+        n,
+        k,
+        alpha,
+        b,
+        b_col_stride,
+        b_row_stride,
+        a,
+        a_col_stride,
+        beta,
+        c,
+        ldc);
+    return;
+  }
+
+  using Blocking = PackedGemmBlocking<opmath_t>;
+  const int64_t m_tiles = utils::divup(m, Blocking::kMC);
+  const int64_t n_tiles = utils::divup(n, Blocking::kNC);
+  ::executorch::extension::parallel_for(
+      0, m_tiles * n_tiles, 1, [&](int64_t begin, int64_t end) {
+        for (int64_t t = begin; t < end; ++t) {
+          const int64_t i0 = (t % m_tiles) * Blocking::kMC;
+          const int64_t j0 = (t / m_tiles) * Blocking::kNC;
+          gemm_packed_tile<scalar_t, opmath_t>(
+              transa,
+              transb,
+              i0,
+              std::min(Blocking::kMC, m - i0),
+              j0,
+              std::min(Blocking::kNC, n - j0),
+              k,
+              alpha,
+              a,
+              lda,
+              b,
+              ldb,
+              beta,
+              c,
+              ldc);
+        }
+      });
+}
+
+} // namespace internal
+} // namespace cpublas
+} // namespace executorch
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/kernels/optimized/cpu/isa_variant.h>
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+#include <cpuinfo.h>
+
+#include <executorch/runtime/platform/log.h>
+
+namespace torch {
+namespace executor {
+namespace native {
+
+using executorch::runtime::KernelIsa;
+
+bool cpu_supports_kernel_isa(KernelIsa isa) {
+  if (isa == KernelIsa::Default) {
+    return true;
+  }
+  if (!cpuinfo_initialize()) {
+    ET_LOG(Error, "cpuinfo initialization failed, using baseline kernels");
+    return false;
+  }
+  switch (isa) {
+    case KernelIsa::Default:
+      return true;
+    // The x86 variants are built with -mfma -mf16c as well; see
+    // get_vec_capability_compiler_flags().
+    case KernelIsa::AVX2:
+      return cpuinfo_has_x86_avx2() && cpuinfo_has_x86_fma3() &&
+          cpuinfo_has_x86_f16c();
+    case KernelIsa::AVX512:
+      return cpuinfo_has_x86_avx512f() && cpuinfo_has_x86_avx512bw() &&
+          cpuinfo_has_x86_avx512dq() && cpuinfo_has_x86_avx512vl() &&
+          cpuinfo_has_x86_fma3() && cpuinfo_has_x86_f16c();
+    // The SVE variant is vector-length specific.
+    case KernelIsa::SVE256:
+      return cpuinfo_has_arm_sve() && cpuinfo_get_max_arm_sve_length() == 256;
+  }
+  return false;
+}
+
+namespace {
+
+bool parse_kernel_isa(const char* str, KernelIsa* isa) {
+  struct {
+    const char* name;
+    KernelIsa isa;
+  } constexpr kNames[] = {
+      {"DEFAULT", KernelIsa::Default},
+      {"AVX2", KernelIsa::AVX2},
+      {"AVX512", KernelIsa::AVX512},
+      {"SVE256", KernelIsa::SVE256},
+  };
+  for (const auto& entry : kNames) {
+    size_t i = 0;
+    while (str[i] != '\0' && entry.name[i] != '\0' &&
+           std::toupper(static_cast<unsigned char>(str[i])) == entry.name[i]) {
+      ++i;
+    }
+    if (str[i] == '\0' && entry.name[i] == '\0') {
+      *isa = entry.isa;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool install_kernel_isa_probe() {
+  executorch::runtime::set_kernel_isa_support_fn(cpu_supports_kernel_isa);
+
+  // Lets benchmarks compare ISA variants without rebuilding.
+  const char* max_isa = std::getenv("ET_KERNEL_ISA");
+  if (max_isa != nullptr && max_isa[0] != '\0') {
+    KernelIsa isa;
+    if (parse_kernel_isa(max_isa, &isa)) {
+      executorch::runtime::set_max_kernel_isa(isa);
+    } else {
+      ET_LOG(
+          Error,
+          "Ignoring ET_KERNEL_ISA=%s: expected DEFAULT, AVX2, AVX512 or SVE256",
+          max_isa);
+    }
+  }
+  return true;
+}
+
+// Installed during static initialization, alongside the ISA variants the ops
+// register, so that it is in place before any Method resolves its operators.
+static const bool kernel_isa_probe_installed = install_kernel_isa_probe();
+
+} // namespace
+
+} // namespace native
+} // namespace executor
+} // namespace torch
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <executorch/runtime/kernel/operator_registry.h>
+
+// Note [Optimized kernel ISA variants]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The vectorized loops of some optimized ops are compiled several times: once
+// for the baseline target, and once for every instruction set the build lists
+// (e.g. AVX2 and AVX512 on x86-64). Each build of the loops is a separate
+// translation unit compiled with that ISA's vec flags and with
+// -DET_OPTIMIZED_ISA_VARIANT=<ISA>, and puts its functions in a namespace
+// named after the ISA so that the builds can be linked together.
+//
+// Only those loops are multi-versioned. The op entry points, i.e. argument
+// checks, output resizing and dtype dispatch, are compiled once for the
+// baseline target and templated on the loops they call. Inline functions
+// from shared headers are therefore never emitted with wider instructions
+// than the baseline, where the linker could pick them for every caller.
+//
+// The baseline entry point is the one codegen registers. Each op also
+// registers its ISA variants, tagged with executorch::runtime::KernelIsa, and
+// the operator registry picks the best one the CPU supports when a Method
+// resolves its operators. The CPU is probed with cpuinfo; see isa_variant.cpp.
+// Setting the ET_KERNEL_ISA environment variable to DEFAULT, AVX2, AVX512 or
+// SVE256 caps the choice, e.g. to compare the variants of a model.
+//
+// To multi-version another op, move its hot loops into a source that is
+// compiled per ISA, as unary_kernels.cpp is, and register its variants with
+// ET_FORALL_OPTIMIZED_ISA_VARIANTS as op_exp.cpp does.
+
+/// Namespace for functions that are compiled once per ISA variant.
+#if defined(ET_OPTIMIZED_ISA_VARIANT)
+#define ET_OPTIMIZED_ISA_NAMESPACE ET_OPTIMIZED_ISA_VARIANT
+#else
+#define ET_OPTIMIZED_ISA_NAMESPACE baseline
+#endif
+
+// The build defines ET_OPTIMIZED_ISA_<ISA> for each ISA variant it compiles.
+#if defined(ET_OPTIMIZED_ISA_AVX2)
+#define ET_OPTIMIZED_ISA_VARIANT_AVX2(_) _(AVX2)
+#define ET_OPTIMIZED_HAS_ISA_VARIANTS
+#else
+#define ET_OPTIMIZED_ISA_VARIANT_AVX2(_)
+#endif
+
+#if defined(ET_OPTIMIZED_ISA_AVX512)
+#define ET_OPTIMIZED_ISA_VARIANT_AVX512(_) _(AVX512)
+#define ET_OPTIMIZED_HAS_ISA_VARIANTS
+#else
+#define ET_OPTIMIZED_ISA_VARIANT_AVX512(_)
+#endif
+
+#if defined(ET_OPTIMIZED_ISA_SVE256)
+#define ET_OPTIMIZED_ISA_VARIANT_SVE256(_) _(SVE256)
+#define ET_OPTIMIZED_HAS_ISA_VARIANTS
+#else
+#define ET_OPTIMIZED_ISA_VARIANT_SVE256(_)
+#endif
+
+/// Expands `_(ISA)` for each ISA variant in the build. ISA names both the
+/// namespace of that variant and its executorch::runtime::KernelIsa value.
+#define ET_FORALL_OPTIMIZED_ISA_VARIANTS(_) \
+  ET_OPTIMIZED_ISA_VARIANT_AVX2(_)          \
+  ET_OPTIMIZED_ISA_VARIANT_AVX512(_)        \
+  ET_OPTIMIZED_ISA_VARIANT_SVE256(_)
+
+namespace torch {
+namespace executor {
+namespace native {
+
+/**
+ * Returns true if this CPU can run kernels compiled for `isa`. This is the
+ * probe the optimized kernels install with
+ * executorch::runtime::set_kernel_isa_support_fn().
+ */
+bool cpu_supports_kernel_isa(executorch::runtime::KernelIsa isa);
+
+} // namespace native
+} // namespace executor
+} // namespace torch
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cmath>
+#include <tuple>
+
+#include <executorch/kernels/optimized/cpu/reduction_utils.h>
+#include <executorch/kernels/portable/cpu/util/reduce_util.h>
+#include <executorch/runtime/kernel/kernel_includes.h>
+#include <executorch/runtime/platform/assert.h>
+
+namespace torch {
+namespace executor {
+namespace native {
+
+using exec_aten::optional;
+using exec_aten::ScalarType;
+using exec_aten::Tensor;
+
+namespace {
+
+/**
+ * Index of the first maximum of a contiguous row, or of the first NaN if the
+ * row has one. The maximum itself is found with vector loads; locating it is
+ * a short scan that usually stops early.
+ */
+template <typename CTYPE>
+long argmax_row(const CTYPE* row, int64_t size) {
+  using Vec = executorch::vec::Vectorized<CTYPE>;
+  const CTYPE max_val = executorch::vec::reduce_all<CTYPE>(
+      [](const Vec& a, const Vec& b) { return ReduceMaximum()(a, b); },
+      row,
+      size);
+  const bool max_is_nan = std::isnan(max_val);
+  for (int64_t i = 0; i < size; ++i) {
+    if (max_is_nan ? std::isnan(row[i]) : row[i] == max_val) {
+      return i;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Argmax over the middle axis of an [outer, reduce, inner] view, for the
+ * `len` outputs starting at `src`. Steps along the reduced axis read
+ * contiguous rows of `len` elements.
+ */
+template <typename CTYPE>
+void argmax_strided(
+    const CTYPE* src,
+    long* out,
+    int64_t reduce_size,
+    int64_t inner_size,
+    int64_t len) {
+  CTYPE best[kReductionInnerBlockSize];
+  std::copy(src, src + len, best);
+  std::fill(out, out + len, 0);
+  for (int64_t r = 1; r < reduce_size; ++r) {
+    const CTYPE* row = src + r * inner_size;
+    for (int64_t i = 0; i < len; ++i) {
+      const CTYPE v = row[i];
+      if (!std::isnan(best[i]) && (std::isnan(v) || v > best[i])) {
+        best[i] = v;
+        out[i] = r;
+      }
+    }
+  }
+}
+
+} // namespace
+
+Tensor& opt_argmax_out(
+    KernelRuntimeContext& ctx,
+    const Tensor& in,
+    optional<int64_t> dim,
+    bool keepdim,
+    Tensor& out) {
+  (void)ctx;
+
+  ET_KERNEL_CHECK(
+      ctx,
+      check_argmin_argmax_args(in, dim, keepdim, out),
+      InvalidArgument,
+      out);
+
+  ET_KERNEL_CHECK(
+      ctx,
+      resize_reduction_out(in, dim, keepdim, out) == Error::Ok,
+      InvalidArgument,
+      out);
+
+  ET_KERNEL_CHECK(
+      ctx, tensors_have_same_dim_order(in, out), InvalidArgument, out);
+
+  ReductionShape shape;
+  if (in.numel() > 0 &&
+      (in.scalar_type() == ScalarType::Float ||
+       in.scalar_type() == ScalarType::Double) &&
+      get_reduction_shape(in, dim, shape)) {
+    ET_SWITCH_FLOAT_TYPES(in.scalar_type(), ctx, "argmax.out", CTYPE, [&] {
+      const CTYPE* in_data = in.const_data_ptr<CTYPE>();
+      long* out_data = out.mutable_data_ptr<long>();
+      parallel_for_each_reduction_block(
+          shape, [&](int64_t outer_ix, int64_t inner_begin, int64_t len) {
+            const CTYPE* src = in_data +
+                outer_ix * shape.reduce_size * shape.inner_size + inner_begin;
+            long* dst = out_data + outer_ix * shape.inner_size + inner_begin;
+            if (shape.inner_size == 1) {
+              *dst = argmax_row(src, shape.reduce_size);
+            } else {
+              argmax_strided(
+                  src, dst, shape.reduce_size, shape.inner_size, len);
+            }
+          });
+    });
+    return out;
+  }
+
+  ET_SWITCH_REAL_TYPES(in.scalar_type(), ctx, "argmax.out", CTYPE, [&] {
+    long* out_data = out.mutable_data_ptr<long>();
+
+    for (size_t out_ix = 0; out_ix < out.numel(); ++out_ix) {
+      std::tuple<CTYPE, long> acc = reduce_over_dim<CTYPE>(
+          [](CTYPE v, long ix, CTYPE acc_val, long acc_ix) {
+            if (!std::isnan(acc_val) && (std::isnan(v) || v > acc_val)) {
+              acc_val = v;
+              acc_ix = ix;
+            }
+            return std::tuple<CTYPE, long>{acc_val, acc_ix};
+          },
+          in,
+          dim,
+          out_ix);
+      out_data[out_ix] = std::get<1>(acc);
+    }
+  });
+
+  return out;
+}
+
+} // namespace native
+} // namespace executor
+} // namespace torch
@@ -0,0 +1,486 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+
+#include <executorch/extension/parallel/thread_parallel.h>
+#include <executorch/kernels/optimized/blas/CPUBlas.h>
+#include <executorch/kernels/optimized/vec/vec.h>
+#include <executorch/kernels/portable/cpu/util/dtype_util.h>
+#include <executorch/kernels/portable/cpu/util/kernel_ops_util.h>
+#include <executorch/runtime/kernel/kernel_includes.h>
+
+namespace torch {
+namespace executor {
+namespace native {
+
+using Tensor = exec_aten::Tensor;
+using ScalarType = exec_aten::ScalarType;
+using IntArrayRef = exec_aten::ArrayRef<int64_t>;
+
+namespace {
+
+/**
+ * Minimum number of multiply-adds each task should perform, so that waking
+ * worker threads is worth it.
+ */
+constexpr int64_t kConvolutionGrainSize = 32 * 1024;
+
+/**
+ * Geometry of a non-transposed convolution over contiguous NCHW tensors. 1D
+ * convolutions are described as 2D ones with a height of 1.
+ */
+struct ConvShape {
+  int64_t batch;
+  int64_t groups;
+  int64_t in_c_per_group;
+  int64_t out_c_per_group;
+  int64_t in_h, in_w;
+  int64_t out_h, out_w;
+  int64_t kernel_h, kernel_w;
+  int64_t stride_h, stride_w;
+  int64_t pad_h, pad_w;
+  int64_t dilation_h, dilation_w;
+};
+
+ConvShape get_conv_shape(
+    const Tensor& in,
+    const Tensor& weight,
+    const Tensor& out,
+    IntArrayRef stride,
+    IntArrayRef padding,
+    IntArrayRef dilation,
+    int64_t groups) {
+  ConvShape s;
+  const bool is_2d = in.dim() == 4;
+  s.batch = in.size(0);
+  s.groups = groups;
+  s.in_c_per_group = in.size(1) / groups;
+  s.out_c_per_group = out.size(1) / groups;
+  s.in_h = is_2d ? in.size(2) : 1;
+  s.in_w = in.size(in.dim() - 1);
+  s.out_h = is_2d ? out.size(2) : 1;
+  s.out_w = out.size(out.dim() - 1);
+  s.kernel_h = is_2d ? weight.size(2) : 1;
+  s.kernel_w = weight.size(weight.dim() - 1);
+  const size_t w_ix = is_2d ? 1 : 0;
+  s.stride_h = is_2d ? val_at(stride, 0) : 1;
+  s.stride_w = val_at(stride, w_ix);
+  s.pad_h = is_2d ? val_at(padding, 0, /*default_value=*/0) : 0;
+  s.pad_w = val_at(padding, w_ix, /*default_value=*/0);
+  s.dilation_h = is_2d ? val_at(dilation, 0) : 1;
+  s.dilation_w = val_at(dilation, w_ix);
+  return s;
+}
+
+/**
+ * Range [begin, end) of output positions whose input position
+ * `out * stride + offset` falls inside [0, in_size).
+ */
+void get_valid_range(
+    int64_t offset,
+    int64_t stride,
+    int64_t in_size,
+    int64_t out_size,
+    int64_t* begin,
+    int64_t* end) {
+  int64_t b = offset >= 0 ? 0 : (-offset + stride - 1) / stride;
+  int64_t e = in_size - 1 - offset < 0 ? 0
+                                       : (in_size - 1 - offset) / stride + 1;
+  *begin = std::min(b, out_size);
+  *end = std::max(*begin, std::min(e, out_size));
+}
+
+/**
+ * Fills each output plane of one batch with its channel's bias, or with zero.
+ */
+template <typename CTYPE>
+void fill_with_bias(
+    CTYPE* out, const CTYPE* bias, int64_t channels, int64_t plane_size) {
+  for (int64_t c = 0; c < channels; ++c) {
+    std::fill(
+        out + c * plane_size,
+        out + (c + 1) * plane_size,
+        bias != nullptr ? bias[c] : static_cast<CTYPE>(0));
+  }
+}
+
+/**
+ * Adds w * in_row[ow * stride] to out_row[ow] for every ow in [begin, end).
+ */
+template <typename CTYPE>
+void axpy_row(
+    CTYPE* out_row,
+    const CTYPE* in_row,
+    CTYPE w,
+    int64_t stride,
+    int64_t begin,
+    int64_t end) {
+  using Vec = executorch::vec::Vectorized<CTYPE>;
+  int64_t ow = begin;
+  if (stride == 1) {
+    const Vec w_vec(w);
+    for (; ow + Vec::size() <= end; ow += Vec::size()) {
+      (Vec::loadu(out_row + ow) + w_vec * Vec::loadu(in_row + ow))
+          .store(out_row + ow);
+    }
+  }
+  for (; ow < end; ++ow) {
+    out_row[ow] += w * in_row[ow * stride];
+  }
+}
+
+/**
+ * Direct convolution, parallel over (batch, output channel) planes. Each
+ * kernel tap is applied to a whole output row at a time, which vectorizes for
+ * unit strides. This is the depthwise path, where there is no reduction over
+ * input channels for a GEMM to exploit.
+ */
+template <typename CTYPE>
+void conv_direct(
+    const CTYPE* in_data,
+    const CTYPE* w_data,
+    const CTYPE* bias_data,
+    CTYPE* out_data,
+    const ConvShape& s) {
+  const int64_t out_c = s.groups * s.out_c_per_group;
+  const int64_t in_plane = s.in_h * s.in_w;
+  const int64_t out_plane = s.out_h * s.out_w;
+  const int64_t taps = s.in_c_per_group * s.kernel_h * s.kernel_w;
+  const int64_t grain =
+      std::max<int64_t>(1, kConvolutionGrainSize / (out_plane * taps));
+  executorch::extension::parallel_for(
+      0, s.batch * out_c, grain, [&](int64_t begin, int64_t end) {
+        for (int64_t plane = begin; plane < end; ++plane) {
+          const int64_t n = plane / out_c;
+          const int64_t oc = plane % out_c;
+          const int64_t g = oc / s.out_c_per_group;
+          const CTYPE* in_g = in_data +
+              (n * s.groups + g) * s.in_c_per_group * in_plane;
+          const CTYPE* w_oc = w_data + oc * taps;
+          CTYPE* out_p = out_data + plane * out_plane;
+          fill_with_bias(
+              out_p, bias_data ? bias_data + oc : nullptr, 1, out_plane);
+          for (int64_t ic = 0; ic < s.in_c_per_group; ++ic) {
+            const CTYPE* in_c = in_g + ic * in_plane;
+            for (int64_t kh = 0; kh < s.kernel_h; ++kh) {
+              const int64_t off_h = kh * s.dilation_h - s.pad_h;
+              int64_t oh_begin, oh_end;
+              get_valid_range(
+                  off_h, s.stride_h, s.in_h, s.out_h, &oh_begin, &oh_end);
+              for (int64_t kw = 0; kw < s.kernel_w; ++kw) {
+                const int64_t off_w = kw * s.dilation_w - s.pad_w;
+                int64_t ow_begin, ow_end;
+                get_valid_range(
+                    off_w, s.stride_w, s.in_w, s.out_w, &ow_begin, &ow_end);
+                const CTYPE w =
+                    w_oc[(ic * s.kernel_h + kh) * s.kernel_w + kw];
+                for (int64_t oh = oh_begin; oh < oh_end; ++oh) {
+                  const CTYPE* in_row =
+                      in_c + (oh * s.stride_h + off_h) * s.in_w + off_w;
+                  axpy_row(
+                      out_p + oh * s.out_w,
+                      in_row,
+                      w,
+                      s.stride_w,
+                      ow_begin,
+                      ow_end);
+                }
+              }
+            }
+          }
+        }
+      });
+}
+
+/**
+ * Unfolds one group of one input image into a [C_per_group * KH * KW,
+ * OH * OW] matrix whose columns are the receptive fields of the output
+ * positions. Padding reads as zero.
+ */
+template <typename CTYPE>
+void im2col(const CTYPE* in_g, CTYPE* col, const ConvShape& s) {
+  const int64_t rows = s.in_c_per_group * s.kernel_h * s.kernel_w;
+  const int64_t out_plane = s.out_h * s.out_w;
+  const int64_t grain = std::max<int64_t>(1, kConvolutionGrainSize / out_plane);
+  executorch::extension::parallel_for(
+      0, rows, grain, [&](int64_t begin, int64_t end) {
+        for (int64_t r = begin; r < end; ++r) {
+          const int64_t kw = r % s.kernel_w;
+          const int64_t kh = (r / s.kernel_w) % s.kernel_h;
+          const int64_t ic = r / (s.kernel_w * s.kernel_h);
+          const CTYPE* in_c = in_g + ic * s.in_h * s.in_w;
+          CTYPE* col_r = col + r * out_plane;
+          const int64_t off_h = kh * s.dilation_h - s.pad_h;
+          const int64_t off_w = kw * s.dilation_w - s.pad_w;
+          int64_t oh_begin, oh_end, ow_begin, ow_end;
+          get_valid_range(
+              off_h, s.stride_h, s.in_h, s.out_h, &oh_begin, &oh_end);
+          get_valid_range(
+              off_w, s.stride_w, s.in_w, s.out_w, &ow_begin, &ow_end);
+          std::fill(
+              col_r, col_r + oh_begin * s.out_w, static_cast<CTYPE>(0));
+          for (int64_t oh = oh_begin; oh < oh_end; ++oh) {
+            CTYPE* col_row = col_r + oh * s.out_w;
+            const CTYPE* in_row =
+                in_c + (oh * s.stride_h + off_h) * s.in_w + off_w;
+            std::fill(col_row, col_row + ow_begin, static_cast<CTYPE>(0));
+            if (s.stride_w == 1) {
+              std::copy(
+                  in_row + ow_begin, in_row + ow_end, col_row + ow_begin);
+            } else {
+              for (int64_t ow = ow_begin; ow < ow_end; ++ow) {
+                col_row[ow] = in_row[ow * s.stride_w];
+              }
+            }
+            std::fill(
+                col_row + ow_end, col_row + s.out_w, static_cast<CTYPE>(0));
+          }
+          std::fill(
+              col_r + oh_end * s.out_w,
+              col_r + out_plane,
+              static_cast<CTYPE>(0));
+        }
+      });
+}
+
+/**
+ * out_g[OC_per_group, P] += w_g[OC_per_group, K] * col[K, P], all row-major,
+ * parallel over blocks of output positions. cpublas is column-major, so this
+ * is computed as out_g^T = col^T * w_g^T.
+ */
+template <typename CTYPE>
+void gemm_over_positions(
+    const CTYPE* col,
+    const CTYPE* w_g,
+    CTYPE* out_g,
+    int64_t out_c_per_group,
+    int64_t k,
+    int64_t positions) {
+  const int64_t grain = std::max<int64_t>(
+      16, kConvolutionGrainSize / std::max<int64_t>(1, k * out_c_per_group));
+  executorch::extension::parallel_for(
+      0, positions, grain, [&](int64_t begin, int64_t end) {
+        executorch::cpublas::gemm(
+            executorch::cpublas::TransposeType::NoTranspose,
+            executorch::cpublas::TransposeType::NoTranspose,
+            end - begin,
+            out_c_per_group,
+            k,
+            static_cast<CTYPE>(1),
+            col + begin,
+            positions,
+            w_g,
+            k,
+            static_cast<CTYPE>(1),
+            out_g + begin,
+            positions);
+      });
+}
+
+/**
+ * Convolution as one GEMM per (batch, group). A 1x1 kernel with unit stride
+ * and no padding reads the input directly; every other shape goes through an
+ * im2col buffer of `col` (which may be null in the 1x1 case).
+ */
+template <typename CTYPE>
+void conv_gemm(
+    const CTYPE* in_data,
+    const CTYPE* w_data,
+    const CTYPE* bias_data,
+    CTYPE* out_data,
+    CTYPE* col,
+    const ConvShape& s) {
+  const int64_t in_plane = s.in_h * s.in_w;
+  const int64_t out_plane = s.out_h * s.out_w;
+  const int64_t k = s.in_c_per_group * s.kernel_h * s.kernel_w;
+  for (int64_t n = 0; n < s.batch; ++n) {
+    for (int64_t g = 0; g < s.groups; ++g) {
+      const CTYPE* in_g =
+          in_data + (n * s.groups + g) * s.in_c_per_group * in_plane;
+      const CTYPE* w_g = w_data + g * s.out_c_per_group * k;
+      CTYPE* out_g =
+          out_data + (n * s.groups + g) * s.out_c_per_group * out_plane;
+      fill_with_bias(
+          out_g,
+          bias_data ? bias_data + g * s.out_c_per_group : nullptr,
+          s.out_c_per_group,
+          out_plane);
+      const CTYPE* a = in_g;
+      if (col != nullptr) {
+        im2col(in_g, col, s);
+        a = col;
+      }
+      gemm_over_positions(a, w_g, out_g, s.out_c_per_group, k, out_plane);
+    }
+  }
+}
+
+bool is_pointwise(const ConvShape& s) {
+  return s.kernel_h == 1 && s.kernel_w == 1 && s.stride_h == 1 &&
+      s.stride_w == 1 && s.pad_h == 0 && s.pad_w == 0;
+}
+
+/**
+ * Whether the fast paths apply: a non-transposed float convolution with
+ * matching dtypes over tensors in the default dim order.
+ */
+bool can_use_fast_path(
+    const Tensor& in,
+    const Tensor& weight,
+    const exec_aten::optional<Tensor>& bias,
+    bool transposed,
+    const Tensor& out) {
+  const ScalarType dtype = in.scalar_type();
+  if (transposed ||
+      (dtype != ScalarType::Float && dtype != ScalarType::Double) ||
+      weight.scalar_type() != dtype || out.scalar_type() != dtype) {
+    return false;
+  }
+  if (bias.has_value() && bias.value().scalar_type() != dtype) {
+    return false;
+  }
+  return tensor_is_default_dim_order(in) &&
+      tensor_is_default_dim_order(weight) &&
+      tensor_is_default_dim_order(out);
+}
+
+} // namespace
+
+Tensor& opt_convolution_out(
+    KernelRuntimeContext& ctx,
+    const Tensor& in,
+    const Tensor& weight,
+    const exec_aten::optional<Tensor>& bias,
+    IntArrayRef stride,
+    IntArrayRef padding,
+    IntArrayRef dilation,
+    bool transposed,
+    IntArrayRef output_padding,
+    int64_t groups,
+    Tensor& out) {
+  ET_KERNEL_CHECK(
+      ctx,
+      check_convolution_args(
+          in,
+          weight,
+          bias,
+          stride,
+          padding,
+          dilation,
+          transposed,
+          output_padding,
+          groups,
+          out),
+      InvalidArgument,
+      out);
+
+  ET_KERNEL_CHECK(
+      ctx, tensors_have_same_dim_order(in, out), InvalidArgument, out);
+
+  size_t output_ndim = 0;
+  exec_aten::SizesType output_sizes[kTensorDimensionLimit];
+  get_convolution_out_target_size(
+      in,
+      weight,
+      stride,
+      padding,
+      dilation,
+      transposed,
+      output_padding,
+      groups,
+      output_sizes,
+      &output_ndim);
+
+  ET_KERNEL_CHECK(
+      ctx,
+      output_size_is_valid({output_sizes, output_ndim}, in.dim() - 2),
+      InvalidArgument,
+      out);
+
+  ET_KERNEL_CHECK(
+      ctx,
+      resize_tensor(out, {output_sizes, output_ndim}) == Error::Ok,
+      InvalidArgument,
+      out);
+
+  if (out.numel() == 0) {
+    return out;
+  }
+
+  // @lint-ignore CLANGTIDY facebook-hte-CArray
+  static constexpr const char name[] = "convolution.out";
+
+  if (can_use_fast_path(in, weight, bias, transposed, out)) {
+    const ConvShape s =
+        get_conv_shape(in, weight, out, stride, padding, dilation, groups);
+    ET_SWITCH_FLOAT_TYPES(in.scalar_type(), ctx, name, CTYPE, [&]() {
+      const CTYPE* in_data = in.const_data_ptr<CTYPE>();
+      const CTYPE* w_data = weight.const_data_ptr<CTYPE>();
+      const CTYPE* bias_data =
+          bias.has_value() ? bias.value().const_data_ptr<CTYPE>() : nullptr;
+      CTYPE* out_data = out.mutable_data_ptr<CTYPE>();
+
+      if (s.in_c_per_group == 1) {
+        conv_direct(in_data, w_data, bias_data, out_data, s);
+        return;
+      }
+      if (is_pointwise(s)) {
+        conv_gemm(
+            in_data,
+            w_data,
+            bias_data,
+            out_data,
+            static_cast<CTYPE*>(nullptr),
+            s);
+        return;
+      }
+      // The im2col buffer comes from the method's temp allocator. Without
+      // one, fall back to the direct convolution.
+      CTYPE* col_data = nullptr;
+      if (ctx.has_temp_allocator()) {
+        const size_t col_size = s.in_c_per_group * s.kernel_h * s.kernel_w *
+            s.out_h * s.out_w * sizeof(CTYPE);
+        Result<void*> col = ctx.allocate_temp(col_size, alignof(CTYPE));
+        if (col.ok()) {
+          col_data = static_cast<CTYPE*>(col.get());
+        }
+      }
+      if (col_data != nullptr) {
+        conv_gemm(in_data, w_data, bias_data, out_data, col_data, s);
+      } else {
+        conv_direct(in_data, w_data, bias_data, out_data, s);
+      }
+    });
+    return out;
+  }
+
+  ET_SWITCH_REALH_TYPES(in.scalar_type(), ctx, name, CTYPE, [&]() {
+    const auto load_bias = bias.has_value()
+        ? utils::internal::get_load_to_common_fn<CTYPE, name>(
+              bias.value(), utils::SupportedTensorDtypes::REALHBF16)
+        : nullptr;
+    apply_convolution_2d<CTYPE>(
+        in,
+        weight,
+        bias,
+        load_bias,
+        stride,
+        padding,
+        dilation,
+        transposed,
+        groups,
+        out);
+  });
+
+  return out;
+}
+
+} // namespace native
+} // namespace executor
+} // namespace torch
@@ -8,8 +8,8 @@
 
 #include <cmath>
 
-#include <executorch/kernels/optimized/vec/functional.h>
-#include <executorch/kernels/optimized/vec/vec.h>
+#include <executorch/extension/kernel_util/make_boxed_from_unboxed_functor.h>
+#include <executorch/kernels/optimized/cpu/unary_kernels.h>
 #include <executorch/runtime/kernel/kernel_includes.h>
 
 namespace torch {
@@ -23,6 +23,7 @@ namespace {
  * vector intrinsics can be used.
  */
 template <
+    typename Kernels,
     typename CTYPE_IN,
     typename CTYPE_OUT,
     typename std::enable_if<
@@ -34,15 +35,14 @@ void exp_data(
     const CTYPE_IN* in_data,
     const size_t numel,
     CTYPE_OUT* out_data) {
-  using Vec = executorch::vec::Vectorized<CTYPE_IN>;
-  executorch::vec::map<CTYPE_IN>(
-      [](Vec x) { return x.exp(); }, out_data, in_data, numel);
+  Kernels::exp(in_data, numel, out_data);
 }
 
 /**
  * Slow path of natural exponential function.
  */
 template <
+    typename Kernels,
     typename CTYPE_IN,
     typename CTYPE_OUT,
     typename std::enable_if<
@@ -62,9 +62,12 @@ void exp_data(
   }
 }
 
-} // namespace
-
-Tensor& opt_exp_out(KernelRuntimeContext& ctx, const Tensor& in, Tensor& out) {
+/**
+ * Body of exp.out, templated on the build of the vectorized loops it calls.
+ * See Note [Optimized kernel ISA variants].
+ */
+template <typename Kernels>
+Tensor& exp_out_impl(KernelRuntimeContext& ctx, const Tensor& in, Tensor& out) {
   (void)ctx;
 
   // Resize for dynamic shape
@@ -81,7 +84,7 @@ Tensor& opt_exp_out(KernelRuntimeContext& ctx, const Tensor& in, Tensor& out) {
   ET_SWITCH_REALHBBF16_TYPES(in.scalar_type(), ctx, "exp.out", CTYPE_IN, [&] {
     ET_SWITCH_FLOATHBF16_TYPES(
         out.scalar_type(), ctx, "exp.out", CTYPE_OUT, [&] {
-          exp_data<CTYPE_IN, CTYPE_OUT>(
+          exp_data<Kernels, CTYPE_IN, CTYPE_OUT>(
               in.const_data_ptr<CTYPE_IN>(),
               in.numel(),
               out.mutable_data_ptr<CTYPE_OUT>());
@@ -91,6 +94,28 @@ Tensor& opt_exp_out(KernelRuntimeContext& ctx, const Tensor& in, Tensor& out) {
   return out;
 }
 
+#if defined(ET_OPTIMIZED_HAS_ISA_VARIANTS)
+#define ET_EXP_ISA_KERNEL(isa)                                       \
+  ::executorch::extension::make_boxed_kernel(                        \
+      "aten::exp.out",                                               \
+      EXECUTORCH_FN(exp_out_impl<isa::UnaryKernels>),                \
+      ::executorch::runtime::KernelIsa::isa),
+
+// Codegen registers opt_exp_out; add the ISA variants alongside it.
+const ::executorch::runtime::Kernel exp_isa_kernels[] = {
+    ET_FORALL_OPTIMIZED_ISA_VARIANTS(ET_EXP_ISA_KERNEL)};
+static auto exp_isa_kernels_registered =
+    ::executorch::runtime::register_kernels(exp_isa_kernels);
+
+#undef ET_EXP_ISA_KERNEL
+#endif // defined(ET_OPTIMIZED_HAS_ISA_VARIANTS)
+
+} // namespace
+
+Tensor& opt_exp_out(KernelRuntimeContext& ctx, const Tensor& in, Tensor& out) {
+  return exp_out_impl<baseline::UnaryKernels>(ctx, in, out);
+}
+
 } // namespace native
 } // namespace executor
 } // namespace torch
@@ -8,8 +8,8 @@
 
 #include <cmath>
 
-#include <executorch/kernels/optimized/vec/functional.h>
-#include <executorch/kernels/optimized/vec/vec.h>
+#include <executorch/extension/kernel_util/make_boxed_from_unboxed_functor.h>
+#include <executorch/kernels/optimized/cpu/unary_kernels.h>
 #include <executorch/runtime/kernel/kernel_includes.h>
 
 namespace torch {
@@ -23,6 +23,7 @@ constexpr bool is_half_or_bf16_v = std::is_same_v<T, exec_aten::Half> ||
     std::is_same_v<T, exec_aten::BFloat16>;
 
 template <
+    typename Kernels,
     typename CTYPE_IN,
     typename CTYPE_OUT,
     typename std::enable_if<
@@ -33,18 +34,11 @@ void sigmoid_data(
     const CTYPE_IN* in_data,
     const size_t numel,
     CTYPE_OUT* out_data) {
-  using Vec = executorch::vec::Vectorized<CTYPE_IN>;
-  executorch::vec::map<CTYPE_IN>(
-      [](Vec x) {
-        auto one_plus_exp = x.neg().exp() + Vec(static_cast<CTYPE_IN>(1.0));
-        return one_plus_exp.reciprocal();
-      },
-      out_data,
-      in_data,
-      numel);
+  Kernels::sigmoid(in_data, numel, out_data);
 }
 
 template <
+    typename Kernels,
     typename CTYPE_IN,
     typename CTYPE_OUT,
     typename std::enable_if<
@@ -61,12 +55,15 @@ void sigmoid_data(
   }
 }
 
-} // namespace
-
 using Tensor = exec_aten::Tensor;
 
+/**
+ * Body of sigmoid.out, templated on the build of the vectorized loops it
+ * calls. See Note [Optimized kernel ISA variants].
+ */
+template <typename Kernels>
 Tensor&
-opt_sigmoid_out(KernelRuntimeContext& ctx, const Tensor& in, Tensor& out) {
+sigmoid_out_impl(KernelRuntimeContext& ctx, const Tensor& in, Tensor& out) {
   (void)ctx;
 
   ET_KERNEL_CHECK(
@@ -88,7 +85,7 @@ opt_sigmoid_out(KernelRuntimeContext& ctx, const Tensor& in, Tensor& out) {
   ScalarType out_type = out.scalar_type();
   ET_SWITCH_REALHB_TYPES(in_type, ctx, "sigmoid.out", CTYPE_IN, [&]() {
     ET_SWITCH_FLOATH_TYPES(out_type, ctx, "sigmoid.out", CTYPE_OUT, [&]() {
-      sigmoid_data<CTYPE_IN, CTYPE_OUT>(
+      sigmoid_data<Kernels, CTYPE_IN, CTYPE_OUT>(
           in.const_data_ptr<CTYPE_IN>(),
           in.numel(),
           out.mutable_data_ptr<CTYPE_OUT>());
@@ -98,6 +95,29 @@ opt_sigmoid_out(KernelRuntimeContext& ctx, const Tensor& in, Tensor& out) {
   return out;
 }
 
+#if defined(ET_OPTIMIZED_HAS_ISA_VARIANTS)
+#define ET_SIGMOID_ISA_KERNEL(isa)                                   \
+  ::executorch::extension::make_boxed_kernel(                        \
+      "aten::sigmoid.out",                                           \
+      EXECUTORCH_FN(sigmoid_out_impl<isa::UnaryKernels>),            \
+      ::executorch::runtime::KernelIsa::isa),
+
+// Codegen registers opt_sigmoid_out; add the ISA variants alongside it.
+const ::executorch::runtime::Kernel sigmoid_isa_kernels[] = {
+    ET_FORALL_OPTIMIZED_ISA_VARIANTS(ET_SIGMOID_ISA_KERNEL)};
+static auto sigmoid_isa_kernels_registered =
+    ::executorch::runtime::register_kernels(sigmoid_isa_kernels);
+
+#undef ET_SIGMOID_ISA_KERNEL
+#endif // defined(ET_OPTIMIZED_HAS_ISA_VARIANTS)
+
+} // namespace
+
+Tensor&
+opt_sigmoid_out(KernelRuntimeContext& ctx, const Tensor& in, Tensor& out) {
+  return sigmoid_out_impl<baseline::UnaryKernels>(ctx, in, out);
+}
+
 } // namespace native
 } // namespace executor
 } // namespace torch
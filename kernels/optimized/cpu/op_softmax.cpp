@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cmath>
+
+#include <executorch/kernels/optimized/cpu/reduction_utils.h>
+#include <executorch/kernels/portable/cpu/util/activation_ops_util.h>
+#include <executorch/kernels/portable/cpu/util/functional_util.h>
+#include <executorch/kernels/portable/cpu/util/reduce_util.h>
+#include <executorch/runtime/kernel/kernel_includes.h>
+
+namespace torch {
+namespace executor {
+namespace native {
+
+using Tensor = exec_aten::Tensor;
+using ScalarType = exec_aten::ScalarType;
+
+namespace {
+
+/**
+ * Softmax of a contiguous row. Each value is shifted by the row maximum before
+ * exp() for numerical stability.
+ */
+template <typename CTYPE>
+void softmax_row(const CTYPE* in, CTYPE* out, int64_t size) {
+  using Vec = executorch::vec::Vectorized<CTYPE>;
+  const Vec max_in(executorch::vec::reduce_all<CTYPE>(
+      [](const Vec& a, const Vec& b) { return ReduceMaximum()(a, b); },
+      in,
+      size));
+  executorch::vec::map<CTYPE>(
+      [max_in](Vec x) { return (x - max_in).exp(); }, out, in, size);
+  const Vec scale(
+      static_cast<CTYPE>(1) /
+      executorch::vec::reduce_all<CTYPE>(
+          [](const Vec& a, const Vec& b) { return a + b; }, out, size));
+  executorch::vec::map<CTYPE>(
+      [scale](Vec x) { return x * scale; }, out, out, size);
+}
+
+/**
+ * Softmax along the middle axis of an [outer, dim_size, inner] view for the
+ * `len` columns starting at `in`/`out`. Every pass walks the softmax axis one
+ * contiguous row of `len` elements at a time.
+ */
+template <typename CTYPE>
+void softmax_strided(
+    const CTYPE* in,
+    CTYPE* out,
+    int64_t dim_size,
+    int64_t inner_size,
+    int64_t len) {
+  using Vec = executorch::vec::Vectorized<CTYPE>;
+  CTYPE max_in[kReductionInnerBlockSize];
+  CTYPE sum[kReductionInnerBlockSize];
+  std::copy(in, in + len, max_in);
+  for (int64_t d = 1; d < dim_size; ++d) {
+    reduce_row_into(ReduceMaximum(), max_in, in + d * inner_size, len);
+  }
+  std::fill(sum, sum + len, static_cast<CTYPE>(0));
+  for (int64_t d = 0; d < dim_size; ++d) {
+    const CTYPE* in_row = in + d * inner_size;
+    CTYPE* out_row = out + d * inner_size;
+    int64_t i = 0;
+    for (; i + Vec::size() <= len; i += Vec::size()) {
+      const Vec e = (Vec::loadu(in_row + i) - Vec::loadu(max_in + i)).exp();
+      e.store(out_row + i);
+      (Vec::loadu(sum + i) + e).store(sum + i);
+    }
+    for (; i < len; ++i) {
+      out_row[i] = std::exp(in_row[i] - max_in[i]);
+      sum[i] += out_row[i];
+    }
+  }
+  for (int64_t i = 0; i < len; ++i) {
+    sum[i] = static_cast<CTYPE>(1) / sum[i];
+  }
+  for (int64_t d = 0; d < dim_size; ++d) {
+    CTYPE* out_row = out + d * inner_size;
+    int64_t i = 0;
+    for (; i + Vec::size() <= len; i += Vec::size()) {
+      (Vec::loadu(out_row + i) * Vec::loadu(sum + i)).store(out_row + i);
+    }
+    for (; i < len; ++i) {
+      out_row[i] *= sum[i];
+    }
+  }
+}
+
+} // namespace
+
+Tensor& opt_softmax_out(
+    KernelRuntimeContext& ctx,
+    const Tensor& in,
+    int64_t dim,
+    bool half_to_float,
+    Tensor& out) {
+  (void)ctx;
+
+  ET_KERNEL_CHECK(
+      ctx,
+      check_softmax_args(in, dim, half_to_float, out),
+      InvalidArgument,
+      out);
+
+  ET_KERNEL_CHECK(
+      ctx, resize_tensor(out, in.sizes()) == Error::Ok, InvalidArgument, out);
+
+  ET_KERNEL_CHECK(
+      ctx, tensors_have_same_dim_order(in, out), InvalidArgument, out);
+
+  // Adjust for negative dim
+  dim = dim < 0 ? dim + nonzero_dim(in) : dim;
+
+  ReductionShape shape;
+  if (in.numel() > 0 &&
+      (in.scalar_type() == ScalarType::Float ||
+       in.scalar_type() == ScalarType::Double) &&
+      get_reduction_shape(in, optional<int64_t>(dim), shape)) {
+    ET_SWITCH_FLOAT_TYPES(in.scalar_type(), ctx, "_softmax.out", CTYPE, [&] {
+      const CTYPE* const in_data = in.const_data_ptr<CTYPE>();
+      CTYPE* const out_data = out.mutable_data_ptr<CTYPE>();
+      parallel_for_each_reduction_block(
+          shape, [&](int64_t outer_ix, int64_t inner_begin, int64_t len) {
+            const int64_t base =
+                outer_ix * shape.reduce_size * shape.inner_size + inner_begin;
+            if (shape.inner_size == 1) {
+              softmax_row(in_data + base, out_data + base, shape.reduce_size);
+            } else {
+              softmax_strided(
+                  in_data + base,
+                  out_data + base,
+                  shape.reduce_size,
+                  shape.inner_size,
+                  len);
+            }
+          });
+    });
+    return out;
+  }
+
+  ET_SWITCH_FLOATH_TYPES(in.scalar_type(), ctx, "_softmax.out", CTYPE, [&]() {
+    const CTYPE* const in_data = in.const_data_ptr<CTYPE>();
+    CTYPE* const out_data = out.mutable_data_ptr<CTYPE>();
+
+    apply_over_dim(
+        [in_data, out_data](
+            const size_t size, const size_t stride, const size_t base) {
+          const CTYPE max_in = apply_unary_reduce_fn(
+              [](const CTYPE val_in, CTYPE val_accum) {
+                return std::max(val_in, val_accum);
+              },
+              in_data + base,
+              size,
+              stride);
+
+          const CTYPE temp_sum = apply_unary_map_reduce_fn<CTYPE, CTYPE>(
+              [max_in](const CTYPE val_in) {
+                return std::exp(val_in - max_in);
+              },
+              [](const CTYPE mapped_in, CTYPE val_accum) {
+                return val_accum + mapped_in;
+              },
+              in_data + base,
+              size,
+              stride);
+
+          apply_unary_map_fn(
+              [max_in, temp_sum](const CTYPE val_in) {
+                return std::exp(val_in - max_in) / temp_sum;
+              },
+              in_data + base,
+              out_data + base,
+              size,
+              stride);
+        },
+        in,
+        dim);
+  });
+
+  return out;
+}
+
+} // namespace native
+} // namespace executor
+} // namespace torch
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cmath>
+#include <type_traits>
+
+#include <executorch/kernels/optimized/cpu/reduction_utils.h>
+#include <executorch/kernels/portable/cpu/scalar_utils.h>
+#include <executorch/kernels/portable/cpu/util/reduce_util.h>
+#include <executorch/runtime/kernel/kernel_includes.h>
+#include <executorch/runtime/platform/assert.h>
+
+namespace torch {
+namespace executor {
+namespace native {
+
+using ScalarType = exec_aten::ScalarType;
+
+namespace {
+
+/**
+ * Two-pass variance over the middle axis of an [outer, reduce, inner] view,
+ * vectorized along the reduced axis when inner_size is 1 and along the inner
+ * axis otherwise.
+ */
+template <typename CTYPE>
+void compute_variance_over_shape(
+    const CTYPE* in_data,
+    CTYPE* out_data,
+    const ReductionShape& shape,
+    const double denominator) {
+  using Vec = executorch::vec::Vectorized<CTYPE>;
+  const int64_t reduce_size = shape.reduce_size;
+  const int64_t inner_size = shape.inner_size;
+  const CTYPE num = static_cast<CTYPE>(reduce_size);
+  parallel_for_each_reduction_block(
+      shape, [&](int64_t outer_ix, int64_t inner_begin, int64_t len) {
+        const CTYPE* src =
+            in_data + outer_ix * reduce_size * inner_size + inner_begin;
+        CTYPE* dst = out_data + outer_ix * inner_size + inner_begin;
+        if (inner_size == 1) {
+          const CTYPE mean =
+              executorch::vec::reduce_all<CTYPE>(
+                  [](const Vec& a, const Vec& b) { return a + b; },
+                  src,
+                  reduce_size) /
+              num;
+          const Vec mean_vec(mean);
+          const CTYPE sum2 = executorch::vec::map_reduce_all<CTYPE>(
+              [mean_vec](const Vec& x) {
+                const Vec d = x - mean_vec;
+                return d * d;
+              },
+              [](const Vec& a, const Vec& b) { return a + b; },
+              src,
+              reduce_size);
+          *dst = sum2 / denominator;
+          return;
+        }
+        CTYPE mean[kReductionInnerBlockSize];
+        std::copy(src, src + len, mean);
+        for (int64_t r = 1; r < reduce_size; ++r) {
+          reduce_row_into(ReduceAdd(), mean, src + r * inner_size, len);
+        }
+        for (int64_t i = 0; i < len; ++i) {
+          mean[i] /= num;
+        }
+        std::fill(dst, dst + len, static_cast<CTYPE>(0));
+        for (int64_t r = 0; r < reduce_size; ++r) {
+          const CTYPE* row = src + r * inner_size;
+          int64_t i = 0;
+          for (; i + Vec::size() <= len; i += Vec::size()) {
+            const Vec d = Vec::loadu(row + i) - Vec::loadu(mean + i);
+            (Vec::loadu(dst + i) + d * d).store(dst + i);
+          }
+          for (; i < len; ++i) {
+            const CTYPE d = row[i] - mean[i];
+            dst[i] += d * d;
+          }
+        }
+        for (int64_t i = 0; i < len; ++i) {
+          dst[i] = dst[i] / denominator;
+        }
+      });
+}
+
+template <typename CTYPE_IN, typename CTYPE_OUT>
+void compute_variance(
+    const Tensor& in,
+    Tensor& out,
+    optional<ArrayRef<int64_t>> dim_list,
+    const size_t num,
+    const double denominator) {
+  CTYPE_OUT* out_data = out.mutable_data_ptr<CTYPE_OUT>();
+  if (num == 0 || denominator <= 0) {
+    for (size_t out_ix = 0; out_ix < out.numel(); ++out_ix) {
+      out_data[out_ix] = NAN;
+    }
+    return;
+  }
+
+  if constexpr (std::is_same_v<CTYPE_IN, CTYPE_OUT>) {
+    ReductionShape shape;
+    if (get_reduction_shape(in, dim_list, shape)) {
+      compute_variance_over_shape(
+          in.const_data_ptr<CTYPE_IN>(), out_data, shape, denominator);
+      return;
+    }
+  }
+
+  for (size_t out_ix = 0; out_ix < out.numel(); ++out_ix) {
+    CTYPE_OUT sum = map_reduce_over_dim_list<CTYPE_IN, CTYPE_OUT>(
+        [](CTYPE_IN v) { return static_cast<CTYPE_OUT>(v); },
+        [](CTYPE_OUT outv, CTYPE_OUT acc) { return acc + outv; },
+        in,
+        dim_list,
+        out_ix);
+    CTYPE_OUT mean = sum / num;
+    CTYPE_OUT sum2 = map_reduce_over_dim_list<CTYPE_IN, CTYPE_OUT>(
+        [mean](CTYPE_IN v) {
+          return (
+              (static_cast<CTYPE_OUT>(v) - mean) *
+              (static_cast<CTYPE_OUT>(v) - mean));
+        },
+        [](CTYPE_OUT outv, CTYPE_OUT acc) { return acc + outv; },
+        in,
+        dim_list,
+        out_ix);
+    out_data[out_ix] = sum2 / denominator;
+  }
+}
+
+} // namespace
+
+Tensor& opt_var_out(
+    KernelRuntimeContext& ctx,
+    const Tensor& in,
+    optional<ArrayRef<int64_t>> dim_list,
+    bool unbiased,
+    bool keepdim,
+    Tensor& out) {
+  (void)ctx;
+
+  ET_KERNEL_CHECK(
+      ctx,
+      check_reduction_args(in, dim_list, keepdim, {}, out),
+      InvalidArgument,
+      out);
+
+  ET_KERNEL_CHECK(ctx, tensor_is_floating_type(in), InvalidArgument, out);
+  ET_KERNEL_CHECK(ctx, tensor_is_floating_type(out), InvalidArgument, out);
+
+  ET_KERNEL_CHECK(
+      ctx, tensors_have_same_dim_order(in, out), InvalidArgument, out);
+
+  ET_KERNEL_CHECK(ctx, tensor_is_default_dim_order(in), InvalidArgument, out);
+
+  ET_KERNEL_CHECK(
+      ctx,
+      resize_reduction_out(in, dim_list, keepdim, out) == Error::Ok,
+      InvalidArgument,
+      out);
+
+  const size_t num = get_reduced_dim_product(in, dim_list);
+  const size_t denom = unbiased ? num - 1 : num;
+
+  constexpr auto name = "var.out";
+
+  ET_SWITCH_FLOAT_TYPES(in.scalar_type(), ctx, name, CTYPE_IN, [&] {
+    ET_SWITCH_FLOAT_TYPES(out.scalar_type(), ctx, name, CTYPE_OUT, [&] {
+      compute_variance<CTYPE_IN, CTYPE_OUT>(in, out, dim_list, num, denom);
+    });
+  });
+
+  return out;
+}
+
+Tensor& opt_var_correction_out(
+    KernelRuntimeContext& ctx,
+    const Tensor& in,
+    optional<ArrayRef<int64_t>> dim_list,
+    const optional<Scalar>& correction,
+    bool keepdim,
+    Tensor& out) {
+  (void)ctx;
+
+  ET_KERNEL_CHECK(
+      ctx,
+      check_reduction_args(in, dim_list, keepdim, {}, out),
+      InvalidArgument,
+      out);
+
+  ET_KERNEL_CHECK(
+      ctx,
+      resize_reduction_out(in, dim_list, keepdim, out) == Error::Ok,
+      InvalidArgument,
+      out);
+
+  constexpr auto name = "var.correction_out";
+
+  double correction_val = 1;
+  if (correction.has_value()) {
+    ScalarType corr_type = utils::get_scalar_dtype(correction.value());
+    ET_SWITCH_SCALAR_OBJ_TYPES(corr_type, ctx, name, CTYPE_CORR, [&]() {
+      CTYPE_CORR corr_val = 0;
+      utils::extract_scalar(correction.value(), &corr_val);
+      correction_val = static_cast<double>(corr_val);
+    });
+  }
+
+  const size_t num = get_reduced_dim_product(in, dim_list);
+  const double denom = num - correction_val;
+
+  ET_SWITCH_FLOAT_TYPES(in.scalar_type(), ctx, name, CTYPE_IN, [&] {
+    ET_SWITCH_FLOAT_TYPES(out.scalar_type(), ctx, name, CTYPE_OUT, [&] {
+      compute_variance<CTYPE_IN, CTYPE_OUT>(in, out, dim_list, num, denom);
+    });
+  });
+
+  return out;
+}
+
+} // namespace native
+} // namespace executor
+} // namespace torch
@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/kernels/optimized/cpu/permute_util.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include <executorch/extension/parallel/thread_parallel.h>
+#include <executorch/kernels/optimized/vec/intrinsics.h>
+
+namespace torch {
+namespace executor {
+namespace native {
+
+namespace {
+
+// Bytes each parallel_for work item should move at least, so that small
+// copies stay on one thread.
+constexpr int64_t kPermuteGrainBytes = 32 * 1024;
+
+// Side of the square tiles that 2D transposes are split into. A source and a
+// destination tile of 8-byte elements fit in L1 together.
+constexpr int64_t kTransposeTile = 32;
+
+/**
+ * A permute reduced to the dimensions that matter, in output dimension order:
+ * size-1 dimensions are dropped and dimensions that are contiguous with their
+ * neighbor in both tensors are merged. Strides are in elements.
+ */
+struct PermutePlan {
+  int64_t ndim = 0;
+  int64_t sizes[kTensorDimensionLimit];
+  int64_t in_strides[kTensorDimensionLimit];
+  int64_t out_strides[kTensorDimensionLimit];
+};
+
+PermutePlan
+make_permute_plan(const Tensor& in, const int64_t* dims, const Tensor& out) {
+  PermutePlan plan;
+  for (size_t i = 0; i < out.dim(); ++i) {
+    const int64_t size = out.size(i);
+    if (size == 1) {
+      continue;
+    }
+    const int64_t in_stride = in.strides()[dims[i]];
+    const int64_t out_stride = out.strides()[i];
+    if (plan.ndim > 0) {
+      const int64_t prev = plan.ndim - 1;
+      if (plan.in_strides[prev] == in_stride * size &&
+          plan.out_strides[prev] == out_stride * size) {
+        plan.sizes[prev] *= size;
+        plan.in_strides[prev] = in_stride;
+        plan.out_strides[prev] = out_stride;
+        continue;
+      }
+    }
+    plan.sizes[plan.ndim] = size;
+    plan.in_strides[plan.ndim] = in_stride;
+    plan.out_strides[plan.ndim] = out_stride;
+    plan.ndim++;
+  }
+  return plan;
+}
+
+/**
+ * The dimensions of a plan that are iterated around a copy of rows or tiles,
+ * i.e. all but up to two excluded ones.
+ */
+struct OuterDims {
+  int64_t ndim = 0;
+  int64_t dims[kTensorDimensionLimit];
+  int64_t numel = 1;
+
+  OuterDims(const PermutePlan& plan, int64_t skip0, int64_t skip1) {
+    for (int64_t d = 0; d < plan.ndim; ++d) {
+      if (d != skip0 && d != skip1) {
+        dims[ndim++] = d;
+        numel *= plan.sizes[d];
+      }
+    }
+  }
+
+  /// Computes where outer element `index` starts in both tensors.
+  void offsets(
+      const PermutePlan& plan,
+      int64_t index,
+      int64_t* in_offset,
+      int64_t* out_offset) const {
+    int64_t in_off = 0;
+    int64_t out_off = 0;
+    for (int64_t k = ndim - 1; k >= 0; --k) {
+      const int64_t d = dims[k];
+      const int64_t i = index % plan.sizes[d];
+      index /= plan.sizes[d];
+      in_off += i * plan.in_strides[d];
+      out_off += i * plan.out_strides[d];
+    }
+    *in_offset = in_off;
+    *out_offset = out_off;
+  }
+};
+
+/// Copies a square block of `kSize` x `kSize` elements, transposing it. The
+/// default is a placeholder for element types without a SIMD version.
+template <typename T>
+struct TransposeMicroKernel {
+  static constexpr int64_t kSize = 1;
+  static void
+  run(const T* src, int64_t ld_src, T* dst, int64_t ld_dst) = delete;
+};
+
+#if defined(CPU_CAPABILITY_AVX2) || defined(CPU_CAPABILITY_AVX512)
+
+template <>
+struct TransposeMicroKernel<uint32_t> {
+  static constexpr int64_t kSize = 8;
+  static void
+  run(const uint32_t* src, int64_t ld_src, uint32_t* dst, int64_t ld_dst) {
+    const auto load = [&](int64_t row) {
+      return _mm256_loadu_ps(reinterpret_cast<const float*>(src + row * ld_src));
+    };
+    // Interleave pairs of rows, then pairs of pairs, then swap the 128-bit
+    // halves so that output row k holds element k of every input row.
+    const __m256 t0 = _mm256_unpacklo_ps(load(0), load(1));
+    const __m256 t1 = _mm256_unpackhi_ps(load(0), load(1));
+    const __m256 t2 = _mm256_unpacklo_ps(load(2), load(3));
+    const __m256 t3 = _mm256_unpackhi_ps(load(2), load(3));
+    const __m256 t4 = _mm256_unpacklo_ps(load(4), load(5));
+    const __m256 t5 = _mm256_unpackhi_ps(load(4), load(5));
+    const __m256 t6 = _mm256_unpacklo_ps(load(6), load(7));
+    const __m256 t7 = _mm256_unpackhi_ps(load(6), load(7));
+    const __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+    const auto store = [&](int64_t row, __m256 v) {
+      _mm256_storeu_ps(reinterpret_cast<float*>(dst + row * ld_dst), v);
+    };
+    store(0, _mm256_permute2f128_ps(s0, s4, 0x20));
+    store(1, _mm256_permute2f128_ps(s1, s5, 0x20));
+    store(2, _mm256_permute2f128_ps(s2, s6, 0x20));
+    store(3, _mm256_permute2f128_ps(s3, s7, 0x20));
+    store(4, _mm256_permute2f128_ps(s0, s4, 0x31));
+    store(5, _mm256_permute2f128_ps(s1, s5, 0x31));
+    store(6, _mm256_permute2f128_ps(s2, s6, 0x31));
+    store(7, _mm256_permute2f128_ps(s3, s7, 0x31));
+  }
+};
+
+#elif defined(__aarch64__)
+
+template <>
+struct TransposeMicroKernel<uint32_t> {
+  static constexpr int64_t kSize = 4;
+  static void
+  run(const uint32_t* src, int64_t ld_src, uint32_t* dst, int64_t ld_dst) {
+    // vtrnq_u32(a, b) = {a0 b0 a2 b2}, {a1 b1 a3 b3}; combining the halves of
+    // two such pairs yields the columns.
+    const uint32x4x2_t p01 =
+        vtrnq_u32(vld1q_u32(src), vld1q_u32(src + ld_src));
+    const uint32x4x2_t p23 =
+        vtrnq_u32(vld1q_u32(src + 2 * ld_src), vld1q_u32(src + 3 * ld_src));
+    vst1q_u32(
+        dst,
+        vcombine_u32(vget_low_u32(p01.val[0]), vget_low_u32(p23.val[0])));
+    vst1q_u32(
+        dst + ld_dst,
+        vcombine_u32(vget_low_u32(p01.val[1]), vget_low_u32(p23.val[1])));
+    vst1q_u32(
+        dst + 2 * ld_dst,
+        vcombine_u32(vget_high_u32(p01.val[0]), vget_high_u32(p23.val[0])));
+    vst1q_u32(
+        dst + 3 * ld_dst,
+        vcombine_u32(vget_high_u32(p01.val[1]), vget_high_u32(p23.val[1])));
+  }
+};
+
+#endif
+
+/**
+ * Writes the transpose of the `rows` x `cols` matrix at `src` to `dst`:
+ * dst[j * ld_dst + i] = src[i * ld_src + j].
+ */
+template <typename T>
+void transpose_tile(
+    const T* src,
+    int64_t ld_src,
+    T* dst,
+    int64_t ld_dst,
+    int64_t rows,
+    int64_t cols) {
+  using Micro = TransposeMicroKernel<T>;
+  int64_t i = 0;
+  if constexpr (Micro::kSize > 1) {
+    constexpr int64_t kSize = Micro::kSize;
+    for (; i + kSize <= rows; i += kSize) {
+      int64_t j = 0;
+      for (; j + kSize <= cols; j += kSize) {
+        Micro::run(src + i * ld_src + j, ld_src, dst + j * ld_dst + i, ld_dst);
+      }
+      for (; j < cols; ++j) {
+        for (int64_t ii = i; ii < i + kSize; ++ii) {
+          dst[j * ld_dst + ii] = src[ii * ld_src + j];
+        }
+      }
+    }
+  }
+  for (; i < rows; ++i) {
+    for (int64_t j = 0; j < cols; ++j) {
+      dst[j * ld_dst + i] = src[i * ld_src + j];
+    }
+  }
+}
+
+/// Copies rows that are contiguous in both tensors along dimension `row_dim`.
+void permute_rows(
+    const PermutePlan& plan,
+    int64_t row_dim,
+    const char* in,
+    char* out,
+    size_t elem_size) {
+  const OuterDims outer(plan, row_dim, -1);
+  // Long rows are split into pieces so that they can be copied in parallel.
+  const int64_t row_bytes = plan.sizes[row_dim] * elem_size;
+  const int64_t piece_bytes =
+      std::max<int64_t>(elem_size, kPermuteGrainBytes / elem_size * elem_size);
+  const int64_t pieces = (row_bytes + piece_bytes - 1) / piece_bytes;
+  const int64_t grain = std::max<int64_t>(
+      1, kPermuteGrainBytes / std::min(row_bytes, piece_bytes));
+  executorch::extension::parallel_for(
+      0, outer.numel * pieces, grain, [&](int64_t begin, int64_t end) {
+        for (int64_t item = begin; item < end; ++item) {
+          int64_t in_offset, out_offset;
+          outer.offsets(plan, item / pieces, &in_offset, &out_offset);
+          const int64_t piece_begin = (item % pieces) * piece_bytes;
+          std::memcpy(
+              out + out_offset * elem_size + piece_begin,
+              in + in_offset * elem_size + piece_begin,
+              std::min(piece_bytes, row_bytes - piece_begin));
+        }
+      });
+}
+
+/**
+ * Copies the plan as 2D transposes between `in_dim`, along which `in` is
+ * contiguous, and `out_dim`, along which `out` is.
+ */
+template <typename T>
+void permute_transpose(
+    const PermutePlan& plan,
+    int64_t in_dim,
+    int64_t out_dim,
+    const T* in,
+    T* out) {
+  const OuterDims outer(plan, in_dim, out_dim);
+  // The source matrix has a row per index of out_dim and the destination
+  // matrix a row per index of in_dim.
+  const int64_t rows = plan.sizes[out_dim];
+  const int64_t cols = plan.sizes[in_dim];
+  const int64_t ld_src = plan.in_strides[out_dim];
+  const int64_t ld_dst = plan.out_strides[in_dim];
+  const int64_t row_tiles = (rows + kTransposeTile - 1) / kTransposeTile;
+  const int64_t col_tiles = (cols + kTransposeTile - 1) / kTransposeTile;
+  const int64_t tiles = row_tiles * col_tiles;
+  const int64_t grain = std::max<int64_t>(
+      1,
+      kPermuteGrainBytes /
+          (std::min(rows, kTransposeTile) * std::min(cols, kTransposeTile) *
+           static_cast<int64_t>(sizeof(T))));
+  executorch::extension::parallel_for(
+      0, outer.numel * tiles, grain, [&](int64_t begin, int64_t end) {
+        for (int64_t item = begin; item < end; ++item) {
+          int64_t in_offset, out_offset;
+          outer.offsets(plan, item / tiles, &in_offset, &out_offset);
+          // Consecutive items walk along a row of tiles.
+          const int64_t i = (item % tiles) % row_tiles * kTransposeTile;
+          const int64_t j = (item % tiles) / row_tiles * kTransposeTile;
+          transpose_tile(
+              in + in_offset + i * ld_src + j,
+              ld_src,
+              out + out_offset + j * ld_dst + i,
+              ld_dst,
+              std::min(kTransposeTile, rows - i),
+              std::min(kTransposeTile, cols - j));
+        }
+      });
+}
+
+/// Copies the plan one element at a time along `inner_dim`.
+template <typename T>
+void permute_strided(
+    const PermutePlan& plan,
+    int64_t inner_dim,
+    const T* in,
+    T* out) {
+  const OuterDims outer(plan, inner_dim, -1);
+  const int64_t size = plan.sizes[inner_dim];
+  const int64_t in_stride = plan.in_strides[inner_dim];
+  const int64_t out_stride = plan.out_strides[inner_dim];
+  const int64_t grain = std::max<int64_t>(
+      1, kPermuteGrainBytes / (size * static_cast<int64_t>(sizeof(T))));
+  executorch::extension::parallel_for(
+      0, outer.numel, grain, [&](int64_t begin, int64_t end) {
+        for (int64_t item = begin; item < end; ++item) {
+          int64_t in_offset, out_offset;
+          outer.offsets(plan, item, &in_offset, &out_offset);
+          const T* src = in + in_offset;
+          T* dst = out + out_offset;
+          for (int64_t k = 0; k < size; ++k) {
+            dst[k * out_stride] = src[k * in_stride];
+          }
+        }
+      });
+}
+
+template <typename T>
+void permute_elements(
+    const PermutePlan& plan,
+    int64_t in_dim,
+    int64_t out_dim,
+    const void* in,
+    void* out) {
+  const T* in_data = static_cast<const T*>(in);
+  T* out_data = static_cast<T*>(out);
+  if (in_dim >= 0 && out_dim >= 0) {
+    permute_transpose(plan, in_dim, out_dim, in_data, out_data);
+  } else {
+    permute_strided(
+        plan, out_dim >= 0 ? out_dim : plan.ndim - 1, in_data, out_data);
+  }
+}
+
+// Stands in for 16-byte element types, i.e. complex double.
+struct Bytes16 {
+  uint64_t lo;
+  uint64_t hi;
+};
+
+} // namespace
+
+void permute_tensor_data(const Tensor& in, const int64_t* dims, Tensor& out) {
+  if (out.numel() == 0) {
+    return;
+  }
+  const size_t elem_size = in.element_size();
+  const char* in_data = static_cast<const char*>(in.const_data_ptr());
+  char* out_data = static_cast<char*>(out.mutable_data_ptr());
+
+  const PermutePlan plan = make_permute_plan(in, dims, out);
+  if (plan.ndim == 0) {
+    std::memcpy(out_data, in_data, elem_size);
+    return;
+  }
+
+  int64_t in_dim = -1;
+  int64_t out_dim = -1;
+  for (int64_t d = 0; d < plan.ndim; ++d) {
+    if (plan.in_strides[d] == 1) {
+      in_dim = d;
+    }
+    if (plan.out_strides[d] == 1) {
+      out_dim = d;
+    }
+  }
+  if (in_dim >= 0 && in_dim == out_dim) {
+    permute_rows(plan, in_dim, in_data, out_data, elem_size);
+    return;
+  }
+
+  switch (elem_size) {
+    case 1:
+      permute_elements<uint8_t>(plan, in_dim, out_dim, in_data, out_data);
+      break;
+    case 2:
+      permute_elements<uint16_t>(plan, in_dim, out_dim, in_data, out_data);
+      break;
+    case 4:
+      permute_elements<uint32_t>(plan, in_dim, out_dim, in_data, out_data);
+      break;
+    case 8:
+      permute_elements<uint64_t>(plan, in_dim, out_dim, in_data, out_data);
+      break;
+    case 16:
+      permute_elements<Bytes16>(plan, in_dim, out_dim, in_data, out_data);
+      break;
+    default:
+      ET_CHECK_MSG(false, "Unsupported element size %zu", elem_size);
+  }
+}
+
+} // namespace native
+} // namespace executor
+} // namespace torch
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <executorch/runtime/kernel/kernel_includes.h>
+
+namespace torch {
+namespace executor {
+namespace native {
+
+/**
+ * Copies the elements of `in` into `out` so that dimension i of `out` is
+ * dimension `dims[i]` of `in`. Both tensors are addressed through their
+ * strides, so any pair of dim orders works.
+ *
+ * Dimensions that stay adjacent and contiguous in both tensors are merged
+ * first. What remains is copied in one of three ways:
+ * - contiguous rows shared by both tensors are memcpy'd,
+ * - a swap of the innermost dimension with another is copied as cache-sized
+ *   2D transposes, using SIMD shuffles for 4-byte elements where available,
+ * - anything else is copied elementwise along the innermost dimension.
+ * The work is split over the outer dimensions with parallel_for.
+ *
+ * @param[in] in The tensor to copy from.
+ * @param[in] dims A permutation of [0, in.dim()), with no negative entries.
+ * @param[out] out The tensor to copy into. Must have the same dtype as `in`
+ *     and sizes `in.size(dims[i])`.
+ */
+void permute_tensor_data(const Tensor& in, const int64_t* dims, Tensor& out);
+
+} // namespace native
+} // namespace executor
+} // namespace torch
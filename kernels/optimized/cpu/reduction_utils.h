@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include <executorch/extension/parallel/thread_parallel.h>
+#include <executorch/kernels/optimized/vec/functional.h>
+#include <executorch/kernels/optimized/vec/vec.h>
+#include <executorch/runtime/core/exec_aten/exec_aten.h>
+#include <executorch/runtime/core/exec_aten/util/tensor_util.h>
+
+/**
+ * Helpers shared by the optimized reduction kernels (sum, mean, amax, amin,
+ * var, argmax) and by softmax.
+ *
+ * A reduction over a set of dimensions of a contiguous tensor that, ignoring
+ * size-1 dimensions, form a single block is a reduction over the middle axis
+ * of an [outer_size, reduce_size, inner_size] view of the data:
+ *   - when inner_size == 1 the reduced elements of each output are contiguous
+ *     and are reduced with full-width vector loads;
+ *   - otherwise consecutive outputs read consecutive inputs, so each step of
+ *     the reduction is vectorized across the inner axis instead.
+ * Work is split across the extension threadpool over outer slices and blocks
+ * of the inner axis. Every output element is produced by exactly one task.
+ */
+
+namespace torch {
+namespace executor {
+namespace native {
+
+struct ReductionShape {
+  int64_t outer_size = 1;
+  int64_t reduce_size = 1;
+  int64_t inner_size = 1;
+};
+
+/**
+ * Minimum number of input elements each task should read, so that waking
+ * worker threads is worth it.
+ */
+constexpr int64_t kReductionGrainSize = 32 * 1024;
+
+/**
+ * Number of inner-axis elements handled by one task of a strided reduction.
+ * Kernels may keep per-block scratch buffers of this size on the stack.
+ */
+constexpr int64_t kReductionInnerBlockSize = 256;
+
+namespace internal {
+
+inline bool get_reduction_shape_from_mask(
+    const exec_aten::Tensor& in,
+    const bool* reduced,
+    ReductionShape& shape) {
+  if (!tensor_is_default_dim_order(in)) {
+    return false;
+  }
+  shape = ReductionShape();
+  // Whether the reduced block has started, and whether it has ended.
+  bool in_block = false;
+  bool after_block = false;
+  for (ssize_t d = 0; d < in.dim(); ++d) {
+    const int64_t size = in.size(d);
+    if (size == 1) {
+      continue;
+    }
+    if (reduced[d]) {
+      if (after_block) {
+        return false;
+      }
+      in_block = true;
+      shape.reduce_size *= size;
+    } else if (in_block) {
+      after_block = true;
+      shape.inner_size *= size;
+    } else {
+      shape.outer_size *= size;
+    }
+  }
+  return true;
+}
+
+} // namespace internal
+
+/**
+ * Computes the [outer, reduce, inner] view of a reduction of `in` over
+ * `dim_list`, where a null or empty list means every dimension. Returns false
+ * if `in` is not in the default dim order or if the reduced dimensions are
+ * not adjacent once size-1 dimensions are dropped; callers must then use a
+ * generic implementation. `dim_list` must already have been validated.
+ */
+inline bool get_reduction_shape(
+    const exec_aten::Tensor& in,
+    const exec_aten::optional<exec_aten::ArrayRef<int64_t>>& dim_list,
+    ReductionShape& shape) {
+  bool reduced[kTensorDimensionLimit];
+  const bool reduce_all =
+      !dim_list.has_value() || dim_list.value().size() == 0;
+  std::fill(reduced, reduced + kTensorDimensionLimit, reduce_all);
+  if (!reduce_all) {
+    for (const int64_t d : dim_list.value()) {
+      reduced[d < 0 ? d + nonzero_dim(in) : d] = true;
+    }
+  }
+  return internal::get_reduction_shape_from_mask(in, reduced, shape);
+}
+
+/**
+ * Like the dim_list overload, for reductions and normalizations over a single
+ * dimension. A null `dim` means every dimension.
+ */
+inline bool get_reduction_shape(
+    const exec_aten::Tensor& in,
+    const exec_aten::optional<int64_t>& dim,
+    ReductionShape& shape) {
+  bool reduced[kTensorDimensionLimit];
+  std::fill(reduced, reduced + kTensorDimensionLimit, !dim.has_value());
+  if (dim.has_value()) {
+    const int64_t d = dim.value();
+    reduced[d < 0 ? d + nonzero_dim(in) : d] = true;
+  }
+  return internal::get_reduction_shape_from_mask(in, reduced, shape);
+}
+
+/**
+ * Calls f(outer_ix, inner_begin, inner_len) for every block of at most
+ * kReductionInnerBlockSize outputs along the inner axis of each outer slice,
+ * possibly on several threads. When inner_size is 1 every call covers the
+ * single output of one outer slice.
+ */
+template <typename Func>
+inline void parallel_for_each_reduction_block(
+    const ReductionShape& shape,
+    const Func& f) {
+  const int64_t block = std::min(shape.inner_size, kReductionInnerBlockSize);
+  if (block <= 0 || shape.outer_size <= 0) {
+    return;
+  }
+  const int64_t num_blocks = (shape.inner_size + block - 1) / block;
+  const int64_t grain_size = std::max<int64_t>(
+      1,
+      kReductionGrainSize / std::max<int64_t>(1, shape.reduce_size * block));
+  executorch::extension::parallel_for(
+      0,
+      shape.outer_size * num_blocks,
+      grain_size,
+      [&](int64_t begin, int64_t end) {
+        for (int64_t task = begin; task < end; ++task) {
+          const int64_t outer_ix = task / num_blocks;
+          const int64_t inner_begin = (task % num_blocks) * block;
+          f(outer_ix,
+            inner_begin,
+            std::min(block, shape.inner_size - inner_begin));
+        }
+      });
+}
+
+/// Reduction operator for sums.
+struct ReduceAdd {
+  template <typename T>
+  T operator()(const T& a, const T& b) const {
+    return a + b;
+  }
+};
+
+/// Reduction operator for maximums. NaN propagates, as in amax.
+struct ReduceMaximum {
+  template <typename T>
+  T operator()(const T& a, const T& b) const {
+    return std::isnan(a) || a > b ? a : b;
+  }
+  template <typename T>
+  executorch::vec::Vectorized<T> operator()(
+      const executorch::vec::Vectorized<T>& a,
+      const executorch::vec::Vectorized<T>& b) const {
+    return executorch::vec::maximum(a, b);
+  }
+};
+
+/// Reduction operator for minimums. NaN propagates, as in amin.
+struct ReduceMinimum {
+  template <typename T>
+  T operator()(const T& a, const T& b) const {
+    return std::isnan(a) || a < b ? a : b;
+  }
+  template <typename T>
+  executorch::vec::Vectorized<T> operator()(
+      const executorch::vec::Vectorized<T>& a,
+      const executorch::vec::Vectorized<T>& b) const {
+    return executorch::vec::minimum(a, b);
+  }
+};
+
+/**
+ * acc[i] = op(acc[i], row[i]) for i in [0, size), vectorized. `op` must accept
+ * both scalars and Vectorized<T>.
+ */
+template <typename T, typename Op>
+inline void
+reduce_row_into(const Op& op, T* acc, const T* row, int64_t size) {
+  using Vec = executorch::vec::Vectorized<T>;
+  int64_t i = 0;
+  for (; i + Vec::size() <= size; i += Vec::size()) {
+    op(Vec::loadu(acc + i), Vec::loadu(row + i)).store(acc + i);
+  }
+  for (; i < size; ++i) {
+    acc[i] = op(acc[i], row[i]);
+  }
+}
+
+/**
+ * Reduces `in`, viewed as [outer_size, reduce_size, inner_size], over its
+ * middle axis into `out`, viewed as [outer_size, inner_size], with the
+ * associative operator `op` (e.g. ReduceAdd). reduce_size must be at least 1.
+ */
+template <typename T, typename Op>
+void reduce_over_shape(
+    const Op& op,
+    const T* in,
+    T* out,
+    const ReductionShape& shape) {
+  using Vec = executorch::vec::Vectorized<T>;
+  const int64_t reduce_size = shape.reduce_size;
+  const int64_t inner_size = shape.inner_size;
+  parallel_for_each_reduction_block(
+      shape, [&](int64_t outer_ix, int64_t inner_begin, int64_t len) {
+        const T* src = in + outer_ix * reduce_size * inner_size + inner_begin;
+        T* dst = out + outer_ix * inner_size + inner_begin;
+        if (inner_size == 1) {
+          *dst = executorch::vec::reduce_all<T>(
+              [&op](const Vec& a, const Vec& b) { return op(a, b); },
+              src,
+              reduce_size);
+          return;
+        }
+        std::copy(src, src + len, dst);
+        for (int64_t r = 1; r < reduce_size; ++r) {
+          reduce_row_into(op, dst, src + r * inner_size, len);
+        }
+      });
+}
+
+} // namespace native
+} // namespace executor
+} // namespace torch
@@ -1,5 +1,33 @@
+load("@fbsource//xplat/executorch/backends/xnnpack/third-party:third_party_libs.bzl", "third_party_dep")
 load("@fbsource//xplat/executorch/build:runtime_wrapper.bzl", "runtime")
+load(
+    "@fbsource//xplat/executorch/kernels/optimized:lib_defs.bzl",
+    "get_vec_capability_compiler_flags",
+    "get_vec_capability_preprocessor_flags",
+    "get_vec_deps",
+    "get_vec_preprocessor_flags",
+)
 load("@fbsource//xplat/executorch/kernels/optimized:op_registration_util.bzl", "define_op_target", "is_op_disabled", "op_target")
+load(
+    "@fbsource//xplat/executorch/kernels/portable:op_registration_util.bzl",
+    "get_compiler_optimization_flags",
+)
+
+# Instruction sets that the multi-versioned kernels are additionally built
+# for, by platform. See Note [Optimized kernel ISA variants] in isa_variant.h.
+_ISA_VARIANTS = ["AVX2", "AVX512", "SVE256"]
+
+def _select_isa_variants(fn):
+    """Returns a select() of fn(isa) for each ISA variant of the platform."""
+    if runtime.is_oss:
+        # various ovr_configs are not available in oss
+        return []
+    return select({
+        "DEFAULT": [],
+        "ovr_config//cpu:x86_64": [fn("AVX2"), fn("AVX512")],
+        "ovr_config//os:android-arm64": [fn("SVE256")],
+        "ovr_config//os:linux-arm64": [fn("SVE256")],
+    })
 
 _OPTIMIZED_ATEN_OPS = (
     op_target(
@@ -10,12 +38,42 @@ _OPTIMIZED_ATEN_OPS = (
             "//executorch/kernels/portable/cpu/util:broadcast_util",
         ],
     ),
+    op_target(
+        name = "op_amax",
+        deps = [
+            ":reduction_utils",
+            "//executorch/kernels/portable/cpu/util:reduce_util",
+        ],
+    ),
+    op_target(
+        name = "op_amin",
+        deps = [
+            ":reduction_utils",
+            "//executorch/kernels/portable/cpu/util:reduce_util",
+        ],
+    ),
+    op_target(
+        name = "op_argmax",
+        deps = [
+            ":reduction_utils",
+            "//executorch/kernels/portable/cpu/util:reduce_util",
+        ],
+    ),
     op_target(
         name = "op_bmm",
         deps = [
             "//executorch/kernels/optimized:libblas",
         ],
     ),
+    op_target(
+        name = "op_convolution",
+        deps = [
+            "//executorch/extension/parallel:thread_parallel",
+            "//executorch/kernels/optimized:libblas",
+            "//executorch/kernels/portable/cpu/util:dtype_util",
+            "//executorch/kernels/portable/cpu/util:kernel_ops_util",
+        ],
+    ),
     op_target(
         name = "op_div",
         deps = [
@@ -24,8 +82,20 @@ _OPTIMIZED_ATEN_OPS = (
             "//executorch/kernels/portable/cpu/util:broadcast_util",
         ],
     ),
-    op_target(name = "op_exp"),
-    op_target(name = "op_sigmoid"),
+    op_target(
+        name = "op_exp",
+        deps = [
+            ":unary_kernels",
+            "//executorch/extension/kernel_util:kernel_util",
+        ],
+    ),
+    op_target(
+        name = "op_sigmoid",
+        deps = [
+            ":unary_kernels",
+            "//executorch/extension/kernel_util:kernel_util",
+        ],
+    ),
     op_target(
         name = "op_gelu",
         deps = select({
@@ -60,6 +130,13 @@ _OPTIMIZED_ATEN_OPS = (
             ],
         }),
     ),
+    op_target(
+        name = "op_mean",
+        deps = [
+            ":reduction_utils",
+            "//executorch/kernels/portable/cpu/util:reduce_util",
+        ],
+    ),
     op_target(
         name = "op_mm",
         deps = [
@@ -84,6 +161,22 @@ _OPTIMIZED_ATEN_OPS = (
         ],
     ),
     op_target(name = "op_neg"),
+    op_target(
+        name = "op_permute_copy",
+        deps = [
+            ":permute_util",
+            "//executorch/kernels/portable/cpu/util:copy_ops_util",
+        ],
+    ),
+    op_target(
+        name = "op_softmax",
+        deps = [
+            ":reduction_utils",
+            "//executorch/kernels/portable/cpu/util:activation_ops_util",
+            "//executorch/kernels/portable/cpu/util:functional_util",
+            "//executorch/kernels/portable/cpu/util:reduce_util",
+        ],
+    ),
     op_target(
         name = "op_sub",
         deps = [
@@ -92,6 +185,28 @@ _OPTIMIZED_ATEN_OPS = (
             "//executorch/kernels/portable/cpu/util:broadcast_util",
         ],
     ),
+    op_target(
+        name = "op_sum",
+        deps = [
+            ":reduction_utils",
+            "//executorch/kernels/portable/cpu/util:reduce_util",
+        ],
+    ),
+    op_target(
+        name = "op_transpose_copy",
+        deps = [
+            ":permute_util",
+            "//executorch/kernels/portable/cpu/util:transpose_util",
+        ],
+    ),
+    op_target(
+        name = "op_var",
+        deps = [
+            ":reduction_utils",
+            "//executorch/kernels/portable/cpu:scalar_utils",
+            "//executorch/kernels/portable/cpu/util:reduce_util",
+        ],
+    ),
 )
 
 def define_common_targets():
@@ -124,6 +239,61 @@ def define_common_targets():
         exported_deps = all_op_targets,
     )
 
+    runtime.cxx_library(
+        name = "isa_variant",
+        srcs = ["isa_variant.cpp"],
+        exported_headers = ["isa_variant.h"],
+        visibility = ["//executorch/kernels/optimized/..."],
+        exported_preprocessor_flags = _select_isa_variants(
+            lambda isa: "-DET_OPTIMIZED_ISA_{}".format(isa),
+        ),
+        deps = [
+            third_party_dep("cpuinfo"),
+            "//executorch/runtime/platform:platform",
+        ],
+        exported_deps = [
+            "//executorch/runtime/kernel:operator_registry",
+        ],
+        # link_whole is necessary because the CPU probe is installed by a
+        # static initializer.
+        # @lint-ignore BUCKLINT link_whole
+        link_whole = True,
+    )
+
+    for isa in _ISA_VARIANTS:
+        runtime.cxx_library(
+            name = "unary_kernels_{}".format(isa.lower()),
+            srcs = ["unary_kernels.cpp"],
+            headers = ["unary_kernels.h"],
+            visibility = ["//executorch/kernels/optimized/cpu/..."],
+            compiler_flags = get_compiler_optimization_flags() +
+                             get_vec_capability_compiler_flags(isa),
+            preprocessor_flags = get_vec_capability_preprocessor_flags(isa) + [
+                "-DET_OPTIMIZED_ISA_VARIANT={}".format(isa),
+            ],
+            deps = [
+                ":isa_variant",
+                "//executorch/kernels/optimized:libvec",
+            ] + get_vec_deps(),
+        )
+
+    runtime.cxx_library(
+        name = "unary_kernels",
+        srcs = ["unary_kernels.cpp"],
+        exported_headers = ["unary_kernels.h"],
+        visibility = ["//executorch/kernels/optimized/cpu/..."],
+        compiler_flags = get_compiler_optimization_flags(),
+        preprocessor_flags = get_vec_preprocessor_flags(),
+        deps = [
+            "//executorch/kernels/optimized:libvec",
+        ] + get_vec_deps(),
+        exported_deps = [
+            ":isa_variant",
+        ] + _select_isa_variants(
+            lambda isa: ":unary_kernels_{}".format(isa.lower()),
+        ),
+    )
+
     runtime.cxx_library(
         name = "moments_utils",
         srcs = [],
@@ -134,3 +304,31 @@ def define_common_targets():
             "//executorch/kernels/optimized:libutils",
         ],
     )
+
+    runtime.cxx_library(
+        name = "permute_util",
+        srcs = ["permute_util.cpp"],
+        exported_headers = ["permute_util.h"],
+        visibility = ["//executorch/kernels/optimized/cpu/..."],
+        compiler_flags = get_compiler_optimization_flags(),
+        preprocessor_flags = get_vec_preprocessor_flags(),
+        deps = [
+            "//executorch/extension/parallel:thread_parallel",
+            "//executorch/kernels/optimized:libvec",
+        ],
+        exported_deps = [
+            "//executorch/runtime/kernel:kernel_includes",
+        ],
+    )
+
+    runtime.cxx_library(
+        name = "reduction_utils",
+        srcs = [],
+        exported_headers = ["reduction_utils.h"],
+        visibility = ["//executorch/kernels/optimized/cpu/..."],
+        exported_deps = [
+            "//executorch/extension/parallel:thread_parallel",
+            "//executorch/kernels/optimized:libvec",
+            "//executorch/runtime/core/exec_aten/util:tensor_util",
+        ],
+    )
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// Compiled once per ISA variant; see Note [Optimized kernel ISA variants].
+// Keep this file free of anything but the loops themselves.
+
+#include <executorch/kernels/optimized/cpu/unary_kernels.h>
+
+#include <executorch/kernels/optimized/vec/functional.h>
+#include <executorch/kernels/optimized/vec/vec.h>
+
+namespace torch {
+namespace executor {
+namespace native {
+namespace ET_OPTIMIZED_ISA_NAMESPACE {
+
+namespace {
+
+template <typename CTYPE>
+void exp_impl(const CTYPE* in, size_t numel, CTYPE* out) {
+  using Vec = executorch::vec::Vectorized<CTYPE>;
+  executorch::vec::map<CTYPE>([](Vec x) { return x.exp(); }, out, in, numel);
+}
+
+template <typename CTYPE>
+void sigmoid_impl(const CTYPE* in, size_t numel, CTYPE* out) {
+  using Vec = executorch::vec::Vectorized<CTYPE>;
+  executorch::vec::map<CTYPE>(
+      [](Vec x) {
+        auto one_plus_exp = x.neg().exp() + Vec(static_cast<CTYPE>(1.0));
+        return one_plus_exp.reciprocal();
+      },
+      out,
+      in,
+      numel);
+}
+
+} // namespace
+
+void UnaryKernels::exp(const float* in, size_t numel, float* out) {
+  exp_impl(in, numel, out);
+}
+
+void UnaryKernels::exp(const double* in, size_t numel, double* out) {
+  exp_impl(in, numel, out);
+}
+
+void UnaryKernels::sigmoid(const float* in, size_t numel, float* out) {
+  sigmoid_impl(in, numel, out);
+}
+
+void UnaryKernels::sigmoid(const double* in, size_t numel, double* out) {
+  sigmoid_impl(in, numel, out);
+}
+
+} // namespace ET_OPTIMIZED_ISA_NAMESPACE
+} // namespace native
+} // namespace executor
+} // namespace torch
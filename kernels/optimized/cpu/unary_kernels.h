@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <executorch/kernels/optimized/cpu/isa_variant.h>
+
+// Vectorized elementwise loops shared by the unary optimized ops. They are
+// built once per ISA variant; see Note [Optimized kernel ISA variants].
+
+#define ET_DECLARE_UNARY_KERNELS(isa)                                   \
+  namespace isa {                                                       \
+  struct UnaryKernels {                                                 \
+    static void exp(const float* in, size_t numel, float* out);         \
+    static void exp(const double* in, size_t numel, double* out);       \
+    static void sigmoid(const float* in, size_t numel, float* out);     \
+    static void sigmoid(const double* in, size_t numel, double* out);   \
+  };                                                                    \
+  }
+
+namespace torch {
+namespace executor {
+namespace native {
+
+#if defined(ET_OPTIMIZED_ISA_VARIANT)
+// Building one ISA variant of the loops.
+ET_DECLARE_UNARY_KERNELS(ET_OPTIMIZED_ISA_VARIANT)
+#else
+ET_DECLARE_UNARY_KERNELS(baseline)
+ET_FORALL_OPTIMIZED_ISA_VARIANTS(ET_DECLARE_UNARY_KERNELS)
+#endif
+
+} // namespace native
+} // namespace executor
+} // namespace torch
+
+#undef ET_DECLARE_UNARY_KERNELS
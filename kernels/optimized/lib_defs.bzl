@@ -71,6 +71,35 @@ def get_vec_fbcode_preprocessor_flags():
     ]
     return preprocessor_flags
 
+# Compiler flags needed by each vec backend. AVX512 assumes the Skylake-SP
+# feature set (F, BW, DQ, VL); SVE256 is vector-length specific and only runs
+# on cores with 256-bit SVE registers.
+_VEC_CAPABILITY_COMPILER_FLAGS = {
+    "AVX2": ["-mavx2", "-mfma", "-mf16c"],
+    "AVX512": ["-mavx512f", "-mavx512bw", "-mavx512dq", "-mavx512vl", "-mfma", "-mf16c"],
+    "DEFAULT": [],
+    "SVE256": ["-march=armv8.2-a+sve", "-msve-vector-bits=256"],
+}
+
+def get_vec_capability_compiler_flags(capability):
+    """Returns the compiler flags that build vec users for `capability`."""
+    if capability not in _VEC_CAPABILITY_COMPILER_FLAGS:
+        fail("Unknown vec CPU capability '{}'".format(capability))
+    return _VEC_CAPABILITY_COMPILER_FLAGS[capability]
+
+def get_vec_capability_preprocessor_flags(capability):
+    """Returns the preprocessor flags that build vec users for `capability`.
+
+    CPU_CAPABILITY names the inline namespace vec is declared in, so objects
+    built for different capabilities can be linked into the same binary.
+    """
+    if capability not in _VEC_CAPABILITY_COMPILER_FLAGS:
+        fail("Unknown vec CPU capability '{}'".format(capability))
+    preprocessor_flags = ["-DCPU_CAPABILITY={}".format(capability)]
+    if capability != "DEFAULT":
+        preprocessor_flags.append("-DCPU_CAPABILITY_{}".format(capability))
+    return preprocessor_flags
+
 def get_apple_framework_deps_kwargs(is_fbcode):
     # various ovr_configs are not available in oss
     if not runtime.is_oss and not is_fbcode:
@@ -132,6 +161,10 @@ def define_libs(is_fbcode=False):
             "//executorch/...",
             "@EXECUTORCH_CLIENTS",
         ],
+        exported_deps = [
+            # vec_half.h converts to and from Half and BFloat16.
+            "//executorch/runtime/core/portable_type:scalar_type",
+        ],
         cxx_platform_deps = select({
             "DEFAULT": [
                 (
@@ -203,7 +236,8 @@ def define_libs(is_fbcode=False):
                 "//executorch/...",
                 "@EXECUTORCH_CLIENTS",
             ],
-            preprocessor_flags = get_preprocessor_flags(),
+            preprocessor_flags = get_preprocessor_flags() + get_vec_preprocessor_flags(),
+            cxx_platform_preprocessor_flags = get_vec_cxx_preprocessor_flags(),
             fbandroid_platform_preprocessor_flags = [
                 (
                     "^android-arm64.*$",
@@ -231,6 +265,7 @@ def define_libs(is_fbcode=False):
             exported_deps = [
                 "//executorch/extension/parallel:thread_parallel",
                 "//executorch/kernels/optimized:libutils",
+                "//executorch/kernels/optimized:libvec",
                 "//executorch/runtime/core/exec_aten:lib",
             ],
             **get_apple_framework_deps_kwargs(is_fbcode),
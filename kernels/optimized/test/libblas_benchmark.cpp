@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+/**
+ * Times cpublas::gemm on matrix shapes taken from LLM and CNN inference and
+ * prints the achieved GFLOP/s. Usage: libblas_benchmark [iterations]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <executorch/kernels/optimized/blas/CPUBlas.h>
+#include <executorch/runtime/core/exec_aten/exec_aten.h>
+#include <executorch/runtime/platform/runtime.h>
+
+namespace {
+
+using executorch::cpublas::TransposeType;
+
+struct GemmShape {
+  const char* name;
+  TransposeType transa;
+  TransposeType transb;
+  int64_t m;
+  int64_t n;
+  int64_t k;
+};
+
+constexpr TransposeType N = TransposeType::NoTranspose;
+constexpr TransposeType T = TransposeType::Transpose;
+
+// linear() computes out^T = weight @ in^T, i.e. gemm(T, N) with m = output
+// features, n = tokens and k = input features. Convolutions lowered to im2col
+// use gemm(N, N) with m = output pixels, n = output channels and k = input
+// channels times the kernel area.
+const GemmShape kShapes[] = {
+    {"llm decode 4096x4096", T, N, 4096, 1, 4096},
+    {"llm decode ffn 11008x4096", T, N, 11008, 1, 4096},
+    {"llm prefill 64 tok 4096x4096", T, N, 4096, 64, 4096},
+    {"llm prefill 128 tok 2048x2048", T, N, 2048, 128, 2048},
+    {"sdpa q@k^T 128x128x64", T, N, 128, 128, 64},
+    {"sdpa p@v 64x128x128", N, N, 64, 128, 128},
+    {"cnn 3x3 64->64 @56x56", N, N, 3136, 64, 576},
+    {"cnn 3x3 128->128 @28x28", N, N, 784, 128, 1152},
+    {"cnn 3x3 256->256 @14x14", N, N, 196, 256, 2304},
+    {"cnn 1x1 32->16 @112x112", N, N, 12544, 16, 32},
+    {"cnn 1x1 144->24 @56x56", N, N, 3136, 24, 144},
+};
+
+template <typename CTYPE>
+void run_benchmark(const char* dtype, int iterations) {
+  for (const GemmShape& s : kShapes) {
+    const int64_t lda = s.transa == N ? s.m : s.k;
+    const int64_t ldb = s.transb == N ? s.k : s.n;
+    std::vector<CTYPE> a(s.m * s.k, CTYPE(0.5f));
+    std::vector<CTYPE> b(s.k * s.n, CTYPE(0.25f));
+    std::vector<CTYPE> c(s.m * s.n);
+
+    const auto run = [&]() {
+      // clang-format off
+      executorch::cpublas::gemm(
+          s.transa, s.transb,
+          s.m, s.n, s.k,
+          CTYPE(1.0f),
+          a.data(), lda,
+          b.data(), ldb,
+          CTYPE(0.0f),
+          c.data(), s.m);
+      // clang-format on
+    };
+    run(); // Warm up.
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+      run();
+    }
+    const double seconds = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - start)
+                               .count() /
+        iterations;
+    const double gflops = 2.0 * s.m * s.n * s.k / seconds * 1e-9;
+    printf(
+        "%-6s %-32s %10.3f ms %8.2f GFLOP/s\n",
+        dtype,
+        s.name,
+        seconds * 1e3,
+        gflops);
+  }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  executorch::runtime::runtime_init();
+  const int iterations = argc > 1 ? std::atoi(argv[1]) : 10;
+  run_benchmark<float>("fp32", iterations);
+  run_benchmark<exec_aten::Half>("fp16", iterations);
+  run_benchmark<exec_aten::BFloat16>("bf16", iterations);
+  return 0;
+}
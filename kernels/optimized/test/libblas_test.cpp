@@ -11,6 +11,7 @@
 #include <executorch/kernels/optimized/blas/CPUBlas.h>
 #include <executorch/runtime/core/exec_aten/exec_aten.h>
 
+#include <cmath>
 #include <vector>
 
 #define TEST_FORALL_SUPPORTED_CTYPES(_, N) \
@@ -76,3 +77,120 @@ void test_matmul_ones() {
 TEST(BlasTest, MatmulOnes) {
   TEST_FORALL_SUPPORTED_CTYPES(test_matmul_ones, 25);
 }
+
+namespace {
+
+// C = alpha * op(A) @ op(B) + beta * C in double precision, column-major.
+template <typename CTYPE>
+void reference_gemm(
+    bool transa,
+    bool transb,
+    int64_t m,
+    int64_t n,
+    int64_t k,
+    double alpha,
+    const std::vector<CTYPE>& a,
+    int64_t lda,
+    const std::vector<CTYPE>& b,
+    int64_t ldb,
+    double beta,
+    std::vector<double>& c,
+    int64_t ldc) {
+  for (int64_t j = 0; j < n; ++j) {
+    for (int64_t i = 0; i < m; ++i) {
+      double dot = 0;
+      for (int64_t l = 0; l < k; ++l) {
+        const double a_il = static_cast<double>(
+            transa ? a[l + i * lda] : a[i + l * lda]);
+        const double b_lj = static_cast<double>(
+            transb ? b[j + l * ldb] : b[l + j * ldb]);
+        dot += a_il * b_lj;
+      }
+      c[i + j * ldc] = alpha * dot + beta * c[i + j * ldc];
+    }
+  }
+}
+
+template <typename CTYPE>
+void test_matches_reference(double tolerance) {
+  using executorch::cpublas::TransposeType;
+
+  // Sizes straddle the register and cache block sizes, and include the
+  // matrix-vector cases.
+  const int64_t sizes[] = {1, 7, 33, 150};
+  for (const bool transa : {false, true}) {
+    for (const bool transb : {false, true}) {
+      for (const int64_t m : sizes) {
+        for (const int64_t n : sizes) {
+          for (const int64_t k : {int64_t(1), int64_t(40), int64_t(300)}) {
+            // Leading dimensions are padded to catch indexing mistakes.
+            const int64_t lda = (transa ? k : m) + 3;
+            const int64_t ldb = (transb ? n : k) + 2;
+            const int64_t ldc = m + 1;
+            std::vector<CTYPE> a(lda * (transa ? m : k));
+            std::vector<CTYPE> b(ldb * (transb ? k : n));
+            std::vector<CTYPE> c(ldc * n);
+            for (size_t i = 0; i < a.size(); ++i) {
+              a[i] = static_cast<CTYPE>(static_cast<int>(i * 7 % 17) / 8.0);
+            }
+            for (size_t i = 0; i < b.size(); ++i) {
+              b[i] = static_cast<CTYPE>(static_cast<int>(i * 5 % 13) / 4.0);
+            }
+            for (size_t i = 0; i < c.size(); ++i) {
+              c[i] = static_cast<CTYPE>(static_cast<int>(i % 5) - 2);
+            }
+            std::vector<double> expected(c.begin(), c.end());
+            reference_gemm(
+                transa,
+                transb,
+                m,
+                n,
+                k,
+                0.5,
+                a,
+                lda,
+                b,
+                ldb,
+                2.0,
+                expected,
+                ldc);
+
+            // clang-format off
+            executorch::cpublas::gemm(
+                transa ? TransposeType::Transpose : TransposeType::NoTranspose,
+                transb ? TransposeType::Transpose : TransposeType::NoTranspose,
+                m, n, k,
+                static_cast<CTYPE>(0.5),
+                a.data(), lda,
+                b.data(), ldb,
+                static_cast<CTYPE>(2.0),
+                c.data(), ldc);
+            // clang-format on
+
+            for (int64_t j = 0; j < n; ++j) {
+              for (int64_t i = 0; i < m; ++i) {
+                const double want = expected[i + j * ldc];
+                EXPECT_NEAR(
+                    static_cast<double>(c[i + j * ldc]),
+                    want,
+                    tolerance * (1 + std::abs(want)))
+                    << "transa=" << transa << " transb=" << transb
+                    << " m=" << m << " n=" << n << " k=" << k << " i=" << i
+                    << " j=" << j;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+} // namespace
+
+TEST(BlasTest, MatchesReference) {
+  test_matches_reference<float>(1e-5);
+  test_matches_reference<double>(1e-12);
+  test_matches_reference<exec_aten::Half>(1e-2);
+  test_matches_reference<exec_aten::BFloat16>(1e-2);
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+/**
+ * Times the vec primitives that the optimized kernels are built from and
+ * prints the achieved bandwidth, so the vec backends (DEFAULT, AVX2, AVX512,
+ * SVE256) can be compared build against build.
+ * Usage: libvec_benchmark [iterations]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <executorch/kernels/optimized/vec/functional.h>
+#include <executorch/kernels/optimized/vec/vec.h>
+#include <executorch/runtime/core/portable_type/bfloat16.h>
+#include <executorch/runtime/core/portable_type/half.h>
+
+namespace {
+
+using executorch::runtime::etensor::BFloat16;
+using executorch::runtime::etensor::Half;
+using Vec = executorch::vec::Vectorized<float>;
+
+// Large enough to stream from L2/L3 rather than L1; odd so that every
+// primitive also runs its tail path.
+constexpr int64_t kNumel = 1 << 20 | 3;
+
+template <typename Fn>
+void time_it(const char* name, int iterations, int64_t bytes, const Fn& fn) {
+  fn(); // Warm up.
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    fn();
+  }
+  const double seconds = std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - start)
+                             .count() /
+      iterations;
+  printf(
+      "%-24s %10.3f us %8.2f GB/s\n",
+      name,
+      seconds * 1e6,
+      bytes / seconds * 1e-9);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  const int iterations = argc > 1 ? std::atoi(argv[1]) : 100;
+  printf("Vectorized<float>::size() = %d\n", Vec::size());
+
+  std::vector<float> a(kNumel, 0.5f);
+  std::vector<float> b(kNumel, 0.25f);
+  std::vector<float> out(kNumel);
+  std::vector<Half> half(kNumel);
+  std::vector<BFloat16> bf16(kNumel);
+  const int64_t fbytes = kNumel * sizeof(float);
+  const int64_t hbytes = kNumel * sizeof(Half);
+
+  time_it("map2 fmadd", iterations, 3 * fbytes, [&]() {
+    executorch::vec::map2<float>(
+        [](Vec x, Vec y) { return executorch::vec::fmadd(x, y, x); },
+        out.data(),
+        a.data(),
+        b.data(),
+        kNumel);
+  });
+  volatile float sink = 0;
+  time_it("reduce_all sum", iterations, fbytes, [&]() {
+    sink = executorch::vec::reduce_all<float>(
+        [](Vec x, Vec y) { return x + y; }, a.data(), kNumel);
+  });
+  time_it("map exp", iterations, 2 * fbytes, [&]() {
+    executorch::vec::map<float>(
+        [](Vec x) { return x.exp(); }, out.data(), a.data(), kNumel);
+  });
+  time_it("convert float->half", iterations, fbytes + hbytes, [&]() {
+    executorch::vec::convert(a.data(), half.data(), kNumel);
+  });
+  time_it("convert half->float", iterations, fbytes + hbytes, [&]() {
+    executorch::vec::convert(half.data(), out.data(), kNumel);
+  });
+  time_it("convert float->bf16", iterations, fbytes + hbytes, [&]() {
+    executorch::vec::convert(a.data(), bf16.data(), kNumel);
+  });
+  time_it("convert bf16->float", iterations, fbytes + hbytes, [&]() {
+    executorch::vec::convert(bf16.data(), out.data(), kNumel);
+  });
+  (void)sink;
+  return 0;
+}
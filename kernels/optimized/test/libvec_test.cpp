@@ -11,6 +11,7 @@
 #include <executorch/kernels/optimized/vec/functional.h>
 #include <executorch/kernels/optimized/vec/vec.h>
 
+#include <cmath>
 #include <vector>
 
 #define TEST_FORALL_SUPPORTED_CTYPES(_) \
@@ -72,3 +73,164 @@ void test_load_and_add() {
 TEST(VecFloatTest, LoadAndAdd) {
   TEST_FORALL_SUPPORTED_CTYPES(test_load_and_add);
 }
+
+TEST(VecFloatTest, PartialLoadAndStore) {
+  using Vec = executorch::vec::Vectorized<float>;
+  constexpr int64_t kVecSize = Vec::size();
+
+  std::vector<float> in(kVecSize);
+  fill_monotonic(in, 1);
+  for (int64_t count = 0; count <= kVecSize; ++count) {
+    const Vec v = Vec::loadu(in.data(), count);
+    std::vector<float> all(kVecSize);
+    v.store(all.data());
+    for (int64_t i = 0; i < kVecSize; ++i) {
+      // Lanes past count read as zero.
+      EXPECT_EQ(all[i], i < count ? in[i] : 0.f);
+    }
+
+    std::vector<float> out(kVecSize, -1.f);
+    Vec(2.f).store(out.data(), count);
+    for (int64_t i = 0; i < kVecSize; ++i) {
+      EXPECT_EQ(out[i], i < count ? 2.f : -1.f);
+    }
+  }
+}
+
+TEST(VecFloatTest, FmaddAndMaximum) {
+  using Vec = executorch::vec::Vectorized<float>;
+  constexpr int64_t kVecSize = Vec::size();
+
+  std::vector<float> a(kVecSize);
+  fill_monotonic(a);
+  const Vec r = executorch::vec::fmadd(Vec::loadu(a.data()), Vec(2.f), Vec(1.f));
+  std::vector<float> out(kVecSize);
+  r.store(out.data());
+  for (int64_t i = 0; i < kVecSize; ++i) {
+    EXPECT_EQ(out[i], 2.f * a[i] + 1.f);
+  }
+
+  a[1] = NAN;
+  executorch::vec::maximum(Vec::loadu(a.data()), Vec(0.f)).store(out.data());
+  EXPECT_EQ(out[0], 0.f);
+  EXPECT_TRUE(std::isnan(out[1]));
+  executorch::vec::minimum(Vec(0.f), Vec::loadu(a.data())).store(out.data());
+  EXPECT_TRUE(std::isnan(out[1]));
+}
+
+TEST(VecFloatTest, InterleaveAndFlip) {
+  using Vec = executorch::vec::Vectorized<float>;
+  constexpr int64_t kVecSize = Vec::size();
+
+  std::vector<float> a(kVecSize);
+  std::vector<float> b(kVecSize);
+  fill_monotonic(a);
+  fill_monotonic(b, 100);
+
+  auto interleaved = executorch::vec::interleave2(
+      Vec::loadu(a.data()), Vec::loadu(b.data()));
+  std::vector<float> out(2 * kVecSize);
+  interleaved.first.store(out.data());
+  interleaved.second.store(out.data() + kVecSize);
+  for (int64_t i = 0; i < kVecSize; ++i) {
+    EXPECT_EQ(out[2 * i], a[i]);
+    EXPECT_EQ(out[2 * i + 1], b[i]);
+  }
+
+  auto deinterleaved =
+      executorch::vec::deinterleave2(interleaved.first, interleaved.second);
+  deinterleaved.first.store(out.data());
+  deinterleaved.second.store(out.data() + kVecSize);
+  for (int64_t i = 0; i < kVecSize; ++i) {
+    EXPECT_EQ(out[i], a[i]);
+    EXPECT_EQ(out[kVecSize + i], b[i]);
+  }
+
+  executorch::vec::flip(Vec::loadu(a.data())).store(out.data());
+  for (int64_t i = 0; i < kVecSize; ++i) {
+    EXPECT_EQ(out[i], a[kVecSize - 1 - i]);
+  }
+}
+
+template <typename T>
+void test_int_compare_and_flip() {
+  using Vec = executorch::vec::Vectorized<T>;
+  constexpr int64_t kVecSize = Vec::size();
+
+  std::vector<T> in(kVecSize);
+  fill_monotonic(in, -kVecSize / 2);
+  const Vec v = Vec::loadu(in.data());
+
+  std::vector<T> out(kVecSize);
+  (v < Vec(T(0))).store(out.data());
+  for (int64_t i = 0; i < kVecSize; ++i) {
+    EXPECT_EQ(out[i], in[i] < 0 ? T(-1) : T(0));
+  }
+
+  executorch::vec::flip(v).store(out.data());
+  for (int64_t i = 0; i < kVecSize; ++i) {
+    EXPECT_EQ(out[i], in[kVecSize - 1 - i]);
+  }
+
+#if defined(CPU_CAPABILITY_AVX2) || defined(CPU_CAPABILITY_AVX512)
+  (v << Vec(T(2))).store(out.data());
+  for (int64_t i = 0; i < kVecSize; ++i) {
+    EXPECT_EQ(out[i], static_cast<T>(in[i] * 4));
+  }
+  (v >> Vec(T(1))).store(out.data());
+  for (int64_t i = 0; i < kVecSize; ++i) {
+    EXPECT_EQ(out[i], static_cast<T>(in[i] >> 1));
+  }
+#endif
+}
+
+TEST(VecIntTest, CompareFlipAndShift) {
+  test_int_compare_and_flip<int8_t>();
+  test_int_compare_and_flip<int16_t>();
+  test_int_compare_and_flip<int32_t>();
+  test_int_compare_and_flip<int64_t>();
+}
+
+template <typename T>
+void test_convert_16bit_float() {
+  // Long enough to cover whole vectors and a scalar tail.
+  constexpr int64_t kSize = 67;
+  std::vector<float> in(kSize);
+  for (int64_t i = 0; i < kSize; ++i) {
+    // Values that are not exactly representable, to exercise rounding.
+    in[i] = (static_cast<float>(i) - 33.f) * 1.0009765625f + 0.000123f;
+  }
+  in[3] = NAN;
+  in[4] = INFINITY;
+  in[5] = -0.f;
+
+  std::vector<T> narrow(kSize);
+  executorch::vec::convert(in.data(), narrow.data(), kSize);
+  for (int64_t i = 0; i < kSize; ++i) {
+    const T expected = static_cast<T>(in[i]);
+    if (std::isnan(in[i])) {
+      EXPECT_TRUE(std::isnan(static_cast<float>(narrow[i])));
+    } else {
+      EXPECT_EQ(narrow[i].x, expected.x) << "at " << i;
+    }
+  }
+
+  std::vector<float> wide(kSize);
+  executorch::vec::convert(narrow.data(), wide.data(), kSize);
+  for (int64_t i = 0; i < kSize; ++i) {
+    const float expected = static_cast<float>(narrow[i]);
+    if (std::isnan(expected)) {
+      EXPECT_TRUE(std::isnan(wide[i]));
+    } else {
+      EXPECT_EQ(wide[i], expected) << "at " << i;
+    }
+  }
+}
+
+TEST(VecConvertTest, HalfMatchesScalar) {
+  test_convert_16bit_float<executorch::runtime::etensor::Half>();
+}
+
+TEST(VecConvertTest, BFloat16MatchesScalar) {
+  test_convert_16bit_float<executorch::runtime::etensor::BFloat16>();
+}
@@ -41,3 +41,28 @@ def define_common_targets():
     _lib_test_bin("libvec_test_bin")
     _lib_test_bin("moments_utils_test_bin", in_cpu = True)
     _lib_test_bin("libblas_test_bin")
+
+    runtime.cxx_binary(
+        name = "libvec_benchmark",
+        srcs = [
+            "libvec_benchmark.cpp",
+        ],
+        deps = [
+            "//executorch/kernels/optimized:libvec",
+        ],
+        cxx_platform_preprocessor_flags = get_vec_cxx_preprocessor_flags(),
+        preprocessor_flags = get_vec_preprocessor_flags(),
+    )
+
+    runtime.cxx_binary(
+        name = "libblas_benchmark",
+        srcs = [
+            "libblas_benchmark.cpp",
+        ],
+        deps = [
+            "//executorch/kernels/optimized:libblas",
+            "//executorch/runtime/platform:platform",
+        ],
+        cxx_platform_preprocessor_flags = get_vec_cxx_preprocessor_flags(),
+        preprocessor_flags = get_vec_preprocessor_flags(),
+    )
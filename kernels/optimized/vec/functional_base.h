@@ -16,6 +16,9 @@
 namespace executorch {
 namespace vec {
 
+// See Note [CPU_CAPABILITY namespace]
+inline namespace CPU_CAPABILITY {
+
 // slow path
 template <typename scalar_t, typename Op>
 inline scalar_t vec_reduce_all(
@@ -418,5 +421,6 @@ inline void broadcasting_map_broadcast_last_dim(
   }
 }
 
+} // namespace CPU_CAPABILITY
 } // namespace vec
 } // namespace executorch
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <executorch/kernels/optimized/vec/intrinsics.h>
+#include <executorch/kernels/optimized/vec/vec_base.h>
+
+#if defined(CPU_CAPABILITY_SVE256)
+
+// Vectorized<T> stores its register as a class member, which sizeless SVE
+// types cannot be. The SVE build is therefore vector-length specific: it is
+// compiled with -msve-vector-bits=256 and only runs on 256-bit SVE cores
+// (e.g. Neoverse V1), matching the 32-byte VECTOR_WIDTH the rest of vec uses.
+#if !defined(__ARM_FEATURE_SVE_BITS) || __ARM_FEATURE_SVE_BITS != 256
+#error "CPU_CAPABILITY_SVE256 requires compiling with -msve-vector-bits=256"
+#endif
+
+namespace executorch {
+namespace vec {
+// See Note [CPU_CAPABILITY namespace]
+inline namespace CPU_CAPABILITY {
+
+typedef svbool_t vls_pred_t
+    __attribute__((arm_sve_vector_bits(VECTOR_WIDTH * 8)));
+typedef svint32_t vls_int32_t
+    __attribute__((arm_sve_vector_bits(VECTOR_WIDTH * 8)));
+typedef svuint32_t vls_uint32_t
+    __attribute__((arm_sve_vector_bits(VECTOR_WIDTH * 8)));
+typedef svfloat32_t vls_float32_t
+    __attribute__((arm_sve_vector_bits(VECTOR_WIDTH * 8)));
+
+#define ptrue svptrue_b8()
+#define ZERO_S32 svdup_n_s32(0)
+#define ALL_S32_TRUE_MASK svdup_n_s32(0xffffffff)
+#define ALL_F32_TRUE_MASK svreinterpret_f32_s32(ALL_S32_TRUE_MASK)
+
+// Expands a predicate into the all-ones/all-zeros lane mask that the
+// comparison operators of Vectorized return.
+inline svfloat32_t sve_pred_to_mask_f32(svbool_t pg) {
+  return svreinterpret_f32_s32(svdup_n_s32_z(pg, -1));
+}
+
+}}}
+
+#endif // defined(CPU_CAPABILITY_SVE256)
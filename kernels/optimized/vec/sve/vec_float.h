@@ -0,0 +1,458 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+// DO NOT DEFINE STATIC DATA IN THIS HEADER!
+// See Note [Do not compile initializers with AVX]
+
+#include <executorch/kernels/optimized/vec/intrinsics.h>
+#include <executorch/kernels/optimized/vec/sve/sve_helper.h>
+#include <executorch/kernels/optimized/vec/vec_base.h>
+
+#include <cmath>
+
+#if defined(CPU_CAPABILITY_SVE256) && defined(ET_BUILD_ARM_VEC256_WITH_SLEEF)
+#include <sleef.h>
+#endif
+
+namespace executorch {
+namespace vec {
+// See Note [CPU_CAPABILITY namespace]
+inline namespace CPU_CAPABILITY {
+
+// Replaces the two-register NEON Vectorized<float> on cores with 256-bit SVE.
+// Partial loads and stores use predicates instead of bouncing through a
+// stack buffer, which is where most of the win over NEON comes from.
+#if defined(CPU_CAPABILITY_SVE256)
+
+#if defined(ET_BUILD_ARM_VEC256_WITH_SLEEF)
+#define USE_SLEEF(sleef_code, non_sleef_code) sleef_code
+#else
+#define USE_SLEEF(sleef_code, non_sleef_code) non_sleef_code
+#endif
+
+template <> class Vectorized<float> {
+private:
+  vls_float32_t values;
+public:
+  using value_type = float;
+  using size_type = int;
+  static constexpr size_type size() {
+    return VECTOR_WIDTH / sizeof(float);
+  }
+  Vectorized() {}
+  Vectorized(svfloat32_t v) : values(v) {}
+  Vectorized(float val) : values(svdup_n_f32(val)) {}
+  template<typename... Args,
+           typename = std::enable_if_t<(sizeof...(Args) == size())>>
+  Vectorized(Args... vals) {
+    __at_align__ float buffer[size()] = { vals... };
+    values = svld1_f32(ptrue, buffer);
+  }
+  operator svfloat32_t() const {
+    return values;
+  }
+  template <int64_t mask>
+  static Vectorized<float> blend(const Vectorized<float>& a, const Vectorized<float>& b) {
+    __at_align__ int32_t flag_arr[size()];
+    for (int i = 0; i < size(); ++i) {
+      flag_arr[i] = (mask & (1ULL << i)) ? 1 : 0;
+    }
+    svbool_t blend_mask = svcmpne_n_s32(ptrue, svld1_s32(ptrue, flag_arr), 0);
+    return svsel_f32(blend_mask, b.values, a.values);
+  }
+  static Vectorized<float> blendv(const Vectorized<float>& a, const Vectorized<float>& b,
+                              const Vectorized<float>& mask) {
+    // As on the other backends, each lane of `mask` must be all ones or all
+    // zeros.
+    svbool_t blend_mask = svcmpeq_s32(
+        ptrue, svreinterpret_s32_f32(mask.values), ALL_S32_TRUE_MASK);
+    return svsel_f32(blend_mask, b.values, a.values);
+  }
+  template<typename step_t>
+  static Vectorized<float> arange(float base = 0.f, step_t step = static_cast<step_t>(1)) {
+    svfloat32_t step_sizes = svcvt_f32_s32_x(ptrue, svindex_s32(0, 1));
+    return svmad_f32_x(
+        ptrue, step_sizes, svdup_n_f32(step), svdup_n_f32(base));
+  }
+  static Vectorized<float> set(const Vectorized<float>& a, const Vectorized<float>& b,
+                           int64_t count = size()) {
+    if (count <= 0) {
+      return a;
+    }
+    if (count < size()) {
+      return svsel_f32(svwhilelt_b32(0ull, count), b.values, a.values);
+    }
+    return b;
+  }
+  // Inactive lanes of a predicated load read as zero, so a partial load
+  // never touches memory past `count`.
+  static Vectorized<float> loadu(const void* ptr, int64_t count = size()) {
+    if (count == size()) {
+      return svld1_f32(ptrue, reinterpret_cast<const float*>(ptr));
+    }
+    return svld1_f32(
+        svwhilelt_b32(0ull, count), reinterpret_cast<const float*>(ptr));
+  }
+  void store(void* ptr, int64_t count = size()) const {
+    if (count == size()) {
+      svst1_f32(ptrue, reinterpret_cast<float*>(ptr), values);
+    } else {
+      svst1_f32(
+          svwhilelt_b32(0ull, count), reinterpret_cast<float*>(ptr), values);
+    }
+  }
+  float operator[](int idx) const {
+    __at_align__ float tmp[size()];
+    store(tmp);
+    return tmp[idx];
+  }
+  float operator[](int idx) {
+    __at_align__ float tmp[size()];
+    store(tmp);
+    return tmp[idx];
+  }
+  int zero_mask() const {
+    // returns an integer mask where all zero elements are translated to 1-bit
+    // and others are translated to 0-bit
+    svbool_t is_zero = svcmpeq_n_f32(ptrue, values, 0.f);
+    __at_align__ int32_t mask_arr[size()];
+    svst1_s32(ptrue, mask_arr, svsel_s32(is_zero, ALL_S32_TRUE_MASK, ZERO_S32));
+    int mask = 0;
+    for (int i = 0; i < size(); ++i) {
+      if (mask_arr[i]) {
+        mask |= (1 << i);
+      }
+    }
+    return mask;
+  }
+  Vectorized<float> isnan() const {
+    return sve_pred_to_mask_f32(svcmpuo_f32(ptrue, values, values));
+  }
+  Vectorized<float> map(float (*const f)(float)) const {
+    __at_align__ float tmp[size()];
+    store(tmp);
+    for (int i = 0; i < size(); ++i) {
+      tmp[i] = f(tmp[i]);
+    }
+    return loadu(tmp);
+  }
+  Vectorized<float> map2(
+      const Vectorized<float>& b,
+      float (*const f)(float, float)) const {
+    __at_align__ float tmp[size()];
+    __at_align__ float tmp_b[size()];
+    store(tmp);
+    b.store(tmp_b);
+    for (int i = 0; i < size(); ++i) {
+      tmp[i] = f(tmp[i], tmp_b[i]);
+    }
+    return loadu(tmp);
+  }
+  Vectorized<float> abs() const {
+    return svabs_f32_x(ptrue, values);
+  }
+  Vectorized<float> acos() const {
+    return USE_SLEEF(Sleef_acosfx_u10sve(values), map(std::acos));
+  }
+  Vectorized<float> asin() const {
+    return USE_SLEEF(Sleef_asinfx_u10sve(values), map(std::asin));
+  }
+  Vectorized<float> atan() const {
+    return USE_SLEEF(Sleef_atanfx_u10sve(values), map(std::atan));
+  }
+  Vectorized<float> atan2(const Vectorized<float> &b) const {
+    return USE_SLEEF(
+        Sleef_atan2fx_u10sve(values, b.values), map2(b, std::atan2));
+  }
+  Vectorized<float> copysign(const Vectorized<float> &sign) const {
+    svuint32_t sign_bit = svdup_n_u32(0x80000000u);
+    svuint32_t magnitude =
+        svbic_u32_x(ptrue, svreinterpret_u32_f32(values), sign_bit);
+    svuint32_t sign_of =
+        svand_u32_x(ptrue, svreinterpret_u32_f32(sign.values), sign_bit);
+    return svreinterpret_f32_u32(svorr_u32_x(ptrue, magnitude, sign_of));
+  }
+  Vectorized<float> erf() const {
+    return USE_SLEEF(Sleef_erffx_u10sve(values), map(std::erf));
+  }
+  Vectorized<float> erfc() const {
+    return USE_SLEEF(Sleef_erfcfx_u15sve(values), map(std::erfc));
+  }
+  Vectorized<float> exp() const {
+    return USE_SLEEF(Sleef_expfx_u10sve(values), map(std::exp));
+  }
+  Vectorized<float> exp2() const {
+    return USE_SLEEF(Sleef_exp2fx_u10sve(values), map(std::exp2));
+  }
+  Vectorized<float> expm1() const {
+    return USE_SLEEF(Sleef_expm1fx_u10sve(values), map(std::expm1));
+  }
+  Vectorized<float> fmod(const Vectorized<float>& q) const {
+    return USE_SLEEF(Sleef_fmodfx_sve(values, q.values), map2(q, std::fmod));
+  }
+  Vectorized<float> hypot(const Vectorized<float> &b) const {
+    return USE_SLEEF(
+        Sleef_hypotfx_u05sve(values, b.values), map2(b, std::hypot));
+  }
+  Vectorized<float> log() const {
+    return USE_SLEEF(Sleef_logfx_u10sve(values), map(std::log));
+  }
+  Vectorized<float> log10() const {
+    return USE_SLEEF(Sleef_log10fx_u10sve(values), map(std::log10));
+  }
+  Vectorized<float> log1p() const {
+    return USE_SLEEF(Sleef_log1pfx_u10sve(values), map(std::log1p));
+  }
+  Vectorized<float> log2() const {
+    return USE_SLEEF(Sleef_log2fx_u10sve(values), map(std::log2));
+  }
+  Vectorized<float> nextafter(const Vectorized<float> &b) const {
+    return USE_SLEEF(
+        Sleef_nextafterfx_sve(values, b.values), map2(b, std::nextafter));
+  }
+  Vectorized<float> frac() const;
+  Vectorized<float> sin() const {
+    return USE_SLEEF(Sleef_sinfx_u10sve(values), map(std::sin));
+  }
+  Vectorized<float> sinh() const {
+    return USE_SLEEF(Sleef_sinhfx_u10sve(values), map(std::sinh));
+  }
+  Vectorized<float> cos() const {
+    return USE_SLEEF(Sleef_cosfx_u10sve(values), map(std::cos));
+  }
+  Vectorized<float> cosh() const {
+    return USE_SLEEF(Sleef_coshfx_u10sve(values), map(std::cosh));
+  }
+  Vectorized<float> ceil() const {
+    return svrintp_f32_x(ptrue, values);
+  }
+  Vectorized<float> floor() const {
+    return svrintm_f32_x(ptrue, values);
+  }
+  Vectorized<float> neg() const {
+    return svneg_f32_x(ptrue, values);
+  }
+  Vectorized<float> round() const {
+    // Rounds half to even, like the AVX2 and AVX512 versions.
+    return svrintn_f32_x(ptrue, values);
+  }
+  Vectorized<float> tan() const {
+    return USE_SLEEF(Sleef_tanfx_u10sve(values), map(std::tan));
+  }
+  Vectorized<float> tanh() const {
+    return USE_SLEEF(Sleef_tanhfx_u10sve(values), map(std::tanh));
+  }
+  Vectorized<float> trunc() const {
+    return svrintz_f32_x(ptrue, values);
+  }
+  Vectorized<float> lgamma() const {
+    return USE_SLEEF(Sleef_lgammafx_u10sve(values), map(std::lgamma));
+  }
+  Vectorized<float> sqrt() const {
+    return svsqrt_f32_x(ptrue, values);
+  }
+  Vectorized<float> reciprocal() const {
+    return svdivr_n_f32_x(ptrue, values, 1.f);
+  }
+  Vectorized<float> rsqrt() const {
+    return this->sqrt().reciprocal();
+  }
+  Vectorized<float> pow(const Vectorized<float> &exp) const {
+    return USE_SLEEF(
+        Sleef_powfx_u10sve(values, exp.values), map2(exp, std::pow));
+  }
+  Vectorized<float> operator==(const Vectorized<float>& other) const {
+    return sve_pred_to_mask_f32(svcmpeq_f32(ptrue, values, other.values));
+  }
+  Vectorized<float> operator!=(const Vectorized<float>& other) const {
+    return sve_pred_to_mask_f32(svcmpne_f32(ptrue, values, other.values));
+  }
+  Vectorized<float> operator<(const Vectorized<float>& other) const {
+    return sve_pred_to_mask_f32(svcmplt_f32(ptrue, values, other.values));
+  }
+  Vectorized<float> operator<=(const Vectorized<float>& other) const {
+    return sve_pred_to_mask_f32(svcmple_f32(ptrue, values, other.values));
+  }
+  Vectorized<float> operator>(const Vectorized<float>& other) const {
+    return sve_pred_to_mask_f32(svcmpgt_f32(ptrue, values, other.values));
+  }
+  Vectorized<float> operator>=(const Vectorized<float>& other) const {
+    return sve_pred_to_mask_f32(svcmpge_f32(ptrue, values, other.values));
+  }
+
+  Vectorized<float> eq(const Vectorized<float>& other) const;
+  Vectorized<float> ne(const Vectorized<float>& other) const;
+  Vectorized<float> gt(const Vectorized<float>& other) const;
+  Vectorized<float> ge(const Vectorized<float>& other) const;
+  Vectorized<float> lt(const Vectorized<float>& other) const;
+  Vectorized<float> le(const Vectorized<float>& other) const;
+};
+
+template <>
+Vectorized<float> inline operator+(const Vectorized<float>& a, const Vectorized<float>& b) {
+  return svadd_f32_x(ptrue, a, b);
+}
+
+template <>
+Vectorized<float> inline operator-(const Vectorized<float>& a, const Vectorized<float>& b) {
+  return svsub_f32_x(ptrue, a, b);
+}
+
+template <>
+Vectorized<float> inline operator*(const Vectorized<float>& a, const Vectorized<float>& b) {
+  return svmul_f32_x(ptrue, a, b);
+}
+
+template <>
+Vectorized<float> inline operator/(const Vectorized<float>& a, const Vectorized<float>& b) {
+  return svdiv_f32_x(ptrue, a, b);
+}
+
+inline Vectorized<float> Vectorized<float>::frac() const {
+  return *this - this->trunc();
+}
+
+// Implements the IEEE 754 201X `maximum` operation, which propagates NaN if
+// either input is a NaN. SVE FMAX already does (FMAXNM is the one that
+// doesn't).
+template <>
+Vectorized<float> inline maximum(const Vectorized<float>& a, const Vectorized<float>& b) {
+  return svmax_f32_x(ptrue, a, b);
+}
+
+// Implements the IEEE 754 201X `minimum` operation, which propagates NaN if
+// either input is a NaN.
+template <>
+Vectorized<float> inline minimum(const Vectorized<float>& a, const Vectorized<float>& b) {
+  return svmin_f32_x(ptrue, a, b);
+}
+
+template <>
+Vectorized<float> inline clamp(const Vectorized<float>& a, const Vectorized<float>& min, const Vectorized<float>& max) {
+  return minimum(max, maximum(min, a));
+}
+
+template <>
+Vectorized<float> inline clamp_max(const Vectorized<float>& a, const Vectorized<float>& max) {
+  return minimum(max, a);
+}
+
+template <>
+Vectorized<float> inline clamp_min(const Vectorized<float>& a, const Vectorized<float>& min) {
+  return maximum(min, a);
+}
+
+template <>
+Vectorized<float> inline operator&(const Vectorized<float>& a, const Vectorized<float>& b) {
+  return svreinterpret_f32_s32(svand_s32_x(
+      ptrue, svreinterpret_s32_f32(a), svreinterpret_s32_f32(b)));
+}
+
+template <>
+Vectorized<float> inline operator|(const Vectorized<float>& a, const Vectorized<float>& b) {
+  return svreinterpret_f32_s32(svorr_s32_x(
+      ptrue, svreinterpret_s32_f32(a), svreinterpret_s32_f32(b)));
+}
+
+template <>
+Vectorized<float> inline operator^(const Vectorized<float>& a, const Vectorized<float>& b) {
+  return svreinterpret_f32_s32(sveor_s32_x(
+      ptrue, svreinterpret_s32_f32(a), svreinterpret_s32_f32(b)));
+}
+
+inline Vectorized<float> Vectorized<float>::eq(const Vectorized<float>& other) const {
+  return (*this == other) & Vectorized<float>(1.0f);
+}
+
+inline Vectorized<float> Vectorized<float>::ne(const Vectorized<float>& other) const {
+  return (*this != other) & Vectorized<float>(1.0f);
+}
+
+inline Vectorized<float> Vectorized<float>::gt(const Vectorized<float>& other) const {
+  return (*this > other) & Vectorized<float>(1.0f);
+}
+
+inline Vectorized<float> Vectorized<float>::ge(const Vectorized<float>& other) const {
+  return (*this >= other) & Vectorized<float>(1.0f);
+}
+
+inline Vectorized<float> Vectorized<float>::lt(const Vectorized<float>& other) const {
+  return (*this < other) & Vectorized<float>(1.0f);
+}
+
+inline Vectorized<float> Vectorized<float>::le(const Vectorized<float>& other) const {
+  return (*this <= other) & Vectorized<float>(1.0f);
+}
+
+template <>
+inline void convert(const float* src, int32_t* dst, int64_t n) {
+  // svwhilelt covers the tail, so there is no scalar epilogue.
+  for (int64_t i = 0; i < n; i += Vectorized<float>::size()) {
+    svbool_t pg = svwhilelt_b32(i, n);
+    svst1_s32(pg, dst + i, svcvt_s32_f32_x(pg, svld1_f32(pg, src + i)));
+  }
+}
+
+template <>
+inline void convert(const int32_t* src, float* dst, int64_t n) {
+  for (int64_t i = 0; i < n; i += Vectorized<float>::size()) {
+    svbool_t pg = svwhilelt_b32(i, n);
+    svst1_f32(pg, dst + i, svcvt_f32_s32_x(pg, svld1_s32(pg, src + i)));
+  }
+}
+
+template <>
+Vectorized<float> inline fmadd(const Vectorized<float>& a, const Vectorized<float>& b, const Vectorized<float>& c) {
+  return svmad_f32_x(ptrue, a, b, c);
+}
+
+template <>
+Vectorized<float> inline fmsub(const Vectorized<float>& a, const Vectorized<float>& b, const Vectorized<float>& c) {
+  return svnmsb_f32_x(ptrue, a, b, c);
+}
+
+template <>
+std::pair<Vectorized<float>, Vectorized<float>>
+inline interleave2<float>(const Vectorized<float>& a, const Vectorized<float>& b) {
+  // inputs:
+  //   a = {a0, a1, a2, a3, a4, a5, a6, a7}
+  //   b = {b0, b1, b2, b3, b4, b5, b6, b7}
+  //
+  // return:
+  //   {a0, b0, a1, b1, a2, b2, a3, b3}
+  //   {a4, b4, a5, b5, a6, b6, a7, b7}
+  return std::make_pair(
+      Vectorized<float>(svzip1_f32(a, b)), Vectorized<float>(svzip2_f32(a, b)));
+}
+
+template <>
+std::pair<Vectorized<float>, Vectorized<float>>
+inline deinterleave2<float>(const Vectorized<float>& a, const Vectorized<float>& b) {
+  // inputs:
+  //   a = {a0, b0, a1, b1, a2, b2, a3, b3}
+  //   b = {a4, b4, a5, b5, a6, b6, a7, b7}
+  //
+  // return:
+  //   {a0, a1, a2, a3, a4, a5, a6, a7}
+  //   {b0, b1, b2, b3, b4, b5, b6, b7}
+  return std::make_pair(
+      Vectorized<float>(svuzp1_f32(a, b)), Vectorized<float>(svuzp2_f32(a, b)));
+}
+
+template<>
+inline Vectorized<float> flip(const Vectorized<float> & v) {
+  return svrev_f32(v);
+}
+
+#undef USE_SLEEF
+
+#endif // defined(CPU_CAPABILITY_SVE256)
+
+}}}
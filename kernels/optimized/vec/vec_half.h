@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+// DO NOT DEFINE STATIC DATA IN THIS HEADER!
+// See Note [Do not compile initializers with AVX]
+
+#include <executorch/kernels/optimized/vec/intrinsics.h>
+#include <executorch/kernels/optimized/vec/vec_base.h>
+#include <executorch/runtime/core/portable_type/bfloat16.h>
+#include <executorch/runtime/core/portable_type/half.h>
+
+// Vectorized conversions between float and the 16-bit floating point types.
+//
+// There is no Vectorized<Half> or Vectorized<BFloat16>: kernels compute in
+// float (see opmath_type) and only need to widen their inputs and narrow
+// their outputs, so these specialize convert() for whole buffers instead.
+// Results match the scalar conversions in runtime/core/portable_type
+// bit for bit: round to nearest even, and NaN becomes the default quiet NaN
+// for BFloat16.
+
+namespace executorch {
+namespace vec {
+// See Note [CPU_CAPABILITY namespace]
+inline namespace CPU_CAPABILITY {
+
+namespace half_internal {
+
+using ::executorch::runtime::etensor::BFloat16;
+using ::executorch::runtime::etensor::Half;
+
+#if defined(CPU_CAPABILITY_AVX512) && !defined(_MSC_VER)
+
+#define ET_VEC_HALF_CONVERT
+#define ET_VEC_BFLOAT16_CONVERT
+constexpr int64_t kChunk = 16;
+
+inline void half_to_float(const Half* src, float* dst) {
+  _mm512_storeu_ps(
+      dst, _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src))));
+}
+
+inline void float_to_half(const float* src, Half* dst) {
+  _mm256_storeu_si256(
+      reinterpret_cast<__m256i*>(dst),
+      _mm512_cvtps_ph(_mm512_loadu_ps(src), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+}
+
+inline void bfloat16_to_float(const BFloat16* src, float* dst) {
+  const __m512i bits = _mm512_cvtepu16_epi32(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)));
+  _mm512_storeu_ps(dst, _mm512_castsi512_ps(_mm512_slli_epi32(bits, 16)));
+}
+
+inline void float_to_bfloat16(const float* src, BFloat16* dst) {
+  const __m512 v = _mm512_loadu_ps(src);
+  const __m512i bits = _mm512_castps_si512(v);
+  const __m512i lsb =
+      _mm512_and_si512(_mm512_srli_epi32(bits, 16), _mm512_set1_epi32(1));
+  const __m512i bias = _mm512_add_epi32(lsb, _mm512_set1_epi32(0x7FFF));
+  __m512i rounded = _mm512_srli_epi32(_mm512_add_epi32(bits, bias), 16);
+  const __mmask16 nan = _mm512_cmp_ps_mask(v, v, _CMP_UNORD_Q);
+  rounded = _mm512_mask_blend_epi32(nan, rounded, _mm512_set1_epi32(0x7FC0));
+  _mm256_storeu_si256(
+      reinterpret_cast<__m256i*>(dst), _mm512_cvtepi32_epi16(rounded));
+}
+
+#elif defined(CPU_CAPABILITY_AVX2) && !defined(_MSC_VER)
+
+#define ET_VEC_BFLOAT16_CONVERT
+constexpr int64_t kChunk = 8;
+
+// F16C shipped alongside AVX2 on every x86 CPU that has both, but it is a
+// separate compiler flag.
+#if defined(__F16C__)
+#define ET_VEC_HALF_CONVERT
+
+inline void half_to_float(const Half* src, float* dst) {
+  _mm256_storeu_ps(
+      dst, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))));
+}
+
+inline void float_to_half(const float* src, Half* dst) {
+  _mm_storeu_si128(
+      reinterpret_cast<__m128i*>(dst),
+      _mm256_cvtps_ph(_mm256_loadu_ps(src), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+}
+#endif // defined(__F16C__)
+
+inline void bfloat16_to_float(const BFloat16* src, float* dst) {
+  const __m256i bits = _mm256_cvtepu16_epi32(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+  _mm256_storeu_ps(dst, _mm256_castsi256_ps(_mm256_slli_epi32(bits, 16)));
+}
+
+inline void float_to_bfloat16(const float* src, BFloat16* dst) {
+  const __m256 v = _mm256_loadu_ps(src);
+  const __m256i bits = _mm256_castps_si256(v);
+  const __m256i lsb =
+      _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+  const __m256i bias = _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7FFF));
+  __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(bits, bias), 16);
+  const __m256 nan = _mm256_cmp_ps(v, v, _CMP_UNORD_Q);
+  rounded = _mm256_blendv_epi8(
+      rounded, _mm256_set1_epi32(0x7FC0), _mm256_castps_si256(nan));
+  // Every lane fits in 16 bits, so the saturating pack is exact. It packs
+  // within 128-bit lanes, so gather the two low quarters afterwards.
+  const __m256i packed = _mm256_permute4x64_epi64(
+      _mm256_packus_epi32(rounded, rounded), 0b1000);
+  _mm_storeu_si128(
+      reinterpret_cast<__m128i*>(dst), _mm256_castsi256_si128(packed));
+}
+
+#elif defined(__aarch64__)
+
+#define ET_VEC_HALF_CONVERT
+#define ET_VEC_BFLOAT16_CONVERT
+constexpr int64_t kChunk = 4;
+
+inline void half_to_float(const Half* src, float* dst) {
+  vst1q_f32(
+      dst,
+      vcvt_f32_f16(vreinterpret_f16_u16(
+          vld1_u16(reinterpret_cast<const uint16_t*>(src)))));
+}
+
+inline void float_to_half(const float* src, Half* dst) {
+  vst1_u16(
+      reinterpret_cast<uint16_t*>(dst),
+      vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src))));
+}
+
+inline void bfloat16_to_float(const BFloat16* src, float* dst) {
+  vst1q_f32(
+      dst,
+      vreinterpretq_f32_u32(
+          vshll_n_u16(vld1_u16(reinterpret_cast<const uint16_t*>(src)), 16)));
+}
+
+inline void float_to_bfloat16(const float* src, BFloat16* dst) {
+  const float32x4_t v = vld1q_f32(src);
+  const uint32x4_t bits = vreinterpretq_u32_f32(v);
+  const uint32x4_t lsb = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+  const uint32x4_t bias = vaddq_u32(lsb, vdupq_n_u32(0x7FFF));
+  const uint32x4_t rounded = vshrq_n_u32(vaddq_u32(bits, bias), 16);
+  // vceqq_f32(v, v) is false exactly for NaN lanes.
+  const uint32x4_t result =
+      vbslq_u32(vceqq_f32(v, v), rounded, vdupq_n_u32(0x7FC0));
+  vst1_u16(reinterpret_cast<uint16_t*>(dst), vmovn_u32(result));
+}
+
+#endif
+
+/// Runs `chunk` over whole chunks of `n` elements and converts the rest one
+/// at a time.
+template <typename src_T, typename dst_T, typename Chunk>
+inline void convert_in_chunks(
+    const src_T* src,
+    dst_T* dst,
+    int64_t n,
+    int64_t chunk_size,
+    const Chunk& chunk) {
+  int64_t i = 0;
+  for (; i + chunk_size <= n; i += chunk_size) {
+    chunk(src + i, dst + i);
+  }
+  for (; i < n; ++i) {
+    dst[i] = static_cast<dst_T>(src[i]);
+  }
+}
+
+} // namespace half_internal
+
+#if defined(ET_VEC_HALF_CONVERT)
+
+template <>
+inline void convert(
+    const ::executorch::runtime::etensor::Half* src,
+    float* dst,
+    int64_t n) {
+  half_internal::convert_in_chunks(
+      src, dst, n, half_internal::kChunk, half_internal::half_to_float);
+}
+
+template <>
+inline void convert(
+    const float* src,
+    ::executorch::runtime::etensor::Half* dst,
+    int64_t n) {
+  half_internal::convert_in_chunks(
+      src, dst, n, half_internal::kChunk, half_internal::float_to_half);
+}
+
+#undef ET_VEC_HALF_CONVERT
+#endif // defined(ET_VEC_HALF_CONVERT)
+
+#if defined(ET_VEC_BFLOAT16_CONVERT)
+
+template <>
+inline void convert(
+    const ::executorch::runtime::etensor::BFloat16* src,
+    float* dst,
+    int64_t n) {
+  half_internal::convert_in_chunks(
+      src, dst, n, half_internal::kChunk, half_internal::bfloat16_to_float);
+}
+
+template <>
+inline void convert(
+    const float* src,
+    ::executorch::runtime::etensor::BFloat16* dst,
+    int64_t n) {
+  half_internal::convert_in_chunks(
+      src, dst, n, half_internal::kChunk, half_internal::float_to_bfloat16);
+}
+
+#undef ET_VEC_BFLOAT16_CONVERT
+#endif // defined(ET_VEC_BFLOAT16_CONVERT)
+
+}}}
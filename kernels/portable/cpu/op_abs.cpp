@@ -32,7 +32,7 @@ Tensor& abs_out(KernelRuntimeContext& ctx, const Tensor& in, Tensor& out) {
       ctx, tensors_have_same_dim_order(in, out), InvalidArgument, out);
 
   ET_SWITCH_REAL_TYPES(in.scalar_type(), ctx, "abs.out", CTYPE, [&] {
-    apply_unary_map_fn(
+    parallel_apply_unary_map_fn(
         [](const CTYPE val_in) {
           if (val_in < 0) {
             return static_cast<CTYPE>(-val_in);
@@ -7,8 +7,10 @@
  */
 
 #include <cstring>
+#include <type_traits>
 
 #include <executorch/kernels/portable/cpu/util/copy_ops_util.h>
+#include <executorch/kernels/portable/cpu/util/parallel_util.h>
 #include <executorch/runtime/kernel/kernel_includes.h>
 
 namespace torch {
@@ -55,26 +57,45 @@ Tensor& cat_out(
   const size_t dim_stride = getTrailingDims(out, dim);
   const size_t ninputs = tensors.size();
 
+  // Each output row (one per index of the leading dims) is the concatenation
+  // of the matching rows of every non-empty input.
+  size_t out_row_size = 0;
+  for (size_t j = 0; j < ninputs; ++j) {
+    if (tensors[j].numel() != 0) {
+      out_row_size += tensors[j].size(dim) * dim_stride;
+    }
+  }
+
   const auto out_type = out.scalar_type();
   ET_SWITCH_REALHB_TYPES(out_type, ctx, "cat.out", CTYPE_OUT, [&] {
-    CTYPE_OUT* out_ptr = out.mutable_data_ptr<CTYPE_OUT>();
-    for (size_t i = 0; i < outer; ++i) {
-      for (size_t j = 0; j < ninputs; ++j) {
-        const auto in_type = tensors[j].scalar_type();
-        ET_SWITCH_REALHB_TYPES(in_type, ctx, "cat.out", CTYPE_IN, [&] {
-          if (tensors[j].numel() == 0) {
-            return;
-          }
-          size_t inner = tensors[j].size(dim) * dim_stride;
-          const CTYPE_IN* const in_ptr =
-              tensors[j].const_data_ptr<CTYPE_IN>() + i * inner;
+    CTYPE_OUT* const out_data = out.mutable_data_ptr<CTYPE_OUT>();
+    size_t row_offset = 0;
+    for (size_t j = 0; j < ninputs; ++j) {
+      const auto in_type = tensors[j].scalar_type();
+      ET_SWITCH_REALHB_TYPES(in_type, ctx, "cat.out", CTYPE_IN, [&] {
+        if (tensors[j].numel() == 0) {
+          return;
+        }
+        const size_t inner = tensors[j].size(dim) * dim_stride;
+        const CTYPE_IN* const in_data = tensors[j].const_data_ptr<CTYPE_IN>();
 
-          for (size_t k = 0; k < inner; ++k) {
-            out_ptr[k] = static_cast<CTYPE_OUT>(in_ptr[k]);
+        const auto copy_rows = [&](int64_t begin, int64_t end) {
+          for (int64_t i = begin; i < end; ++i) {
+            const CTYPE_IN* const in_ptr = in_data + i * inner;
+            CTYPE_OUT* const out_ptr = out_data + i * out_row_size + row_offset;
+            if (std::is_same<CTYPE_IN, CTYPE_OUT>::value) {
+              memcpy(out_ptr, in_ptr, inner * sizeof(CTYPE_OUT));
+            } else {
+              for (size_t k = 0; k < inner; ++k) {
+                out_ptr[k] = static_cast<CTYPE_OUT>(in_ptr[k]);
+              }
+            }
           }
-          out_ptr += inner;
-        });
-      }
+        };
+        utils::parallel_for(
+            0, outer, utils::parallel_grain_size(inner), copy_rows);
+        row_offset += inner;
+      });
     }
   });
 
@@ -39,7 +39,7 @@ Tensor& gelu_out(
 
   ET_SWITCH_FLOAT_TYPES(in.scalar_type(), ctx, "gelu.out", CTYPE, [&]() {
     if (approximate == "tanh") {
-      apply_unary_map_fn(
+      parallel_apply_unary_map_fn(
           [](const CTYPE x) {
             if (x == -std::numeric_limits<CTYPE>::infinity()) {
               return static_cast<CTYPE>(0.0);
@@ -59,7 +59,7 @@ Tensor& gelu_out(
           out.mutable_data_ptr<CTYPE>(),
           in.numel());
     } else if (approximate == "none") {
-      apply_unary_map_fn(
+      parallel_apply_unary_map_fn(
           [](const CTYPE x) {
             if (x == -std::numeric_limits<CTYPE>::infinity()) {
               return static_cast<CTYPE>(0.0);
@@ -61,7 +61,7 @@ Tensor& hardtanh_out(
       max_casted = static_cast<CTYPE>(max_val);
     });
 
-    apply_unary_map_fn(
+    parallel_apply_unary_map_fn(
         [min_casted, max_casted](const CTYPE val_in) {
           return utils::min_override(
               utils::max_override(val_in, min_casted), max_casted);
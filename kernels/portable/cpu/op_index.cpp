@@ -6,6 +6,7 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <atomic>
 #include <cinttypes>
 #include <cstdint>
 #include <cstring>
@@ -13,6 +14,7 @@
 
 #include <executorch/kernels/portable/cpu/util/advanced_index_util.h>
 #include <executorch/kernels/portable/cpu/util/broadcast_util.h>
+#include <executorch/kernels/portable/cpu/util/parallel_util.h>
 #include <executorch/runtime/kernel/kernel_includes.h>
 
 namespace torch {
@@ -93,14 +95,25 @@ Tensor& index_Tensor_out(
     const CTYPE* const in_data = in.const_data_ptr<CTYPE>();
     CTYPE* const out_data = out.mutable_data_ptr<CTYPE>();
 
-    for (auto out_ix = 0; out_ix < out.numel(); out_ix++) {
-      size_t in_ix = 0;
-      bool success = true;
-      std::tie(in_ix, success) =
-          get_in_ix(in, indices, out, out_ix, start, xdim, dim_map, ix_map);
-      ET_KERNEL_CHECK(ctx, success, InvalidArgument, );
-      out_data[out_ix] = in_data[in_ix];
-    }
+    std::atomic<bool> all_valid(true);
+    const auto gather_range = [&](int64_t begin, int64_t end) {
+      for (int64_t out_ix = begin; out_ix < end; out_ix++) {
+        size_t in_ix = 0;
+        bool success = true;
+        std::tie(in_ix, success) =
+            get_in_ix(in, indices, out, out_ix, start, xdim, dim_map, ix_map);
+        if (!success) {
+          all_valid = false;
+          return;
+        }
+        out_data[out_ix] = in_data[in_ix];
+      }
+    };
+    // Every element needs a full index computation, so far fewer elements
+    // than for a plain copy are enough to make a task worthwhile.
+    utils::parallel_for(
+        0, out.numel(), utils::kParallelGrainSize / 16, gather_range);
+    ET_KERNEL_CHECK(ctx, all_valid, InvalidArgument, );
   });
 
   return out;
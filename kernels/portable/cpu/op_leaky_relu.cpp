@@ -53,7 +53,7 @@ Tensor& leaky_relu_out(
           negative_slope_casted = static_cast<CTYPE>(negative_slope_val);
         });
 
-    apply_unary_map_fn(
+    parallel_apply_unary_map_fn(
         [negative_slope_casted](const CTYPE val_in) {
           if (val_in >= 0) {
             return val_in;
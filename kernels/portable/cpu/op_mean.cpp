@@ -7,6 +7,7 @@
  */
 
 #include <executorch/kernels/portable/cpu/util/kernel_ops_util.h>
+#include <executorch/kernels/portable/cpu/util/parallel_util.h>
 #include <executorch/kernels/portable/cpu/util/reduce_util.h>
 #include <executorch/runtime/kernel/kernel_includes.h>
 #include <executorch/runtime/platform/assert.h>
@@ -48,18 +49,22 @@ Tensor& mean_dim_out(
     ET_SWITCH_FLOATH_TYPES(out.scalar_type(), ctx, "mean.out", CTYPE_OUT, [&] {
       CTYPE_OUT* out_data = out.mutable_data_ptr<CTYPE_OUT>();
       const size_t num = get_reduced_dim_product(in, dim_list);
-      for (size_t out_ix = 0; out_ix < out.numel(); ++out_ix) {
-        CTYPE_OUT sum = 0;
-        if (in.numel() > 0) {
-          sum = map_reduce_over_dim_list<CTYPE_IN, CTYPE_OUT>(
-              [](CTYPE_IN v) { return static_cast<CTYPE_OUT>(v); },
-              [](CTYPE_OUT outv, CTYPE_OUT acc) { return acc + outv; },
-              in,
-              dim_list,
-              out_ix);
+      const auto reduce_range = [&](int64_t begin, int64_t end) {
+        for (int64_t out_ix = begin; out_ix < end; ++out_ix) {
+          CTYPE_OUT sum = 0;
+          if (in.numel() > 0) {
+            sum = map_reduce_over_dim_list<CTYPE_IN, CTYPE_OUT>(
+                [](CTYPE_IN v) { return static_cast<CTYPE_OUT>(v); },
+                [](CTYPE_OUT outv, CTYPE_OUT acc) { return acc + outv; },
+                in,
+                dim_list,
+                out_ix);
+          }
+          out_data[out_ix] = sum / static_cast<float>(num);
         }
-        out_data[out_ix] = sum / static_cast<float>(num);
-      }
+      };
+      utils::parallel_for(
+          0, out.numel(), utils::parallel_grain_size(num), reduce_range);
     });
   });
 
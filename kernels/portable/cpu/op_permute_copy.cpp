@@ -7,6 +7,7 @@
  */
 
 #include <executorch/kernels/portable/cpu/util/copy_ops_util.h>
+#include <executorch/kernels/portable/cpu/util/parallel_util.h>
 #include <executorch/runtime/kernel/kernel_includes.h>
 
 namespace torch {
@@ -34,6 +35,20 @@ void increment_coordinate_permuted(
   }
 }
 
+// Sets `coordinate` to the position in `tensor` of the element that lands at
+// flat index `out_ix` of the permuted output.
+void init_coordinate_permuted(
+    const Tensor& tensor,
+    size_t* const coordinate,
+    IntArrayRef dims,
+    size_t out_ix) {
+  for (int i = dims.size() - 1; i >= 0; i--) {
+    size_t d = dims[i] >= 0 ? dims[i] : dims[i] + tensor.dim();
+    coordinate[d] = out_ix % tensor.size(d);
+    out_ix /= tensor.size(d);
+  }
+}
+
 } // namespace
 
 Tensor& permute_copy_out(
@@ -61,7 +76,6 @@ Tensor& permute_copy_out(
 
   const auto in_type = out.scalar_type();
 
-  size_t in_coord[kTensorDimensionLimit] = {0};
   size_t trailing_dims_memo[kTensorDimensionLimit];
   executorch::runtime::memoizeTrailingDims(in, trailing_dims_memo);
 
@@ -70,12 +84,17 @@ Tensor& permute_copy_out(
     const CTYPE* const in_data = in.const_data_ptr<CTYPE>();
     CTYPE* const out_data = out.mutable_data_ptr<CTYPE>();
 
-    for (size_t i = 0; i < out.numel(); ++i) {
-      out_data[i] =
-          in_data[executorch::runtime::coordinateToIndexWithTrailingDimsMemo(
-              in, in_coord, trailing_dims_memo)];
-      increment_coordinate_permuted(in, in_coord, dims);
-    }
+    const auto copy_range = [&](int64_t begin, int64_t end) {
+      size_t in_coord[kTensorDimensionLimit] = {0};
+      init_coordinate_permuted(in, in_coord, dims, begin);
+      for (int64_t i = begin; i < end; ++i) {
+        out_data[i] =
+            in_data[executorch::runtime::coordinateToIndexWithTrailingDimsMemo(
+                in, in_coord, trailing_dims_memo)];
+        increment_coordinate_permuted(in, in_coord, dims);
+      }
+    };
+    utils::parallel_for(0, out.numel(), utils::kParallelGrainSize, copy_range);
   });
 
   return out;
@@ -51,7 +51,7 @@ Tensor& round_out(KernelRuntimeContext& ctx, const Tensor& in, Tensor& out) {
   auto in_scalar_type = in.scalar_type();
 
   ET_SWITCH_REAL_TYPES(in.scalar_type(), ctx, "round.out", CTYPE, [&] {
-    apply_unary_map_fn(
+    parallel_apply_unary_map_fn(
         [in_scalar_type](const CTYPE val_in) {
           if (isIntegralType(in_scalar_type, /*includeBool=*/false)) {
             return val_in;
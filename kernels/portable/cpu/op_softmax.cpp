@@ -46,7 +46,7 @@ Tensor& softmax_out(
     const CTYPE* const in_data = in.const_data_ptr<CTYPE>();
     CTYPE* const out_data = out.mutable_data_ptr<CTYPE>();
 
-    apply_over_dim(
+    parallel_apply_over_dim(
         [in_data, out_data](
             const size_t size, const size_t stride, const size_t base) {
           // calculate max in softmax dim. During softmax computation each
@@ -6,6 +6,7 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <executorch/kernels/portable/cpu/util/parallel_util.h>
 #include <executorch/kernels/portable/cpu/util/reduce_util.h>
 #include <executorch/runtime/kernel/kernel_includes.h>
 #include <executorch/runtime/platform/assert.h>
@@ -48,18 +49,28 @@ Tensor& sum_dim_out(
         ET_SWITCH_REAL_TYPES_AND(
             Bool, out.scalar_type(), ctx, "sum.IntList_out", CTYPE_OUT, [&] {
               CTYPE_OUT* out_data = out.mutable_data_ptr<CTYPE_OUT>();
-              for (size_t out_ix = 0; out_ix < out.numel(); ++out_ix) {
-                CTYPE_OUT sum = 0;
-                if (in.numel() > 0) {
-                  sum = map_reduce_over_dim_list<CTYPE_IN, CTYPE_OUT>(
-                      [](CTYPE_IN v) { return static_cast<CTYPE_OUT>(v); },
-                      [](CTYPE_OUT outv, CTYPE_OUT acc) { return acc + outv; },
-                      in,
-                      dim_list,
-                      out_ix);
+              const size_t num = get_reduced_dim_product(in, dim_list);
+              const auto reduce_range = [&](int64_t begin, int64_t end) {
+                for (int64_t out_ix = begin; out_ix < end; ++out_ix) {
+                  CTYPE_OUT sum = 0;
+                  if (in.numel() > 0) {
+                    sum = map_reduce_over_dim_list<CTYPE_IN, CTYPE_OUT>(
+                        [](CTYPE_IN v) { return static_cast<CTYPE_OUT>(v); },
+                        [](CTYPE_OUT outv, CTYPE_OUT acc) {
+                          return acc + outv;
+                        },
+                        in,
+                        dim_list,
+                        out_ix);
+                  }
+                  out_data[out_ix] = sum;
                 }
-                out_data[out_ix] = sum;
-              }
+              };
+              utils::parallel_for(
+                  0,
+                  out.numel(),
+                  utils::parallel_grain_size(num),
+                  reduce_range);
             });
       });
 
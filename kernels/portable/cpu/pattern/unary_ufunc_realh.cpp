@@ -37,7 +37,7 @@ Tensor& unary_ufunc_realh(
       ctx, tensors_have_same_dim_order(in, out), InvalidArgument, out);
 
   ET_SWITCH_REALH_TYPES(in.scalar_type(), ctx, __func__, CTYPE, [&] {
-    apply_unary_map_fn(
+    parallel_apply_unary_map_fn(
         [fn](const CTYPE val_in) { return static_cast<CTYPE>(fn(val_in)); },
         in.const_data_ptr<CTYPE>(),
         out.mutable_data_ptr<CTYPE>(),
@@ -44,7 +44,7 @@ Tensor& unary_ufunc_realhb_to_bool(
   const auto in_type = in.scalar_type();
 
   ET_SWITCH_REALHBBF16_TYPES(in_type, ctx, __func__, CTYPE_IN, [&] {
-    apply_unary_map_fn(
+    parallel_apply_unary_map_fn(
         [fn](const CTYPE_IN val_in) { return fn(val_in); },
         in.const_data_ptr<CTYPE_IN>(),
         out.mutable_data_ptr<bool>(),
@@ -40,7 +40,7 @@ Tensor& unary_ufunc_realhbbf16_to_floathbf16(
 
   ET_SWITCH_REALHBBF16_TYPES(in_type, ctx, __func__, CTYPE_IN, [&] {
     ET_SWITCH_FLOATHBF16_TYPES(out_type, ctx, __func__, CTYPE_OUT, [&] {
-      apply_unary_map_fn(
+      parallel_apply_unary_map_fn(
           [fn](const CTYPE_IN val_in) {
             CTYPE_OUT xi = static_cast<CTYPE_OUT>(val_in);
             return static_cast<CTYPE_OUT>(fn(xi));
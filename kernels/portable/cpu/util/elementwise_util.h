@@ -8,8 +8,13 @@
 
 #pragma once
 
+#include <array>
+#include <utility>
+
 #include <executorch/kernels/portable/cpu/util/broadcast_util.h>
 #include <executorch/kernels/portable/cpu/util/dtype_util.h>
+#include <executorch/kernels/portable/cpu/util/parallel_util.h>
+#include <executorch/kernels/portable/cpu/util/strided_loop.h>
 #include <executorch/runtime/kernel/kernel_runtime_context.h>
 
 namespace torch {
@@ -44,6 +49,153 @@ inline int64_t scalar_to<int64_t>(const Scalar& s) {
                              : s.to<int64_t>();
 }
 
+namespace internal {
+
+/**
+ * Runs compute_fun over `loop` when every input and the output already hold
+ * CTYPE_COMMON, reading and writing the tensors directly.
+ */
+template <typename CTYPE_COMMON, typename Op, size_t kNumInputs, size_t... Is>
+inline void apply_elementwise_fn_same_dtype(
+    const Op& compute_fun,
+    const BroadcastStridedLoop<kNumInputs>& loop,
+    const std::array<const Tensor*, kNumInputs>& inputs,
+    const Tensor& out,
+    std::index_sequence<Is...>) {
+  const std::array<const CTYPE_COMMON*, kNumInputs> data_in = {
+      inputs[Is]->template const_data_ptr<CTYPE_COMMON>()...};
+  CTYPE_COMMON* const data_out = out.mutable_data_ptr<CTYPE_COMMON>();
+  const std::array<size_t, kNumInputs> inner_strides = {
+      loop.inner_stride(Is)...};
+  const bool inner_contiguous = ((inner_strides[Is] == 1) && ...);
+
+  const auto run = [&](size_t out_ix,
+                       const std::array<size_t, kNumInputs>& in_ix,
+                       size_t len) {
+    CTYPE_COMMON* const out_run = data_out + out_ix;
+    const std::array<const CTYPE_COMMON*, kNumInputs> in_run = {
+        (data_in[Is] + in_ix[Is])...};
+    if (inner_contiguous) {
+      // Kept separate so that the compiler can vectorize it.
+      for (size_t j = 0; j < len; ++j) {
+        out_run[j] = compute_fun(in_run[Is][j]...);
+      }
+    } else {
+      for (size_t j = 0; j < len; ++j) {
+        out_run[j] = compute_fun(in_run[Is][j * inner_strides[Is]]...);
+      }
+    }
+  };
+  parallel_for(
+      0,
+      loop.num_runs(),
+      parallel_grain_size(loop.inner_size()),
+      [&](int64_t begin, int64_t end) { loop.run(begin, end, run); });
+}
+
+/**
+ * Runs compute_fun over `loop`, converting each element to and from
+ * CTYPE_COMMON through the load/store functions selected for each tensor's
+ * dtype.
+ */
+template <
+    typename CTYPE_COMMON,
+    const char* op_name,
+    typename Op,
+    size_t kNumInputs,
+    size_t... Is>
+inline void apply_elementwise_fn_mixed_dtype(
+    const Op& compute_fun,
+    const BroadcastStridedLoop<kNumInputs>& loop,
+    const std::array<const Tensor*, kNumInputs>& inputs,
+    const std::array<SupportedTensorDtypes, kNumInputs>& input_dtypes,
+    const Tensor& out,
+    SupportedTensorDtypes out_dtypes,
+    std::index_sequence<Is...>) {
+  const std::array<load_to_common_fn<CTYPE_COMMON>, kNumInputs>
+      load_to_common = {get_load_to_common_fn<CTYPE_COMMON, op_name>(
+          *inputs[Is], input_dtypes[Is])...};
+  const auto store_common_to_out =
+      get_store_common_to_tensor_fn<CTYPE_COMMON, op_name>(out, out_dtypes);
+  const std::array<const char*, kNumInputs> data_in = {
+      reinterpret_cast<const char*>(inputs[Is]->const_data_ptr())...};
+  // Byte strides between consecutive elements of each run.
+  const std::array<size_t, kNumInputs> inner_strides = {
+      (loop.inner_stride(Is) * inputs[Is]->element_size())...};
+  const std::array<size_t, kNumInputs> element_sizes = {
+      static_cast<size_t>(inputs[Is]->element_size())...};
+  const size_t out_element_size = out.element_size();
+  char* const data_out = reinterpret_cast<char*>(out.mutable_data_ptr());
+
+  const auto run = [&](size_t out_ix,
+                       const std::array<size_t, kNumInputs>& in_ix,
+                       size_t len) {
+    char* out_ptr = data_out + out_ix * out_element_size;
+    std::array<const char*, kNumInputs> in_ptrs = {
+        (data_in[Is] + in_ix[Is] * element_sizes[Is])...};
+    for (size_t j = 0; j < len; ++j) {
+      auto result = compute_fun(load_to_common[Is](in_ptrs[Is])...);
+      store_common_to_out(result, out_ptr);
+      ((in_ptrs[Is] += inner_strides[Is]), ...);
+      out_ptr += out_element_size;
+    }
+  };
+  parallel_for(
+      0,
+      loop.num_runs(),
+      parallel_grain_size(loop.inner_size()),
+      [&](int64_t begin, int64_t end) { loop.run(begin, end, run); });
+}
+
+/**
+ * Shared implementation of the apply_*_elementwise_fn functions below, after
+ * dtype checks.
+ *
+ * The output is walked with BroadcastStridedLoop, so broadcasting costs a few
+ * additions per run of elements rather than an index remapping per element.
+ * When all tensors already have the compute dtype, elements are accessed
+ * directly instead of through per-element load/store function pointers.
+ * Large outputs are split into ranges of runs with parallel_for().
+ */
+template <
+    typename CTYPE_COMMON,
+    const char* op_name,
+    typename Op,
+    size_t kNumInputs>
+inline void apply_elementwise_fn(
+    const Op& compute_fun,
+    const std::array<const Tensor*, kNumInputs>& inputs,
+    const std::array<SupportedTensorDtypes, kNumInputs>& input_dtypes,
+    const Tensor& out,
+    SupportedTensorDtypes out_dtypes) {
+  constexpr auto compute_type = CppTypeToScalarType<CTYPE_COMMON>::value;
+  const BroadcastStridedLoop<kNumInputs> loop(out, inputs);
+
+  bool all_compute_type = out.scalar_type() == compute_type;
+  for (const Tensor* input : inputs) {
+    all_compute_type = all_compute_type && input->scalar_type() == compute_type;
+  }
+  if (all_compute_type) {
+    apply_elementwise_fn_same_dtype<CTYPE_COMMON>(
+        compute_fun,
+        loop,
+        inputs,
+        out,
+        std::make_index_sequence<kNumInputs>());
+  } else {
+    apply_elementwise_fn_mixed_dtype<CTYPE_COMMON, op_name>(
+        compute_fun,
+        loop,
+        inputs,
+        input_dtypes,
+        out,
+        out_dtypes,
+        std::make_index_sequence<kNumInputs>());
+  }
+}
+
+} // namespace internal
+
 template <typename CTYPE_COMMON, const char* op_name, typename Op>
 inline void apply_unitensor_elementwise_fn(
     const Op& compute_fun,
@@ -60,21 +212,8 @@ inline void apply_unitensor_elementwise_fn(
        internal::check_tensor_dtype(out, out_dtypes, compute_type)),
       InvalidArgument, );
 
-  const auto load_a_to_common =
-      internal::get_load_to_common_fn<CTYPE_COMMON, op_name>(a, a_dtypes);
-  const auto store_common_to_out =
-      internal::get_store_common_to_tensor_fn<CTYPE_COMMON, op_name>(
-          out, out_dtypes);
-  const char* const data_a = reinterpret_cast<const char*>(a.const_data_ptr());
-  const auto a_element_size = a.element_size();
-  const auto out_element_size = out.element_size();
-  char* const data_out = reinterpret_cast<char*>(out.mutable_data_ptr());
-
-  auto out_numel = out.numel();
-  for (size_t i = 0; i < out_numel; ++i) {
-    auto result = compute_fun(load_a_to_common(&data_a[i * a_element_size]));
-    store_common_to_out(result, &data_out[i * out_element_size]);
-  }
+  internal::apply_elementwise_fn<CTYPE_COMMON, op_name, Op, 1>(
+      compute_fun, {&a}, {a_dtypes}, out, out_dtypes);
 }
 
 /**
@@ -101,46 +240,8 @@ inline void apply_bitensor_elementwise_fn(
        internal::check_tensor_dtype(out, out_dtypes, compute_type)),
       InvalidArgument, );
 
-  const bool a_is_broadcasted = !out.sizes().equals(a.sizes());
-  const bool b_is_broadcasted = !out.sizes().equals(b.sizes());
-  const bool any_is_broadcasted = (a_is_broadcasted || b_is_broadcasted);
-
-  const auto load_a_to_common =
-      internal::get_load_to_common_fn<CTYPE_COMMON, op_name>(a, a_dtypes);
-  const auto load_b_to_common =
-      internal::get_load_to_common_fn<CTYPE_COMMON, op_name>(b, b_dtypes);
-  const auto store_common_to_out =
-      internal::get_store_common_to_tensor_fn<CTYPE_COMMON, op_name>(
-          out, out_dtypes);
-  const char* const data_a = reinterpret_cast<const char*>(a.const_data_ptr());
-  const char* const data_b = reinterpret_cast<const char*>(b.const_data_ptr());
-  const auto a_element_size = a.element_size();
-  const auto b_element_size = b.element_size();
-  const auto out_element_size = out.element_size();
-  char* const data_out = reinterpret_cast<char*>(out.mutable_data_ptr());
-
-  auto out_numel = out.numel();
-  for (size_t i = 0; i < out_numel; ++i) {
-    size_t a_linear_index = i;
-    size_t b_linear_index = i;
-
-    if (any_is_broadcasted) {
-      size_t out_indexes[kTensorDimensionLimit];
-      delinearize_index(i, out, out_indexes, kTensorDimensionLimit);
-
-      if (a_is_broadcasted) {
-        a_linear_index = linearize_access_indexes(out_indexes, out.dim(), a);
-      }
-      if (b_is_broadcasted) {
-        b_linear_index = linearize_access_indexes(out_indexes, out.dim(), b);
-      }
-    }
-
-    auto result = compute_fun(
-        load_a_to_common(&data_a[a_linear_index * a_element_size]),
-        load_b_to_common(&data_b[b_linear_index * b_element_size]));
-    store_common_to_out(result, &data_out[i * out_element_size]);
-  }
+  internal::apply_elementwise_fn<CTYPE_COMMON, op_name, Op, 2>(
+      compute_fun, {&a, &b}, {a_dtypes, b_dtypes}, out, out_dtypes);
 }
 
 /**
@@ -185,57 +286,12 @@ inline void apply_tritensor_elementwise_fn(
        internal::check_tensor_dtype(out, out_dtypes, compute_type)),
       InvalidArgument, );
 
-  const bool a_is_broadcasted = !out.sizes().equals(a.sizes());
-  const bool b_is_broadcasted = !out.sizes().equals(b.sizes());
-  const bool c_is_broadcasted = !out.sizes().equals(c.sizes());
-  const bool any_is_broadcasted =
-      (a_is_broadcasted || b_is_broadcasted || c_is_broadcasted);
-
-  const auto load_a_to_common =
-      internal::get_load_to_common_fn<CTYPE_COMMON, op_name>(a, a_dtypes);
-  const auto load_b_to_common =
-      internal::get_load_to_common_fn<CTYPE_COMMON, op_name>(b, b_dtypes);
-  const auto load_c_to_common =
-      internal::get_load_to_common_fn<CTYPE_COMMON, op_name>(c, c_dtypes);
-  const auto store_common_to_out =
-      internal::get_store_common_to_tensor_fn<CTYPE_COMMON, op_name>(
-          out, out_dtypes);
-  const char* const data_a = reinterpret_cast<const char*>(a.const_data_ptr());
-  const char* const data_b = reinterpret_cast<const char*>(b.const_data_ptr());
-  const char* const data_c = reinterpret_cast<const char*>(c.const_data_ptr());
-  const auto a_element_size = a.element_size();
-  const auto b_element_size = b.element_size();
-  const auto c_element_size = c.element_size();
-  const auto out_element_size = out.element_size();
-  char* const data_out = reinterpret_cast<char*>(out.mutable_data_ptr());
-
-  auto out_numel = out.numel();
-  for (size_t i = 0; i < out_numel; ++i) {
-    size_t a_linear_index = i;
-    size_t b_linear_index = i;
-    size_t c_linear_index = i;
-
-    if (any_is_broadcasted) {
-      size_t out_indexes[kTensorDimensionLimit];
-      delinearize_index(i, out, out_indexes, kTensorDimensionLimit);
-
-      if (a_is_broadcasted) {
-        a_linear_index = linearize_access_indexes(out_indexes, out.dim(), a);
-      }
-      if (b_is_broadcasted) {
-        b_linear_index = linearize_access_indexes(out_indexes, out.dim(), b);
-      }
-      if (c_is_broadcasted) {
-        c_linear_index = linearize_access_indexes(out_indexes, out.dim(), c);
-      }
-    }
-
-    auto result = compute_fun(
-        load_a_to_common(&data_a[a_linear_index * a_element_size]),
-        load_b_to_common(&data_b[b_linear_index * b_element_size]),
-        load_c_to_common(&data_c[c_linear_index * c_element_size]));
-    store_common_to_out(result, &data_out[i * out_element_size]);
-  }
+  internal::apply_elementwise_fn<CTYPE_COMMON, op_name, Op, 3>(
+      compute_fun,
+      {&a, &b, &c},
+      {a_dtypes, b_dtypes, c_dtypes},
+      out,
+      out_dtypes);
 }
 
 inline ScalarType get_compute_type(ScalarType& common_type) {
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <executorch/kernels/portable/cpu/util/parallel_util.h>
 #include <executorch/runtime/core/exec_aten/exec_aten.h>
 #include <executorch/runtime/core/exec_aten/util/tensor_util.h>
 
@@ -56,6 +57,26 @@ inline void apply_unary_map_fn(
   }
 }
 
+/**
+ * Same as apply_unary_map_fn() with a stride of 1, but splits the elements
+ * across threads when the portable kernels are built with ET_USE_THREADPOOL.
+ */
+template <typename CTYPE_IN, typename CTYPE_OUT, typename MapOp>
+inline void parallel_apply_unary_map_fn(
+    const MapOp& map_fun,
+    const CTYPE_IN* const data_in,
+    CTYPE_OUT* const data_out,
+    const int64_t size) {
+  native::utils::parallel_for(
+      0,
+      size,
+      native::utils::kParallelGrainSize,
+      [&](int64_t begin, int64_t end) {
+        apply_unary_map_fn(
+            map_fun, data_in + begin, data_out + begin, end - begin);
+      });
+}
+
 //
 // Mapping + Reduction
 //
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#ifdef ET_USE_THREADPOOL
+#include <executorch/extension/parallel/thread_parallel.h>
+#endif
+
+/**
+ * Work partitioning for the portable kernels.
+ *
+ * The portable kernels are single-threaded by default. When the library is
+ * built with ET_USE_THREADPOOL (the EXECUTORCH_PORTABLE_USE_THREADPOOL CMake
+ * option, or executorch.portable_use_threadpool=true in buck), kernels that
+ * route their outer loop through parallel_for() split it across the
+ * extension threadpool. Otherwise parallel_for() calls the function once on
+ * the calling thread and no threading code is linked in.
+ */
+
+namespace torch {
+namespace executor {
+namespace native {
+namespace utils {
+
+/**
+ * Minimum number of elements each task should touch. Below this, the cost of
+ * waking worker threads exceeds the work saved.
+ */
+constexpr int64_t kParallelGrainSize = 32 * 1024;
+
+/**
+ * Returns the grain size, in work items, for a loop in which each item
+ * touches `elements_per_item` elements, so that every task touches at least
+ * kParallelGrainSize elements.
+ */
+inline int64_t parallel_grain_size(int64_t elements_per_item) {
+  return std::max<int64_t>(
+      1, kParallelGrainSize / std::max<int64_t>(1, elements_per_item));
+}
+
+/**
+ * Runs f(chunk_begin, chunk_end) over chunks of [begin, end) that are at
+ * least `grain_size` items long. The chunks may run concurrently, so `f`
+ * must only write state that is private to its chunk.
+ */
+template <typename Func>
+inline void parallel_for(
+    int64_t begin,
+    int64_t end,
+    int64_t grain_size,
+    const Func& f) {
+  if (begin >= end) {
+    return;
+  }
+#ifdef ET_USE_THREADPOOL
+  if (end - begin > grain_size) {
+    ::executorch::extension::parallel_for(begin, end, grain_size, f);
+    return;
+  }
+#else
+  (void)grain_size;
+#endif
+  f(begin, end);
+}
+
+} // namespace utils
+} // namespace native
+} // namespace executor
+} // namespace torch
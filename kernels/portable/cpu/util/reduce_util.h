@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <executorch/kernels/portable/cpu/util/parallel_util.h>
 #include <executorch/runtime/core/exec_aten/exec_aten.h>
 #include <executorch/runtime/core/exec_aten/util/tensor_util.h>
 #include <cstring>
@@ -232,6 +233,41 @@ void apply_over_dim(
   }
 }
 
+/**
+ * Same as apply_over_dim() above, but splits the calls to `fn` across threads
+ * when the portable kernels are built with ET_USE_THREADPOOL. `fn` is called
+ * exactly once per base index, in no particular order, and must only write
+ * the output elements of its own reduction.
+ */
+template <typename Fn>
+void parallel_apply_over_dim(
+    const Fn& fn,
+    const exec_aten::Tensor& in,
+    const exec_aten::optional<int64_t>& dim) {
+  if (!dim.has_value() || in.dim() == 0 || in.numel() == 0) {
+    apply_over_dim(fn, in, dim);
+    return;
+  }
+
+  ET_CHECK_VALID_DIM(dim.value(), in.dim());
+  const size_t d = ET_NORMALIZE_IX(dim.value(), in.dim());
+
+  const size_t size = in.size(d);
+  const size_t stride = in.strides()[d];
+  const size_t outer_stride = size * stride;
+  const int64_t num_reductions = getLeadingDims(in, d) * stride;
+  native::utils::parallel_for(
+      0,
+      num_reductions,
+      native::utils::parallel_grain_size(size),
+      [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+          const size_t base = (i / stride) * outer_stride + i % stride;
+          fn(size, stride, base);
+        }
+      });
+}
+
 /**
  * Useful to reduce a tensor `in` over a given dimension `dim` for the output
  * element at index `out_ix` using the reduce function `fn`, which
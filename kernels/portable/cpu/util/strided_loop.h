@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include <executorch/runtime/core/exec_aten/exec_aten.h>
+#include <executorch/runtime/core/exec_aten/util/tensor_util.h>
+
+namespace torch {
+namespace executor {
+namespace native {
+namespace utils {
+
+/**
+ * Walks the elements of an output tensor, in linear order, together with the
+ * matching (possibly broadcast) elements of kNumInputs input tensors.
+ *
+ * Instead of mapping every output index back to input indexes, the loop is
+ * planned once up front:
+ *   - each input gets an element stride per output dimension, 0 where it is
+ *     broadcast;
+ *   - size-1 dimensions are dropped, and adjacent dimensions that every
+ *     tensor traverses contiguously are merged, so a bias add over
+ *     [N, C, H, W] + [C, 1, 1] becomes a loop over [N, C, H * W];
+ *   - the innermost remaining dimension becomes a run of elements with a
+ *     fixed stride per input, handed to the caller in one call.
+ *
+ * Inputs with the same sizes as the output are addressed by the output's
+ * linear index, and broadcast inputs through their strides, exactly as
+ * delinearize_index() and linearize_access_indexes() would.
+ *
+ * Example:
+ *
+ *   BroadcastStridedLoop<2> loop(out, {&a, &b});
+ *   loop.run([&](size_t out_ix, const std::array<size_t, 2>& in_ix,
+ *                size_t len) {
+ *     for (size_t j = 0; j < len; ++j) {
+ *       out_data[out_ix + j] = a_data[in_ix[0] + j * loop.inner_stride(0)] +
+ *           b_data[in_ix[1] + j * loop.inner_stride(1)];
+ *     }
+ *   });
+ */
+template <size_t kNumInputs>
+class BroadcastStridedLoop {
+ public:
+  BroadcastStridedLoop(
+      const Tensor& out,
+      const std::array<const Tensor*, kNumInputs>& inputs)
+      : numel_(out.numel()) {
+    const ssize_t out_dim = out.dim();
+    // Element strides of a contiguous tensor with the output's sizes, used
+    // for inputs that aren't broadcast.
+    size_t linear_strides[kTensorDimensionLimit];
+    size_t linear_stride = 1;
+    for (ssize_t d = out_dim - 1; d >= 0; --d) {
+      linear_strides[d] = linear_stride;
+      linear_stride *= out.size(d);
+    }
+
+    // Walk the output dimensions from innermost to outermost, dropping
+    // size-1 dimensions and merging each one into the previous (inner) one
+    // when every input steps over both as a single dimension.
+    for (ssize_t d = out_dim - 1; d >= 0; --d) {
+      const size_t size = out.size(d);
+      if (size == 1) {
+        continue;
+      }
+      size_t strides[kNumInputs];
+      for (size_t k = 0; k < kNumInputs; ++k) {
+        strides[k] = input_stride(*inputs[k], out, d, linear_strides[d]);
+      }
+      bool can_merge = ndim_ > 0;
+      for (size_t k = 0; can_merge && k < kNumInputs; ++k) {
+        can_merge = strides[k] == strides_[k][ndim_ - 1] * sizes_[ndim_ - 1];
+      }
+      if (can_merge) {
+        sizes_[ndim_ - 1] *= size;
+      } else {
+        sizes_[ndim_] = size;
+        for (size_t k = 0; k < kNumInputs; ++k) {
+          strides_[k][ndim_] = strides[k];
+        }
+        ndim_++;
+      }
+    }
+  }
+
+  /// Returns the number of dimensions left after coalescing.
+  size_t ndim() const {
+    return ndim_;
+  }
+
+  /// Returns the number of elements in each call made by run().
+  size_t inner_size() const {
+    return ndim_ > 0 ? sizes_[0] : 1;
+  }
+
+  /// Returns the number of runs of inner_size() elements in the output.
+  size_t num_runs() const {
+    return numel_ == 0 ? 0 : numel_ / inner_size();
+  }
+
+  /**
+   * Returns the element stride of input `k` within each run of inner_size()
+   * elements: 1 if it's contiguous, 0 if it's broadcast along the run.
+   */
+  size_t inner_stride(size_t k) const {
+    return ndim_ > 0 ? strides_[k][0] : 0;
+  }
+
+  /**
+   * Calls fn(out_index, input_indexes, len) for every run of len ==
+   * inner_size() output elements, in increasing order of out_index.
+   * input_indexes[k] is the element index into input k of the first element
+   * of the run; consecutive elements are inner_stride(k) apart.
+   */
+  template <typename Fn>
+  void run(const Fn& fn) const {
+    run(0, num_runs(), fn);
+  }
+
+  /**
+   * Like run(), but only for the runs with index in [begin, end), where run
+   * `r` starts at output element r * inner_size(). Ranges can be processed
+   * independently, e.g. on different threads.
+   */
+  template <typename Fn>
+  void run(size_t begin, size_t end, const Fn& fn) const {
+    if (begin >= end) {
+      return;
+    }
+    const size_t inner = inner_size();
+    // Position of run `begin` along each outer dimension.
+    size_t counter[kTensorDimensionLimit] = {};
+    std::array<size_t, kNumInputs> offsets{};
+    size_t remaining = begin;
+    for (size_t d = 1; d < ndim_; ++d) {
+      counter[d] = remaining % sizes_[d];
+      remaining /= sizes_[d];
+      for (size_t k = 0; k < kNumInputs; ++k) {
+        offsets[k] += counter[d] * strides_[k][d];
+      }
+    }
+
+    for (size_t r = begin; r < end; ++r) {
+      fn(r * inner, offsets, inner);
+      // Advance to the next run like an odometer.
+      for (size_t d = 1; d < ndim_; ++d) {
+        for (size_t k = 0; k < kNumInputs; ++k) {
+          offsets[k] += strides_[k][d];
+        }
+        if (++counter[d] < sizes_[d]) {
+          break;
+        }
+        for (size_t k = 0; k < kNumInputs; ++k) {
+          offsets[k] -= strides_[k][d] * sizes_[d];
+        }
+        counter[d] = 0;
+      }
+    }
+  }
+
+ private:
+  // Returns the element stride of `in` along output dimension `d`.
+  static size_t input_stride(
+      const Tensor& in,
+      const Tensor& out,
+      ssize_t d,
+      size_t linear_stride) {
+    if (in.sizes().equals(out.sizes())) {
+      return linear_stride;
+    }
+    const ssize_t in_d = d - (out.dim() - in.dim());
+    if (in_d < 0 || in.size(in_d) == 1) {
+      return 0;
+    }
+    return in.strides()[in_d];
+  }
+
+  size_t numel_;
+  // Coalesced dimensions, innermost first.
+  size_t ndim_ = 0;
+  size_t sizes_[kTensorDimensionLimit];
+  size_t strides_[kNumInputs][kTensorDimensionLimit];
+};
+
+} // namespace utils
+} // namespace native
+} // namespace executor
+} // namespace torch
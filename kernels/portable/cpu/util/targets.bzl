@@ -1,5 +1,13 @@
 load("@fbsource//xplat/executorch/build:runtime_wrapper.bzl", "runtime")
 
+def portable_use_threadpool():
+    """Whether the portable kernels split large ops across the threadpool.
+
+    Off by default so that the portable kernels stay single-threaded and free
+    of threading dependencies for embedded targets.
+    """
+    return native.read_config("executorch", "portable_use_threadpool", "false") == "true"
+
 def define_common_targets():
     """Defines targets that should be shared between fbcode and xplat.
 
@@ -31,6 +39,8 @@ def define_common_targets():
             "//executorch/kernels/portable/cpu/util:advanced_index_util",
             "//executorch/kernels/portable/cpu/util:slice_util",
             "//executorch/kernels/portable/cpu/util:elementwise_util",
+            "//executorch/kernels/portable/cpu/util:strided_loop",
+            "//executorch/kernels/portable/cpu/util:parallel_util",
         ],
         visibility = ["//executorch/...", "@EXECUTORCH_CLIENTS"],
     )
@@ -100,9 +110,24 @@ def define_common_targets():
         deps = [
             ":broadcast_util",
             ":dtype_util",
+            ":strided_loop",
             "//executorch/kernels/portable/cpu:scalar_utils",
             "//executorch/runtime/kernel:kernel_includes",
         ],
+        exported_deps = [
+            ":parallel_util",
+        ],
+        visibility = ["//executorch/kernels/portable/cpu/...", "//executorch/kernels/optimized/cpu/..."],
+    )
+
+    runtime.cxx_library(
+        name = "strided_loop",
+        exported_headers = [
+            "strided_loop.h",
+        ],
+        deps = [
+            "//executorch/runtime/core/exec_aten/util:tensor_util",
+        ],
         visibility = ["//executorch/kernels/portable/cpu/...", "//executorch/kernels/optimized/cpu/..."],
     )
 
@@ -234,7 +259,10 @@ def define_common_targets():
             "//executorch/runtime/core/exec_aten/util:tensor_util",
             ":broadcast_util",
         ],
-        visibility = ["//executorch/kernels/portable/cpu/...", "//executorch/kernels/quantized/...", "@EXECUTORCH_CLIENTS"],
+        exported_deps = [
+            ":parallel_util",
+        ],
+        visibility = ["//executorch/kernels/portable/cpu/...", "//executorch/kernels/optimized/cpu/...", "//executorch/kernels/quantized/...", "@EXECUTORCH_CLIENTS"],
     )
 
     runtime.cxx_library(
@@ -266,9 +294,28 @@ def define_common_targets():
         visibility = ["//executorch/kernels/portable/cpu/..."],
     )
 
-    # Utility functions that can be used by operators that perform reduction
     for aten_mode in [True, False]:
         suffix = "_aten" if aten_mode else ""
+
+        # Splits loops across the threadpool when portable_use_threadpool is
+        # set, and runs them inline otherwise.
+        runtime.cxx_library(
+            name = "parallel_util{}".format(suffix),
+            exported_headers = ["parallel_util.h"],
+            exported_deps = [
+                "//executorch/extension/parallel:thread_parallel{}".format(suffix),
+                "//executorch/extension/threadpool:threadpool",
+            ] if portable_use_threadpool() else [],
+            visibility = [
+                "//executorch/extension/llm/custom_ops/...",
+                "//executorch/kernels/portable/cpu/...",
+                "//executorch/kernels/optimized/cpu/...",
+                "//executorch/kernels/quantized/...",
+                "@EXECUTORCH_CLIENTS",
+            ],
+        )
+
+        # Utility functions that can be used by operators that perform reduction
         runtime.cxx_library(
             name = "reduce_util{}".format(suffix),
             srcs = ["reduce_util.cpp"],
@@ -277,10 +324,14 @@ def define_common_targets():
                 "//executorch/runtime/kernel:kernel_includes{}".format(suffix),
                 "//executorch/runtime/core/exec_aten/util:tensor_util{}".format(suffix),
             ],
+            exported_deps = [
+                ":parallel_util{}".format(suffix),
+            ],
             exported_preprocessor_flags = ["-DUSE_ATEN_LIB"] if aten_mode else [],
             visibility = [
                 "//executorch/extension/llm/custom_ops/...",
                 "//executorch/kernels/portable/cpu/...",
+                "//executorch/kernels/optimized/cpu/...",
                 "//executorch/kernels/quantized/...",
                 "@EXECUTORCH_CLIENTS",
             ],
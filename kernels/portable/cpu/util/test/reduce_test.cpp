@@ -23,6 +23,7 @@ using executorch::runtime::testing::TensorFactory;
 using torch::executor::apply_over_dim;
 using torch::executor::apply_over_dim_list;
 using torch::executor::get_out_numel;
+using torch::executor::parallel_apply_over_dim;
 
 void _apply_over_dim(const Tensor& in, const optional<int64_t>& dim) {
   int64_t* in_data = in.mutable_data_ptr<int64_t>();
@@ -121,6 +122,39 @@ TEST(ReduceUtilTest, ApplyOverDim) {
   // clang-format on
 }
 
+TEST(ReduceUtilTest, ParallelApplyOverDimVisitsEachElementOnce) {
+  TensorFactory<ScalarType::Long> tf;
+
+  for (int64_t dim = -1; dim < 4; ++dim) {
+    Tensor in = tf.zeros({2, 4, 5, 3});
+    int64_t* in_data = in.mutable_data_ptr<int64_t>();
+    const size_t expected_size = in.size(ET_NORMALIZE_IX(dim, in.dim()));
+    parallel_apply_over_dim(
+        [in_data, expected_size](size_t size, size_t stride, size_t base) {
+          EXPECT_EQ(size, expected_size);
+          for (size_t i = 0; i < size; ++i) {
+            in_data[base + i * stride] += 1;
+          }
+        },
+        in,
+        dim);
+    EXPECT_TENSOR_EQ(in, tf.ones({2, 4, 5, 3}));
+  }
+
+  Tensor in = tf.zeros({2, 4, 5, 3});
+  int64_t* in_data = in.mutable_data_ptr<int64_t>();
+  parallel_apply_over_dim(
+      [in_data](size_t size, size_t stride, size_t base) {
+        EXPECT_EQ(size, 120);
+        for (size_t i = 0; i < size; ++i) {
+          in_data[base + i * stride] += 1;
+        }
+      },
+      in,
+      {});
+  EXPECT_TENSOR_EQ(in, tf.ones({2, 4, 5, 3}));
+}
+
 TEST(ReduceUtilTest, ApplyOverDimListNull) {
   TensorFactory<ScalarType::Long> tf;
   optional<ArrayRef<int64_t>> null_dim_list;
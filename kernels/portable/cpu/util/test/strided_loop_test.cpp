@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/kernels/portable/cpu/util/broadcast_util.h>
+#include <executorch/kernels/portable/cpu/util/strided_loop.h>
+
+#include <executorch/runtime/core/exec_aten/exec_aten.h>
+#include <executorch/runtime/core/exec_aten/testing_util/tensor_factory.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+using namespace ::testing;
+using exec_aten::ScalarType;
+using exec_aten::Tensor;
+using executorch::runtime::testing::TensorFactory;
+using torch::executor::delinearize_index;
+using torch::executor::kTensorDimensionLimit;
+using torch::executor::linearize_access_indexes;
+using torch::executor::native::utils::BroadcastStridedLoop;
+
+namespace {
+
+// Returns, for every output element in order, the index into each input.
+template <size_t N>
+std::vector<std::array<size_t, N>> loop_indexes(
+    const BroadcastStridedLoop<N>& loop,
+    size_t begin,
+    size_t end) {
+  std::vector<std::array<size_t, N>> result;
+  loop.run(
+      begin,
+      end,
+      [&](size_t out_ix, const std::array<size_t, N>& in_ix, size_t len) {
+        EXPECT_EQ(out_ix, (begin + result.size() / len) * len);
+        for (size_t j = 0; j < len; ++j) {
+          std::array<size_t, N> element;
+          for (size_t k = 0; k < N; ++k) {
+            element[k] = in_ix[k] + j * loop.inner_stride(k);
+          }
+          result.push_back(element);
+        }
+      });
+  return result;
+}
+
+// Checks the loop against delinearize_index()/linearize_access_indexes().
+template <size_t N>
+void expect_matches_reference(
+    const Tensor& out,
+    const std::array<const Tensor*, N>& inputs) {
+  BroadcastStridedLoop<N> loop(out, inputs);
+  const auto actual = loop_indexes(loop, 0, loop.num_runs());
+  ASSERT_EQ(actual.size(), out.numel());
+  for (size_t i = 0; i < actual.size(); ++i) {
+    size_t out_indexes[kTensorDimensionLimit];
+    delinearize_index(i, out, out_indexes, kTensorDimensionLimit);
+    for (size_t k = 0; k < N; ++k) {
+      const size_t expected = inputs[k]->sizes().equals(out.sizes())
+          ? i
+          : linearize_access_indexes(out_indexes, out.dim(), *inputs[k]);
+      EXPECT_EQ(actual[i][k], expected) << "element " << i << " input " << k;
+    }
+  }
+}
+
+} // namespace
+
+TEST(StridedLoopTest, ContiguousInputsCoalesceToOneRun) {
+  TensorFactory<ScalarType::Float> tf;
+  Tensor a = tf.zeros({2, 3, 4});
+  Tensor b = tf.zeros({2, 3, 4});
+  Tensor out = tf.zeros({2, 3, 4});
+
+  BroadcastStridedLoop<2> loop(out, {&a, &b});
+  EXPECT_EQ(loop.ndim(), 1);
+  EXPECT_EQ(loop.inner_size(), 24);
+  EXPECT_EQ(loop.num_runs(), 1);
+  EXPECT_EQ(loop.inner_stride(0), 1);
+  EXPECT_EQ(loop.inner_stride(1), 1);
+}
+
+TEST(StridedLoopTest, BroadcastDimsAreMergedWhenPossible) {
+  TensorFactory<ScalarType::Float> tf;
+  // A per-channel bias over NCHW: H and W merge into one contiguous run.
+  Tensor a = tf.zeros({2, 3, 4, 5});
+  Tensor bias = tf.zeros({3, 1, 1});
+  Tensor out = tf.zeros({2, 3, 4, 5});
+
+  BroadcastStridedLoop<2> loop(out, {&a, &bias});
+  EXPECT_EQ(loop.ndim(), 3);
+  EXPECT_EQ(loop.inner_size(), 20);
+  EXPECT_EQ(loop.num_runs(), 6);
+  EXPECT_EQ(loop.inner_stride(0), 1);
+  EXPECT_EQ(loop.inner_stride(1), 0);
+
+  expect_matches_reference<2>(out, {&a, &bias});
+}
+
+TEST(StridedLoopTest, MatchesReferenceIndexing) {
+  TensorFactory<ScalarType::Float> tf;
+  Tensor out = tf.zeros({3, 1, 4, 5});
+
+  Tensor same = tf.zeros({3, 1, 4, 5});
+  Tensor scalar = tf.zeros({1});
+  Tensor row = tf.zeros({5});
+  Tensor column = tf.zeros({4, 1});
+  Tensor outer = tf.zeros({3, 1, 1, 1});
+  Tensor mixed = tf.zeros({3, 1, 1, 5});
+
+  expect_matches_reference<1>(out, {&same});
+  expect_matches_reference<1>(out, {&scalar});
+  expect_matches_reference<2>(out, {&row, &column});
+  expect_matches_reference<3>(out, {&outer, &mixed, &same});
+  expect_matches_reference<3>(out, {&column, &scalar, &mixed});
+}
+
+TEST(StridedLoopTest, PartialRangesMatchFullRun) {
+  TensorFactory<ScalarType::Float> tf;
+  Tensor a = tf.zeros({4, 1, 6});
+  Tensor b = tf.zeros({5, 1});
+  Tensor out = tf.zeros({4, 5, 6});
+
+  BroadcastStridedLoop<2> loop(out, {&a, &b});
+  const auto full = loop_indexes(loop, 0, loop.num_runs());
+  std::vector<std::array<size_t, 2>> pieces;
+  for (size_t begin = 0; begin < loop.num_runs(); begin += 3) {
+    const size_t end = std::min(begin + 3, loop.num_runs());
+    const auto piece = loop_indexes(loop, begin, end);
+    pieces.insert(pieces.end(), piece.begin(), piece.end());
+  }
+  EXPECT_EQ(pieces, full);
+}
+
+TEST(StridedLoopTest, EmptyAndScalarOutputs) {
+  TensorFactory<ScalarType::Float> tf;
+  Tensor empty = tf.zeros({2, 0, 3});
+  BroadcastStridedLoop<1> empty_loop(empty, {&empty});
+  EXPECT_EQ(empty_loop.num_runs(), 0);
+  size_t calls = 0;
+  empty_loop.run([&](size_t, const std::array<size_t, 1>&, size_t) {
+    calls++;
+  });
+  EXPECT_EQ(calls, 0);
+
+  Tensor scalar = tf.zeros({});
+  BroadcastStridedLoop<1> scalar_loop(scalar, {&scalar});
+  EXPECT_EQ(scalar_loop.num_runs(), 1);
+  EXPECT_EQ(scalar_loop.inner_size(), 1);
+  expect_matches_reference<1>(scalar, {&scalar});
+}
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include <executorch/kernels/optimized/vec/functional.h>
+#include <executorch/kernels/optimized/vec/vec.h>
+#include <executorch/kernels/portable/cpu/util/parallel_util.h>
+#include <executorch/kernels/quantized/cpu/vec_quantize.h>
+
+/**
+ * The lookup loop shared by quantized_decomposed::embedding_byte,
+ * embedding_2bit and embedding_4bit.
+ *
+ * Rows are dequantized one quantization group at a time, so the scale and
+ * zero point are loaded once per group rather than once per element, and
+ * sub-byte values are unpacked a vector of bytes at a time with
+ * vec_load_subbyte(). Indices are split across threads, and each thread
+ * prefetches the row of its next index while it dequantizes the current one,
+ * since indices are in no particular order.
+ */
+
+namespace torch {
+namespace executor {
+namespace native {
+namespace internal {
+
+/// Bytes between prefetches of an embedding row.
+constexpr int64_t kEmbeddingPrefetchStride = 64;
+
+/// Hints that the `size` bytes at `data` will be read soon.
+inline void embedding_prefetch(const void* data, int64_t size) {
+#if defined(__GNUC__) || defined(__clang__)
+  const char* bytes = static_cast<const char*>(data);
+  for (int64_t i = 0; i < size; i += kEmbeddingPrefetchStride) {
+    __builtin_prefetch(bytes + i);
+  }
+#else
+  (void)data;
+  (void)size;
+#endif
+}
+
+/// Returns element `index` of a row of kBits-bit values, offset removed.
+template <int kBits, typename CTYPE_W>
+inline int32_t embedding_weight_value(const CTYPE_W* row, int64_t index) {
+  if constexpr (kBits == 8) {
+    return static_cast<int32_t>(row[index]);
+  } else {
+    constexpr int kPerByte = 8 / kBits;
+    constexpr int kMask = (1 << kBits) - 1;
+    const int field = index % kPerByte;
+    const int shift = kBits == 4 ? 4 - 4 * field : kBits * field;
+    const uint8_t byte = static_cast<uint8_t>(row[index / kPerByte]);
+    return static_cast<int32_t>((byte >> shift) & kMask) - (1 << (kBits - 1));
+  }
+}
+
+/// Stores a vector to `dst`, converting to CTYPE_OUT.
+template <typename CTYPE_OUT>
+inline void embedding_store(
+    const ::executorch::vec::Vectorized<float>& v,
+    CTYPE_OUT* dst) {
+  using Vec = ::executorch::vec::Vectorized<float>;
+  if constexpr (std::is_same<CTYPE_OUT, float>::value) {
+    v.store(dst);
+  } else {
+    float buf[Vec::size()];
+    v.store(buf);
+    for (int64_t i = 0; i < Vec::size(); ++i) {
+      dst[i] = static_cast<CTYPE_OUT>(buf[i]);
+    }
+  }
+}
+
+/**
+ * out[j] = (w[begin + j] - zero_point) * scale for `size` elements of a row
+ * of kBits-bit values, with the same float arithmetic as the scalar
+ * reference.
+ */
+template <int kBits, typename CTYPE_W, typename CTYPE_OUT>
+void embedding_dequantize_span(
+    const CTYPE_W* row,
+    int64_t begin,
+    int64_t size,
+    float scale,
+    float zero_point,
+    CTYPE_OUT* out) {
+  using Vec = ::executorch::vec::Vectorized<float>;
+  constexpr int64_t kPerByte = 8 / kBits;
+  constexpr int64_t kStep = Vec::size() * kPerByte;
+  const auto dequantize = [&](int64_t j) {
+    out[j] = static_cast<CTYPE_OUT>(
+        (static_cast<float>(embedding_weight_value<kBits>(row, begin + j)) -
+         zero_point) *
+        scale);
+  };
+
+  int64_t j = 0;
+  // Sub-byte spans can start mid-byte when the group size isn't a multiple
+  // of the values per byte.
+  for (; j < size && (begin + j) % kPerByte != 0; ++j) {
+    dequantize(j);
+  }
+  const Vec scale_vec(scale);
+  const Vec zero_point_vec(zero_point);
+  for (; j + kStep <= size; j += kStep) {
+    if constexpr (kBits == 8) {
+      embedding_store(
+          (vec_load_8bit(row + begin + j) - zero_point_vec) * scale_vec,
+          out + j);
+    } else {
+      Vec fields[kPerByte];
+      vec_load_subbyte<kBits>(
+          reinterpret_cast<const uint8_t*>(row) + (begin + j) / kPerByte,
+          fields);
+      for (int64_t f = 0; f < kPerByte; ++f) {
+        fields[f] = (fields[f] - zero_point_vec) * scale_vec;
+      }
+      // Field f of byte t is element t * kPerByte + f.
+      if constexpr (kBits == 4) {
+        const auto pairs =
+            ::executorch::vec::interleave2<float>(fields[0], fields[1]);
+        embedding_store(pairs.first, out + j);
+        embedding_store(pairs.second, out + j + Vec::size());
+      } else {
+        const auto even =
+            ::executorch::vec::interleave2<float>(fields[0], fields[2]);
+        const auto odd =
+            ::executorch::vec::interleave2<float>(fields[1], fields[3]);
+        const auto first =
+            ::executorch::vec::interleave2<float>(even.first, odd.first);
+        const auto second =
+            ::executorch::vec::interleave2<float>(even.second, odd.second);
+        embedding_store(first.first, out + j);
+        embedding_store(first.second, out + j + Vec::size());
+        embedding_store(second.first, out + j + 2 * Vec::size());
+        embedding_store(second.second, out + j + 3 * Vec::size());
+      }
+    }
+  }
+  for (; j < size; ++j) {
+    dequantize(j);
+  }
+}
+
+/**
+ * Looks up and dequantizes `num_indices` rows of a kBits-bit embedding table
+ * into `out`, which holds num_indices * embedding_dim values.
+ *
+ * @param[in] weight The table, `row_stride` CTYPE_W elements per row.
+ * @param[in] scales num_groups scales per row.
+ * @param[in] zero_points num_groups zero points per row, or null.
+ */
+template <
+    int kBits,
+    typename CTYPE_W,
+    typename CTYPE_PARAMS,
+    typename CTYPE_OUT>
+void embedding_lookup(
+    const CTYPE_W* weight,
+    int64_t row_stride,
+    const CTYPE_PARAMS* scales,
+    const CTYPE_PARAMS* zero_points,
+    int64_t num_groups,
+    int64_t embedding_dim,
+    const int64_t* indices,
+    int64_t num_indices,
+    CTYPE_OUT* out) {
+  static_assert(kBits == 8 || kBits == 4 || kBits == 2, "unsupported width");
+  const int64_t group_size = embedding_dim / num_groups;
+  const int64_t row_bytes = row_stride * sizeof(CTYPE_W);
+  const int64_t grain_size = std::max<int64_t>(
+      1, kQuantizeGrainSize / std::max<int64_t>(1, embedding_dim));
+
+  utils::parallel_for(
+      0, num_indices, grain_size, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+          if (i + 1 < end) {
+            embedding_prefetch(
+                weight + indices[i + 1] * row_stride, row_bytes);
+          }
+          const int64_t index = indices[i];
+          const CTYPE_W* row = weight + index * row_stride;
+          const CTYPE_PARAMS* row_scales = scales + index * num_groups;
+          const CTYPE_PARAMS* row_zero_points =
+              zero_points ? zero_points + index * num_groups : nullptr;
+          CTYPE_OUT* out_row = out + i * embedding_dim;
+          for (int64_t g = 0; g < num_groups; ++g) {
+            embedding_dequantize_span<kBits>(
+                row,
+                g * group_size,
+                group_size,
+                static_cast<float>(row_scales[g]),
+                row_zero_points ? static_cast<float>(row_zero_points[g])
+                                : 0.0f,
+                out_row + g * group_size);
+          }
+        }
+      });
+}
+
+} // namespace internal
+} // namespace native
+} // namespace executor
+} // namespace torch
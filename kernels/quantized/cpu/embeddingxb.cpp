@@ -6,6 +6,7 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <executorch/kernels/quantized/cpu/embedding_util.h>
 #include <executorch/kernels/quantized/cpu/embeddingxb.h>
 #include <executorch/runtime/kernel/kernel_includes.h>
 #include <algorithm>
@@ -23,34 +24,6 @@ using ScalarType = exec_aten::ScalarType;
 
 namespace {
 
-static inline int32_t
-weight_value(const unsigned char* w_data, int32_t index, int32_t weight_nbit) {
-  if (weight_nbit == 2) {
-    int32_t subbyte = index % 4;
-    index >>= 2;
-    switch (subbyte) {
-      case 0:
-        return (int32_t)(w_data[index] & 3) - 2;
-      case 1:
-        return (int32_t)((w_data[index] & 12) >> 2) - 2;
-      case 2:
-        return (int32_t)((w_data[index] & 48) >> 4) - 2;
-      case 3:
-        return (int32_t)((w_data[index] & 192) >> 6) - 2;
-    }
-  } else if (weight_nbit == 4) {
-    int32_t odd = index & 1;
-    index >>= 1;
-    if (odd) {
-      return (int32_t)(w_data[index] & 0x0F) - 8;
-    } else {
-      return (int32_t)((w_data[index] >> 4) & 0x0F) - 8;
-    }
-  }
-
-  ET_CHECK_MSG(false, "invalid weight_nbit");
-}
-
 static inline int32_t get_embedding_dim(
     int32_t packed_dim,
     int32_t weight_nbit) {
@@ -176,47 +149,33 @@ void embedding_xbit_per_channel(
     int weight_nbit) {
   auto embedding_dim = get_embedding_dim(weight.size(1), weight_nbit);
 
-  int32_t num_groups_per_channel = 1;
+  int64_t num_groups_per_channel = 1;
   if (weight_scales.dim() == 2) {
     num_groups_per_channel = weight_scales.size(1);
   }
-  int32_t group_size = embedding_dim / num_groups_per_channel;
 
-  CTYPE_OUT* out_data = out.mutable_data_ptr<CTYPE_OUT>();
-  const int64_t* indices_ptr = indices.const_data_ptr<int64_t>();
-
-  const CTYPE_PARAMS* scales = weight_scales.const_data_ptr<CTYPE_PARAMS>();
   const CTYPE_PARAMS* zero_points = nullptr;
   if (opt_weight_zero_points.has_value()) {
     zero_points = opt_weight_zero_points.value().const_data_ptr<CTYPE_PARAMS>();
   }
 
-  for (int i = 0; i < indices.numel(); i++) {
-    int64_t index = indices_ptr[i];
-    // If using groupwise embedding
-    int32_t qparams_index = index * num_groups_per_channel;
-    CTYPE_PARAMS zp = 0.0;
-    const CTYPE_PARAMS* scale_ptr = scales + qparams_index;
-    const CTYPE_PARAMS* zero_points_ptr = nullptr;
-    if (opt_weight_zero_points.has_value()) {
-      zero_points_ptr = zero_points + qparams_index;
-    }
-
-    const uint8_t* w_data =
-        weight.const_data_ptr<uint8_t>() + weight.size(1) * index;
-
-    for (int j = 0; j < embedding_dim; ++j) {
-      int32_t group_id = j / group_size;
-      const CTYPE_PARAMS scale = scale_ptr[group_id];
-      if (opt_weight_zero_points.has_value()) {
-        zp = zero_points_ptr[group_id];
-      }
-      out_data[j] = static_cast<CTYPE_OUT>(
-          (static_cast<float>(weight_value(w_data, j, weight_nbit)) -
-           static_cast<float>(zp)) *
-          static_cast<float>(scale));
-    }
-    out_data += embedding_dim;
+  const auto lookup = [&](auto bits) {
+    internal::embedding_lookup<decltype(bits)::value>(
+        weight.const_data_ptr<uint8_t>(),
+        weight.size(1),
+        weight_scales.const_data_ptr<CTYPE_PARAMS>(),
+        zero_points,
+        num_groups_per_channel,
+        embedding_dim,
+        indices.const_data_ptr<int64_t>(),
+        indices.numel(),
+        out.mutable_data_ptr<CTYPE_OUT>());
+  };
+  if (weight_nbit == 4) {
+    lookup(std::integral_constant<int, 4>());
+  } else {
+    ET_CHECK_MSG(weight_nbit == 2, "invalid weight_nbit");
+    lookup(std::integral_constant<int, 2>());
   }
 }
 
@@ -0,0 +1,622 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <executorch/kernels/optimized/utils/unroll.h>
+#include <executorch/kernels/optimized/vec/functional.h>
+#include <executorch/kernels/optimized/vec/vec.h>
+#include <executorch/kernels/portable/cpu/util/parallel_util.h>
+#include <executorch/kernels/quantized/cpu/vec_quantize.h>
+
+/**
+ * Tiled, vectorized and (when built with ET_USE_THREADPOOL) multithreaded
+ * implementations of the weight-only quantized matmuls behind
+ * quantized_decomposed::mixed_linear and quantized_decomposed::mixed_mm.
+ *
+ * Weights are dequantized one tile at a time into a small float buffer that
+ * stays in L1, with the scale folded in, and the tile is then reused for a
+ * block of input rows. A single input row (LLM decode) instead dequantizes
+ * weights straight into vector registers, since no tile would be reused.
+ * All accumulation is done in float regardless of the input and output
+ * dtypes. Work is split across threads by output columns, so every thread
+ * reads a disjoint slice of the weights.
+ *
+ * mixed_linear also takes weights pre-packed by pack_mixed_linear_weight(),
+ * which interleaves kMixedLinearPackedCols output columns so a single load
+ * yields one weight for each of them. The packed kernels dequantize those
+ * loads in registers and apply the group scales once per group.
+ */
+
+namespace torch {
+namespace executor {
+namespace native {
+namespace internal {
+
+// Output columns computed together from one dequantized weight tile.
+constexpr int64_t kMixedMatmulColTile = 8;
+// Input rows that reuse a dequantized weight tile.
+constexpr int64_t kMixedMatmulRowTile = 16;
+// Reduction-dimension block, sized so a linear weight tile is 8KiB of floats.
+constexpr int64_t kMixedMatmulKBlock = 256;
+// Output columns per tile for mixed_mm, whose weight rows are contiguous.
+constexpr int64_t kMixedMmColTile = 64;
+// Output columns interleaved in the pre-packed mixed_linear weight layout.
+constexpr int64_t kMixedLinearPackedCols = 8;
+// Input rows sharing each weight load in the pre-packed kernel. Fewer rows
+// than this (decode) run a one-row instantiation of the same kernel.
+constexpr int kMixedLinearPackedRows = 4;
+
+/// Returns the dot product of two float vectors of length `len`.
+inline float mixed_matmul_dot(const float* a, const float* b, int64_t len) {
+  using Vec = ::executorch::vec::Vectorized<float>;
+  constexpr int64_t kVecSize = Vec::size();
+  Vec acc0(0.0f);
+  Vec acc1(0.0f);
+  int64_t k = 0;
+  for (; k + 2 * kVecSize <= len; k += 2 * kVecSize) {
+    acc0 = ::executorch::vec::fmadd(Vec::loadu(a + k), Vec::loadu(b + k), acc0);
+    acc1 = ::executorch::vec::fmadd(
+        Vec::loadu(a + k + kVecSize), Vec::loadu(b + k + kVecSize), acc1);
+  }
+  for (; k + kVecSize <= len; k += kVecSize) {
+    acc0 = ::executorch::vec::fmadd(Vec::loadu(a + k), Vec::loadu(b + k), acc0);
+  }
+  float partial[kVecSize];
+  (acc0 + acc1).store(partial);
+  float sum = 0;
+  for (int64_t i = 0; i < kVecSize; ++i) {
+    sum += partial[i];
+  }
+  for (; k < len; ++k) {
+    sum += a[k] * b[k];
+  }
+  return sum;
+}
+
+/// Unpacks element `index` of a row of 4-bit weights, two per byte with the
+/// even element in the high nibble, stored with an offset of 8. This is the
+/// same packing used by quantized_decomposed::embedding_4bit.
+inline int32_t mixed_matmul_int4_value(const uint8_t* row, int64_t index) {
+  const uint8_t byte = row[index >> 1];
+  return (index & 1) ? static_cast<int32_t>(byte & 0x0F) - 8
+                     : static_cast<int32_t>(byte >> 4) - 8;
+}
+
+/// Returns the dot product of `len` floats with `len` int8 weights.
+inline float
+mixed_matmul_dot_int8(const float* x, const int8_t* w, int64_t len) {
+  using Vec = ::executorch::vec::Vectorized<float>;
+  constexpr int64_t kVecSize = Vec::size();
+  Vec acc0(0.0f);
+  Vec acc1(0.0f);
+  int64_t k = 0;
+  for (; k + 2 * kVecSize <= len; k += 2 * kVecSize) {
+    acc0 = ::executorch::vec::fmadd(
+        Vec::loadu(x + k), vec_load_int8(w + k), acc0);
+    acc1 = ::executorch::vec::fmadd(
+        Vec::loadu(x + k + kVecSize),
+        vec_load_int8(w + k + kVecSize),
+        acc1);
+  }
+  for (; k + kVecSize <= len; k += kVecSize) {
+    acc0 = ::executorch::vec::fmadd(
+        Vec::loadu(x + k), vec_load_int8(w + k), acc0);
+  }
+  float partial[kVecSize];
+  (acc0 + acc1).store(partial);
+  float sum = 0;
+  for (int64_t i = 0; i < kVecSize; ++i) {
+    sum += partial[i];
+  }
+  for (; k < len; ++k) {
+    sum += x[k] * static_cast<float>(w[k]);
+  }
+  return sum;
+}
+
+/**
+ * Returns the dot product of `len` floats with `len` 4-bit weights packed
+ * two per byte from the start of `w`. The floats are split by parity:
+ * element 2t is x_even[t] and element 2t + 1 is x_odd[t], to line up with
+ * the high and low nibbles of byte t.
+ */
+inline float mixed_matmul_dot_int4(
+    const float* x_even,
+    const float* x_odd,
+    const uint8_t* w,
+    int64_t len) {
+  using Vec = ::executorch::vec::Vectorized<float>;
+  constexpr int64_t kVecSize = Vec::size();
+  const int64_t num_bytes = len / 2;
+  Vec acc0(0.0f);
+  Vec acc1(0.0f);
+  int64_t t = 0;
+  for (; t + kVecSize <= num_bytes; t += kVecSize) {
+    Vec nibbles[2];
+    vec_load_subbyte<4>(w + t, nibbles);
+    acc0 = ::executorch::vec::fmadd(Vec::loadu(x_even + t), nibbles[0], acc0);
+    acc1 = ::executorch::vec::fmadd(Vec::loadu(x_odd + t), nibbles[1], acc1);
+  }
+  float partial[kVecSize];
+  (acc0 + acc1).store(partial);
+  float sum = 0;
+  for (int64_t i = 0; i < kVecSize; ++i) {
+    sum += partial[i];
+  }
+  for (; t < num_bytes; ++t) {
+    sum += x_even[t] * static_cast<float>((w[t] >> 4) - 8) +
+        x_odd[t] * static_cast<float>((w[t] & 0x0F) - 8);
+  }
+  if (len & 1) {
+    sum += x_even[t] * static_cast<float>((w[t] >> 4) - 8);
+  }
+  return sum;
+}
+
+/**
+ * mixed_linear() for a single input row: z[j] = sum_k(x[k] * w[j][k] *
+ * s[j][k / g]). Every weight is used once, so it is dequantized in registers
+ * and multiplied straight into the running dot product; the scale is applied
+ * to each group's partial sum.
+ */
+template <int kWeightBits, typename CTYPE_OUT, typename CTYPE, typename WTYPE>
+void mixed_linear_gemv(
+    CTYPE_OUT* z,
+    const CTYPE* x,
+    const WTYPE* w,
+    const CTYPE* s,
+    int64_t n,
+    int64_t p,
+    int64_t g) {
+  const int64_t n_over_g = (n + g - 1) / g;
+  const int64_t w_row_bytes = kWeightBits == 8 ? n : (n + 1) / 2;
+  const int64_t num_col_tiles =
+      (p + kMixedMatmulColTile - 1) / kMixedMatmulColTile;
+
+  auto compute_col_tiles = [&](int64_t begin, int64_t end) {
+    float x_buf[kMixedMatmulKBlock];
+    float acc[kMixedMatmulColTile];
+
+    for (int64_t tile = begin; tile < end; ++tile) {
+      const int64_t j0 = tile * kMixedMatmulColTile;
+      const int64_t nj = std::min(kMixedMatmulColTile, p - j0);
+      std::fill(acc, acc + nj, 0.0f);
+
+      for (int64_t k0 = 0; k0 < n;) {
+        const int64_t k1 =
+            std::min({k0 + kMixedMatmulKBlock, (k0 / g + 1) * g, n});
+        const int64_t len = k1 - k0;
+        // int4 blocks only start mid-byte when g is odd; those take a
+        // scalar path.
+        const bool int4_unaligned = kWeightBits == 4 && (k0 & 1);
+
+        const float* x_block = x_buf;
+        const float* x_odd = x_buf + kMixedMatmulKBlock / 2;
+        if (kWeightBits == 4 && !int4_unaligned) {
+          for (int64_t k = 0; k < len; ++k) {
+            x_buf[(k & 1) * (kMixedMatmulKBlock / 2) + k / 2] =
+                static_cast<float>(x[k0 + k]);
+          }
+        } else if (std::is_same<CTYPE, float>::value) {
+          x_block = reinterpret_cast<const float*>(x) + k0;
+        } else {
+          for (int64_t k = 0; k < len; ++k) {
+            x_buf[k] = static_cast<float>(x[k0 + k]);
+          }
+        }
+
+        for (int64_t jj = 0; jj < nj; ++jj) {
+          const int64_t j = j0 + jj;
+          const uint8_t* row =
+              reinterpret_cast<const uint8_t*>(w) + j * w_row_bytes;
+          float dot = 0;
+          if (kWeightBits == 8) {
+            dot = mixed_matmul_dot_int8(
+                x_block, reinterpret_cast<const int8_t*>(row) + k0, len);
+          } else if (!int4_unaligned) {
+            dot = mixed_matmul_dot_int4(x_block, x_odd, row + k0 / 2, len);
+          } else {
+            for (int64_t k = 0; k < len; ++k) {
+              dot += x_block[k] *
+                  static_cast<float>(mixed_matmul_int4_value(row, k0 + k));
+            }
+          }
+          acc[jj] += dot * static_cast<float>(s[j * n_over_g + k0 / g]);
+        }
+        k0 = k1;
+      }
+
+      for (int64_t jj = 0; jj < nj; ++jj) {
+        z[j0 + jj] = static_cast<CTYPE_OUT>(acc[jj]);
+      }
+    }
+  };
+  utils::parallel_for(0, num_col_tiles, 1, compute_col_tiles);
+}
+
+/**
+ * z[i][j] = sum_k(x[i][k] * w[j][k] * s[j][k / g])
+ *
+ * x: m * n, w: p * n (int8, or int4 packed as p * n/2 bytes), s: p * ceil(n/g),
+ * z: m * p.
+ *
+ * @tparam kWeightBits Either 8 (`w` is int8_t) or 4 (`w` is packed uint8_t).
+ */
+template <int kWeightBits, typename CTYPE_OUT, typename CTYPE, typename WTYPE>
+void mixed_linear(
+    CTYPE_OUT* z,
+    const CTYPE* x,
+    const WTYPE* w,
+    const CTYPE* s,
+    int64_t m,
+    int64_t n,
+    int64_t p,
+    int64_t g) {
+  static_assert(kWeightBits == 8 || kWeightBits == 4, "unsupported bit width");
+  if (m == 1) {
+    mixed_linear_gemv<kWeightBits>(z, x, w, s, n, p, g);
+    return;
+  }
+  const int64_t n_over_g = (n + g - 1) / g;
+  const int64_t w_row_bytes = kWeightBits == 8 ? n : (n + 1) / 2;
+  const int64_t num_col_tiles =
+      (p + kMixedMatmulColTile - 1) / kMixedMatmulColTile;
+
+  auto compute_col_tiles = [&](int64_t begin, int64_t end) {
+    float w_buf[kMixedMatmulColTile * kMixedMatmulKBlock];
+    float x_buf[kMixedMatmulKBlock];
+    float acc[kMixedMatmulRowTile * kMixedMatmulColTile];
+
+    for (int64_t tile = begin; tile < end; ++tile) {
+      const int64_t j0 = tile * kMixedMatmulColTile;
+      const int64_t nj = std::min(kMixedMatmulColTile, p - j0);
+      for (int64_t i0 = 0; i0 < m; i0 += kMixedMatmulRowTile) {
+        const int64_t ni = std::min(kMixedMatmulRowTile, m - i0);
+        std::fill(acc, acc + ni * kMixedMatmulColTile, 0.0f);
+
+        for (int64_t k0 = 0; k0 < n;) {
+          // Blocks never straddle a quantization group, so a single scale
+          // applies to each weight row in the block.
+          const int64_t k1 =
+              std::min({k0 + kMixedMatmulKBlock, (k0 / g + 1) * g, n});
+          const int64_t len = k1 - k0;
+
+          for (int64_t jj = 0; jj < nj; ++jj) {
+            const int64_t j = j0 + jj;
+            const float scale = static_cast<float>(s[j * n_over_g + k0 / g]);
+            float* dst = w_buf + jj * kMixedMatmulKBlock;
+            if (kWeightBits == 8) {
+              const int8_t* src =
+                  reinterpret_cast<const int8_t*>(w) + j * w_row_bytes + k0;
+              for (int64_t k = 0; k < len; ++k) {
+                dst[k] = static_cast<float>(src[k]) * scale;
+              }
+            } else {
+              const uint8_t* row =
+                  reinterpret_cast<const uint8_t*>(w) + j * w_row_bytes;
+              int64_t k = 0;
+              if (k0 & 1) {
+                dst[k++] =
+                    static_cast<float>(mixed_matmul_int4_value(row, k0)) *
+                    scale;
+              }
+              // Unpack whole bytes at a time.
+              const uint8_t* bytes = row + ((k0 + k) >> 1);
+              for (; k + 1 < len; k += 2, ++bytes) {
+                dst[k] = static_cast<float>((*bytes >> 4) - 8) * scale;
+                dst[k + 1] = static_cast<float>((*bytes & 0x0F) - 8) * scale;
+              }
+              if (k < len) {
+                dst[k] =
+                    static_cast<float>(mixed_matmul_int4_value(row, k0 + k)) *
+                    scale;
+              }
+            }
+          }
+
+          for (int64_t ii = 0; ii < ni; ++ii) {
+            const CTYPE* x_row = x + (i0 + ii) * n + k0;
+            const float* x_block;
+            if (std::is_same<CTYPE, float>::value) {
+              x_block = reinterpret_cast<const float*>(x_row);
+            } else {
+              for (int64_t k = 0; k < len; ++k) {
+                x_buf[k] = static_cast<float>(x_row[k]);
+              }
+              x_block = x_buf;
+            }
+            float* acc_row = acc + ii * kMixedMatmulColTile;
+            for (int64_t jj = 0; jj < nj; ++jj) {
+              acc_row[jj] += mixed_matmul_dot(
+                  x_block, w_buf + jj * kMixedMatmulKBlock, len);
+            }
+          }
+          k0 = k1;
+        }
+
+        for (int64_t ii = 0; ii < ni; ++ii) {
+          for (int64_t jj = 0; jj < nj; ++jj) {
+            z[(i0 + ii) * p + j0 + jj] =
+                static_cast<CTYPE_OUT>(acc[ii * kMixedMatmulColTile + jj]);
+          }
+        }
+      }
+    }
+  };
+  utils::parallel_for(0, num_col_tiles, 1, compute_col_tiles);
+}
+
+/**
+ * Returns the number of bytes in each of the ceil(p / kMixedLinearPackedCols)
+ * blocks of a pre-packed mixed_linear weight with `row_bytes` bytes per
+ * output column (n for int8, ceil(n / 2) for int4).
+ */
+inline int64_t mixed_linear_packed_block_bytes(int64_t row_bytes) {
+  return row_bytes * kMixedLinearPackedCols;
+}
+
+/**
+ * Packs a plain p x row_bytes mixed_linear weight (int8, or int4 packed two
+ * per byte) into the interleaved layout taken by mixed_linear_packed():
+ *
+ *   packed[j / C][b][j % C] = w[j][b], C = kMixedLinearPackedCols
+ *
+ * so byte `b` of C consecutive output columns is contiguous. Columns past
+ * `p` in the last block are zero-filled. `packed` must hold
+ * ceil(p / C) * mixed_linear_packed_block_bytes(row_bytes) bytes. Weights
+ * are constant, so this is meant to run once, ahead of inference.
+ */
+inline void pack_mixed_linear_weight(
+    const uint8_t* w,
+    uint8_t* packed,
+    int64_t p,
+    int64_t row_bytes) {
+  constexpr int64_t C = kMixedLinearPackedCols;
+  const int64_t num_blocks = (p + C - 1) / C;
+  for (int64_t jb = 0; jb < num_blocks; ++jb) {
+    uint8_t* dst = packed + jb * mixed_linear_packed_block_bytes(row_bytes);
+    for (int64_t b = 0; b < row_bytes; ++b) {
+      for (int64_t c = 0; c < C; ++c) {
+        const int64_t j = jb * C + c;
+        dst[b * C + c] = j < p ? w[j * row_bytes + b] : 0;
+      }
+    }
+  }
+}
+
+/**
+ * Computes kRows input rows starting at `i0` against Vec::size() pre-packed
+ * output columns starting at `j0`, of which the first `nj` are real. When
+ * vectors are wider than kMixedLinearPackedCols, the columns span several
+ * consecutive blocks, `block_stride` bytes apart.
+ *
+ * Each step along k loads one weight per column, dequantizes it in
+ * registers and multiplies it with every row. The partial sums of a
+ * quantization group are scaled once when the group ends.
+ */
+template <int kWeightBits, int kRows, typename CTYPE_OUT, typename CTYPE>
+void mixed_linear_packed_block(
+    CTYPE_OUT* z,
+    const CTYPE* x,
+    const uint8_t* w_block,
+    int64_t block_stride,
+    const CTYPE* s,
+    int64_t n,
+    int64_t p,
+    int64_t g,
+    int64_t i0,
+    int64_t j0,
+    int64_t nj) {
+  using Vec = ::executorch::vec::Vectorized<float>;
+  constexpr int64_t C = kMixedLinearPackedCols;
+  static_assert(
+      C == kVecLoadRunBytes, "a packed weight load must be a run of bytes");
+  const int64_t n_over_g = (n + g - 1) / g;
+
+  using ::executorch::utils::ForcedUnroll;
+
+  // Multiplies every row by the weights of column `k`.
+  const auto fma_rows =
+      [&](Vec* part, const Vec& wv, int64_t k) ET_INLINE_ATTRIBUTE {
+        ForcedUnroll<kRows>{}([&](int r) ET_INLINE_ATTRIBUTE {
+          const Vec xv(static_cast<float>(x[(i0 + r) * n + k]));
+          part[r] = ::executorch::vec::fmadd(xv, wv, part[r]);
+        });
+      };
+
+  Vec total[kRows];
+  ForcedUnroll<kRows>{}(
+      [&](int r) ET_INLINE_ATTRIBUTE { total[r] = Vec(0.0f); });
+  float scales[Vec::size()];
+  for (int64_t k0 = 0; k0 < n; k0 += g) {
+    const int64_t k1 = std::min(k0 + g, n);
+    // Even and odd k accumulate separately to halve the FMA dependency
+    // chains, which matters when there is a single row.
+    Vec even[kRows];
+    Vec odd[kRows];
+    ForcedUnroll<kRows>{}([&](int r) ET_INLINE_ATTRIBUTE {
+      even[r] = Vec(0.0f);
+      odd[r] = Vec(0.0f);
+    });
+    if (kWeightBits == 8) {
+      const int8_t* src = reinterpret_cast<const int8_t*>(w_block);
+      int64_t k = k0;
+      for (; k + 1 < k1; k += 2) {
+        fma_rows(even, vec_load_int8_runs(src + k * C, block_stride), k);
+        fma_rows(
+            odd, vec_load_int8_runs(src + (k + 1) * C, block_stride), k + 1);
+      }
+      if (k < k1) {
+        fma_rows(even, vec_load_int8_runs(src + k * C, block_stride), k);
+      }
+    } else {
+      // Byte k / 2 holds column k in its high nibble when k is even. Odd
+      // group sizes can start or end a group mid-byte.
+      for (int64_t k = k0; k < k1;) {
+        Vec nibbles[2];
+        vec_load_subbyte_runs<4>(
+            w_block + (k >> 1) * C, block_stride, nibbles);
+        if (k & 1) {
+          fma_rows(odd, nibbles[1], k);
+          k += 1;
+        } else if (k + 1 < k1) {
+          fma_rows(even, nibbles[0], k);
+          fma_rows(odd, nibbles[1], k + 1);
+          k += 2;
+        } else {
+          fma_rows(even, nibbles[0], k);
+          k += 1;
+        }
+      }
+    }
+
+    for (int64_t c = 0; c < Vec::size(); ++c) {
+      scales[c] =
+          c < nj ? static_cast<float>(s[(j0 + c) * n_over_g + k0 / g]) : 0.0f;
+    }
+    const Vec sv = Vec::loadu(scales);
+    ForcedUnroll<kRows>{}([&](int r) ET_INLINE_ATTRIBUTE {
+      total[r] = ::executorch::vec::fmadd(even[r] + odd[r], sv, total[r]);
+    });
+  }
+
+  float out[Vec::size()];
+  for (int64_t r = 0; r < kRows; ++r) {
+    total[r].store(out);
+    CTYPE_OUT* z_row = z + (i0 + r) * p + j0;
+    for (int64_t c = 0; c < nj; ++c) {
+      z_row[c] = static_cast<CTYPE_OUT>(out[c]);
+    }
+  }
+}
+
+/**
+ * mixed_linear() with a weight laid out by pack_mixed_linear_weight().
+ *
+ * Tiles of Vec::size() output columns, i.e. one or more packed blocks, are
+ * split across threads. Within a tile, input rows are processed kMixedLinearPackedRows at a time
+ * (prefill) with the remainder, including the single row of decode, one at
+ * a time.
+ *
+ * @tparam kWeightBits Either 8 or 4, as for mixed_linear().
+ */
+template <int kWeightBits, typename CTYPE_OUT, typename CTYPE>
+void mixed_linear_packed(
+    CTYPE_OUT* z,
+    const CTYPE* x,
+    const uint8_t* w,
+    const CTYPE* s,
+    int64_t m,
+    int64_t n,
+    int64_t p,
+    int64_t g) {
+  static_assert(kWeightBits == 8 || kWeightBits == 4, "unsupported bit width");
+  using Vec = ::executorch::vec::Vectorized<float>;
+  constexpr int64_t C = kMixedLinearPackedCols;
+  constexpr int64_t kTileCols = Vec::size();
+  static_assert(
+      kTileCols == C || kTileCols == 2 * C,
+      "a tile must be one or two packed blocks");
+  const int64_t row_bytes = kWeightBits == 8 ? n : (n + 1) / 2;
+  const int64_t block_bytes = mixed_linear_packed_block_bytes(row_bytes);
+  const int64_t num_tiles = (p + kTileCols - 1) / kTileCols;
+
+  utils::parallel_for(0, num_tiles, 1, [&](int64_t begin, int64_t end) {
+    for (int64_t tile = begin; tile < end; ++tile) {
+      const int64_t j0 = tile * kTileCols;
+      const int64_t nj = std::min(kTileCols, p - j0);
+      const uint8_t* w_block = w + (j0 / C) * block_bytes;
+      // A last tile with a single block rereads it rather than reading past
+      // the end of the weight; the extra columns are dropped.
+      const int64_t block_stride = nj > C ? block_bytes : 0;
+      int64_t i = 0;
+      for (; i + kMixedLinearPackedRows <= m; i += kMixedLinearPackedRows) {
+        mixed_linear_packed_block<kWeightBits, kMixedLinearPackedRows>(
+            z, x, w_block, block_stride, s, n, p, g, i, j0, nj);
+      }
+      for (; i < m; ++i) {
+        mixed_linear_packed_block<kWeightBits, 1>(
+            z, x, w_block, block_stride, s, n, p, g, i, j0, nj);
+      }
+    }
+  });
+}
+
+/**
+ * z[i][j] = sum_k(x[i][k] * w[k][j] * s[k])
+ *
+ * x: m * n, w: n * p (int8), s: n, z: m * p.
+ */
+template <typename CTYPE>
+void mixed_mm(
+    CTYPE* z,
+    const CTYPE* x,
+    const int8_t* w,
+    const CTYPE* s,
+    int64_t m,
+    int64_t n,
+    int64_t p) {
+  using Vec = ::executorch::vec::Vectorized<float>;
+  constexpr int64_t kVecSize = Vec::size();
+  const int64_t num_col_tiles = (p + kMixedMmColTile - 1) / kMixedMmColTile;
+
+  auto compute_col_tiles = [&](int64_t begin, int64_t end) {
+    float w_buf[kMixedMmColTile];
+    float acc[kMixedMatmulRowTile * kMixedMmColTile];
+
+    for (int64_t tile = begin; tile < end; ++tile) {
+      const int64_t j0 = tile * kMixedMmColTile;
+      const int64_t nj = std::min(kMixedMmColTile, p - j0);
+      for (int64_t i0 = 0; i0 < m; i0 += kMixedMatmulRowTile) {
+        const int64_t ni = std::min(kMixedMatmulRowTile, m - i0);
+        std::fill(acc, acc + ni * kMixedMmColTile, 0.0f);
+
+        for (int64_t k = 0; k < n; ++k) {
+          const float scale = static_cast<float>(s[k]);
+          const int8_t* w_row = w + k * p + j0;
+          for (int64_t jj = 0; jj < nj; ++jj) {
+            w_buf[jj] = static_cast<float>(w_row[jj]) * scale;
+          }
+          for (int64_t ii = 0; ii < ni; ++ii) {
+            const float xv = static_cast<float>(x[(i0 + ii) * n + k]);
+            const Vec xv_vec(xv);
+            float* acc_row = acc + ii * kMixedMmColTile;
+            int64_t jj = 0;
+            for (; jj + kVecSize <= nj; jj += kVecSize) {
+              ::executorch::vec::fmadd(
+                  xv_vec, Vec::loadu(w_buf + jj), Vec::loadu(acc_row + jj))
+                  .store(acc_row + jj);
+            }
+            for (; jj < nj; ++jj) {
+              acc_row[jj] += xv * w_buf[jj];
+            }
+          }
+        }
+
+        for (int64_t ii = 0; ii < ni; ++ii) {
+          for (int64_t jj = 0; jj < nj; ++jj) {
+            z[(i0 + ii) * p + j0 + jj] =
+                static_cast<CTYPE>(acc[ii * kMixedMmColTile + jj]);
+          }
+        }
+      }
+    }
+  };
+  utils::parallel_for(0, num_col_tiles, 1, compute_col_tiles);
+}
+
+} // namespace internal
+} // namespace native
+} // namespace executor
+} // namespace torch
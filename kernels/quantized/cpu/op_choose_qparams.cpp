@@ -6,7 +6,8 @@
  * LICENSE file in the root directory of this source tree.
  */
 
-#include <executorch/kernels/portable/cpu/vec_ops.h>
+#include <executorch/kernels/portable/cpu/util/parallel_util.h>
+#include <executorch/kernels/quantized/cpu/vec_quantize.h>
 #include <executorch/runtime/kernel/kernel_includes.h>
 #include <algorithm>
 #include <cinttypes>
@@ -178,8 +179,9 @@ void choose_qparams(
     Tensor& zero_point_out) {
   const float* x_fp32 = input.const_data_ptr<float>();
   // Compute x_min, x_max and q_params (scale, zero_point)
-  float min = torch::executor::vec_minf(x_fp32, input.numel());
-  float max = torch::executor::vec_maxf(x_fp32, input.numel());
+  float min;
+  float max;
+  internal::vec_min_max(x_fp32, input.numel(), &min, &max);
 
   double scale;
   int32_t zero_point;
@@ -197,23 +199,33 @@ void choose_qparams_per_token(
     Tensor& zero_point_out) {
   const float* x_fp32 = input.const_data_ptr<float>();
   // Compute x_min, x_max and q_params (scale, zero_point)
-  auto num_tokens = 1;
+  int64_t num_tokens = 1;
   for (auto i = 0; i < input.dim() - 1; i++) {
     num_tokens *= input.size(i);
   }
-  auto token_dim_size = input.size(input.dim() - 1);
-  for (auto i = 0; i < num_tokens; i++) {
-    // vec_minf uses std::min_element. Check if it actually
-    // gets vectorized.
-    float min = torch::executor::vec_minf(x_fp32, token_dim_size);
-    float max = torch::executor::vec_maxf(x_fp32, token_dim_size);
-    double scale;
-    int32_t zero_point;
-    calculate_scale_and_zero_point(min, max, qmin, qmax, scale, zero_point);
-    scale_out.mutable_data_ptr<double>()[i] = scale;
-    zero_point_out.mutable_data_ptr<int64_t>()[i] = zero_point;
-    x_fp32 += token_dim_size;
-  }
+  const int64_t token_dim_size = input.size(input.dim() - 1);
+  double* scale_data = scale_out.mutable_data_ptr<double>();
+  int64_t* zero_point_data = zero_point_out.mutable_data_ptr<int64_t>();
+  // Tokens are independent, so split them across threads; each token's
+  // min/max is a single vectorized pass over its row.
+  auto choose_token_qparams = [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; i++) {
+      float min;
+      float max;
+      internal::vec_min_max(
+          x_fp32 + i * token_dim_size, token_dim_size, &min, &max);
+      double scale;
+      int32_t zero_point;
+      calculate_scale_and_zero_point(min, max, qmin, qmax, scale, zero_point);
+      scale_data[i] = scale;
+      zero_point_data[i] = zero_point;
+    }
+  };
+  utils::parallel_for(
+      0,
+      num_tokens,
+      utils::parallel_grain_size(token_dim_size),
+      choose_token_qparams);
 }
 } // namespace
 
@@ -6,11 +6,14 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <executorch/kernels/portable/cpu/util/parallel_util.h>
 #include <executorch/kernels/portable/cpu/util/reduce_util.h>
+#include <executorch/kernels/quantized/cpu/vec_quantize.h>
 #include <executorch/runtime/kernel/kernel_includes.h>
 #include <algorithm>
 #include <cinttypes>
 #include <cmath>
+#include <type_traits>
 
 /**
  * For an input tensor, use the scale and zero_point arguments to quantize it.
@@ -63,6 +66,26 @@ void check_dequantize_per_tensor_args(
       quant_max);
 }
 
+/**
+ * Dequantizes `size` contiguous elements that share one scale and zero point:
+ * out[i] = (in[i] - zero_point) * scale, computed in float.
+ */
+template <typename IN_CTYPE, typename OUT_CTYPE>
+void dequantize_span(
+    const IN_CTYPE* in,
+    OUT_CTYPE* out,
+    int64_t size,
+    float scale,
+    int32_t zero_point) {
+  if constexpr (std::is_same<OUT_CTYPE, float>::value) {
+    internal::vec_dequantize(in, out, size, scale, zero_point);
+  } else {
+    for (int64_t i = 0; i < size; ++i) {
+      out[i] = static_cast<OUT_CTYPE>((in[i] - zero_point) * scale);
+    }
+  }
+}
+
 } // namespace
 
 /**
@@ -99,12 +122,16 @@ Tensor& dequantize_per_tensor_out(
      * get inlined without LTO, particularly in ATen mode. */                  \
     auto* out_data_ptr = out.mutable_data_ptr<OUT_CTYPE>();                    \
     const auto* input_data_ptr = input.const_data_ptr<IN_CTYPE>();             \
-    const auto input_numel = input.numel();                                    \
-    for (size_t i = 0; i < input_numel; i++) {                                 \
-      out_data_ptr[i] = static_cast<OUT_CTYPE>(                                \
-          (input_data_ptr[i] - static_cast<int32_t>(zero_point)) *             \
-          static_cast<float>(scale));                                          \
-    }                                                                          \
+    auto dequantize_chunk = [&](int64_t begin, int64_t end) {                  \
+      dequantize_span(                                                         \
+          input_data_ptr + begin,                                              \
+          out_data_ptr + begin,                                                \
+          end - begin,                                                         \
+          static_cast<float>(scale),                                           \
+          static_cast<int32_t>(zero_point));                                   \
+    };                                                                         \
+    utils::parallel_for(                                                       \
+        0, input.numel(), internal::kQuantizeGrainSize, dequantize_chunk);     \
   } break;
 #define CALCULATE_INT_TYPE(IN_CTYPE, in_dtype)               \
   case ScalarType::in_dtype:                                 \
@@ -185,6 +212,55 @@ float get_scale(const Tensor& scale, size_t channel_ix) {
   }
 }
 
+namespace {
+
+/**
+ * Dequantizes a tensor whose input and output both have contiguous spans (see
+ * internal::has_contiguous_spans()). Each row of the elements that follow
+ * `axis` shares one channel's scale and zero point, so rows are dequantized
+ * independently and in parallel.
+ */
+template <typename IN_CTYPE, typename OUT_CTYPE>
+void dequantize_per_channel_contiguous(
+    const Tensor& input,
+    const Tensor& scale,
+    const int64_t* zero_point_data,
+    int64_t axis,
+    Tensor& out) {
+  if (input.numel() == 0) {
+    return;
+  }
+  const int64_t num_channels = input.size(axis);
+  int64_t row_size = 1;
+  for (int64_t d = axis + 1; d < input.dim(); ++d) {
+    row_size *= input.size(d);
+  }
+  const int64_t num_rows = input.numel() / row_size;
+  const auto* in_data = input.const_data_ptr<IN_CTYPE>();
+  auto* out_data = out.mutable_data_ptr<OUT_CTYPE>();
+
+  auto dequantize_rows = [&](int64_t begin, int64_t end) {
+    for (int64_t row = begin; row < end; ++row) {
+      const int64_t channel = row % num_channels;
+      const int64_t zero_point =
+          zero_point_data != nullptr ? zero_point_data[channel] : 0;
+      dequantize_span(
+          in_data + row * row_size,
+          out_data + row * row_size,
+          row_size,
+          get_scale(scale, channel),
+          static_cast<int32_t>(zero_point));
+    }
+  };
+  utils::parallel_for(
+      0,
+      num_rows,
+      std::max<int64_t>(1, internal::kQuantizeGrainSize / row_size),
+      dequantize_rows);
+}
+
+} // namespace
+
 Tensor& dequantize_per_channel_out(
     const Tensor& input,
     const Tensor& scale,
@@ -247,6 +323,8 @@ Tensor& dequantize_per_channel_out(
 
   exec_aten::optional<exec_aten::ArrayRef<int64_t>> optional_dim_list{
       exec_aten::ArrayRef<int64_t>{dims, size_t(input.dim() - 1)}};
+  const bool contiguous = internal::has_contiguous_spans(input) &&
+      internal::has_contiguous_spans(out);
 
   // Actual dequantization logic
   // input, out are the input and output tensors
@@ -258,6 +336,11 @@ Tensor& dequantize_per_channel_out(
   //   in other words you are dequantizing in_data[in_ix]
 #define DEQUANTIZE_IMPL(CTYPE_IN, CTYPE_OUT, out_dtype)                        \
   case ScalarType::out_dtype:                                                  \
+    if (contiguous) {                                                          \
+      dequantize_per_channel_contiguous<CTYPE_IN, CTYPE_OUT>(                  \
+          input, scale, zero_point_data, axis, out);                           \
+      break;                                                                   \
+    }                                                                          \
     if (input.dim() == 1) {                                                    \
       auto* out_data_ptr = out.mutable_data_ptr<CTYPE_OUT>();                  \
       const auto* input_data_ptr = input.const_data_ptr<CTYPE_IN>();           \
@@ -6,6 +6,7 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <executorch/kernels/quantized/cpu/embedding_util.h>
 #include <executorch/runtime/kernel/kernel_includes.h>
 #include <algorithm>
 #include <cinttypes>
@@ -136,47 +137,26 @@ void embedding_byte_per_channel(
   // weight of shape (num_embeddings, embedding_dim).
   auto embedding_dim = weight.size(1);
 
-  int32_t num_groups_per_channel = 1;
+  int64_t num_groups_per_channel = 1;
   if (weight_scales.dim() == 2) {
     num_groups_per_channel = weight_scales.size(1);
   }
-  int32_t group_size = weight.size(1) / num_groups_per_channel;
 
-  CTYPE_OUT* out_data = out.mutable_data_ptr<CTYPE_OUT>();
-  const int64_t* indices_ptr = indices.const_data_ptr<int64_t>();
-
-  const CTYPE_PARAMS* scales = weight_scales.const_data_ptr<CTYPE_PARAMS>();
   const CTYPE_PARAMS* zero_points = nullptr;
   if (opt_weight_zero_points.has_value()) {
     zero_points = opt_weight_zero_points.value().const_data_ptr<CTYPE_PARAMS>();
   }
 
-  for (int i = 0; i < indices.numel(); i++) {
-    int64_t index = indices_ptr[i];
-    // If using groupwise embedding
-    int32_t qparams_index = index * num_groups_per_channel;
-    CTYPE_PARAMS zp = 0.0;
-    const CTYPE_PARAMS* scale_ptr = scales + qparams_index;
-    const CTYPE_PARAMS* zero_points_ptr = nullptr;
-    if (opt_weight_zero_points.has_value()) {
-      zero_points_ptr = zero_points + qparams_index;
-    }
-
-    const CTYPE_WEIGHT* w_data =
-        weight.const_data_ptr<CTYPE_WEIGHT>() + embedding_dim * index;
-
-    for (int j = 0; j < embedding_dim; ++j) {
-      int32_t group_id = j / group_size;
-      const CTYPE_PARAMS scale = scale_ptr[group_id];
-      if (opt_weight_zero_points.has_value()) {
-        zp = zero_points_ptr[group_id];
-      }
-      out_data[j] = static_cast<CTYPE_OUT>(
-          (static_cast<float>(w_data[j]) - static_cast<float>(zp)) *
-          static_cast<float>(scale));
-    }
-    out_data += embedding_dim;
-  }
+  internal::embedding_lookup<8>(
+      weight.const_data_ptr<CTYPE_WEIGHT>(),
+      embedding_dim,
+      weight_scales.const_data_ptr<CTYPE_PARAMS>(),
+      zero_points,
+      num_groups_per_channel,
+      embedding_dim,
+      indices.const_data_ptr<int64_t>(),
+      indices.numel(),
+      out.mutable_data_ptr<CTYPE_OUT>());
 }
 
 void resize_out_tensor(
@@ -6,7 +6,7 @@
  * LICENSE file in the root directory of this source tree.
  */
 
-#include <executorch/kernels/portable/cpu/vec_ops.h>
+#include <executorch/kernels/quantized/cpu/mixed_matmul.h>
 #include <executorch/runtime/kernel/kernel_includes.h>
 
 namespace torch {
@@ -23,29 +23,52 @@ bool check_quantized_mixed_linear_args(
     const exec_aten::optional<ScalarType> dtype,
     Tensor& out) {
   ET_LOG_AND_RETURN_IF_FALSE(tensor_is_rank(in, 2));
-  ET_LOG_AND_RETURN_IF_FALSE(tensor_is_rank(weight, 2));
+  ET_LOG_AND_RETURN_IF_FALSE(
+      tensor_is_rank(weight, 2) || tensor_is_rank(weight, 3));
   ET_LOG_AND_RETURN_IF_FALSE(
       tensor_is_rank(weight_scales, 1) || tensor_is_rank(weight_scales, 2));
   ET_LOG_AND_RETURN_IF_FALSE(tensor_is_rank(out, 2));
 
-  ET_LOG_AND_RETURN_IF_FALSE(tensors_have_same_size_at_dims(in, 1, weight, 1));
-  ET_LOG_AND_RETURN_IF_FALSE(
-      tensors_have_same_size_at_dims(weight_scales, 0, weight, 0));
-  ET_LOG_AND_RETURN_IF_FALSE(tensors_have_same_size_at_dims(in, 1, weight, 1));
+  // 4-bit weights are packed two per byte along the input dimension.
+  const int64_t row_bytes =
+      weight.scalar_type() == ScalarType::Byte ? (in.size(1) + 1) / 2
+                                               : in.size(1);
+  if (weight.dim() == 3) {
+    // Pre-packed by internal::pack_mixed_linear_weight(), with the output
+    // features given by the scales.
+    constexpr int64_t kCols = internal::kMixedLinearPackedCols;
+    ET_LOG_MSG_AND_RETURN_IF_FALSE(
+        weight.size(0) == (weight_scales.size(0) + kCols - 1) / kCols &&
+            weight.size(1) == row_bytes && weight.size(2) == kCols,
+        "packed weight must be [ceil(out_features / 8), row_bytes, 8], where "
+        "row_bytes is in.size(1) for int8 and ceil(in.size(1) / 2) for int4");
+  } else {
+    ET_LOG_AND_RETURN_IF_FALSE(
+        tensors_have_same_size_at_dims(weight_scales, 0, weight, 0));
+    ET_LOG_MSG_AND_RETURN_IF_FALSE(
+        weight.size(1) == row_bytes,
+        "weight must have in.size(1) columns, or ceil(in.size(1) / 2) for "
+        "packed int4");
+  }
 
   ET_LOG_AND_RETURN_IF_FALSE(tensors_have_same_dtype(in, weight_scales));
   if (dtype.has_value()) {
     ET_LOG_AND_RETURN_IF_FALSE(out.scalar_type() == dtype.value());
     ET_LOG_MSG_AND_RETURN_IF_FALSE(
-        dtype.value() == ScalarType::Float || dtype.value() == ScalarType::Half,
-        "dtype must be Float or Half");
+        dtype.value() == ScalarType::Float ||
+            dtype.value() == ScalarType::Half ||
+            dtype.value() == ScalarType::BFloat16,
+        "dtype must be Float, Half or BFloat16");
   }
   ET_LOG_MSG_AND_RETURN_IF_FALSE(
-      weight.scalar_type() == ScalarType::Char, "weight dtype must be int8");
+      weight.scalar_type() == ScalarType::Char ||
+          weight.scalar_type() == ScalarType::Byte,
+      "weight dtype must be int8, or uint8 holding packed int4 values");
   ET_LOG_MSG_AND_RETURN_IF_FALSE(
       in.scalar_type() == ScalarType::Float ||
-          in.scalar_type() == ScalarType::Half,
-      "input dtype must be Float or Half");
+          in.scalar_type() == ScalarType::Half ||
+          in.scalar_type() == ScalarType::BFloat16,
+      "input dtype must be Float, Half or BFloat16");
 
   if (opt_weight_zero_points.has_value()) {
     ET_LOG_AND_RETURN_IF_FALSE(
@@ -76,38 +99,63 @@ Tensor& quantized_mixed_linear_out(
   size_t output_ndim = 2;
   exec_aten::SizesType output_sizes[kTensorDimensionLimit];
   output_sizes[0] = in.size(0);
-  output_sizes[1] = weight.size(0);
+  output_sizes[1] = weight_scales.size(0);
 
   // TODO (gjcomer) Replace with ET_KERNEL_CHECK when context is available.
   ET_CHECK(resize_tensor(out, {output_sizes, output_ndim}) == Error::Ok);
 
   constexpr auto name = "quantized_decomposed::mixed_linear.out";
 
-  ET_SWITCH_TWO_TYPES(Float, Half, in.scalar_type(), ctx, name, CTYPE, [&]() {
-    ET_SWITCH_FLOAT_TYPES_AND(Half, out_dtype, ctx, name, CTYPE_OUT, [&]() {
-      size_t m = in.size(0);
-      size_t n = in.size(1);
-      size_t p = weight.size(0);
-      size_t g = n;
-
-      if (weight_scales.dim() == 2) {
-        g = (n + weight_scales.size(1) - 1) / weight_scales.size(1);
-      };
-
-      // FIXME: this currently ignores dtype
-      vec_quantized_matmul_transb_int8<
-          CTYPE_OUT, // T *z
-          CTYPE>( // U *x, U *s
-          out.mutable_data_ptr<CTYPE_OUT>(),
-          in.const_data_ptr<CTYPE>(),
-          weight.const_data_ptr<int8_t>(),
-          weight_scales.const_data_ptr<CTYPE>(),
-          m,
-          n,
-          p,
-          g);
-    });
-  });
+  ET_SWITCH_THREE_TYPES(
+      Float, Half, BFloat16, in.scalar_type(), ctx, name, CTYPE, [&]() {
+        ET_SWITCH_FLOATHBF16_TYPES(out_dtype, ctx, name, CTYPE_OUT, [&]() {
+          size_t m = in.size(0);
+          size_t n = in.size(1);
+          size_t p = weight_scales.size(0);
+          size_t g = n;
+
+          if (weight_scales.dim() == 2) {
+            g = (n + weight_scales.size(1) - 1) / weight_scales.size(1);
+          };
+
+          CTYPE_OUT* out_data = out.mutable_data_ptr<CTYPE_OUT>();
+          const CTYPE* in_data = in.const_data_ptr<CTYPE>();
+          const CTYPE* scales_data = weight_scales.const_data_ptr<CTYPE>();
+          const uint8_t* weight_bytes =
+              static_cast<const uint8_t*>(weight.const_data_ptr());
+          const bool is_int8 = weight.scalar_type() == ScalarType::Char;
+
+          if (weight.dim() == 3) {
+            if (is_int8) {
+              internal::mixed_linear_packed<8>(
+                  out_data, in_data, weight_bytes, scales_data, m, n, p, g);
+            } else {
+              internal::mixed_linear_packed<4>(
+                  out_data, in_data, weight_bytes, scales_data, m, n, p, g);
+            }
+          } else if (is_int8) {
+            internal::mixed_linear<8>(
+                out_data,
+                in_data,
+                weight.const_data_ptr<int8_t>(),
+                scales_data,
+                m,
+                n,
+                p,
+                g);
+          } else {
+            internal::mixed_linear<4>(
+                out_data,
+                in_data,
+                weight.const_data_ptr<uint8_t>(),
+                scales_data,
+                m,
+                n,
+                p,
+                g);
+          }
+        });
+      });
 
   return out;
 }
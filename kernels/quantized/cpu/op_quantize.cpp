@@ -6,11 +6,14 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <executorch/kernels/portable/cpu/util/parallel_util.h>
 #include <executorch/kernels/portable/cpu/util/reduce_util.h>
+#include <executorch/kernels/quantized/cpu/vec_quantize.h>
 #include <executorch/runtime/kernel/kernel_includes.h>
 #include <algorithm>
 #include <cinttypes>
 #include <cmath>
+#include <type_traits>
 
 /**
  * For an input tensor, use the scale and zero_point arguments to quantize it.
@@ -105,6 +108,111 @@ T quantize_val(
   return static_cast<T>(qvalue);
 }
 
+namespace {
+
+/**
+ * Quantizes `size` contiguous elements that share one scale and zero point,
+ * with the same results as calling quantize_val() on each of them.
+ */
+template <typename IN_CTYPE, typename OUT_CTYPE>
+void quantize_span(
+    const IN_CTYPE* in,
+    OUT_CTYPE* out,
+    int64_t size,
+    double scale,
+    int64_t zero_point,
+    int64_t quant_min,
+    int64_t quant_max) {
+  if constexpr (
+      std::is_same<IN_CTYPE, float>::value &&
+      internal::can_vec_quantize<OUT_CTYPE>()) {
+    internal::vec_quantize(
+        in,
+        out,
+        size,
+        1.0f / static_cast<float>(scale),
+        static_cast<int32_t>(zero_point),
+        quant_min,
+        quant_max);
+  } else {
+    for (int64_t i = 0; i < size; ++i) {
+      out[i] = quantize_val<OUT_CTYPE, IN_CTYPE>(
+          scale, zero_point, in[i], quant_min, quant_max);
+    }
+  }
+}
+
+template <typename IN_CTYPE, typename OUT_CTYPE>
+void quantize_per_tensor_impl(
+    const IN_CTYPE* in,
+    OUT_CTYPE* out,
+    int64_t numel,
+    double scale,
+    int64_t zero_point,
+    int64_t quant_min,
+    int64_t quant_max) {
+  auto quantize_chunk = [&](int64_t begin, int64_t end) {
+    quantize_span(
+        in + begin,
+        out + begin,
+        end - begin,
+        scale,
+        zero_point,
+        quant_min,
+        quant_max);
+  };
+  utils::parallel_for(0, numel, internal::kQuantizeGrainSize, quantize_chunk);
+}
+
+/**
+ * Quantizes a tensor whose input and output both have contiguous spans (see
+ * internal::has_contiguous_spans()). Each row of the elements that follow
+ * `axis` shares one channel's scale and zero point, so rows are quantized
+ * independently and in parallel.
+ */
+template <typename IN_CTYPE, typename OUT_CTYPE>
+void quantize_per_channel_contiguous(
+    const Tensor& input,
+    const double* scale_data,
+    const int64_t* zero_point_data,
+    int64_t axis,
+    int64_t quant_min,
+    int64_t quant_max,
+    Tensor& out) {
+  if (input.numel() == 0) {
+    return;
+  }
+  const int64_t num_channels = input.size(axis);
+  int64_t row_size = 1;
+  for (int64_t d = axis + 1; d < input.dim(); ++d) {
+    row_size *= input.size(d);
+  }
+  const int64_t num_rows = input.numel() / row_size;
+  const auto* in_data = input.const_data_ptr<IN_CTYPE>();
+  auto* out_data = out.mutable_data_ptr<OUT_CTYPE>();
+
+  auto quantize_rows = [&](int64_t begin, int64_t end) {
+    for (int64_t row = begin; row < end; ++row) {
+      const int64_t channel = row % num_channels;
+      quantize_span(
+          in_data + row * row_size,
+          out_data + row * row_size,
+          row_size,
+          scale_data[channel],
+          zero_point_data[channel],
+          quant_min,
+          quant_max);
+    }
+  };
+  utils::parallel_for(
+      0,
+      num_rows,
+      std::max<int64_t>(1, internal::kQuantizeGrainSize / row_size),
+      quantize_rows);
+}
+
+} // namespace
+
 Tensor& quantize_per_tensor_out(
     const Tensor& input,
     double scale,
@@ -123,16 +231,14 @@ Tensor& quantize_per_tensor_out(
   // calculate the quantized input
 #define QUANTIZE_IMPL(IN_CTYPE, OUT_CTYPE, out_dtype)                          \
   case ScalarType::out_dtype: {                                                \
-    /* Hoist these function calls out of our inner loop because they might not \
-     * get inlined without LTO, particularly in ATen mode. */                  \
-    auto* out_data_ptr = out.mutable_data_ptr<OUT_CTYPE>();                    \
-    const auto* input_data_ptr = input.const_data_ptr<IN_CTYPE>();             \
-    const auto input_numel = input.numel();                                    \
-    for (size_t i = 0; i < input_numel; i++) {                                 \
-      IN_CTYPE value = input_data_ptr[i];                                      \
-      out_data_ptr[i] = quantize_val<OUT_CTYPE, IN_CTYPE>(                     \
-          scale, zero_point, value, quant_min, quant_max);                     \
-    }                                                                          \
+    quantize_per_tensor_impl<IN_CTYPE, OUT_CTYPE>(                             \
+        input.const_data_ptr<IN_CTYPE>(),                                      \
+        out.mutable_data_ptr<OUT_CTYPE>(),                                     \
+        input.numel(),                                                         \
+        scale,                                                                 \
+        zero_point,                                                            \
+        quant_min,                                                             \
+        quant_max);                                                            \
   } break;
 #define CALCULATE_FLOAT_TYPE(IN_CTYPE, in_dtype)         \
   case ScalarType::in_dtype:                             \
@@ -287,11 +393,13 @@ Tensor& quantize_per_channel_out(
     if (i < axis) {
       dims[i] = i;
     } else {
-      dims[i] = i - 1;
+      dims[i] = i + 1;
     }
   }
   const double* scale_data = scale.const_data_ptr<double>();
   const int64_t* zero_point_data = zero_point.const_data_ptr<int64_t>();
+  const bool contiguous = internal::has_contiguous_spans(input) &&
+      internal::has_contiguous_spans(out);
 
   exec_aten::optional<exec_aten::ArrayRef<int64_t>> optional_dim_list{
       exec_aten::ArrayRef<int64_t>{dims, size_t(input.dim() - 1)}};
@@ -306,6 +414,17 @@ Tensor& quantize_per_channel_out(
   //   in other words you are quantizing in_data[in_ix]
 #define QUANTIZE_IMPL(CTYPE_IN, CTYPE_OUT, out_dtype)                          \
   case ScalarType::out_dtype:                                                  \
+    if (contiguous) {                                                          \
+      quantize_per_channel_contiguous<CTYPE_IN, CTYPE_OUT>(                    \
+          input,                                                               \
+          scale_data,                                                          \
+          zero_point_data,                                                     \
+          axis,                                                                \
+          quant_min,                                                           \
+          quant_max,                                                           \
+          out);                                                                \
+      break;                                                                   \
+    }                                                                          \
     for (size_t channel_ix = 0; channel_ix < input.size(axis); ++channel_ix) { \
       double _scale = scale_data[channel_ix];                                  \
       int64_t _zero_point = zero_point_data[channel_ix];                       \
@@ -1,6 +1,13 @@
 load("@fbsource//xplat/executorch/build:runtime_wrapper.bzl", "runtime")
 load("@fbsource//xplat/executorch/kernels/portable:op_registration_util.bzl", "define_op_target", "op_target")
 
+def quantized_use_threadpool():
+    """Whether the quantized kernels split large ops across the threadpool.
+
+    Off by default, like portable_use_threadpool() for the portable kernels.
+    """
+    return native.read_config("executorch", "quantized_use_threadpool", "false") == "true"
+
 _QUANT_OPS = (
     op_target(
         name = "op_add",
@@ -8,20 +15,33 @@ _QUANT_OPS = (
     op_target(
         name = "op_choose_qparams",
         deps = [
-            "//executorch/kernels/portable/cpu:vec_ops",
+            "//executorch/kernels/quantized/cpu:parallel_util",
+            "//executorch/kernels/quantized/cpu:vec_quantize",
+        ],
+        _aten_mode_deps = [
+            "//executorch/kernels/quantized/cpu:parallel_util_aten",
+            "//executorch/kernels/quantized/cpu:vec_quantize_aten",
         ],
     ),
     op_target(
         name = "op_dequantize",
         deps = [
             "//executorch/kernels/portable/cpu/util:reduce_util",
+            "//executorch/kernels/quantized/cpu:parallel_util",
+            "//executorch/kernels/quantized/cpu:vec_quantize",
         ],
         _aten_mode_deps = [
             "//executorch/kernels/portable/cpu/util:reduce_util_aten",
+            "//executorch/kernels/quantized/cpu:parallel_util_aten",
+            "//executorch/kernels/quantized/cpu:vec_quantize_aten",
         ],
     ),
     op_target(
         name = "op_embedding",
+        deps = ["//executorch/kernels/quantized/cpu:embedding_util"],
+        _aten_mode_deps = [
+            "//executorch/kernels/quantized/cpu:embedding_util_aten",
+        ],
     ),
     op_target(
         name = "op_embedding2b",
@@ -40,22 +60,32 @@ _QUANT_OPS = (
     op_target(
         name = "op_mixed_mm",
         deps = [
-            "//executorch/kernels/portable/cpu:vec_ops",
+            "//executorch/kernels/quantized/cpu:mixed_matmul",
+        ],
+        _aten_mode_deps = [
+            "//executorch/kernels/quantized/cpu:mixed_matmul_aten",
         ],
     ),
     op_target(
         name = "op_mixed_linear",
         deps = [
-            "//executorch/kernels/portable/cpu:vec_ops",
+            "//executorch/kernels/quantized/cpu:mixed_matmul",
+        ],
+        _aten_mode_deps = [
+            "//executorch/kernels/quantized/cpu:mixed_matmul_aten",
         ],
     ),
     op_target(
         name = "op_quantize",
         deps = [
             "//executorch/kernels/portable/cpu/util:reduce_util",
+            "//executorch/kernels/quantized/cpu:parallel_util",
+            "//executorch/kernels/quantized/cpu:vec_quantize",
         ],
         _aten_mode_deps = [
             "//executorch/kernels/portable/cpu/util:reduce_util_aten",
+            "//executorch/kernels/quantized/cpu:parallel_util_aten",
+            "//executorch/kernels/quantized/cpu:vec_quantize_aten",
         ],
     ),
 )
@@ -76,6 +106,64 @@ def define_common_targets():
         exported_deps = quant_op_targets,
     )
 
+    for aten_mode in (True, False):
+        aten_suffix = "_aten" if aten_mode else ""
+
+        # The portable utils::parallel_for(), plus the threadpool when
+        # quantized_use_threadpool is set so that the quantized kernels can be
+        # threaded independently of the portable ones.
+        runtime.cxx_library(
+            name = "parallel_util" + aten_suffix,
+            visibility = [
+                "//executorch/kernels/quantized/...",
+            ],
+            exported_deps = [
+                "//executorch/kernels/portable/cpu/util:parallel_util" + aten_suffix,
+            ] + ([
+                "//executorch/extension/parallel:thread_parallel" + aten_suffix,
+                "//executorch/extension/threadpool:threadpool",
+            ] if quantized_use_threadpool() else []),
+        )
+
+        runtime.cxx_library(
+            name = "vec_quantize" + aten_suffix,
+            exported_headers = ["vec_quantize.h"],
+            visibility = [
+                "//executorch/kernels/quantized/...",
+            ],
+            exported_deps = [
+                "//executorch/kernels/optimized:libvec",
+                "//executorch/runtime/kernel:kernel_includes" + aten_suffix,
+            ],
+        )
+
+        runtime.cxx_library(
+            name = "mixed_matmul" + aten_suffix,
+            exported_headers = ["mixed_matmul.h"],
+            visibility = [
+                "//executorch/kernels/quantized/...",
+            ],
+            exported_deps = [
+                ":parallel_util" + aten_suffix,
+                ":vec_quantize" + aten_suffix,
+                "//executorch/kernels/optimized:libutils",
+                "//executorch/kernels/optimized:libvec",
+            ],
+        )
+
+        runtime.cxx_library(
+            name = "embedding_util" + aten_suffix,
+            exported_headers = ["embedding_util.h"],
+            visibility = [
+                "//executorch/kernels/quantized/...",
+            ],
+            exported_deps = [
+                ":parallel_util" + aten_suffix,
+                ":vec_quantize" + aten_suffix,
+                "//executorch/kernels/optimized:libvec",
+            ],
+        )
+
     runtime.cxx_library(
         name = "embeddingxb",
         srcs = ["embeddingxb.cpp"],
@@ -83,7 +171,10 @@ def define_common_targets():
         visibility = [
             "//executorch/kernels/quantized/...",
         ],
-        deps = ["//executorch/runtime/kernel:kernel_includes"],
+        deps = [
+            ":embedding_util",
+            "//executorch/runtime/kernel:kernel_includes",
+        ],
     )
 
     runtime.cxx_library(
@@ -93,7 +184,10 @@ def define_common_targets():
         visibility = [
             "//executorch/kernels/quantized/...",
         ],
-        deps = ["//executorch/runtime/kernel:kernel_includes_aten"],
+        deps = [
+            ":embedding_util_aten",
+            "//executorch/runtime/kernel:kernel_includes_aten",
+        ],
     )
 
     runtime.cxx_library(
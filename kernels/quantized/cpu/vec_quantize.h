@@ -0,0 +1,385 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include <executorch/kernels/optimized/vec/vec.h>
+#include <executorch/runtime/kernel/kernel_includes.h>
+
+/**
+ * Vectorized inner loops for the quantize, dequantize and choose_qparams
+ * kernels. Each helper processes one contiguous span that shares a single
+ * scale and zero point; the op implementations split tensors into such spans
+ * (the whole tensor, one channel, or one token) and distribute them across
+ * threads with utils::parallel_for().
+ *
+ * Also holds the loads that widen 8-, 4- and 2-bit integers to
+ * Vectorized<float> in registers, shared by the kernels that consume
+ * quantized weights.
+ */
+
+namespace torch {
+namespace executor {
+namespace native {
+namespace internal {
+
+/// Minimum number of elements per task when splitting elementwise
+/// (de)quantization across threads.
+constexpr int64_t kQuantizeGrainSize = 32 * 1024;
+
+/**
+ * Returns true if `t` is laid out densely in row-major order, so that every
+ * channel along any axis is a run of equal-length contiguous spans. Unlike
+ * tensor_is_contiguous(), doesn't log when the answer is no: callers use this
+ * to choose a fast path, not to reject the tensor.
+ */
+inline bool has_contiguous_spans(const exec_aten::Tensor& t) {
+  const auto sizes = t.sizes();
+  const auto strides = t.strides();
+  int64_t expected_stride = 1;
+  for (int64_t d = t.dim() - 1; d >= 0; --d) {
+    if (sizes[d] != 1 && strides[d] != expected_stride) {
+      return false;
+    }
+    expected_stride *= sizes[d];
+  }
+  return true;
+}
+
+/**
+ * Returns true if vec_quantize() can produce values of this type exactly.
+ *
+ * The vectorized path rounds and clamps in float, which is exact as long as
+ * every value in [quant_min, quant_max] is representable, i.e. for 8- and
+ * 16-bit outputs.
+ */
+template <typename OUT_CTYPE>
+constexpr bool can_vec_quantize() {
+  return sizeof(OUT_CTYPE) <= 2;
+}
+
+/**
+ * out[i] = clamp(zero_point + nearbyint(in[i] * inv_scale), quant_min,
+ * quant_max), with the same float arithmetic as quantize_val().
+ */
+template <typename OUT_CTYPE>
+void vec_quantize(
+    const float* in,
+    OUT_CTYPE* out,
+    int64_t size,
+    float inv_scale,
+    int32_t zero_point,
+    int64_t quant_min,
+    int64_t quant_max) {
+  static_assert(
+      can_vec_quantize<OUT_CTYPE>(), "output type is too wide to vectorize");
+  using Vec = ::executorch::vec::Vectorized<float>;
+  constexpr int64_t kVecSize = Vec::size();
+  // Adding and subtracting 1.5 * 2^23 rounds to the nearest integer, ties to
+  // even, for |x| < 2^22. Vectorized<float>::round() rounds ties away from
+  // zero on some platforms, which wouldn't match std::nearbyint(). Larger
+  // values are clamped to the quantized range regardless.
+  constexpr float kRoundMagic = 12582912.0f;
+
+  const Vec inv_scale_vec(inv_scale);
+  const Vec magic_vec(kRoundMagic);
+  const Vec zero_point_vec(static_cast<float>(zero_point));
+  const Vec min_vec(static_cast<float>(quant_min));
+  const Vec max_vec(static_cast<float>(quant_max));
+  float buf[kVecSize];
+
+  int64_t i = 0;
+  for (; i + kVecSize <= size; i += kVecSize) {
+    Vec v = Vec::loadu(in + i) * inv_scale_vec;
+    v = ((v + magic_vec) - magic_vec) + zero_point_vec;
+    ::executorch::vec::clamp(v, min_vec, max_vec).store(buf);
+    for (int64_t j = 0; j < kVecSize; ++j) {
+      out[i + j] = static_cast<OUT_CTYPE>(static_cast<int32_t>(buf[j]));
+    }
+  }
+  for (; i < size; ++i) {
+    int64_t qvalue = static_cast<int64_t>(
+        zero_point + std::nearbyint(static_cast<float>(inv_scale * in[i])));
+    qvalue = std::max<int64_t>(qvalue, quant_min);
+    qvalue = std::min<int64_t>(qvalue, quant_max);
+    out[i] = static_cast<OUT_CTYPE>(qvalue);
+  }
+}
+
+/**
+ * out[i] = (in[i] - zero_point) * scale
+ *
+ * Vectorized<float> has no conversions from narrow integers, so this is kept
+ * as a simple loop with no cross-iteration dependencies, which compilers
+ * reliably vectorize; routing it through a float staging buffer is slower.
+ */
+template <typename IN_CTYPE>
+void vec_dequantize(
+    const IN_CTYPE* in,
+    float* out,
+    int64_t size,
+    float scale,
+    int32_t zero_point) {
+  for (int64_t i = 0; i < size; ++i) {
+    out[i] = static_cast<float>(in[i] - zero_point) * scale;
+  }
+}
+
+/// Computes the minimum and maximum of a non-empty span.
+inline void
+vec_min_max(const float* in, int64_t size, float* min_out, float* max_out) {
+  using Vec = ::executorch::vec::Vectorized<float>;
+  constexpr int64_t kVecSize = Vec::size();
+  float min = in[0];
+  float max = in[0];
+  int64_t i = 0;
+  if (size >= kVecSize) {
+    Vec min_vec = Vec::loadu(in);
+    Vec max_vec = min_vec;
+    for (i = kVecSize; i + kVecSize <= size; i += kVecSize) {
+      const Vec v = Vec::loadu(in + i);
+      min_vec = ::executorch::vec::minimum(min_vec, v);
+      max_vec = ::executorch::vec::maximum(max_vec, v);
+    }
+    float min_buf[kVecSize];
+    float max_buf[kVecSize];
+    min_vec.store(min_buf);
+    max_vec.store(max_buf);
+    min = *std::min_element(min_buf, min_buf + kVecSize);
+    max = *std::max_element(max_buf, max_buf + kVecSize);
+  }
+  for (; i < size; ++i) {
+    min = std::min(min, in[i]);
+    max = std::max(max, in[i]);
+  }
+  *min_out = min;
+  *max_out = max;
+}
+
+/**
+ * Widens the int8 lanes of `v` to float. Vectorized has no conversions from
+ * narrow integers, and going through a float buffer costs more than the
+ * arithmetic the values feed, so the vec_load_* helpers below use intrinsics
+ * where available.
+ */
+#if defined(CPU_CAPABILITY_AVX512) && !defined(_MSC_VER)
+inline ::executorch::vec::Vectorized<float> vec_widen_int8(__m128i v) {
+  return _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(v));
+}
+#elif defined(CPU_CAPABILITY_AVX2) && !defined(_MSC_VER)
+inline ::executorch::vec::Vectorized<float> vec_widen_int8(__m128i v) {
+  return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(v));
+}
+#elif defined(CPU_CAPABILITY_SVE256)
+// SVE loads widen as they go, so there is nothing to share.
+#elif defined(__aarch64__)
+inline ::executorch::vec::Vectorized<float> vec_widen_int8(int8x8_t v) {
+  const int16x8_t v16 = vmovl_s8(v);
+  return ::executorch::vec::Vectorized<float>(
+      vcvtq_f32_s32(vmovl_s16(vget_low_s16(v16))),
+      vcvtq_f32_s32(vmovl_s16(vget_high_s16(v16))));
+}
+#endif
+
+/// Loads Vectorized<float>::size() int8 values as floats.
+inline ::executorch::vec::Vectorized<float> vec_load_int8(const int8_t* src) {
+  using Vec = ::executorch::vec::Vectorized<float>;
+#if defined(CPU_CAPABILITY_AVX512) && !defined(_MSC_VER)
+  static_assert(Vec::size() == 16, "expected 512-bit vectors");
+  return vec_widen_int8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+#elif defined(CPU_CAPABILITY_AVX2) && !defined(_MSC_VER)
+  static_assert(Vec::size() == 8, "expected 256-bit vectors");
+  return vec_widen_int8(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+#elif defined(CPU_CAPABILITY_SVE256)
+  const svbool_t pg = svptrue_b32();
+  return svcvt_f32_s32_x(pg, svld1sb_s32(pg, src));
+#elif defined(__aarch64__)
+  static_assert(Vec::size() == 8, "expected a pair of 128-bit vectors");
+  return vec_widen_int8(vld1_s8(src));
+#else
+  float buf[Vec::size()];
+  for (int64_t i = 0; i < Vec::size(); ++i) {
+    buf[i] = static_cast<float>(src[i]);
+  }
+  return Vec::loadu(buf);
+#endif
+}
+
+/// Loads Vectorized<float>::size() uint8 values as floats.
+inline ::executorch::vec::Vectorized<float> vec_load_uint8(
+    const uint8_t* src) {
+  using Vec = ::executorch::vec::Vectorized<float>;
+#if defined(CPU_CAPABILITY_AVX512) && !defined(_MSC_VER)
+  static_assert(Vec::size() == 16, "expected 512-bit vectors");
+  return _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(src))));
+#elif defined(CPU_CAPABILITY_AVX2) && !defined(_MSC_VER)
+  static_assert(Vec::size() == 8, "expected 256-bit vectors");
+  return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src))));
+#elif defined(CPU_CAPABILITY_SVE256)
+  const svbool_t pg = svptrue_b32();
+  return svcvt_f32_u32_x(pg, svld1ub_u32(pg, src));
+#elif defined(__aarch64__)
+  static_assert(Vec::size() == 8, "expected a pair of 128-bit vectors");
+  const uint16x8_t v16 = vmovl_u8(vld1_u8(src));
+  return Vec(
+      vcvtq_f32_u32(vmovl_u16(vget_low_u16(v16))),
+      vcvtq_f32_u32(vmovl_u16(vget_high_u16(v16))));
+#else
+  float buf[Vec::size()];
+  for (int64_t i = 0; i < Vec::size(); ++i) {
+    buf[i] = static_cast<float>(src[i]);
+  }
+  return Vec::loadu(buf);
+#endif
+}
+
+/// Loads Vectorized<float>::size() int8 or uint8 values as floats.
+inline ::executorch::vec::Vectorized<float> vec_load_8bit(const int8_t* src) {
+  return vec_load_int8(src);
+}
+inline ::executorch::vec::Vectorized<float> vec_load_8bit(const uint8_t* src) {
+  return vec_load_uint8(src);
+}
+
+/**
+ * Loads Vectorized<float>::size() bytes that each hold 8 / kBits values of
+ * kBits bits, stored with an offset of 2^(kBits - 1), and unpacks them.
+ * fields[f] gets the value of field f of every byte, with the offset
+ * removed.
+ *
+ * Fields are numbered in element order: for 4 bits, the high nibble (the
+ * even element) is field 0, as in embedding_4bit and mixed_linear; for 2
+ * bits, the lowest two bits are field 0, as in embedding_2bit.
+ */
+template <int kBits>
+inline void vec_load_subbyte(
+    const uint8_t* src,
+    ::executorch::vec::Vectorized<float> (&fields)[8 / kBits]) {
+  static_assert(kBits == 4 || kBits == 2, "unsupported bit width");
+  using Vec = ::executorch::vec::Vectorized<float>;
+  constexpr int kFields = 8 / kBits;
+  constexpr int kMask = (1 << kBits) - 1;
+  constexpr int kOffset = 1 << (kBits - 1);
+  // Bit position of each field.
+  const auto shift = [](int f) { return kBits == 4 ? 4 - 4 * f : 2 * f; };
+#if defined(CPU_CAPABILITY_AVX512) && !defined(_MSC_VER)
+  static_assert(Vec::size() == 16, "expected 512-bit vectors");
+  const __m512i bytes = _mm512_cvtepu8_epi32(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+  const __m512i mask = _mm512_set1_epi32(kMask);
+  const __m512i offset = _mm512_set1_epi32(kOffset);
+  for (int f = 0; f < kFields; ++f) {
+    const __m512i field = _mm512_and_si512(
+        _mm512_srl_epi32(bytes, _mm_cvtsi32_si128(shift(f))), mask);
+    fields[f] = _mm512_cvtepi32_ps(_mm512_sub_epi32(field, offset));
+  }
+#elif defined(CPU_CAPABILITY_AVX2) && !defined(_MSC_VER)
+  static_assert(Vec::size() == 8, "expected 256-bit vectors");
+  const __m256i bytes = _mm256_cvtepu8_epi32(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+  const __m256i mask = _mm256_set1_epi32(kMask);
+  const __m256i offset = _mm256_set1_epi32(kOffset);
+  for (int f = 0; f < kFields; ++f) {
+    const __m256i field = _mm256_and_si256(
+        _mm256_srl_epi32(bytes, _mm_cvtsi32_si128(shift(f))), mask);
+    fields[f] = _mm256_cvtepi32_ps(_mm256_sub_epi32(field, offset));
+  }
+#elif defined(CPU_CAPABILITY_SVE256)
+  const svbool_t pg = svptrue_b32();
+  const svint32_t bytes = svreinterpret_s32_u32(svld1ub_u32(pg, src));
+  for (int f = 0; f < kFields; ++f) {
+    const svint32_t field =
+        svand_n_s32_x(pg, svasr_n_s32_x(pg, bytes, shift(f)), kMask);
+    fields[f] = svcvt_f32_s32_x(pg, svsub_n_s32_x(pg, field, kOffset));
+  }
+#elif defined(__aarch64__)
+  static_assert(Vec::size() == 8, "expected a pair of 128-bit vectors");
+  const uint8x8_t bytes = vld1_u8(src);
+  for (int f = 0; f < kFields; ++f) {
+    const uint8x8_t field = vand_u8(
+        vshl_u8(bytes, vdup_n_s8(static_cast<int8_t>(-shift(f)))),
+        vdup_n_u8(kMask));
+    fields[f] = vec_widen_int8(
+        vsub_s8(vreinterpret_s8_u8(field), vdup_n_s8(kOffset)));
+  }
+#else
+  float buf[Vec::size()];
+  for (int f = 0; f < kFields; ++f) {
+    for (int64_t i = 0; i < Vec::size(); ++i) {
+      buf[i] = static_cast<float>(((src[i] >> shift(f)) & kMask) - kOffset);
+    }
+    fields[f] = Vec::loadu(buf);
+  }
+#endif
+}
+
+/// Bytes per run read by the vec_load_*_runs() helpers.
+constexpr int64_t kVecLoadRunBytes = 8;
+
+/**
+ * Like vec_load_int8(), but reads Vectorized<float>::size() / 8 runs of 8
+ * bytes, run r starting at src + r * stride. Lets a fixed 8-byte layout,
+ * such as the packed mixed_linear weight, fill wider vectors.
+ */
+inline ::executorch::vec::Vectorized<float> vec_load_int8_runs(
+    const int8_t* src,
+    int64_t stride) {
+  using Vec = ::executorch::vec::Vectorized<float>;
+  static_assert(Vec::size() % kVecLoadRunBytes == 0, "runs must fill a vector");
+  if constexpr (Vec::size() == kVecLoadRunBytes) {
+    (void)stride;
+    return vec_load_int8(src);
+  } else {
+#if defined(CPU_CAPABILITY_AVX512) && !defined(_MSC_VER)
+    return vec_widen_int8(_mm_unpacklo_epi64(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)),
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + stride))));
+#else
+    int8_t buf[Vec::size()];
+    for (int64_t r = 0; r < Vec::size() / kVecLoadRunBytes; ++r) {
+      std::memcpy(
+          buf + r * kVecLoadRunBytes, src + r * stride, kVecLoadRunBytes);
+    }
+    return vec_load_int8(buf);
+#endif
+  }
+}
+
+/// vec_load_subbyte() over runs of bytes, as for vec_load_int8_runs().
+template <int kBits>
+inline void vec_load_subbyte_runs(
+    const uint8_t* src,
+    int64_t stride,
+    ::executorch::vec::Vectorized<float> (&fields)[8 / kBits]) {
+  using Vec = ::executorch::vec::Vectorized<float>;
+  static_assert(Vec::size() % kVecLoadRunBytes == 0, "runs must fill a vector");
+  if constexpr (Vec::size() == kVecLoadRunBytes) {
+    (void)stride;
+    vec_load_subbyte<kBits>(src, fields);
+  } else {
+    uint8_t buf[Vec::size()];
+    for (int64_t r = 0; r < Vec::size() / kVecLoadRunBytes; ++r) {
+      std::memcpy(
+          buf + r * kVecLoadRunBytes, src + r * stride, kVecLoadRunBytes);
+    }
+    vec_load_subbyte<kBits>(buf, fields);
+  }
+}
+
+} // namespace internal
+} // namespace native
+} // namespace executor
+} // namespace torch
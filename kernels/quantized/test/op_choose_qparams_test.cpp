@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include <vector>
 
 using namespace ::testing;
 using exec_aten::ArrayRef;
@@ -163,3 +164,44 @@ TEST(OpChooseQparamsPerTokenAsymmetricTensorOutTest, DynamicShapeFloat) {
   EXPECT_TENSOR_CLOSE_WITH_TOL(scale_out, new_expected_scale, 1e-4, 1e-4);
   EXPECT_TENSOR_EQ(zero_point_out, new_expected_zero_point);
 }
+
+TEST(OpChooseQparamsPerTokenAsymmetricTensorOutTest, ManyTokens) {
+  et_pal_init();
+  TensorFactory<ScalarType::Float> tf_float;
+  TensorFactory<ScalarType::Double> tf_double;
+  TensorFactory<ScalarType::Long> tf_long;
+
+  // Tokens longer than a vector, with a length that isn't a multiple of the
+  // vector width, and the extremes in varying positions.
+  constexpr int32_t num_tokens = 64;
+  constexpr int32_t token_dim = 37;
+  std::vector<float> input_data(num_tokens * token_dim);
+  for (size_t i = 0; i < input_data.size(); ++i) {
+    input_data[i] = static_cast<float>((i * 29) % 97) * 0.05f - 2.0f;
+  }
+  Tensor input = tf_float.make({num_tokens, token_dim}, input_data);
+  Tensor scale_out = tf_double.zeros({num_tokens, 1});
+  Tensor zero_point_out = tf_long.zeros({num_tokens, 1});
+
+  choose_qparams_per_token_asymmetric_out(
+      input, ScalarType::Float, scale_out, zero_point_out);
+
+  for (int32_t t = 0; t < num_tokens; ++t) {
+    Tensor token = tf_float.make(
+        {1, token_dim},
+        std::vector<float>(
+            input_data.begin() + t * token_dim,
+            input_data.begin() + (t + 1) * token_dim));
+    Tensor token_scale = tf_double.zeros({1, 1});
+    Tensor token_zero_point = tf_long.zeros({1, 1});
+    choose_qparams_per_token_asymmetric_out(
+        token, ScalarType::Float, token_scale, token_zero_point);
+
+    EXPECT_EQ(
+        scale_out.const_data_ptr<double>()[t],
+        token_scale.const_data_ptr<double>()[0]);
+    EXPECT_EQ(
+        zero_point_out.const_data_ptr<int64_t>()[t],
+        token_zero_point.const_data_ptr<int64_t>()[0]);
+  }
+}
@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include <vector>
 
 using namespace ::testing;
 using exec_aten::ArrayRef;
@@ -195,3 +196,81 @@ TEST(OpDequantizeOutTest, DequantizePerChannel) {
       out);
   EXPECT_TENSOR_EQ(out, expected);
 }
+
+TEST(OpDequantizeOutTest, LargeTensor) {
+  TensorFactory<ScalarType::Char> tf;
+  TensorFactory<ScalarType::Float> tfo;
+
+  // Enough elements to be split into several chunks, with a length that isn't
+  // a multiple of the vector width.
+  constexpr int32_t numel = 100003;
+  const double scale = 0.25;
+  const int64_t zero_point = -3;
+
+  std::vector<int8_t> input_data(numel);
+  std::vector<float> expected_data(numel);
+  for (int32_t i = 0; i < numel; ++i) {
+    input_data[i] = static_cast<int8_t>(i % 256 - 128);
+    expected_data[i] = static_cast<float>(input_data[i] - zero_point) * 0.25f;
+  }
+
+  Tensor input = tf.make({numel}, input_data);
+  Tensor out = tfo.zeros({numel});
+  Tensor expected = tfo.make({numel}, expected_data);
+  dequantize_per_tensor_out(
+      input,
+      scale,
+      zero_point,
+      /*quant_min=*/-128,
+      /*quant_max=*/127,
+      ScalarType::Char,
+      optional<ScalarType>(),
+      out);
+
+  EXPECT_TENSOR_EQ(out, expected);
+}
+
+TEST(OpDequantizeOutTest, DequantizePerChannelInnerAxis) {
+  et_pal_init();
+  TensorFactory<ScalarType::Byte> tf_byte;
+  TensorFactory<ScalarType::Double> tf_double;
+  TensorFactory<ScalarType::Long> tf_long;
+
+  // Channels along the middle dimension of a 3-D tensor, with rows longer
+  // than a vector.
+  constexpr int32_t outer = 2;
+  constexpr int32_t channels = 3;
+  constexpr int32_t inner = 19;
+  std::vector<uint8_t> input_data(outer * channels * inner);
+  for (size_t i = 0; i < input_data.size(); ++i) {
+    input_data[i] = static_cast<uint8_t>(i * 7 % 256);
+  }
+  const std::vector<double> scales = {0.5, 0.75, 1};
+  const std::vector<int64_t> zero_points = {30, 50, 60};
+  std::vector<float> expected_data(input_data.size());
+  for (size_t i = 0; i < input_data.size(); ++i) {
+    const size_t c = (i / inner) % channels;
+    expected_data[i] = static_cast<float>(input_data[i] - zero_points[c]) *
+        static_cast<float>(scales[c]);
+  }
+
+  Tensor input = tf_byte.make({outer, channels, inner}, input_data);
+  Tensor scale = tf_double.make({channels}, scales);
+  Tensor zero_point = tf_long.make({channels}, zero_points);
+
+  TensorFactory<ScalarType::Float> tfo;
+  Tensor out = tfo.zeros({outer, channels, inner});
+  Tensor expected = tfo.make({outer, channels, inner}, expected_data);
+  dequantize_per_channel_out(
+      input,
+      scale,
+      zero_point,
+      /*axis=*/1,
+      /*quant_min=*/0,
+      /*quant_max=*/255,
+      ScalarType::Byte,
+      optional<ScalarType>(),
+      out);
+
+  EXPECT_TENSOR_EQ(out, expected);
+}
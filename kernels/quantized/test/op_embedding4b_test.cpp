@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include <vector>
 
 using namespace ::testing;
 using exec_aten::ArrayRef;
@@ -101,6 +102,57 @@ TEST(OpQuantizedEmbedding4bTest, TestGroupWiseQuantizedEmbedding) {
   EXPECT_TENSOR_EQ(out, expected);
 }
 
+TEST(OpQuantizedEmbedding4bTest, TestWideRowsMatchReference) {
+  et_pal_init();
+  TensorFactory<ScalarType::Byte> tfb;
+  TensorFactory<ScalarType::Float> tf;
+  TensorFactory<ScalarType::Long> tfl;
+
+  // Two groups of 51 values per row, so the second group starts in the
+  // middle of a byte and both groups end with a partial vector.
+  constexpr int32_t kRows = 5;
+  constexpr int32_t kPackedDim = 51;
+  constexpr int32_t kDim = 2 * kPackedDim;
+  constexpr int32_t kGroups = 2;
+  constexpr int32_t kGroupSize = kDim / kGroups;
+
+  std::vector<uint8_t> packed(kRows * kPackedDim);
+  for (size_t i = 0; i < packed.size(); ++i) {
+    packed[i] = static_cast<uint8_t>((i * 37 + 11) % 256);
+  }
+  std::vector<float> scales(kRows * kGroups);
+  std::vector<float> zero_points(kRows * kGroups);
+  for (size_t i = 0; i < scales.size(); ++i) {
+    scales[i] = 0.25f * (i + 1);
+    zero_points[i] = static_cast<float>(i % 5) - 2;
+  }
+  const std::vector<int64_t> index_values = {3, 0, 4, 4, 1, 2, 0};
+  const int32_t num_indices = index_values.size();
+
+  // The high nibble of each byte holds the even element.
+  std::vector<float> expected_values;
+  for (int64_t index : index_values) {
+    for (int32_t j = 0; j < kDim; ++j) {
+      const uint8_t byte = packed[index * kPackedDim + j / 2];
+      const int32_t value = (j % 2 == 0 ? byte >> 4 : byte & 0x0F) - 8;
+      const int32_t group = index * kGroups + j / kGroupSize;
+      expected_values.push_back(
+          (static_cast<float>(value) - zero_points[group]) * scales[group]);
+    }
+  }
+
+  Tensor qweight = tfb.make({kRows, kPackedDim}, packed);
+  Tensor weight_scales = tf.make({kRows, kGroups}, scales);
+  Tensor weight_zero_points = tf.make({kRows, kGroups}, zero_points);
+  Tensor indices = tfl.make({num_indices}, index_values);
+  Tensor out = tf.zeros({num_indices, kDim});
+
+  quantized_embedding_4bit_out(
+      qweight, weight_scales, weight_zero_points, -8, 7, indices, out);
+
+  EXPECT_TENSOR_EQ(out, tf.make({num_indices, kDim}, expected_values));
+}
+
 TEST(OpQuantizedEmbedding4bTest, TestGroupWiseQuantizedEmbeddingDeath1) {
   et_pal_init();
   TensorFactory<ScalarType::Byte> tfb;
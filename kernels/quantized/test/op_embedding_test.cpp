@@ -17,6 +17,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include <vector>
 
 using namespace ::testing;
 using exec_aten::ArrayRef;
@@ -227,6 +228,53 @@ TEST(OpQuantizedEmbeddingTest, TestGroupWiseQuantizedEmbedding) {
   EXPECT_TENSOR_EQ(out, expected);
 }
 
+TEST(OpQuantizedEmbeddingTest, TestWideRowsMatchReference) {
+  et_pal_init();
+  TensorFactory<ScalarType::Byte> tfb;
+  TensorFactory<ScalarType::Float> tf;
+  TensorFactory<ScalarType::Long> tfl;
+
+  // Four groups of 25 values per row, each ending with a partial vector.
+  constexpr int32_t kRows = 5;
+  constexpr int32_t kDim = 100;
+  constexpr int32_t kGroups = 4;
+  constexpr int32_t kGroupSize = kDim / kGroups;
+
+  std::vector<uint8_t> weight(kRows * kDim);
+  for (size_t i = 0; i < weight.size(); ++i) {
+    weight[i] = static_cast<uint8_t>((i * 37 + 11) % 256);
+  }
+  std::vector<float> scales(kRows * kGroups);
+  std::vector<float> zero_points(kRows * kGroups);
+  for (size_t i = 0; i < scales.size(); ++i) {
+    scales[i] = 0.25f * (i + 1);
+    zero_points[i] = static_cast<float>(100 + i);
+  }
+  const std::vector<int64_t> index_values = {3, 0, 4, 4, 1, 2, 0};
+  const int32_t num_indices = index_values.size();
+
+  std::vector<float> expected_values;
+  for (int64_t index : index_values) {
+    for (int32_t j = 0; j < kDim; ++j) {
+      const int32_t group = index * kGroups + j / kGroupSize;
+      expected_values.push_back(
+          (static_cast<float>(weight[index * kDim + j]) - zero_points[group]) *
+          scales[group]);
+    }
+  }
+
+  Tensor qweight = tfb.make({kRows, kDim}, weight);
+  Tensor weight_scales = tf.make({kRows, kGroups}, scales);
+  Tensor weight_zero_points = tf.make({kRows, kGroups}, zero_points);
+  Tensor indices = tfl.make({num_indices}, index_values);
+  Tensor out = tf.zeros({num_indices, kDim});
+
+  quantized_embedding_byte_out(
+      qweight, weight_scales, weight_zero_points, 0, 255, indices, out);
+
+  EXPECT_TENSOR_EQ(out, tf.make({num_indices, kDim}, expected_values));
+}
+
 TEST(OpQuantizedEmbeddingTest, TestGroupWiseQuantizedEmbeddingDeath1) {
   et_pal_init();
   TensorFactory<ScalarType::Float> tf;
@@ -8,6 +8,7 @@
 
 #include <executorch/kernels/portable/NativeFunctions.h> // Declares the aten operator
 #include <executorch/kernels/quantized/NativeFunctions.h> // Declares the quantized operator
+#include <executorch/kernels/quantized/cpu/mixed_matmul.h>
 #include <executorch/runtime/core/exec_aten/exec_aten.h>
 #include <executorch/runtime/core/exec_aten/testing_util/tensor_factory.h>
 #include <executorch/runtime/core/exec_aten/testing_util/tensor_util.h>
@@ -16,12 +17,17 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <vector>
+
 using namespace ::testing;
 using exec_aten::optional;
 using exec_aten::ScalarType;
 using exec_aten::Tensor;
 using executorch::runtime::KernelRuntimeContext;
 using torch::executor::native::quantized_mixed_linear_out;
+using torch::executor::native::internal::kMixedLinearPackedCols;
+using torch::executor::native::internal::pack_mixed_linear_weight;
 using torch::executor::testing::TensorFactory;
 
 class OpQuantizedMixedDtypeLinearTest : public ::testing::Test {
@@ -140,3 +146,247 @@ TEST_F(OpQuantizedMixedDtypeLinearTest, HalfInputHalfOutput_Partials) {
   test_dtype_partials<ScalarType::Half, ScalarType::Half>();
 }
 #endif
+
+TEST_F(OpQuantizedMixedDtypeLinearTest, PackedInt4Weight) {
+  TensorFactory<ScalarType::Float> tf;
+  TensorFactory<ScalarType::Byte> tf_byte;
+
+  Tensor input = tf.make(
+      /*sizes=*/{1, 3},
+      /*data=*/{1.0, 1.5, 2.0});
+  // Values {5, 3, 1} and {4, 2, 1}, offset by 8 and packed two per byte with
+  // the even element in the high nibble.
+  Tensor weight = tf_byte.make(
+      /*sizes=*/{2, 2},
+      /*data=*/{0xDB, 0x90, 0xCA, 0x90});
+  Tensor weight_scales = tf.make(
+      /*sizes=*/{2, 2},
+      /*data=*/{0.2, 1, 0.4, 0.5});
+  const optional<Tensor> opt_weight_zp{};
+  const optional<ScalarType> opt_dtype_out{};
+
+  Tensor out = tf.zeros({1, 2});
+
+  Tensor expected = tf.make(
+      /*sizes=*/{1, 2},
+      /*data=*/
+      {(1.0 * 5 + 1.5 * 3) * 0.2 + 2.0 * 1 * 1,
+       (1.0 * 4 + 1.5 * 2) * 0.4 + 2.0 * 1 * 0.5});
+
+  KernelRuntimeContext ctx{};
+
+  quantized_mixed_linear_out(
+      ctx, input, weight, weight_scales, opt_weight_zp, opt_dtype_out, out);
+
+  EXPECT_TENSOR_CLOSE(out, expected);
+}
+
+TEST_F(OpQuantizedMixedDtypeLinearTest, SpansMultipleTiles) {
+  TensorFactory<ScalarType::Float> tf;
+  TensorFactory<ScalarType::Char> tf_char;
+
+  // Larger than one tile along every dimension, with groups that don't line
+  // up with the reduction blocks.
+  constexpr int32_t m = 20;
+  constexpr int32_t n = 300;
+  constexpr int32_t p = 11;
+  constexpr int32_t num_groups = 3;
+  constexpr int32_t g = n / num_groups;
+
+  std::vector<float> input_data(m * n);
+  std::vector<int8_t> weight_data(p * n);
+  std::vector<float> scales_data(p * num_groups);
+  for (int32_t i = 0; i < m * n; ++i) {
+    input_data[i] = static_cast<float>(i % 7) * 0.25f - 0.75f;
+  }
+  for (int32_t i = 0; i < p * n; ++i) {
+    weight_data[i] = static_cast<int8_t>((i * 37) % 255 - 127);
+  }
+  for (int32_t i = 0; i < p * num_groups; ++i) {
+    scales_data[i] = 0.01f * static_cast<float>(i + 1);
+  }
+
+  std::vector<float> expected_data(m * p);
+  for (int32_t i = 0; i < m; ++i) {
+    for (int32_t j = 0; j < p; ++j) {
+      float sum = 0;
+      for (int32_t k = 0; k < n; ++k) {
+        sum += input_data[i * n + k] * weight_data[j * n + k] *
+            scales_data[j * num_groups + k / g];
+      }
+      expected_data[i * p + j] = sum;
+    }
+  }
+
+  Tensor input = tf.make({m, n}, input_data);
+  Tensor weight = tf_char.make({p, n}, weight_data);
+  Tensor weight_scales = tf.make({p, num_groups}, scales_data);
+  const optional<Tensor> opt_weight_zp{};
+  const optional<ScalarType> opt_dtype_out{};
+
+  Tensor out = tf.zeros({m, p});
+  Tensor expected = tf.make({m, p}, expected_data);
+
+  KernelRuntimeContext ctx{};
+
+  quantized_mixed_linear_out(
+      ctx, input, weight, weight_scales, opt_weight_zp, opt_dtype_out, out);
+
+  EXPECT_TENSOR_CLOSE_WITH_TOL(out, expected, 1e-4, 1e-3);
+}
+
+namespace {
+
+/**
+ * Random-ish mixed_linear problem with weights in [-8, 7] so they fit both
+ * int8 and int4, and its float reference output.
+ */
+struct MixedLinearProblem {
+  int32_t m;
+  int32_t n;
+  int32_t p;
+  int32_t num_groups;
+  std::vector<float> input;
+  std::vector<int8_t> weight;
+  std::vector<float> scales;
+  std::vector<float> expected;
+
+  MixedLinearProblem(int32_t m_, int32_t n_, int32_t p_, int32_t num_groups_)
+      : m(m_), n(n_), p(p_), num_groups(num_groups_) {
+    const int32_t g = (n + num_groups - 1) / num_groups;
+    input.resize(m * n);
+    weight.resize(p * n);
+    scales.resize(p * num_groups);
+    expected.resize(m * p);
+    for (int32_t i = 0; i < m * n; ++i) {
+      input[i] = static_cast<float>(i % 7) * 0.25f - 0.75f;
+    }
+    for (int32_t i = 0; i < p * n; ++i) {
+      weight[i] = static_cast<int8_t>((i * 37) % 16 - 8);
+    }
+    for (int32_t i = 0; i < p * num_groups; ++i) {
+      scales[i] = 0.01f * static_cast<float>(i % 13 + 1);
+    }
+    for (int32_t i = 0; i < m; ++i) {
+      for (int32_t j = 0; j < p; ++j) {
+        float sum = 0;
+        for (int32_t k = 0; k < n; ++k) {
+          sum += input[i * n + k] * weight[j * n + k] *
+              scales[j * num_groups + k / g];
+        }
+        expected[i * p + j] = sum;
+      }
+    }
+  }
+
+  /// The weights as uint8 bytes, packed two per byte when `bits` is 4.
+  std::vector<uint8_t> weight_bytes(int bits) const {
+    if (bits == 8) {
+      return std::vector<uint8_t>(weight.begin(), weight.end());
+    }
+    const int32_t row_bytes = (n + 1) / 2;
+    std::vector<uint8_t> bytes(p * row_bytes, 0);
+    for (int32_t j = 0; j < p; ++j) {
+      for (int32_t k = 0; k < n; ++k) {
+        const uint8_t q = static_cast<uint8_t>(weight[j * n + k] + 8);
+        bytes[j * row_bytes + k / 2] |= (k % 2 == 0) ? q << 4 : q;
+      }
+    }
+    return bytes;
+  }
+};
+
+/// Runs mixed_linear on `problem` with plain or pre-packed weights.
+void run_mixed_linear(
+    const MixedLinearProblem& problem,
+    int bits,
+    bool prepack) {
+  TensorFactory<ScalarType::Float> tf;
+  TensorFactory<ScalarType::Char> tf_char;
+  TensorFactory<ScalarType::Byte> tf_byte;
+
+  const int32_t row_bytes = bits == 8 ? problem.n : (problem.n + 1) / 2;
+  std::vector<uint8_t> bytes = problem.weight_bytes(bits);
+  std::vector<int32_t> weight_sizes = {problem.p, row_bytes};
+  if (prepack) {
+    const int32_t num_blocks =
+        (problem.p + kMixedLinearPackedCols - 1) / kMixedLinearPackedCols;
+    std::vector<uint8_t> packed(
+        num_blocks * row_bytes * kMixedLinearPackedCols);
+    pack_mixed_linear_weight(bytes.data(), packed.data(), problem.p, row_bytes);
+    bytes = packed;
+    weight_sizes = {
+        num_blocks, row_bytes, static_cast<int32_t>(kMixedLinearPackedCols)};
+  }
+
+  Tensor input = tf.make({problem.m, problem.n}, problem.input);
+  Tensor weight = bits == 8
+      ? tf_char.make(
+            weight_sizes, std::vector<int8_t>(bytes.begin(), bytes.end()))
+      : tf_byte.make(weight_sizes, bytes);
+  Tensor weight_scales =
+      tf.make({problem.p, problem.num_groups}, problem.scales);
+  const optional<Tensor> opt_weight_zp{};
+  const optional<ScalarType> opt_dtype_out{};
+
+  Tensor out = tf.zeros({problem.m, problem.p});
+  Tensor expected = tf.make({problem.m, problem.p}, problem.expected);
+
+  KernelRuntimeContext ctx{};
+
+  quantized_mixed_linear_out(
+      ctx, input, weight, weight_scales, opt_weight_zp, opt_dtype_out, out);
+
+  EXPECT_TENSOR_CLOSE_WITH_TOL(out, expected, 1e-4, 1e-3);
+}
+
+} // namespace
+
+TEST_F(OpQuantizedMixedDtypeLinearTest, SingleRowDecode) {
+  // One input row takes the decode path; odd sizes exercise the int4 nibble
+  // handling at group and row boundaries.
+  MixedLinearProblem problem(1, 301, 70, 7);
+  run_mixed_linear(problem, 8, /*prepack=*/false);
+  run_mixed_linear(problem, 4, /*prepack=*/false);
+}
+
+TEST_F(OpQuantizedMixedDtypeLinearTest, PrePackedWeight) {
+  // Row counts cover decode, a partial row block and several full blocks;
+  // p is not a multiple of the packed column count.
+  for (int32_t m : {1, 3, 9}) {
+    MixedLinearProblem problem(m, 301, 21, 7);
+    run_mixed_linear(problem, 8, /*prepack=*/true);
+    run_mixed_linear(problem, 4, /*prepack=*/true);
+  }
+}
+
+TEST_F(OpQuantizedMixedDtypeLinearTest, BFloat16Input) {
+  TensorFactory<ScalarType::BFloat16> tf;
+  TensorFactory<ScalarType::Char> tf_char;
+  TensorFactory<ScalarType::Float> tf_out;
+
+  Tensor input = tf.make(
+      /*sizes=*/{1, 3},
+      /*data=*/{1.0, 1.5, 2.0});
+  Tensor weight = tf_char.make(
+      /*sizes=*/{2, 3},
+      /*data=*/{5, 3, 1, 4, 2, 1});
+  Tensor weight_scales = tf.make(
+      /*sizes=*/{2},
+      /*data=*/{0.25, 0.5});
+  const optional<Tensor> opt_weight_zp{};
+  const optional<ScalarType> opt_dtype_out = ScalarType::Float;
+
+  Tensor out = tf_out.zeros({1, 2});
+
+  Tensor expected = tf_out.make(
+      /*sizes=*/{1, 2},
+      /*data=*/{2.875, 4.5});
+
+  KernelRuntimeContext ctx{};
+
+  quantized_mixed_linear_out(
+      ctx, input, weight, weight_scales, opt_weight_zp, opt_dtype_out, out);
+
+  EXPECT_TENSOR_CLOSE(out, expected);
+}
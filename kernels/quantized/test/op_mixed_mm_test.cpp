@@ -59,7 +59,9 @@ void test_dtype() {
 
   quantized_mixed_mm_out(ctx, input, weight, weight_scales, opt_weight_zp, out);
 
-  EXPECT_TENSOR_CLOSE(out, expected);
+  // The kernel accumulates in float, so Half results can differ from the
+  // Half-rounded expectation by one ulp.
+  EXPECT_TENSOR_CLOSE_WITH_TOL(out, expected, 0, 2e-3);
 }
 
 TEST_F(OpQuantizedMixedMMTest, FloatInput) {
@@ -69,3 +71,51 @@ TEST_F(OpQuantizedMixedMMTest, FloatInput) {
 TEST_F(OpQuantizedMixedMMTest, HalfInput) {
   test_dtype<ScalarType::Half>();
 }
+
+TEST_F(OpQuantizedMixedMMTest, SpansMultipleTiles) {
+  TensorFactory<ScalarType::Float> tf;
+  TensorFactory<ScalarType::Char> tf_char;
+
+  // Larger than one tile along the row and column dimensions.
+  constexpr int32_t m = 19;
+  constexpr int32_t n = 40;
+  constexpr int32_t p = 70;
+
+  std::vector<float> input_data(m * n);
+  std::vector<int8_t> weight_data(n * p);
+  std::vector<float> scales_data(n);
+  for (int32_t i = 0; i < m * n; ++i) {
+    input_data[i] = static_cast<float>(i % 5) * 0.5f - 1.0f;
+  }
+  for (int32_t i = 0; i < n * p; ++i) {
+    weight_data[i] = static_cast<int8_t>((i * 31) % 255 - 127);
+  }
+  for (int32_t i = 0; i < n; ++i) {
+    scales_data[i] = 0.01f * static_cast<float>(i + 1);
+  }
+
+  std::vector<float> expected_data(m * p);
+  for (int32_t i = 0; i < m; ++i) {
+    for (int32_t j = 0; j < p; ++j) {
+      float sum = 0;
+      for (int32_t k = 0; k < n; ++k) {
+        sum += input_data[i * n + k] * weight_data[k * p + j] * scales_data[k];
+      }
+      expected_data[i * p + j] = sum;
+    }
+  }
+
+  Tensor input = tf.make({m, n}, input_data);
+  Tensor weight = tf_char.make({n, p}, weight_data);
+  Tensor weight_scales = tf.make({n}, scales_data);
+  const optional<Tensor> opt_weight_zp{};
+
+  Tensor out = tf.zeros({m, p});
+  Tensor expected = tf.make({m, p}, expected_data);
+
+  KernelRuntimeContext ctx{};
+
+  quantized_mixed_mm_out(ctx, input, weight, weight_scales, opt_weight_zp, out);
+
+  EXPECT_TENSOR_CLOSE_WITH_TOL(out, expected, 1e-4, 1e-3);
+}
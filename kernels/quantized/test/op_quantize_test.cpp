@@ -14,7 +14,10 @@
 #include <executorch/test/utils/DeathTest.h>
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <vector>
 
 using namespace ::testing;
 using exec_aten::ArrayRef;
@@ -141,3 +144,73 @@ TEST(OpQuantizeOutTest, QuantizePerChannel) {
 
   EXPECT_TENSOR_EQ(out, expected);
 }
+
+TEST(OpQuantizeOutTest, LargeTensorMatchesScalarReference) {
+  TensorFactory<ScalarType::Float> tf;
+  TensorFactory<ScalarType::Char> tfo;
+
+  // Enough elements to be split into several chunks, with a length that isn't
+  // a multiple of the vector width, and values that land exactly on .5 so
+  // that the rounding mode matters.
+  constexpr int32_t numel = 100003;
+  const double scale = 0.25;
+  const int64_t zero_point = 3;
+  const int64_t quant_min = -128;
+  const int64_t quant_max = 127;
+
+  std::vector<float> input_data(numel);
+  std::vector<int8_t> expected_data(numel);
+  for (int32_t i = 0; i < numel; ++i) {
+    input_data[i] = static_cast<float>(i % 301 - 150) * 0.125f;
+    int64_t q = zero_point + static_cast<int64_t>(std::nearbyint(
+                                 input_data[i] / static_cast<float>(scale)));
+    q = std::max(std::min(q, quant_max), quant_min);
+    expected_data[i] = static_cast<int8_t>(q);
+  }
+
+  Tensor input = tf.make({numel}, input_data);
+  Tensor out = tfo.zeros({numel});
+  Tensor expected = tfo.make({numel}, expected_data);
+  quantize_per_tensor_out(
+      input, scale, zero_point, quant_min, quant_max, ScalarType::Char, out);
+
+  EXPECT_TENSOR_EQ(out, expected);
+}
+
+TEST(OpQuantizeOutTest, QuantizePerChannelInnerAxis) {
+  TensorFactory<ScalarType::Float> tf_float;
+  TensorFactory<ScalarType::Double> tf_double;
+  TensorFactory<ScalarType::Long> tf_long;
+
+  // Channels along the middle dimension of a 3-D tensor, with rows longer
+  // than a vector.
+  constexpr int32_t outer = 2;
+  constexpr int32_t channels = 3;
+  constexpr int32_t inner = 19;
+  std::vector<float> input_data(outer * channels * inner);
+  for (size_t i = 0; i < input_data.size(); ++i) {
+    input_data[i] = static_cast<float>(i % 11) - 5.0f;
+  }
+  Tensor input = tf_float.make({outer, channels, inner}, input_data);
+  Tensor scale = tf_double.make({channels}, {0.5, 1, 2});
+  Tensor zero_point = tf_long.make({channels}, {10, 20, 30});
+  int64_t quant_min = 0;
+  int64_t quant_max = 255;
+
+  std::vector<uint8_t> expected_data(input_data.size());
+  for (size_t i = 0; i < input_data.size(); ++i) {
+    const int64_t c = (i / inner) % channels;
+    expected_data[i] = static_cast<uint8_t>(
+        zero_point.const_data_ptr<int64_t>()[c] +
+        std::nearbyint(
+            input_data[i] / scale.const_data_ptr<double>()[c]));
+  }
+
+  TensorFactory<ScalarType::Byte> tfo;
+  Tensor out = tfo.zeros({outer, channels, inner});
+  Tensor expected = tfo.make({outer, channels, inner}, expected_data);
+  quantize_per_channel_out(
+      input, scale, zero_point, 1, quant_min, quant_max, ScalarType::Byte, out);
+
+  EXPECT_TENSOR_EQ(out, expected);
+}
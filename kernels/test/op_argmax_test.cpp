@@ -15,6 +15,9 @@
 #include <executorch/runtime/core/exec_aten/util/scalar_type_util.h>
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <vector>
+
 using namespace ::testing;
 using exec_aten::ArrayRef;
 using exec_aten::optional;
@@ -108,3 +111,29 @@ TEST_F(OpArgmaxTest, SanityCheckNullDim) {
   EXPECT_TENSOR_EQ(out, expected);
   // clang-format on
 }
+
+TEST_F(OpArgmaxTest, LargeInnerAndOuterDims) {
+  TensorFactory<ScalarType::Float> tf_float;
+  TensorFactory<ScalarType::Long> tf_long;
+
+  // Column c has its maximum at row c % 5 and a tie at row 4, so the first
+  // occurrence must win. Column 299 also has a NaN, which wins over any value.
+  std::vector<float> data(5 * 300, 0);
+  std::vector<int64_t> expected_0(300);
+  for (int64_t c = 0; c < 300; ++c) {
+    data[(c % 5) * 300 + c] = 1;
+    data[4 * 300 + c] = 1;
+    expected_0[c] = c % 5;
+  }
+  data[3 * 300 + 299] = NAN;
+  expected_0[299] = 3;
+  Tensor in = tf_float.make({5, 300}, data);
+
+  Tensor out_0 = tf_long.zeros({300});
+  op_argmax_out(in, /*dim=*/0, /*keepdim=*/false, out_0);
+  EXPECT_TENSOR_EQ(out_0, tf_long.make({300}, expected_0));
+
+  Tensor out_1 = tf_long.zeros({5});
+  op_argmax_out(in, /*dim=*/1, /*keepdim=*/false, out_1);
+  EXPECT_TENSOR_EQ(out_1, tf_long.make({5}, {0, 1, 2, 299, 0}));
+}
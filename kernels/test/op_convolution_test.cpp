@@ -12,14 +12,18 @@
 #include <executorch/runtime/core/exec_aten/exec_aten.h>
 #include <executorch/runtime/core/exec_aten/testing_util/tensor_factory.h>
 #include <executorch/runtime/core/exec_aten/testing_util/tensor_util.h>
+#include <executorch/runtime/core/memory_allocator.h>
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 using namespace ::testing;
 using exec_aten::ArrayRef;
 using exec_aten::optional;
 using exec_aten::ScalarType;
 using exec_aten::Tensor;
+using executorch::runtime::MemoryAllocator;
 using torch::executor::testing::TensorFactory;
 
 class OpConvOutTest : public OperatorTest {
@@ -728,3 +732,95 @@ TEST_F(OpConvCorrectnessTest, InvalidOutputPadding) {
           groups,
           out));
 }
+
+TEST_F(OpConvCorrectnessTest, GroupedWithTempAllocator) {
+  // Kernels may unfold the input into scratch memory when the context
+  // provides a temp allocator, so check that path against a direct reference
+  // as well as the plain context.
+  TensorFactory<ScalarType::Float> tf;
+
+  constexpr int64_t N = 2, C = 6, H = 7, W = 9, OC = 4, G = 2, KH = 3, KW = 2;
+  constexpr int64_t SH = 2, SW = 1, PH = 1, PW = 2, DH = 2, DW = 1;
+  constexpr int64_t OH = (H + 2 * PH - DH * (KH - 1) - 1) / SH + 1;
+  constexpr int64_t OW = (W + 2 * PW - DW * (KW - 1) - 1) / SW + 1;
+  constexpr int64_t CG = C / G, OCG = OC / G;
+
+  std::vector<float> in_data(N * C * H * W);
+  for (size_t i = 0; i < in_data.size(); ++i) {
+    in_data[i] = static_cast<float>((i * 7) % 13) / 4 - 1.5f;
+  }
+  std::vector<float> w_data(OC * CG * KH * KW);
+  for (size_t i = 0; i < w_data.size(); ++i) {
+    w_data[i] = static_cast<float>((i * 5) % 11) / 8 - 0.5f;
+  }
+  std::vector<float> bias_data = {0.5, -1.0, 0.25, 2.0};
+
+  std::vector<float> expected_data(N * OC * OH * OW);
+  for (int64_t n = 0; n < N; ++n) {
+    for (int64_t oc = 0; oc < OC; ++oc) {
+      const int64_t g = oc / OCG;
+      for (int64_t oh = 0; oh < OH; ++oh) {
+        for (int64_t ow = 0; ow < OW; ++ow) {
+          float acc = bias_data[oc];
+          for (int64_t ic = 0; ic < CG; ++ic) {
+            for (int64_t kh = 0; kh < KH; ++kh) {
+              for (int64_t kw = 0; kw < KW; ++kw) {
+                const int64_t ih = oh * SH - PH + kh * DH;
+                const int64_t iw = ow * SW - PW + kw * DW;
+                if (ih < 0 || ih >= H || iw < 0 || iw >= W) {
+                  continue;
+                }
+                acc += in_data[((n * C + g * CG + ic) * H + ih) * W + iw] *
+                    w_data[((oc * CG + ic) * KH + kh) * KW + kw];
+              }
+            }
+          }
+          expected_data[((n * OC + oc) * OH + oh) * OW + ow] = acc;
+        }
+      }
+    }
+  }
+
+  Tensor input = tf.make({N, C, H, W}, in_data);
+  Tensor weight = tf.make({OC, CG, KH, KW}, w_data);
+  optional<Tensor> bias(tf.make({OC}, bias_data));
+  Tensor expected = tf.make({N, OC, OH, OW}, expected_data);
+
+  int64_t stride[] = {SH, SW};
+  int64_t padding[] = {PH, PW};
+  int64_t dilation[] = {DH, DW};
+  int64_t output_padding[] = {0};
+
+  Tensor out = tf.zeros({N, OC, OH, OW});
+  op_convolution_out(
+      input,
+      weight,
+      bias,
+      stride,
+      padding,
+      dilation,
+      false,
+      output_padding,
+      G,
+      out);
+  EXPECT_TENSOR_CLOSE(out, expected);
+
+  alignas(16) static uint8_t temp_buffer[16 * 1024];
+  MemoryAllocator temp_allocator(sizeof(temp_buffer), temp_buffer);
+  executorch::runtime::KernelRuntimeContext context(nullptr, &temp_allocator);
+  Tensor out_with_temp = tf.zeros({N, OC, OH, OW});
+  torch::executor::aten::convolution_outf(
+      context,
+      input,
+      weight,
+      bias,
+      stride,
+      padding,
+      dilation,
+      false,
+      output_padding,
+      G,
+      out_with_temp);
+  EXPECT_EQ(context.failure_state(), torch::executor::Error::Ok);
+  EXPECT_TENSOR_CLOSE(out_with_temp, expected);
+}
@@ -28,6 +28,71 @@ class OpPermuteCopyTest : public OperatorTest {
   op_permute_copy_out(const Tensor& self, IntArrayRef dims, Tensor& out) {
     return torch::executor::aten::permute_copy_outf(context_, self, dims, out);
   }
+
+  // Checks a permute of a tensor large enough to span several blocks of the
+  // copy against the definition out[i_0, ..., i_n] = in[i_perm^-1(0), ...].
+  template <ScalarType DTYPE>
+  void test_large_permute(
+      const std::vector<int32_t>& sizes,
+      const std::vector<int64_t>& perm) {
+    TensorFactory<DTYPE> tf;
+    using CTYPE = typename TensorFactory<DTYPE>::ctype;
+
+    const size_t ndim = sizes.size();
+    int64_t numel = 1;
+    for (int32_t size : sizes) {
+      numel *= size;
+    }
+    std::vector<CTYPE> in_data(numel);
+    for (int64_t i = 0; i < numel; ++i) {
+      in_data[i] = static_cast<CTYPE>(i % 251);
+    }
+
+    std::vector<int32_t> out_sizes(ndim);
+    std::vector<int64_t> in_strides(ndim, 1);
+    for (size_t d = 0; d < ndim; ++d) {
+      out_sizes[d] = sizes[perm[d]];
+    }
+    for (size_t d = ndim - 1; d > 0; --d) {
+      in_strides[d - 1] = in_strides[d] * sizes[d];
+    }
+    std::vector<CTYPE> expected_data(numel);
+    std::vector<int64_t> index(ndim, 0);
+    for (int64_t i = 0; i < numel; ++i) {
+      int64_t in_offset = 0;
+      for (size_t d = 0; d < ndim; ++d) {
+        in_offset += index[d] * in_strides[perm[d]];
+      }
+      expected_data[i] = in_data[in_offset];
+      for (size_t d = ndim; d > 0; --d) {
+        if (++index[d - 1] < out_sizes[d - 1]) {
+          break;
+        }
+        index[d - 1] = 0;
+      }
+    }
+
+    Tensor in = tf.make(sizes, in_data);
+    Tensor out = tf.zeros(out_sizes);
+    op_permute_copy_out(in, ArrayRef<int64_t>(perm.data(), perm.size()), out);
+    EXPECT_TENSOR_EQ(out, tf.make(out_sizes, expected_data));
+  }
+
+  template <ScalarType DTYPE>
+  void test_large_permutes() {
+    // NCHW -> NHWC and back, with a channel count that is not a multiple of
+    // any vector width.
+    test_large_permute<DTYPE>({2, 3, 37, 19}, {0, 2, 3, 1});
+    test_large_permute<DTYPE>({2, 37, 19, 3}, {0, 3, 1, 2});
+    // [B, S, H, D] -> [B, H, S, D], which moves whole rows.
+    test_large_permute<DTYPE>({2, 33, 4, 16}, {0, 2, 1, 3});
+    // Plain and batched matrix transposes.
+    test_large_permute<DTYPE>({67, 45}, {1, 0});
+    test_large_permute<DTYPE>({3, 40, 72}, {0, 2, 1});
+    // No dimension keeps its place.
+    test_large_permute<DTYPE>({5, 7, 9, 11}, {3, 2, 1, 0});
+    test_large_permute<DTYPE>({6, 1, 10, 1, 12}, {2, 4, 3, 0, 1});
+  }
 };
 
 TEST_F(OpPermuteCopyTest, OneDPermute) {
@@ -474,3 +539,10 @@ TEST_F(OpPermuteCopyTest, DynamicShapeUnbound) {
   op_permute_copy_out(x, perm_aref, out);
   EXPECT_TENSOR_EQ(out, expected);
 }
+
+TEST_F(OpPermuteCopyTest, LargePermutesAllElementSizes) {
+  test_large_permutes<ScalarType::Byte>();
+  test_large_permutes<ScalarType::Half>();
+  test_large_permutes<ScalarType::Float>();
+  test_large_permutes<ScalarType::Double>();
+}
@@ -319,3 +319,18 @@ TEST_F(OpSoftmaxOutTest, DynamicShapeUnbound) {
   Tensor ret = op_softmax_out(x, 1, false, out);
   EXPECT_TENSOR_CLOSE(out, expected_result);
 }
+
+TEST_F(OpSoftmaxOutTest, LargeInnerAndOuterDims) {
+  TensorFactory<ScalarType::Float> tf;
+  // Large enough that softmax over either dim spans several vectors and
+  // several blocks of the other dim.
+  Tensor x = tf.full({4, 300}, 7);
+
+  Tensor out_0 = tf.zeros({4, 300});
+  op_softmax_out(x, /*dim=*/0, /*half_to_float=*/false, out_0);
+  EXPECT_TENSOR_CLOSE(out_0, tf.full({4, 300}, 0.25));
+
+  Tensor out_1 = tf.zeros({4, 300});
+  op_softmax_out(x, /*dim=*/1, /*half_to_float=*/false, out_1);
+  EXPECT_TENSOR_CLOSE(out_1, tf.full({4, 300}, 1.0 / 300));
+}
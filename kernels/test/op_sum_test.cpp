@@ -401,3 +401,23 @@ TEST_F(OpSumOutTest, InfinityAndNANTest) {
     }));
   // clang-format on
 }
+
+TEST_F(OpSumOutTest, LargeInnerAndOuterDims) {
+  TensorFactory<ScalarType::Float> tf_float;
+  // Large enough that reductions over either dim span several vectors and
+  // several blocks of the non-reduced dim.
+  Tensor self = tf_float.ones({3, 600});
+  optional<ScalarType> dtype;
+
+  int64_t dim_0[1] = {0};
+  Tensor out_0 = tf_float.zeros({1, 600});
+  op_sum_intlist_out(
+      self, ArrayRef<int64_t>{dim_0, 1}, /*keepdim=*/true, dtype, out_0);
+  EXPECT_TENSOR_CLOSE(out_0, tf_float.full({1, 600}, 3));
+
+  int64_t dim_1[1] = {1};
+  Tensor out_1 = tf_float.zeros({3});
+  op_sum_intlist_out(
+      self, ArrayRef<int64_t>{dim_1, 1}, /*keepdim=*/false, dtype, out_1);
+  EXPECT_TENSOR_CLOSE(out_1, tf_float.full({3}, 600));
+}
@@ -232,3 +232,31 @@ TEST_F(OpTransposeIntCopyTest, DynamicShapeUnbound) {
   op_transpose_copy_int_out(x, 0, 2, out);
   EXPECT_TENSOR_EQ(out, expected);
 }
+
+TEST_F(OpTransposeIntCopyTest, LargeTranspose) {
+  TensorFactory<ScalarType::Float> tf;
+
+  // Large enough to span several tiles, and not a multiple of any vector
+  // width.
+  const int32_t batch = 3;
+  const int32_t rows = 41;
+  const int32_t cols = 70;
+  std::vector<float> in_data(batch * rows * cols);
+  for (size_t i = 0; i < in_data.size(); ++i) {
+    in_data[i] = static_cast<float>(i);
+  }
+  std::vector<float> expected_data(in_data.size());
+  for (int32_t b = 0; b < batch; ++b) {
+    for (int32_t r = 0; r < rows; ++r) {
+      for (int32_t c = 0; c < cols; ++c) {
+        expected_data[(b * cols + c) * rows + r] =
+            in_data[(b * rows + r) * cols + c];
+      }
+    }
+  }
+
+  Tensor in = tf.make({batch, rows, cols}, in_data);
+  Tensor out = tf.zeros({batch, cols, rows});
+  op_transpose_copy_int_out(in, -1, 1, out);
+  EXPECT_TENSOR_EQ(out, tf.make({batch, cols, rows}, expected_data));
+}
@@ -180,11 +180,11 @@ def define_common_targets():
     _common_op_test("op_add_test", ["aten", "portable", "optimized"])
     _common_op_test("op_addmm_test", ["aten", "portable"])
     _common_op_test("op_alias_copy_test", ["aten", "portable"])
-    _common_op_test("op_amax_test", ["aten", "portable"])
-    _common_op_test("op_amin_test", ["aten", "portable"])
+    _common_op_test("op_amax_test", ["aten", "portable", "optimized"])
+    _common_op_test("op_amin_test", ["aten", "portable", "optimized"])
     _common_op_test("op_any_test", ["aten", "portable"])
     _common_op_test("op_arange_test", ["aten", "portable"])
-    _common_op_test("op_argmax_test", ["aten", "portable"])
+    _common_op_test("op_argmax_test", ["aten", "portable", "optimized"])
     _common_op_test("op_argmin_test", ["aten", "portable"])
     _common_op_test("op_as_strided_copy_test", ["aten", "portable"])
     _common_op_test("op_asin_test", ["aten", "portable"])
@@ -204,7 +204,7 @@ def define_common_targets():
     _common_op_test("op_clamp_test", ["aten", "portable"])
     _common_op_test("op_clone_test", ["aten", "portable"])
     _common_op_test("op_constant_pad_nd_test", ["aten", "portable"])
-    _common_op_test("op_convolution_test", ["aten", "portable"])
+    _common_op_test("op_convolution_test", ["aten", "portable", "optimized"])
     _common_op_test("op_convolution_backward_test", ["aten", "portable"])
     _common_op_test("op_copy_test", ["aten", "portable"])
     _common_op_test("op_cos_test", ["aten", "portable"])
@@ -259,7 +259,7 @@ def define_common_targets():
     _common_op_test("op_max_test", ["aten", "portable"])
     _common_op_test("op_max_pool2d_with_indices_test", ["aten", "portable"])
     _common_op_test("op_maximum_test", ["aten", "portable"])
-    _common_op_test("op_mean_test", ["aten", "portable"])
+    _common_op_test("op_mean_test", ["aten", "portable", "optimized"])
     _common_op_test("op_min_test", ["aten", "portable"])
     _common_op_test("op_minimum_test", ["aten", "portable"])
     _common_op_test("op_mm_test", ["aten", "portable", "optimized"])
@@ -273,7 +273,7 @@ def define_common_targets():
     _common_op_test("op_nonzero_test", ["aten", "portable"])
     _common_op_test("op_ones_test", ["aten", "portable"])
     _common_op_test("op_pdist_forward_test", ["aten", "portable"])
-    _common_op_test("op_permute_copy_test", ["aten", "portable"])
+    _common_op_test("op_permute_copy_test", ["aten", "portable", "optimized"])
     _common_op_test("op_pixel_shuffle_test", ["aten", "portable"])
     _common_op_test("op_pixel_unshuffle_test", ["aten", "portable"])
     _common_op_test("op_pow_test", ["aten", "portable"])
@@ -303,25 +303,25 @@ def define_common_targets():
     _common_op_test("op_sinh_test", ["aten", "portable"])
     _common_op_test("op_slice_scatter_test", ["aten", "portable"])
     _common_op_test("op_slice_copy_test", ["aten", "portable"])
-    _common_op_test("op_softmax_test", ["aten", "portable"])
+    _common_op_test("op_softmax_test", ["aten", "portable", "optimized"])
     _common_op_test("op_split_copy_test", ["aten", "portable"])
     _common_op_test("op_split_with_sizes_copy_test", ["aten", "portable"])
     _common_op_test("op_sqrt_test", ["aten", "portable"])
     _common_op_test("op_squeeze_copy_test", ["aten", "portable"])
     _common_op_test("op_stack_test", ["aten", "portable"])
     _common_op_test("op_sub_test", ["aten", "portable", "optimized"])
-    _common_op_test("op_sum_test", ["aten", "portable"])
+    _common_op_test("op_sum_test", ["aten", "portable", "optimized"])
     _common_op_test("op_t_copy_test", ["aten", "portable"])
     _common_op_test("op_tan_test", ["aten", "portable"])
     _common_op_test("op_tanh_test", ["aten", "portable"])
     _common_op_test("op_to_copy_test", ["aten", "portable"])
     _common_op_test("op_topk_test", ["aten", "portable"])
-    _common_op_test("op_transpose_copy_test", ["aten", "portable"])
+    _common_op_test("op_transpose_copy_test", ["aten", "portable", "optimized"])
     _common_op_test("op_tril_test", ["aten", "portable"])
     _common_op_test("op_trunc_test", ["aten", "portable"])
     _common_op_test("op_unbind_copy_test", ["aten", "portable"])
     _common_op_test("op_unsqueeze_copy_test", ["aten", "portable"])
-    _common_op_test("op_var_test", ["aten", "portable"])
+    _common_op_test("op_var_test", ["aten", "portable", "optimized"])
     _common_op_test("op_view_copy_test", ["aten", "portable"])
     _common_op_test("op_where_test", ["aten", "portable"])
     _common_op_test("op_zeros_test", ["aten", "portable"])
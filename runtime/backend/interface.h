@@ -108,6 +108,71 @@ class BackendInterface {
    *     `init()`.
    */
   virtual void destroy(ET_UNUSED DelegateHandle* handle) const {}
+
+  /**
+   * Optional. Returns the number of bytes that `serialize()` needs to write the
+   * initialized state of `handle`. Backends whose `init()` does expensive work,
+   * like compiling a graph for the target device, can implement this along
+   * with `serialize()` and `deserialize()` so that the state can be saved and
+   * restored by a later process instead of being rebuilt.
+   *
+   * The runtime does not call these hooks yet.
+   *
+   * @param[in] handle An opaque handle returned by `init()` or
+   *     `deserialize()`.
+   *
+   * @retval Error::NotSupported if the backend cannot serialize its state.
+   */
+  ET_NODISCARD virtual Result<size_t> get_serialized_size(
+      ET_UNUSED DelegateHandle* handle) const {
+    return Error::NotSupported;
+  }
+
+  /**
+   * Optional. Writes the initialized state of `handle` to `buffer`.
+   *
+   * @param[in] handle An opaque handle returned by `init()` or
+   *     `deserialize()`.
+   * @param[out] buffer The buffer to write to. Aligned to at least 16 bytes.
+   * @param[in] size The size of `buffer`, as returned by
+   *     `get_serialized_size()`.
+   *
+   * @retval Error::Ok if the whole state was written.
+   * @retval Error::NotSupported if the backend cannot serialize its state.
+   */
+  ET_NODISCARD virtual Error serialize(
+      ET_UNUSED DelegateHandle* handle,
+      ET_UNUSED void* buffer,
+      ET_UNUSED size_t size) const {
+    return Error::NotSupported;
+  }
+
+  /**
+   * Optional. Creates a handle from state previously written by `serialize()`,
+   * instead of calling `init()`. Only called with state that was serialized
+   * from the same `processed` data and `compile_specs`, but possibly by a
+   * different process or an older version of the backend; the backend should
+   * check that it understands the state and return an error if it does not,
+   * in which case the caller falls back to `init()`.
+   *
+   * @param[in] processed The same data that would be passed to `init()`. Must
+   *     not be freed unless deserialization succeeds.
+   * @param[in] compile_specs The same compile specs that would be passed to
+   *     `init()`.
+   * @param[in] serialized The state written by `serialize()`. The backend may
+   *     point its handle into this data, which then stays valid until the
+   *     handle is destroyed. Calling serialized->Free() can reclaim its memory
+   *     if it is not needed after deserialization.
+   *
+   * @returns On success, an opaque handle like the one `init()` returns.
+   */
+  ET_NODISCARD virtual Result<DelegateHandle*> deserialize(
+      ET_UNUSED BackendInitContext& context,
+      ET_UNUSED FreeableBuffer* processed,
+      ET_UNUSED ArrayRef<CompileSpec> compile_specs,
+      ET_UNUSED FreeableBuffer* serialized) const {
+    return Error::NotSupported;
+  }
 };
 
 /**
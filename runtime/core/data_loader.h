@@ -9,6 +9,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
 #include <executorch/runtime/core/freeable_buffer.h>
 #include <executorch/runtime/core/result.h>
@@ -48,6 +49,10 @@ class DataLoader {
        * Data used for initializing mutable tensors.
        */
       Mutable,
+      /**
+       * Data stored outside of the program, such as weights in a .ptd file.
+       */
+      External,
     };
 
     /// Type of the segment.
@@ -58,10 +63,39 @@ class DataLoader {
     size_t segment_index;
 
     /// An optional, null-terminated string describing the segment. For
-    /// `Backend` segments, this is the backend ID. Null for other segment
+    /// `Backend` segments, this is the backend ID. For `External` segments,
+    /// this is the name of the tensor being loaded. Null for other segment
     /// types.
     const char* descriptor;
 
+    /**
+     * Describes how a segment is compressed. The data is split into chunks
+     * that are compressed independently and stored back to back.
+     */
+    struct Compression {
+      enum class Codec : uint8_t {
+        /// Each chunk is an LZ4 block, or is stored as-is if its compressed
+        /// size equals its uncompressed size.
+        LZ4 = 1,
+      };
+
+      Codec codec;
+      /// The size of the segment data after decompression.
+      size_t uncompressed_size;
+      /// The uncompressed size of each chunk except the last, which may be
+      /// smaller.
+      size_t chunk_size;
+      /// The compressed size of each chunk, in order.
+      const uint64_t* compressed_chunk_sizes;
+      size_t num_chunks;
+    };
+
+    /// How the segment is compressed, or null if it is not. The offset and
+    /// size passed to `load()` then cover the compressed data. Loaders that
+    /// ignore this field return the compressed data, which a Program rejects;
+    /// see DecompressingDataLoader.
+    const Compression* compression = nullptr;
+
     SegmentInfo() = default;
 
     explicit SegmentInfo(
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace executorch {
+namespace runtime {
+
+/**
+ * Provides storage for tensors with TensorShapeDynamism::DYNAMIC_UNBOUND.
+ *
+ * The memory planner does not reserve space for unbounded tensors. Instead, a
+ * resize that needs more elements than the tensor's storage can hold asks the
+ * tensor's DynamicTensorAllocator for a larger buffer, and the tensor gives
+ * its previous buffer back with release(). A Method also releases the storage
+ * of an unbounded tensor when the tensor's lifetime ends during execution, so
+ * an allocator that caches released buffers lets later tensors, and later
+ * executions, reuse them.
+ *
+ * Implementations do not need to be thread-safe unless the Methods that use
+ * them execute concurrently.
+ */
+class DynamicTensorAllocator {
+ public:
+  /// Alignment of the buffers returned by allocate().
+  static constexpr size_t kAlignment = 64;
+
+  virtual ~DynamicTensorAllocator() = default;
+
+  /**
+   * Returns a buffer of at least `size` bytes, aligned to kAlignment, or
+   * nullptr on failure.
+   */
+  virtual void* allocate(size_t size) = 0;
+
+  /**
+   * Gives back a buffer previously returned by allocate().
+   *
+   * @param[in] ptr The buffer to release.
+   * @param[in] size The size that was passed to allocate() for `ptr`.
+   */
+  virtual void release(void* ptr, size_t size) = 0;
+};
+
+} // namespace runtime
+} // namespace executorch
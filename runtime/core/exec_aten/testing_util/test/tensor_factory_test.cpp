@@ -70,7 +70,8 @@ void resize_tensor_to_assert_dynamic_unbound(Tensor&& t) {
 #ifdef USE_ATEN_LIB
   EXPECT_EQ(resize_tensor(t, ArrayRef<SizesType>({100, 100})), Error::Ok);
 #else
-  // TODO(T175194371): For now, we can't resize past the original capacity.
+  // TensorFactory tensors have no DynamicTensorAllocator, so they can't grow
+  // past their original capacity.
   EXPECT_NE(resize_tensor(t, ArrayRef<SizesType>({100, 100})), Error::Ok);
 #endif
 }
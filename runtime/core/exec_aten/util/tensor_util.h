@@ -1142,7 +1142,8 @@ ET_NODISCARD Error set_tensor_data(
     size_t buffer_size);
 
 /**
- * Reset tensor's data_ptr, clear all the storage for at::Tensor.
+ * Reset tensor's data_ptr, clear all the storage for at::Tensor. Storage that
+ * an ETensor got from its DynamicTensorAllocator is released to it.
  */
 void reset_data_ptr(const executorch::aten::Tensor& tensor);
 
@@ -1156,9 +1157,9 @@ ET_NODISCARD Error resize_tensor_impl(
 } // namespace internal
 
 /**
- * Resize a tensor to new_sizes, rank must stay the same. Currently does not
- * expand the tensor if new size exceeds the current capacity. Currently
- * fails an ET_CHECK if the tensor cannot be resized.
+ * Resize a tensor to new_sizes, rank must stay the same. Only expands the
+ * tensor beyond its current capacity if it is DYNAMIC_UNBOUND and has a
+ * DynamicTensorAllocator. Returns an error if the tensor cannot be resized.
  *
  * WARNING: Placeholder API until discussion around runtime context is
  * settled, will likely move to be a class method on a TensorResizer object
@@ -1171,9 +1172,9 @@ ET_NODISCARD inline Error resize_tensor(
 }
 
 /**
- * Resize a tensor to new_sizes, rank must stay the same. Currently does not
- * expand the tensor if new size exceeds the current capacity. Currently
- * fails an ET_CHECK if the tensor cannot be resized.
+ * Resize a tensor to new_sizes, rank must stay the same. Only expands the
+ * tensor beyond its current capacity if it is DYNAMIC_UNBOUND and has a
+ * DynamicTensorAllocator. Returns an error if the tensor cannot be resized.
  *
  * WARNING: Placeholder API until discussion around runtime context is
  * settled, will likely move to be a class method on a TensorResizer object
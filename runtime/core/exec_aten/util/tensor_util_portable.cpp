@@ -191,7 +191,8 @@ ET_NODISCARD Error set_tensor_data(
 }
 
 void reset_data_ptr(const torch::executor::Tensor& tensor) {
-  // Lean mode doesn't deallocate the tensor data_ptr in the allocator
+  // Lean mode doesn't deallocate the tensor data_ptr in the allocator, except
+  // for storage that an unbounded tensor got from its DynamicTensorAllocator.
   tensor.unsafeGetTensorImpl()->set_data(nullptr);
 }
 
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <executorch/runtime/core/error.h>
+#include <executorch/runtime/core/freeable_buffer.h>
+#include <executorch/runtime/core/result.h>
+#include <executorch/runtime/core/tensor_layout.h>
+#include <executorch/runtime/platform/compiler.h>
+
+namespace executorch {
+namespace runtime {
+
+/**
+ * Interface to access data stored outside of a Program, keyed by name.
+ *
+ * A Program can leave the data of its constant tensors to a NamedDataMap,
+ * referring to each tensor by its fully qualified name (e.g.
+ * "mod.linear.weight"). This lets several programs share the same weights,
+ * while each ships only its own program file.
+ *
+ * Implementations must be safe to use from several Methods at once.
+ */
+class NamedDataMap {
+ public:
+  virtual ~NamedDataMap() = default;
+
+  /**
+   * Returns the layout of the tensor stored under `key`.
+   *
+   * @param[in] key The name of the tensor.
+   *
+   * @retval Error::NotFound There is no tensor named `key`.
+   */
+  ET_NODISCARD virtual Result<TensorLayout> get_metadata(
+      const char* key) const = 0;
+
+  /**
+   * Returns the data of the tensor stored under `key`. The returned buffer
+   * may point into memory shared with other callers, and must not be
+   * modified.
+   *
+   * @param[in] key The name of the tensor.
+   *
+   * @retval Error::NotFound There is no tensor named `key`.
+   */
+  ET_NODISCARD virtual Result<FreeableBuffer> get_data(
+      const char* key) const = 0;
+
+  /**
+   * Copies the data of the tensor stored under `key` into `buffer`.
+   *
+   * @param[in] key The name of the tensor.
+   * @param[in] buffer The buffer to copy into.
+   * @param[in] size The size of `buffer` in bytes. Must be at least the size
+   *     of the tensor's data.
+   *
+   * @retval Error::NotFound There is no tensor named `key`.
+   * @retval Error::InvalidArgument `buffer` is too small.
+   */
+  ET_NODISCARD virtual Error
+  load_data_into(const char* key, void* buffer, size_t size) const = 0;
+
+  /// Returns the number of keys in the map.
+  ET_NODISCARD virtual Result<size_t> get_num_keys() const = 0;
+
+  /**
+   * Returns the key at `index`, which must be less than get_num_keys(). The
+   * returned string lives as long as the map.
+   */
+  ET_NODISCARD virtual Result<const char*> get_key(size_t index) const = 0;
+};
+
+} // namespace runtime
+} // namespace executorch
@@ -31,6 +31,7 @@ def define_common_targets():
         exported_deps = [
             ":scalar_type",
             "//executorch/runtime/core:core",
+            "//executorch/runtime/core:dynamic_tensor_allocator",
             "//executorch/runtime/core:tensor_shape_dynamism",
             "//executorch/runtime/core/exec_aten/util:scalar_type_util",
             "//executorch/runtime/core/exec_aten/util:dim_order_util",
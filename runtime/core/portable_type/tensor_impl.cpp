@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 
 #include <executorch/runtime/core/exec_aten/util/dim_order_util.h>
 #include <executorch/runtime/core/exec_aten/util/scalar_type_util.h>
@@ -54,7 +55,11 @@ TensorImpl::TensorImpl(
       data_(data),
       dim_(dim),
       numel_(compute_numel(sizes, dim)),
-      numel_bound_(numel_),
+      // An unbounded tensor without storage can't hold any elements yet.
+      numel_bound_(
+          dynamism == TensorShapeDynamism::DYNAMIC_UNBOUND && data == nullptr
+              ? 0
+              : numel_),
       type_(type),
       shape_dynamism_(dynamism) {
   ET_CHECK_MSG(
@@ -71,6 +76,50 @@ ssize_t TensorImpl::element_size() const {
   return elementSize(type_);
 }
 
+void TensorImpl::set_data(void* ptr) {
+  if (ptr == data_) {
+    return;
+  }
+  if (owns_data_) {
+    dynamic_allocator_->release(data_, numel_bound_ * elementSize(type_));
+    owns_data_ = false;
+  }
+  data_ = ptr;
+  if (shape_dynamism_ == TensorShapeDynamism::DYNAMIC_UNBOUND) {
+    // All we know about a buffer from elsewhere is that it fits the current
+    // shape.
+    numel_bound_ = ptr == nullptr ? 0 : numel_;
+  }
+}
+
+void TensorImpl::set_data(void* ptr, size_t nbytes) {
+  set_data(ptr);
+  // Storage from dynamic_allocator_ must keep the capacity it was allocated
+  // with, so that it is released with the right size.
+  if (shape_dynamism_ != TensorShapeDynamism::STATIC && !owns_data_) {
+    numel_bound_ = nbytes / elementSize(type_);
+  }
+}
+
+Error TensorImpl::grow_storage(size_t new_numel) {
+  const size_t new_nbytes = new_numel * elementSize(type_);
+  void* new_data = dynamic_allocator_->allocate(new_nbytes);
+  ET_CHECK_OR_RETURN_ERROR(
+      new_data != nullptr,
+      MemoryAllocationFailed,
+      "Failed to allocate %zu bytes for an unbounded tensor",
+      new_nbytes);
+  // Growing a bounded tensor leaves its data in place, so keep the current
+  // contents here too.
+  if (data_ != nullptr) {
+    std::memcpy(new_data, data_, nbytes());
+  }
+  set_data(new_data);
+  owns_data_ = true;
+  numel_bound_ = new_numel;
+  return Error::Ok;
+}
+
 Error TensorImpl::internal_resize_contiguous(ArrayRef<SizesType> new_sizes) {
   ET_CHECK_OR_RETURN_ERROR(
       new_sizes.size() == dim_,
@@ -98,16 +147,26 @@ Error TensorImpl::internal_resize_contiguous(ArrayRef<SizesType> new_sizes) {
           "Attempted to resize a static tensor");
       break;
     case TensorShapeDynamism::DYNAMIC_BOUND:
-      // TODO(T175194371): Unbounded dynamic tensor resizing is not yet
-      // supported: treat them as upper-bounded.
     case TensorShapeDynamism::DYNAMIC_UNBOUND: {
       const auto new_numel = compute_numel(new_sizes.data(), dim_);
+      if (new_numel > numel_bound_ &&
+          shape_dynamism_ == TensorShapeDynamism::DYNAMIC_UNBOUND) {
+        if (dynamic_allocator_ != nullptr) {
+          Error err = grow_storage(new_numel);
+          if (err != Error::Ok) {
+            return err;
+          }
+        } else if (data_ == nullptr) {
+          // No storage to outgrow; see set_dynamic_allocator().
+          numel_bound_ = new_numel;
+        }
+      }
       ET_CHECK_OR_RETURN_ERROR(
           new_numel <= numel_bound_,
           NotSupported,
           "Attempted to resize a bounded tensor with capacity of %zu elements to %zu elements.",
-          new_numel,
-          numel_bound_);
+          numel_bound_,
+          new_numel);
 
       if (strides_ && dim_order_) {
         auto error =
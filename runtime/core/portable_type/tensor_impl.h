@@ -9,6 +9,7 @@
 #pragma once
 
 #include <executorch/runtime/core/array_ref.h>
+#include <executorch/runtime/core/dynamic_tensor_allocator.h>
 #include <executorch/runtime/core/error.h>
 #include <executorch/runtime/core/portable_type/scalar_type.h>
 #include <executorch/runtime/core/tensor_shape_dynamism.h>
@@ -198,9 +199,45 @@ class TensorImpl {
     return data_;
   }
 
-  /// Sets the underlying data blob to the passed in pointer.
-  void set_data(void* ptr) {
-    data_ = ptr;
+  /**
+   * Sets the underlying data blob to the passed in pointer.
+   *
+   * If the tensor's storage came from its DynamicTensorAllocator, that storage
+   * is released first. For a DYNAMIC_UNBOUND tensor, `ptr` becomes the
+   * tensor's capacity: it must hold the tensor's current shape, and resizing
+   * the tensor to more elements allocates new storage.
+   */
+  void set_data(void* ptr);
+
+  /**
+   * Like set_data(ptr), but for a buffer of `nbytes` bytes: resizing a
+   * DYNAMIC_BOUND or DYNAMIC_UNBOUND tensor to more elements than fit in it
+   * fails, or for a DYNAMIC_UNBOUND tensor with a dynamic allocator, moves it
+   * to new storage. Used to move tensors between buffers of different sizes,
+   * like the slots of different memory plans.
+   *
+   * The current shape may need more than `nbytes`, as long as the tensor is
+   * resized to fit before its data is used.
+   */
+  void set_data(void* ptr, size_t nbytes);
+
+  /**
+   * Sets the allocator that a DYNAMIC_UNBOUND tensor gets new storage from
+   * when it is resized beyond its capacity. Without one, such a resize fails
+   * as it does for DYNAMIC_BOUND tensors, unless the tensor has no storage at
+   * all, in which case whoever later provides it must size it for the new
+   * shape.
+   *
+   * `allocator` must outlive the tensor's storage; set_data(nullptr) releases
+   * it. Has no effect on tensors of other dynamism.
+   */
+  void set_dynamic_allocator(DynamicTensorAllocator* allocator) {
+    dynamic_allocator_ = allocator;
+  }
+
+  /// Returns the allocator set with set_dynamic_allocator(), if any.
+  DynamicTensorAllocator* dynamic_allocator() const {
+    return dynamic_allocator_;
   }
 
   /*
@@ -231,6 +268,10 @@ class TensorImpl {
    */
   ET_NODISCARD Error internal_resize_contiguous(ArrayRef<SizesType> new_sizes);
 
+  /// Replaces the storage of a DYNAMIC_UNBOUND tensor with a buffer from
+  /// dynamic_allocator_ that holds `new_numel` elements.
+  ET_NODISCARD Error grow_storage(size_t new_numel);
+
  private:
   // Keep fields arranged to avoid unnecessary alignment holes.
 
@@ -246,6 +287,9 @@ class TensorImpl {
   /// Pointer to underlying data blob. NOTE: Can be null.
   void* data_;
 
+  /// Where a DYNAMIC_UNBOUND tensor gets storage when it outgrows data_.
+  DynamicTensorAllocator* dynamic_allocator_ = nullptr;
+
   /// Tensor's number of dimensions.
   const ssize_t dim_;
 
@@ -253,7 +297,8 @@ class TensorImpl {
   ssize_t numel_;
 
   /// Maximum number of elements in the bounded tensor. Used when resizing up
-  /// and down.
+  /// and down. For DYNAMIC_UNBOUND tensors, the number of elements data_ can
+  /// hold.
   size_t numel_bound_;
 
   /// Scalar type (int, float, bool, etc) of the tensor data.
@@ -261,6 +306,9 @@ class TensorImpl {
 
   /// Specifies the mutability of the shape of the tensor.
   const TensorShapeDynamism shape_dynamism_;
+
+  /// True if data_ came from dynamic_allocator_ and must be released to it.
+  bool owns_data_ = false;
 };
 
 /**
@@ -194,6 +194,43 @@ TEST_F(TensorImplTest, TestSetSizesContigUpperBounded) {
   EXPECT_NE(err, Error::Ok);
 }
 
+TEST_F(TensorImplTest, TestSetDataWithNbytesUpperBounded) {
+  SizesType sizes[2] = {3, 2};
+  DimOrderType dim_order[2] = {0, 1};
+  StridesType strides[2] = {2, 1};
+  float data[6] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+  TensorImpl t(
+      ScalarType::Float,
+      2,
+      sizes,
+      data,
+      dim_order,
+      strides,
+      TensorShapeDynamism::DYNAMIC_BOUND);
+
+  // Move to a buffer that holds only 2 elements. The shape may stay larger
+  // until the tensor is resized.
+  float small_data[2];
+  t.set_data(small_data, sizeof(small_data));
+  EXPECT_EQ(t.data(), small_data);
+  EXPECT_EQ(t.numel(), 6);
+
+  SizesType new_sizes_1[2] = {1, 2};
+  Error err = resize_tensor_impl(&t, {new_sizes_1, 2});
+  EXPECT_EQ(err, Error::Ok);
+
+  SizesType new_sizes_2[2] = {2, 2};
+  // Can't exceed the new buffer
+  err = resize_tensor_impl(&t, {new_sizes_2, 2});
+  EXPECT_NE(err, Error::Ok);
+
+  // Moving back to the original buffer restores its capacity
+  t.set_data(data, sizeof(data));
+  SizesType new_sizes_3[2] = {3, 2};
+  err = resize_tensor_impl(&t, {new_sizes_3, 2});
+  EXPECT_EQ(err, Error::Ok);
+}
+
 TEST_F(TensorImplTest, TestZeroDimSetEmptySizesContig) {
   SizesType sizes[0] = {};
   DimOrderType dim_order[0] = {};
@@ -261,15 +298,40 @@ TEST_F(TensorImplTest, TestSetSizesContigUnbounded) {
   err = resize_tensor_impl(&t, {new_sizes_4, 1});
   EXPECT_NE(err, Error::Ok);
 
-  // TODO(T175194371): For now, we can't resize past the original capacity.
-  // Once we can, this test should check for that ability.
-
   SizesType new_sizes_3[2] = {4, 2};
-  // Can't execeed original capacity.
+  // Can't execeed original capacity without a DynamicTensorAllocator.
   err = resize_tensor_impl(&t, {new_sizes_3, 2});
   EXPECT_NE(err, Error::Ok);
 }
 
+TEST_F(TensorImplTest, TestSetSizesContigUnboundedNoStorage) {
+  SizesType sizes[2] = {3, 2};
+  DimOrderType dim_order[2] = {0, 1};
+  StridesType strides[2] = {2, 1};
+  TensorImpl t(
+      ScalarType::Float,
+      2,
+      sizes,
+      nullptr,
+      dim_order,
+      strides,
+      TensorShapeDynamism::DYNAMIC_UNBOUND);
+
+  // Without storage there is no capacity to exceed.
+  SizesType new_sizes[2] = {30, 20};
+  Error err = resize_tensor_impl(&t, {new_sizes, 2});
+  EXPECT_EQ(err, Error::Ok);
+  EXPECT_EQ(t.numel(), 600);
+  EXPECT_EQ(t.strides()[0], 20);
+
+  // Storage set afterwards must fit the shape at that point, and bounds it.
+  float data[600];
+  t.set_data(data);
+  SizesType larger_sizes[2] = {31, 20};
+  err = resize_tensor_impl(&t, {larger_sizes, 2});
+  EXPECT_NE(err, Error::Ok);
+}
+
 TEST_F(TensorImplTest, TestDynamicTensorNoStridesDimOrder) {
   SizesType sizes[3] = {2, 3, 4};
   float data[24] = {0};
@@ -55,6 +55,17 @@ def define_common_targets():
         ],
     )
 
+    runtime.cxx_library(
+        name = "dynamic_tensor_allocator",
+        exported_headers = [
+            "dynamic_tensor_allocator.h",
+        ],
+        visibility = [
+            "//executorch/...",
+            "@EXECUTORCH_CLIENTS",
+        ],
+    )
+
     runtime.cxx_library(
         name = "memory_allocator",
         exported_headers = [
@@ -89,6 +100,40 @@ def define_common_targets():
             ],
         )
 
+        runtime.cxx_library(
+            name = "tensor_layout" + aten_suffix,
+            exported_headers = [
+                "tensor_layout.h",
+            ],
+            srcs = ["tensor_layout.cpp"],
+            visibility = [
+                "//executorch/...",
+                "@EXECUTORCH_CLIENTS",
+            ],
+            exported_deps = [
+                ":core",
+                "//executorch/runtime/core/exec_aten:lib" + aten_suffix,
+            ],
+            deps = [
+                "//executorch/runtime/core/exec_aten/util:scalar_type_util" + aten_suffix,
+            ],
+        )
+
+        runtime.cxx_library(
+            name = "named_data_map" + aten_suffix,
+            exported_headers = [
+                "named_data_map.h",
+            ],
+            visibility = [
+                "//executorch/...",
+                "@EXECUTORCH_CLIENTS",
+            ],
+            exported_deps = [
+                ":core",
+                ":tensor_layout" + aten_suffix,
+            ],
+        )
+
         runtime.cxx_library(
             name = "event_tracer" + aten_suffix,
             exported_headers = [
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/runtime/core/tensor_layout.h>
+
+#include <executorch/runtime/core/error.h>
+#include <executorch/runtime/core/exec_aten/util/scalar_type_util.h>
+
+namespace executorch {
+namespace runtime {
+
+Result<TensorLayout> TensorLayout::create(
+    Span<const int32_t> sizes,
+    Span<const uint8_t> dim_order,
+    executorch::aten::ScalarType scalar_type) {
+  ET_CHECK_OR_RETURN_ERROR(
+      isValid(scalar_type),
+      InvalidArgument,
+      "Invalid scalar type %d",
+      static_cast<int>(scalar_type));
+  ET_CHECK_OR_RETURN_ERROR(
+      dim_order.size() == sizes.size(),
+      InvalidArgument,
+      "dim_order size %zu != number of dims %zu",
+      dim_order.size(),
+      sizes.size());
+
+  // Each dimension must appear exactly once in the dim order. Tensors have
+  // few enough dimensions that a quadratic check is cheap.
+  for (size_t i = 0; i < dim_order.size(); ++i) {
+    ET_CHECK_OR_RETURN_ERROR(
+        dim_order[i] < sizes.size(),
+        InvalidArgument,
+        "dim_order[%zu] = %u is out of range for %zu dims",
+        i,
+        static_cast<unsigned int>(dim_order[i]),
+        sizes.size());
+    for (size_t j = 0; j < i; ++j) {
+      ET_CHECK_OR_RETURN_ERROR(
+          dim_order[j] != dim_order[i],
+          InvalidArgument,
+          "dim_order repeats dim %u",
+          static_cast<unsigned int>(dim_order[i]));
+    }
+  }
+
+  size_t numel = 1;
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    ET_CHECK_OR_RETURN_ERROR(
+        sizes[i] >= 0,
+        InvalidArgument,
+        "sizes[%zu] = %" PRId32 " is negative",
+        i,
+        sizes[i]);
+    numel *= static_cast<size_t>(sizes[i]);
+  }
+  return TensorLayout(
+      sizes, dim_order, scalar_type, numel * elementSize(scalar_type));
+}
+
+} // namespace runtime
+} // namespace executorch
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <executorch/runtime/core/exec_aten/exec_aten.h>
+#include <executorch/runtime/core/result.h>
+#include <executorch/runtime/core/span.h>
+
+namespace executorch {
+namespace runtime {
+
+/**
+ * Describes the layout of a tensor's data: its sizes, dim order and dtype.
+ * Does not own the sizes and dim order arrays, which must outlive it.
+ */
+class TensorLayout final {
+ public:
+  TensorLayout() = delete;
+
+  /**
+   * Creates a TensorLayout after checking that its fields are consistent.
+   *
+   * @param[in] sizes The size of each dimension.
+   * @param[in] dim_order The order of the dimensions in memory, from outer to
+   *     inner. Must be a permutation of [0, sizes.size()).
+   * @param[in] scalar_type The type of each element.
+   *
+   * @retval Error::InvalidArgument The fields are inconsistent.
+   */
+  static Result<TensorLayout> create(
+      Span<const int32_t> sizes,
+      Span<const uint8_t> dim_order,
+      executorch::aten::ScalarType scalar_type);
+
+  /// Returns the size of each dimension.
+  Span<const int32_t> sizes() const {
+    return sizes_;
+  }
+
+  /// Returns the order of the dimensions in memory, from outer to inner.
+  Span<const uint8_t> dim_order() const {
+    return dim_order_;
+  }
+
+  /// Returns the type of each element.
+  executorch::aten::ScalarType scalar_type() const {
+    return scalar_type_;
+  }
+
+  /// Returns the size of the tensor's data in bytes.
+  size_t nbytes() const {
+    return nbytes_;
+  }
+
+ private:
+  TensorLayout(
+      Span<const int32_t> sizes,
+      Span<const uint8_t> dim_order,
+      executorch::aten::ScalarType scalar_type,
+      size_t nbytes)
+      : sizes_(sizes),
+        dim_order_(dim_order),
+        scalar_type_(scalar_type),
+        nbytes_(nbytes) {}
+
+  Span<const int32_t> sizes_;
+  Span<const uint8_t> dim_order_;
+  executorch::aten::ScalarType scalar_type_;
+  size_t nbytes_;
+};
+
+} // namespace runtime
+} // namespace executorch
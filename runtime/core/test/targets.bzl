@@ -45,6 +45,14 @@ def define_common_targets():
         ],
     )
 
+    runtime.cxx_test(
+        name = "tensor_layout_test",
+        srcs = ["tensor_layout_test.cpp"],
+        deps = [
+            "//executorch/runtime/core:tensor_layout",
+        ],
+    )
+
     runtime.cxx_test(
         name = "array_ref_test",
         srcs = ["array_ref_test.cpp"],
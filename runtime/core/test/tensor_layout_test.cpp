@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/runtime/core/tensor_layout.h>
+
+#include <gtest/gtest.h>
+
+#include <executorch/runtime/platform/runtime.h>
+
+using namespace ::testing;
+using executorch::aten::ScalarType;
+using executorch::runtime::Error;
+using executorch::runtime::Result;
+using executorch::runtime::Span;
+using executorch::runtime::TensorLayout;
+
+class TensorLayoutTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Since these tests cause ET_LOG to be called, the PAL must be initialized
+    // first.
+    executorch::runtime::runtime_init();
+  }
+};
+
+TEST_F(TensorLayoutTest, Ctor) {
+  int32_t sizes[2] = {1, 2};
+  uint8_t dim_order[2] = {0, 1};
+
+  Result<TensorLayout> layout = TensorLayout::create(
+      Span<const int32_t>(sizes, 2),
+      Span<const uint8_t>(dim_order, 2),
+      ScalarType::Float);
+  ASSERT_EQ(layout.error(), Error::Ok);
+
+  EXPECT_EQ(layout->scalar_type(), ScalarType::Float);
+  ASSERT_EQ(layout->sizes().size(), 2);
+  EXPECT_EQ(layout->sizes()[0], 1);
+  EXPECT_EQ(layout->sizes()[1], 2);
+  ASSERT_EQ(layout->dim_order().size(), 2);
+  EXPECT_EQ(layout->dim_order()[0], 0);
+  EXPECT_EQ(layout->dim_order()[1], 1);
+  EXPECT_EQ(layout->nbytes(), 8);
+}
+
+TEST_F(TensorLayoutTest, Ctor_InvalidDimOrder) {
+  int32_t sizes[1] = {2};
+  uint8_t dim_order[1] = {1};
+
+  Result<TensorLayout> layout = TensorLayout::create(
+      Span<const int32_t>(sizes, 1),
+      Span<const uint8_t>(dim_order, 1),
+      ScalarType::Float);
+  EXPECT_EQ(layout.error(), Error::InvalidArgument);
+}
+
+TEST_F(TensorLayoutTest, Ctor_InvalidSizes) {
+  int32_t sizes[1] = {-1};
+  uint8_t dim_order[1] = {0};
+
+  Result<TensorLayout> layout = TensorLayout::create(
+      Span<const int32_t>(sizes, 1),
+      Span<const uint8_t>(dim_order, 1),
+      ScalarType::Float);
+  EXPECT_EQ(layout.error(), Error::InvalidArgument);
+}
+
+TEST_F(TensorLayoutTest, Ctor_SizesDimOrderMismatch) {
+  int32_t sizes[1] = {2};
+  uint8_t dim_order[2] = {0, 1};
+
+  Result<TensorLayout> layout = TensorLayout::create(
+      Span<const int32_t>(sizes, 1),
+      Span<const uint8_t>(dim_order, 2),
+      ScalarType::Float);
+  EXPECT_EQ(layout.error(), Error::InvalidArgument);
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <executorch/runtime/core/dynamic_tensor_allocator.h>
+#include <executorch/runtime/platform/log.h>
+#include <executorch/runtime/platform/platform.h>
+
+namespace executorch {
+namespace runtime {
+
+/**
+ * A DynamicTensorAllocator that caches released buffers for reuse. A Method
+ * creates one when its MemoryManager does not provide a
+ * DynamicTensorAllocator; several Methods can also share one.
+ *
+ * Buffers come from et_pal_allocate() and are rounded up to size classes, four
+ * per power of two, so that a buffer is at most 25% larger than requested.
+ * Released buffers go on a free list per size class and are handed out again
+ * for requests of the same class. Once a Method has executed with its largest
+ * inputs, later executions therefore stop calling et_pal_allocate(), while the
+ * memory in use still follows the sizes of the actual inputs rather than a
+ * declared maximum. All buffers are freed when the allocator is destroyed.
+ */
+class CachingDynamicTensorAllocator final : public DynamicTensorAllocator {
+ public:
+  CachingDynamicTensorAllocator() = default;
+
+  void* allocate(size_t size) override {
+    size_t size_class = 0;
+    const size_t block_size = round_up_size(size, &size_class);
+
+    Block* block = free_lists_[size_class];
+    if (block != nullptr) {
+      free_lists_[size_class] = block->next_free;
+    } else {
+      // Leave room for the header in front of the aligned data.
+      void* memory = et_pal_allocate(sizeof(Block) + kAlignment + block_size);
+      if (memory == nullptr) {
+        ET_LOG(
+            Error,
+            "Failed to allocate %zu bytes",
+            sizeof(Block) + kAlignment + block_size);
+        return nullptr;
+      }
+      const uintptr_t header_end =
+          reinterpret_cast<uintptr_t>(memory) + sizeof(Block);
+      const uintptr_t data = (header_end + kAlignment - 1) & ~(kAlignment - 1);
+      block = reinterpret_cast<Block*>(data) - 1;
+      block->memory = memory;
+      block->next_block = blocks_;
+      blocks_ = block;
+      bytes_reserved_ += block_size;
+    }
+    block->next_free = nullptr;
+
+    bytes_in_use_ += block_size;
+    if (bytes_in_use_ > peak_bytes_in_use_) {
+      peak_bytes_in_use_ = bytes_in_use_;
+    }
+    return block + 1;
+  }
+
+  void release(void* ptr, size_t size) override {
+    if (ptr == nullptr) {
+      return;
+    }
+    size_t size_class = 0;
+    const size_t block_size = round_up_size(size, &size_class);
+    Block* block = static_cast<Block*>(ptr) - 1;
+    block->next_free = free_lists_[size_class];
+    free_lists_[size_class] = block;
+    bytes_in_use_ -= block_size;
+  }
+
+  /// Returns the bytes in buffers that have been allocated and not released.
+  size_t bytes_in_use() const {
+    return bytes_in_use_;
+  }
+
+  /// Returns the largest value bytes_in_use() has had.
+  size_t peak_bytes_in_use() const {
+    return peak_bytes_in_use_;
+  }
+
+  /// Returns the bytes in all buffers obtained from et_pal_allocate(),
+  /// including cached ones.
+  size_t bytes_reserved() const {
+    return bytes_reserved_;
+  }
+
+  ~CachingDynamicTensorAllocator() override {
+    Block* block = blocks_;
+    while (block != nullptr) {
+      Block* next = block->next_block;
+      et_pal_free(block->memory);
+      block = next;
+    }
+  }
+
+ private:
+  // Header stored in front of each buffer.
+  struct Block {
+    // Pointer returned by et_pal_allocate().
+    void* memory;
+    // Next block on the same free list.
+    Block* next_free;
+    // Next block obtained from et_pal_allocate(), so they can all be freed.
+    Block* next_block;
+  };
+  static_assert(
+      kAlignment % alignof(Block) == 0,
+      "Headers in front of aligned buffers must be aligned");
+
+  static constexpr size_t kMinBlockSizeLog2 = 6;
+  static constexpr size_t kClassesPerDoubling = 4;
+  static constexpr size_t kNumSizeClasses = kClassesPerDoubling * 64;
+
+  /**
+   * Returns the block size that a request of `size` bytes uses, and sets
+   * `*size_class` to the index of its free list.
+   */
+  static size_t round_up_size(size_t size, size_t* size_class) {
+    if (size <= (size_t{1} << kMinBlockSizeLog2)) {
+      *size_class = 0;
+      return size_t{1} << kMinBlockSizeLog2;
+    }
+    // size is in (2^log2, 2^(log2 + 1)]; split that range into
+    // kClassesPerDoubling classes of `step` bytes each.
+    size_t log2 = 0;
+    for (size_t v = size - 1; v > 1; v >>= 1) {
+      ++log2;
+    }
+    const size_t step = (size_t{1} << log2) / kClassesPerDoubling;
+    const size_t rounded = (size + step - 1) / step * step;
+    *size_class = (log2 - kMinBlockSizeLog2) * kClassesPerDoubling +
+        (rounded / step - kClassesPerDoubling);
+    return rounded;
+  }
+
+  Block* free_lists_[kNumSizeClasses] = {};
+  Block* blocks_ = nullptr;
+
+  size_t bytes_in_use_ = 0;
+  size_t peak_bytes_in_use_ = 0;
+  size_t bytes_reserved_ = 0;
+
+  // Disable copy and move.
+  CachingDynamicTensorAllocator(const CachingDynamicTensorAllocator&) = delete;
+  CachingDynamicTensorAllocator& operator=(
+      const CachingDynamicTensorAllocator&) = delete;
+  CachingDynamicTensorAllocator(CachingDynamicTensorAllocator&&) noexcept =
+      delete;
+  CachingDynamicTensorAllocator& operator=(
+      CachingDynamicTensorAllocator&&) noexcept = delete;
+};
+
+} // namespace runtime
+} // namespace executorch
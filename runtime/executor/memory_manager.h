@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <executorch/runtime/core/dynamic_tensor_allocator.h>
 #include <executorch/runtime/core/hierarchical_allocator.h>
 #include <executorch/runtime/core/memory_allocator.h>
 
@@ -48,14 +49,21 @@ class MemoryManager final {
    *     uses it. May be `nullptr` if the Method does not use kernels or
    *     delegates that allocate temporary data. This allocator will be reset
    *     after every kernel or delegate call during execution.
+   * @param[in] dynamic_tensor_allocator The allocator that DYNAMIC_UNBOUND
+   *     tensors get their storage from, since the memory plan does not reserve
+   *     any for them. Must outlive the Method that uses it. May be `nullptr`,
+   *     in which case a Method with unbounded tensors creates a
+   *     CachingDynamicTensorAllocator of its own.
    */
   explicit MemoryManager(
       MemoryAllocator* method_allocator,
       HierarchicalAllocator* planned_memory = nullptr,
-      MemoryAllocator* temp_allocator = nullptr)
+      MemoryAllocator* temp_allocator = nullptr,
+      DynamicTensorAllocator* dynamic_tensor_allocator = nullptr)
       : method_allocator_(method_allocator),
         planned_memory_(planned_memory),
-        temp_allocator_(temp_allocator) {
+        temp_allocator_(temp_allocator),
+        dynamic_tensor_allocator_(dynamic_tensor_allocator) {
     ET_CHECK_MSG(
         method_allocator != temp_allocator,
         "method allocator cannot be the same as temp allocator");
@@ -105,10 +113,18 @@ class MemoryManager final {
     return temp_allocator_;
   }
 
+  /**
+   * Returns the allocator for the storage of DYNAMIC_UNBOUND tensors.
+   */
+  DynamicTensorAllocator* dynamic_tensor_allocator() const {
+    return dynamic_tensor_allocator_;
+  }
+
  private:
   MemoryAllocator* method_allocator_;
   HierarchicalAllocator* planned_memory_;
   MemoryAllocator* temp_allocator_;
+  DynamicTensorAllocator* dynamic_tensor_allocator_;
 };
 
 } // namespace runtime
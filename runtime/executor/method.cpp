@@ -11,13 +11,15 @@
 #include <cinttypes> // @donotremove
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
 
 #include <executorch/runtime/backend/interface.h>
 #include <executorch/runtime/core/event_tracer_hooks.h>
 #include <executorch/runtime/core/exec_aten/util/tensor_util.h>
 #include <executorch/runtime/core/span.h>
+#include <executorch/runtime/executor/caching_dynamic_tensor_allocator.h>
 #include <executorch/runtime/executor/memory_manager.h>
-#include <executorch/runtime/executor/platform_memory_allocator.h>
+#include <executorch/runtime/executor/planned_temp_allocator.h>
 #include <executorch/runtime/executor/program.h>
 #include <executorch/runtime/executor/tensor_parser.h>
 #include <executorch/runtime/kernel/kernel_runtime_context.h>
@@ -30,7 +32,7 @@
 namespace executorch {
 namespace runtime {
 
-using internal::PlatformMemoryAllocator;
+using internal::PlannedTempAllocator;
 
 /**
  * Runtime state for a backend delegate.
@@ -284,9 +286,96 @@ Result<bool> parse_cond_value(const EValue& cond_value) {
   return true;
 }
 
+/**
+ * Returns the key of the serialized value if it is a tensor whose data is
+ * stored outside of the program, or nullptr otherwise.
+ */
+const char* get_external_constant_key(
+    const executorch_flatbuffer::EValue* s_value) {
+  if (s_value == nullptr ||
+      s_value->val_type() != executorch_flatbuffer::KernelTypes::Tensor) {
+    return nullptr;
+  }
+  const auto* s_tensor = s_value->val_as_Tensor();
+  if (s_tensor == nullptr) {
+    return nullptr;
+  }
+  const auto* extra_info = s_tensor->extra_tensor_info();
+  if (extra_info == nullptr ||
+      extra_info->location() !=
+          executorch_flatbuffer::TensorDataLocation::EXTERNAL ||
+      extra_info->fully_qualified_name() == nullptr) {
+    return nullptr;
+  }
+  return extra_info->fully_qualified_name()->c_str();
+}
+
 } // namespace
 
-Error Method::parse_values() {
+Error Method::parse_external_constants(const NamedDataMap* named_data_map) {
+  auto flatbuffer_values = serialization_plan_->values();
+  ET_CHECK_OR_RETURN_ERROR(
+      flatbuffer_values != nullptr, InvalidProgram, "Missing values");
+
+  // Count the external constants first so that their data fits in a single
+  // allocation. Values that share a key are only counted once below, so this
+  // is an upper bound.
+  size_t max_external_constants = 0;
+  for (size_t i = 0; i < flatbuffer_values->size(); ++i) {
+    if (get_external_constant_key(flatbuffer_values->Get(i)) != nullptr) {
+      max_external_constants++;
+    }
+  }
+  if (max_external_constants == 0) {
+    return Error::Ok;
+  }
+  ET_CHECK_OR_RETURN_ERROR(
+      named_data_map != nullptr,
+      InvalidArgument,
+      "Method has %zu external constants, but no NamedDataMap was provided",
+      max_external_constants);
+
+  external_constants_ =
+      memory_manager_->method_allocator()
+          ->allocateList<deserialization::NamedData>(max_external_constants);
+  if (external_constants_ == nullptr) {
+    return Error::MemoryAllocationFailed;
+  }
+
+  // n_external_constants_ counts the number of successfully-loaded entries for
+  // ~Method() to free, and is incremented at the bottom of the loop.
+  n_external_constants_ = 0;
+  for (size_t i = 0; i < flatbuffer_values->size(); ++i) {
+    const char* key = get_external_constant_key(flatbuffer_values->Get(i));
+    if (key == nullptr) {
+      continue;
+    }
+    bool loaded = false;
+    for (size_t j = 0; j < n_external_constants_ && !loaded; ++j) {
+      loaded = std::strcmp(external_constants_[j].key, key) == 0;
+    }
+    if (loaded) {
+      continue;
+    }
+    // With a mmap-backed map this only maps the pages; they are shared with
+    // any other Method or process that maps the same file.
+    Result<FreeableBuffer> buffer = named_data_map->get_data(key);
+    if (!buffer.ok()) {
+      ET_LOG(
+          Error,
+          "Failed to load external constant %s: 0x%" PRIx32,
+          key,
+          static_cast<uint32_t>(buffer.error()));
+      return buffer.error();
+    }
+    new (&external_constants_[n_external_constants_])
+        deserialization::NamedData{key, std::move(buffer.get())};
+    n_external_constants_++;
+  }
+  return Error::Ok;
+}
+
+Error Method::parse_values(const NamedDataMap* named_data_map) {
   auto flatbuffer_values = serialization_plan_->values();
   ET_CHECK_OR_RETURN_ERROR(
       flatbuffer_values != nullptr, InvalidProgram, "Missing values");
@@ -383,7 +472,12 @@ Error Method::parse_values() {
       } break;
       case executorch_flatbuffer::KernelTypes::Tensor: {
         auto t = deserialization::parseTensor(
-            program_, memory_manager_, serialization_value->val_as_Tensor());
+            program_,
+            memory_manager_,
+            serialization_value->val_as_Tensor(),
+            named_data_map,
+            Span<deserialization::NamedData>(
+                external_constants_, n_external_constants_));
         if (!t.ok()) {
           ET_LOG(
               Error,
@@ -487,8 +581,397 @@ Error populate_operator_name(
 
   return Error::Ok;
 }
+
+/**
+ * Returns true if the given value is the output of an et_view call, which
+ * points it at the data of another tensor each time it runs.
+ */
+bool is_view_output(
+    const executorch_flatbuffer::ExecutionPlan* plan,
+    size_t value_index) {
+  for (size_t i = 0; i < plan->chains()->size(); ++i) {
+    const auto* instructions = plan->chains()->Get(i)->instructions();
+    if (instructions == nullptr) {
+      continue;
+    }
+    for (size_t j = 0; j < instructions->size(); ++j) {
+      const auto* kernel_call =
+          instructions->Get(j)->instr_args_as_KernelCall();
+      if (kernel_call == nullptr || kernel_call->args()->size() == 0) {
+        continue;
+      }
+      const auto* args = kernel_call->args();
+      if (static_cast<size_t>(args->Get(args->size() - 1)) != value_index) {
+        continue;
+      }
+      const auto* op = plan->operators()->Get(kernel_call->op_index());
+      if (strcmp(op->name()->c_str(), "executorch_prim::et_view") == 0) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+/**
+ * Returns the serialized tensor at the given index in the plan's values if it
+ * is part of the method state, or nullptr otherwise. State tensors are
+ * memory-planned tensors that have an initial value or are named mutable
+ * buffers.
+ */
+const executorch_flatbuffer::Tensor* get_state_tensor(
+    const executorch_flatbuffer::ExecutionPlan* plan,
+    size_t value_index) {
+  const auto* s_tensor = plan->values()->Get(value_index)->val_as_Tensor();
+  if (s_tensor == nullptr || s_tensor->allocation_info() == nullptr) {
+    return nullptr;
+  }
+  if (s_tensor->data_buffer_idx() > 0) {
+    return s_tensor;
+  }
+  const auto* extra_info = s_tensor->extra_tensor_info();
+  if (extra_info != nullptr && extra_info->fully_qualified_name() != nullptr) {
+    return s_tensor;
+  }
+  return nullptr;
+}
+
+/**
+ * Returns true if the given value is a tensor that the memory plan places in
+ * the planned buffers. Unlike TensorInfo::is_memory_planned(), this is false
+ * for constant tensors, whose data lives in the program.
+ */
+bool has_planned_buffer(
+    const executorch_flatbuffer::ExecutionPlan* plan,
+    size_t value_index) {
+  const auto* s_tensor = plan->values()->Get(value_index)->val_as_Tensor();
+  return s_tensor != nullptr && s_tensor->allocation_info() != nullptr;
+}
+
+/**
+ * Returns the number of bytes the serialized tensor takes at its serialized
+ * sizes, which are the upper bounds of dynamic-shaped tensors.
+ */
+size_t get_serialized_nbytes(const executorch_flatbuffer::Tensor* s_tensor) {
+  size_t nbytes =
+      elementSize(static_cast<exec_aten::ScalarType>(s_tensor->scalar_type()));
+  if (s_tensor->sizes() != nullptr) {
+    for (int32_t size : *s_tensor->sizes()) {
+      nbytes *= static_cast<size_t>(size);
+    }
+  }
+  return nbytes;
+}
 } // namespace
 
+Error Method::init_dynamic_tensors() {
+#ifdef USE_ATEN_LIB
+  // The tensor parser already gave unbounded at::Tensors resizable storage.
+  return Error::Ok;
+#else
+  for (size_t i = 0; i < n_value_; ++i) {
+    if (!values_[i].isTensor()) {
+      continue;
+    }
+    auto* impl = values_[i].toTensor().unsafeGetTensorImpl();
+    if (impl->shape_dynamism() != TensorShapeDynamism::DYNAMIC_UNBOUND) {
+      continue;
+    }
+    // Inputs that are not memory-planned share the caller's buffers, so they
+    // never need storage of their own.
+    if (impl->data() == nullptr) {
+      bool is_input = false;
+      for (size_t j = 0; j < inputs_size() && !is_input; ++j) {
+        is_input = get_input_index(j) == i;
+      }
+      if (is_input) {
+        continue;
+      }
+    }
+    if (dynamic_tensor_allocator_ == nullptr) {
+      auto* allocator = memory_manager_->method_allocator()
+                            ->allocateInstance<CachingDynamicTensorAllocator>();
+      if (allocator == nullptr) {
+        return Error::MemoryAllocationFailed;
+      }
+      new (allocator) CachingDynamicTensorAllocator();
+      default_dynamic_tensor_allocator_ = allocator;
+      dynamic_tensor_allocator_ = allocator;
+    }
+    impl->set_dynamic_allocator(dynamic_tensor_allocator_);
+  }
+  return Error::Ok;
+#endif
+}
+
+Error Method::validate_memory_plans() const {
+  const auto* plans = serialization_plan_->shape_specialized_memory_plans();
+  if (plans == nullptr || plans->size() == 0) {
+    return Error::Ok;
+  }
+  const auto* buffer_sizes = serialization_plan_->non_const_buffer_sizes();
+  ET_CHECK_OR_RETURN_ERROR(
+      buffer_sizes != nullptr && memory_manager_->planned_memory() != nullptr,
+      InvalidProgram,
+      "Shape-specialized memory plans without planned memory");
+
+  // The number of entries the inputs take in input_max_sizes.
+  size_t num_input_sizes = 0;
+  for (size_t i = 0; i < inputs_size(); ++i) {
+    const EValue& input = values_[get_input_index(i)];
+    if (input.isTensor()) {
+      num_input_sizes += input.toTensor().dim();
+    }
+  }
+
+  for (size_t i = 0; i < plans->size(); ++i) {
+    const auto* plan = plans->Get(i);
+    const auto* plan_buffer_sizes = plan->non_const_buffer_sizes();
+    const auto* value_indices = plan->value_indices();
+    const auto* allocations = plan->allocations();
+    const auto* allocation_nbytes = plan->allocation_nbytes();
+    ET_CHECK_OR_RETURN_ERROR(
+        plan->input_max_sizes() != nullptr && plan_buffer_sizes != nullptr &&
+            value_indices != nullptr && allocations != nullptr &&
+            allocation_nbytes != nullptr,
+        InvalidProgram,
+        "Memory plan %zu is missing fields",
+        i);
+    ET_CHECK_OR_RETURN_ERROR(
+        plan->input_max_sizes()->size() == num_input_sizes,
+        InvalidProgram,
+        "Memory plan %zu has %" PRIu32 " input sizes, expected %zu",
+        i,
+        plan->input_max_sizes()->size(),
+        num_input_sizes);
+    ET_CHECK_OR_RETURN_ERROR(
+        plan_buffer_sizes->size() <= buffer_sizes->size(),
+        InvalidProgram,
+        "Memory plan %zu uses %" PRIu32 " buffers, method has %" PRIu32,
+        i,
+        plan_buffer_sizes->size(),
+        buffer_sizes->size());
+    // Buffer 0 is reserved for constants.
+    for (size_t j = 1; j < plan_buffer_sizes->size(); ++j) {
+      ET_CHECK_OR_RETURN_ERROR(
+          plan_buffer_sizes->Get(j) <= buffer_sizes->Get(j),
+          InvalidProgram,
+          "Memory plan %zu needs %" PRId64 " bytes in buffer %zu, more than "
+          "the method's %" PRId64,
+          i,
+          plan_buffer_sizes->Get(j),
+          j,
+          buffer_sizes->Get(j));
+    }
+    ET_CHECK_OR_RETURN_ERROR(
+        value_indices->size() == allocations->size() &&
+            allocation_nbytes->size() == allocations->size(),
+        InvalidProgram,
+        "Memory plan %zu has %" PRIu32 " values, %" PRIu32
+        " allocations and %" PRIu32 " allocation sizes",
+        i,
+        value_indices->size(),
+        allocations->size(),
+        allocation_nbytes->size());
+    for (size_t j = 0; j < value_indices->size(); ++j) {
+      const int32_t value_index = value_indices->Get(j);
+      ET_CHECK_OR_RETURN_ERROR(
+          value_index >= 0 && static_cast<size_t>(value_index) < n_value_ &&
+              values_[value_index].isTensor(),
+          InvalidProgram,
+          "Memory plan %zu places value %" PRId32 ", which is not a tensor",
+          i,
+          value_index);
+      const auto* allocation = allocations->Get(j);
+      ET_CHECK_OR_RETURN_ERROR(
+          allocation->memory_id() >= 1 &&
+              allocation->memory_id() < plan_buffer_sizes->size(),
+          InvalidProgram,
+          "Memory plan %zu places value %" PRId32 " in buffer %" PRIu32,
+          i,
+          value_index,
+          allocation->memory_id());
+      // The tensor only takes its bytes at the plan's largest sizes; an
+      // execution that needs more makes select_memory_plan() pick another
+      // plan.
+      const uint64_t nbytes = allocation_nbytes->Get(j);
+      ET_CHECK_OR_RETURN_ERROR(
+          nbytes <= get_serialized_nbytes(
+                        serialization_plan_->values()
+                            ->Get(value_index)
+                            ->val_as_Tensor()),
+          InvalidProgram,
+          "Memory plan %zu gives value %" PRId32 " %" PRIu64
+          " bytes, more than its upper bound",
+          i,
+          value_index,
+          nbytes);
+      auto ptr = deserialization::getMemPlannedPtr(
+          allocation,
+          static_cast<size_t>(nbytes),
+          memory_manager_->planned_memory());
+      if (!ptr.ok()) {
+        return ptr.error();
+      }
+    }
+  }
+  return Error::Ok;
+}
+
+Error Method::select_memory_plan() {
+#ifdef USE_ATEN_LIB
+  // at::Tensors keep the default plan, since moving their storage could
+  // make them reallocate it.
+  return Error::Ok;
+#else
+  const auto* plans = serialization_plan_->shape_specialized_memory_plans();
+  if (plans == nullptr || plans->size() == 0) {
+    return Error::Ok;
+  }
+  int32_t best_plan_idx = kDefaultMemoryPlan;
+  int64_t best_plan_bytes = 0;
+  for (size_t i = 0; i < plans->size(); ++i) {
+    const auto* plan = plans->Get(i);
+    const auto* input_max_sizes = plan->input_max_sizes();
+    bool fits = true;
+    size_t size_idx = 0;
+    for (size_t j = 0; j < inputs_size() && fits; ++j) {
+      const EValue& input = values_[get_input_index(j)];
+      if (!input.isTensor()) {
+        continue;
+      }
+      const auto sizes = input.toTensor().sizes();
+      for (size_t d = 0; d < sizes.size() && fits; ++d) {
+        fits = sizes[d] <= input_max_sizes->Get(size_idx + d);
+      }
+      size_idx += sizes.size();
+    }
+    if (!fits) {
+      continue;
+    }
+    int64_t plan_bytes = 0;
+    for (size_t j = 1; j < plan->non_const_buffer_sizes()->size(); ++j) {
+      plan_bytes += plan->non_const_buffer_sizes()->Get(j);
+    }
+    if (best_plan_idx == kDefaultMemoryPlan || plan_bytes < best_plan_bytes) {
+      best_plan_idx = static_cast<int32_t>(i);
+      best_plan_bytes = plan_bytes;
+    }
+  }
+  if (best_plan_idx == memory_plan_idx_) {
+    return Error::Ok;
+  }
+  return apply_memory_plan(best_plan_idx);
+#endif
+}
+
+Error Method::apply_memory_plan(int32_t memory_plan_idx) {
+#ifdef USE_ATEN_LIB
+  (void)memory_plan_idx;
+  return Error::NotSupported;
+#else
+  const auto* plans = serialization_plan_->shape_specialized_memory_plans();
+  HierarchicalAllocator* planned_memory = memory_manager_->planned_memory();
+
+  // Return the tensors the current plan placed to their own allocation_info,
+  // then place the tensors of the new plan. The plans only list tensors that
+  // their placement applies to, so this handles plans that list different
+  // tensors. Tensors that bind_input() or bind_output() pointed at caller
+  // memory are not where the plan placed them, and are left alone.
+  if (memory_plan_idx_ != kDefaultMemoryPlan) {
+    const auto* plan = plans->Get(memory_plan_idx_);
+    for (size_t i = 0; i < plan->value_indices()->size(); ++i) {
+      const int32_t value_index = plan->value_indices()->Get(i);
+      const auto* s_tensor =
+          serialization_plan_->values()->Get(value_index)->val_as_Tensor();
+      ET_CHECK_OR_RETURN_ERROR(
+          s_tensor != nullptr && s_tensor->allocation_info() != nullptr,
+          InvalidProgram,
+          "Value %" PRId32 " in a memory plan is not a memory-planned tensor",
+          value_index);
+      auto plan_ptr = deserialization::getMemPlannedPtr(
+          plan->allocations()->Get(i),
+          static_cast<size_t>(plan->allocation_nbytes()->Get(i)),
+          planned_memory);
+      if (!plan_ptr.ok()) {
+        return plan_ptr.error();
+      }
+      auto ptr = deserialization::getMemPlannedPtr(
+          s_tensor->allocation_info(),
+          get_serialized_nbytes(s_tensor),
+          planned_memory);
+      if (!ptr.ok()) {
+        return ptr.error();
+      }
+      auto* impl = values_[value_index].toTensor().unsafeGetTensorImpl();
+      if (impl->data() == plan_ptr.get()) {
+        impl->set_data(ptr.get(), get_serialized_nbytes(s_tensor));
+      }
+    }
+    memory_plan_idx_ = kDefaultMemoryPlan;
+  }
+
+  if (memory_plan_idx != kDefaultMemoryPlan) {
+    const auto* plan = plans->Get(memory_plan_idx);
+    for (size_t i = 0; i < plan->value_indices()->size(); ++i) {
+      const int32_t value_index = plan->value_indices()->Get(i);
+      const auto* s_tensor =
+          serialization_plan_->values()->Get(value_index)->val_as_Tensor();
+      auto default_ptr = deserialization::getMemPlannedPtr(
+          s_tensor->allocation_info(),
+          get_serialized_nbytes(s_tensor),
+          planned_memory);
+      if (!default_ptr.ok()) {
+        return default_ptr.error();
+      }
+      auto ptr = deserialization::getMemPlannedPtr(
+          plan->allocations()->Get(i),
+          static_cast<size_t>(plan->allocation_nbytes()->Get(i)),
+          planned_memory);
+      if (!ptr.ok()) {
+        return ptr.error();
+      }
+      // Kernels must not resize the tensor past the smaller slot, where it
+      // would overwrite its neighbors.
+      auto* impl = values_[value_index].toTensor().unsafeGetTensorImpl();
+      if (impl->data() == default_ptr.get()) {
+        impl->set_data(
+            ptr.get(), static_cast<size_t>(plan->allocation_nbytes()->Get(i)));
+      }
+    }
+    memory_plan_idx_ = memory_plan_idx;
+  }
+  return Error::Ok;
+#endif
+}
+
+Result<void*> Method::get_planned_data_ptr(size_t value_index) const {
+  const auto* s_tensor =
+      serialization_plan_->values()->Get(value_index)->val_as_Tensor();
+  ET_CHECK_OR_RETURN_ERROR(
+      s_tensor != nullptr && s_tensor->allocation_info() != nullptr,
+      InvalidArgument,
+      "Value %zu is not a memory-planned tensor",
+      value_index);
+  HierarchicalAllocator* planned_memory = memory_manager_->planned_memory();
+  if (memory_plan_idx_ != kDefaultMemoryPlan) {
+    const auto* plan = serialization_plan_->shape_specialized_memory_plans()
+                           ->Get(memory_plan_idx_);
+    for (size_t i = 0; i < plan->value_indices()->size(); ++i) {
+      if (static_cast<size_t>(plan->value_indices()->Get(i)) == value_index) {
+        return deserialization::getMemPlannedPtr(
+            plan->allocations()->Get(i),
+            static_cast<size_t>(plan->allocation_nbytes()->Get(i)),
+            planned_memory);
+      }
+    }
+  }
+  return deserialization::getMemPlannedPtr(
+      s_tensor->allocation_info(),
+      get_serialized_nbytes(s_tensor),
+      planned_memory);
+}
+
 Error Method::resolve_operator(
     int32_t op_index,
     OpFunction* kernels,
@@ -562,21 +1045,23 @@ Result<Method> Method::load(
     executorch_flatbuffer::ExecutionPlan* s_plan,
     const Program* program,
     MemoryManager* memory_manager,
-    EventTracer* event_tracer) {
+    EventTracer* event_tracer,
+    const NamedDataMap* named_data_map) {
   MemoryAllocator* temp_allocator = memory_manager->temp_allocator();
+  PlannedTempAllocator* default_temp_allocator = nullptr;
   if (temp_allocator == nullptr) {
-    PlatformMemoryAllocator* platform_allocator =
-        memory_manager->method_allocator()
-            ->allocateInstance<PlatformMemoryAllocator>();
-    if (platform_allocator == nullptr) {
+    default_temp_allocator = memory_manager->method_allocator()
+                                 ->allocateInstance<PlannedTempAllocator>();
+    if (default_temp_allocator == nullptr) {
       return Error::MemoryAllocationFailed;
     }
-    new (platform_allocator) PlatformMemoryAllocator();
-    temp_allocator = platform_allocator;
+    new (default_temp_allocator) PlannedTempAllocator();
+    temp_allocator = default_temp_allocator;
   }
   Method method(program, memory_manager, event_tracer, temp_allocator);
+  method.default_temp_allocator_ = default_temp_allocator;
 
-  Error err = method.init(s_plan);
+  Error err = method.init(s_plan, named_data_map);
   if (err != Error::Ok) {
     return err;
   } else {
@@ -585,7 +1070,9 @@ Result<Method> Method::load(
   }
 }
 
-Error Method::init(executorch_flatbuffer::ExecutionPlan* s_plan) {
+Error Method::init(
+    executorch_flatbuffer::ExecutionPlan* s_plan,
+    const NamedDataMap* named_data_map) {
   EXECUTORCH_SCOPE_PROF("Method::init");
   internal::EventTracerProfileMethodScope event_tracer_profile_scope =
       internal::EventTracerProfileMethodScope(event_tracer_, "Method::init");
@@ -601,8 +1088,21 @@ Error Method::init(executorch_flatbuffer::ExecutionPlan* s_plan) {
   auto method_allocator = memory_manager_->method_allocator();
 
   {
-    // Parse the elements of the values_ array.
-    Error err = parse_values();
+    // Load the external constants that the values refer to, then parse the
+    // elements of the values_ array.
+    Error err = parse_external_constants(named_data_map);
+    if (err != Error::Ok) {
+      return err;
+    }
+    err = parse_values(named_data_map);
+    if (err != Error::Ok) {
+      return err;
+    }
+    err = init_dynamic_tensors();
+    if (err != Error::Ok) {
+      return err;
+    }
+    err = validate_memory_plans();
     if (err != Error::Ok) {
       return err;
     }
@@ -824,6 +1324,15 @@ Method::set_input(const EValue& input_evalue, size_t input_idx) {
         input_idx,
         static_cast<int8_t>(t_src.scalar_type()),
         static_cast<int8_t>(t_dst.scalar_type()));
+    auto tensor_meta = this->method_meta().input_tensor_meta(input_idx);
+#ifndef USE_ATEN_LIB
+    if (!tensor_meta->is_memory_planned() &&
+        t_dst.shape_dynamism() == TensorShapeDynamism::DYNAMIC_UNBOUND) {
+      // The input is about to share the new buffer, so the size of the one it
+      // shared before must not limit its new shape.
+      internal::reset_data_ptr(t_dst);
+    }
+#endif
     // Reset the shape for the Method's input as the size of forwarded input
     // tensor for shape dynamism. Also is a safety check if need memcpy.
     Error err = resize_tensor(t_dst, t_src.sizes());
@@ -834,9 +1343,21 @@ Method::set_input(const EValue& input_evalue, size_t input_idx) {
         input_idx,
         static_cast<uint32_t>(err));
     Error error;
-    auto tensor_meta = this->method_meta().input_tensor_meta(input_idx);
     if (tensor_meta->is_memory_planned()) {
-      error = internal::copy_tensor_data(t_dst, t_src);
+      // Copy into the planned buffer, not into memory that bind_input() may
+      // have aliased before.
+      auto planned_ptr = get_planned_data_ptr(get_input_index(input_idx));
+      if (!planned_ptr.ok()) {
+        return planned_ptr.error();
+      }
+      error = Error::Ok;
+      if (t_dst.const_data_ptr() != planned_ptr.get()) {
+        error = internal::set_tensor_data(
+            t_dst, planned_ptr.get(), t_dst.nbytes());
+      }
+      if (error == Error::Ok) {
+        error = internal::copy_tensor_data(t_dst, t_src);
+      }
     } else {
       error = internal::share_tensor_data(t_dst, t_src);
     }
@@ -986,6 +1507,164 @@ Method::set_output_data_ptr(void* buffer, size_t size, size_t output_idx) {
   return internal::set_tensor_data(t, buffer, size);
 }
 
+ET_NODISCARD Error
+Method::bind_input(const EValue& input_evalue, size_t input_idx) {
+  ET_CHECK_OR_RETURN_ERROR(
+      initialized(),
+      InvalidState,
+      "Input can not be bound until method has been initialized.");
+  ET_CHECK_OR_RETURN_ERROR(
+      step_state_.instr_idx == 0 && step_state_.chain_idx == 0,
+      InvalidState,
+      "Inputs can not be bound mid execution.");
+  ET_CHECK_OR_RETURN_ERROR(
+      input_idx < inputs_size(),
+      InvalidArgument,
+      "input_idx: %zu >= num_inputs: %zu",
+      input_idx,
+      inputs_size());
+
+  const auto& e = get_value(get_input_index(input_idx));
+  ET_CHECK_OR_RETURN_ERROR(
+      e.isTensor() && input_evalue.isTensor(),
+      InvalidArgument,
+      "Only tensor inputs can be bound, but input %zu has tag %" PRIu32
+      " and the given value has tag %" PRIu32,
+      input_idx,
+      static_cast<uint32_t>(e.tag),
+      static_cast<uint32_t>(input_evalue.tag));
+
+  if (!has_planned_buffer(serialization_plan_, get_input_index(input_idx))) {
+    // set_input() already aliases inputs that have no planned buffer.
+    return set_input(input_evalue, input_idx);
+  }
+
+  const auto& t_dst = e.toTensor();
+  const auto& t_src = input_evalue.toTensor();
+  ET_CHECK_OR_RETURN_ERROR(
+      t_dst.scalar_type() == t_src.scalar_type(),
+      InvalidArgument,
+      "Input %zu has scalar type %" PRId8 " but the given tensor has %" PRId8,
+      input_idx,
+      static_cast<int8_t>(t_dst.scalar_type()),
+      static_cast<int8_t>(t_src.scalar_type()));
+  void* data = t_src.mutable_data_ptr();
+  ET_CHECK_OR_RETURN_ERROR(
+      data != nullptr &&
+          reinterpret_cast<uintptr_t>(data) % kIOBindingAlignment == 0,
+      InvalidArgument,
+      "Data %p of input %zu is not aligned to %zu bytes",
+      data,
+      input_idx,
+      kIOBindingAlignment);
+
+  Error err = resize_tensor(t_dst, t_src.sizes());
+  ET_CHECK_OR_RETURN_ERROR(
+      err == Error::Ok,
+      InvalidArgument,
+      "Error setting input %zu: 0x%" PRIx32,
+      input_idx,
+      static_cast<uint32_t>(err));
+  return internal::set_tensor_data(t_dst, data, t_src.nbytes());
+}
+
+ET_NODISCARD Error
+Method::bind_output(void* buffer, size_t size, size_t output_idx) {
+  ET_CHECK_OR_RETURN_ERROR(
+      initialized(),
+      InvalidState,
+      "Outputs can not be bound until method has been initialized.");
+  ET_CHECK_OR_RETURN_ERROR(
+      step_state_.instr_idx == 0 && step_state_.chain_idx == 0,
+      InvalidState,
+      "Outputs can not be bound mid execution.");
+  ET_CHECK_OR_RETURN_ERROR(
+      output_idx < outputs_size(),
+      InvalidArgument,
+      "output_idx: %zu >= num_outputs: %zu",
+      output_idx,
+      outputs_size());
+
+  const size_t value_index = get_output_index(output_idx);
+  auto& output = mutable_value(value_index);
+  ET_CHECK_OR_RETURN_ERROR(
+      output.isTensor(),
+      InvalidArgument,
+      "output type: %zu is not tensor",
+      (size_t)output.tag);
+
+  auto tensor_meta = this->method_meta().output_tensor_meta(output_idx);
+  if (!has_planned_buffer(serialization_plan_, value_index)) {
+    // Constants count as memory planned but have no planned buffer, and their
+    // data belongs to the program.
+    ET_CHECK_OR_RETURN_ERROR(
+        !tensor_meta->is_memory_planned(),
+        InvalidArgument,
+        "Output %zu is a constant and can not be bound",
+        output_idx);
+    return set_output_data_ptr(buffer, size, output_idx);
+  }
+
+  ET_CHECK_OR_RETURN_ERROR(
+      buffer != nullptr &&
+          reinterpret_cast<uintptr_t>(buffer) % kIOBindingAlignment == 0,
+      InvalidArgument,
+      "Buffer %p for output %zu is not aligned to %zu bytes",
+      buffer,
+      output_idx,
+      kIOBindingAlignment);
+  // The output may grow up to its serialized sizes during execution.
+  ET_CHECK_OR_RETURN_ERROR(
+      tensor_meta->nbytes() <= size,
+      InvalidArgument,
+      "buffer size: %zu is smaller than the largest output size: %zu",
+      size,
+      tensor_meta->nbytes());
+  ET_CHECK_OR_RETURN_ERROR(
+      !is_view_output(serialization_plan_, value_index),
+      NotSupported,
+      "Output %zu is a view of another tensor and can not be bound",
+      output_idx);
+
+  return internal::set_tensor_data(output.toTensor(), buffer, size);
+}
+
+ET_NODISCARD Error Method::reset_io_bindings() {
+  ET_CHECK_OR_RETURN_ERROR(
+      initialized(),
+      InvalidState,
+      "Bindings can not be reset until method has been initialized.");
+  ET_CHECK_OR_RETURN_ERROR(
+      step_state_.instr_idx == 0 && step_state_.chain_idx == 0,
+      InvalidState,
+      "Bindings can not be reset mid execution.");
+
+  const size_t n_inputs = inputs_size();
+  for (size_t i = 0; i < n_inputs + outputs_size(); ++i) {
+    const bool is_input = i < n_inputs;
+    const size_t value_index =
+        is_input ? get_input_index(i) : get_output_index(i - n_inputs);
+    // Values without a planned buffer, including constants, are never
+    // rebound.
+    if (!values_[value_index].isTensor() ||
+        !has_planned_buffer(serialization_plan_, value_index)) {
+      continue;
+    }
+    auto planned_ptr = get_planned_data_ptr(value_index);
+    if (!planned_ptr.ok()) {
+      return planned_ptr.error();
+    }
+    const auto& t = values_[value_index].toTensor();
+    if (t.const_data_ptr() != planned_ptr.get()) {
+      Error err = internal::set_tensor_data(t, planned_ptr.get(), t.nbytes());
+      if (err != Error::Ok) {
+        return err;
+      }
+    }
+  }
+  return Error::Ok;
+}
+
 ET_NODISCARD Error Method::get_outputs(EValue* output_evalues, size_t length) {
   ET_CHECK_OR_RETURN_ERROR(
       initialized(),
@@ -1195,6 +1874,194 @@ Error Method::experimental_reset_execution() {
   return reset_execution(); // @lint-ignore CLANGTIDY facebook-hte-Deprecated
 }
 
+size_t Method::state_nbytes() const {
+  if (!initialized()) {
+    return 0;
+  }
+  size_t nbytes = 0;
+  for (size_t i = 0; i < n_value_; ++i) {
+    if (get_state_tensor(serialization_plan_, i) != nullptr) {
+      nbytes += values_[i].toTensor().nbytes();
+    }
+  }
+  return nbytes;
+}
+
+Error Method::bind_external_constants(const NamedDataMap* data_map) {
+  ET_CHECK_OR_RETURN_ERROR(
+      initialized(),
+      InvalidState,
+      "Constants can not be bound until method has been initialized.");
+  ET_CHECK_OR_RETURN_ERROR(
+      step_state_.instr_idx == 0 && step_state_.chain_idx == 0,
+      InvalidState,
+      "Constants can not be bound mid execution.");
+  ET_CHECK_OR_RETURN_ERROR(
+      data_map != nullptr, InvalidArgument, "Data map is null");
+  const auto* flatbuffer_values = serialization_plan_->values();
+
+  // Check every constant that the map replaces before rebinding any, so that a
+  // map that does not fit leaves the method unchanged.
+  bool found_any = false;
+  for (size_t i = 0; i < n_value_; ++i) {
+    const char* key = get_external_constant_key(flatbuffer_values->Get(i));
+    if (key == nullptr) {
+      continue;
+    }
+    Result<TensorLayout> layout = data_map->get_metadata(key);
+    if (layout.error() == Error::NotFound) {
+      continue;
+    }
+    if (!layout.ok()) {
+      return layout.error();
+    }
+    found_any = true;
+    const auto& t = values_[i].toTensor();
+    ET_CHECK_OR_RETURN_ERROR(
+        layout->scalar_type() == t.scalar_type() &&
+            layout->nbytes() == t.nbytes(),
+        InvalidExternalData,
+        "Constant %s: new data of type %" PRId8 " and %zu bytes does not "
+        "match type %" PRId8 " and %zu bytes",
+        key,
+        static_cast<int8_t>(layout->scalar_type()),
+        layout->nbytes(),
+        static_cast<int8_t>(t.scalar_type()),
+        t.nbytes());
+  }
+  // A map may hold constants of other methods too, but one that replaces none
+  // of this method's was most likely built for a different program.
+  ET_CHECK_OR_RETURN_ERROR(
+      found_any,
+      NotFound,
+      "Data map has no external constants of method %s",
+      serialization_plan_->name()->c_str());
+
+  for (size_t j = 0; j < n_external_constants_; ++j) {
+    deserialization::NamedData& constant = external_constants_[j];
+    Result<FreeableBuffer> buffer = data_map->get_data(constant.key);
+    if (buffer.error() == Error::NotFound) {
+      continue;
+    }
+    if (!buffer.ok()) {
+      return buffer.error();
+    }
+    for (size_t i = 0; i < n_value_; ++i) {
+      const char* key = get_external_constant_key(flatbuffer_values->Get(i));
+      if (key == nullptr || std::strcmp(key, constant.key) != 0) {
+        continue;
+      }
+      // Every tensor with this key has the size checked above, so this fails
+      // on the first one if at all, before any of them point into `buffer`.
+      ET_CHECK_OR_RETURN_ERROR(
+          buffer->size() >= values_[i].toTensor().nbytes(),
+          InvalidExternalData,
+          "Constant %s: loaded %zu bytes < %zu",
+          key,
+          buffer->size(),
+          values_[i].toTensor().nbytes());
+      // The const_cast is 'ok' here because the program and runtime should
+      // guarantee that this data is never modified.
+      Error err = internal::set_tensor_data(
+          values_[i].toTensor(),
+          const_cast<void*>(buffer->data()),
+          buffer->size());
+      if (err != Error::Ok) {
+        return err;
+      }
+    }
+    // FreeableBuffer can't be assigned, so replace it in place. Destroying the
+    // old buffer frees it.
+    constant.buffer.~FreeableBuffer();
+    new (&constant.buffer) FreeableBuffer(std::move(buffer.get()));
+  }
+  return Error::Ok;
+}
+
+Error Method::reset_state() {
+  ET_CHECK_OR_RETURN_ERROR(
+      initialized(),
+      InvalidState,
+      "State can not be reset until method has been initialized.");
+  ET_CHECK_OR_RETURN_ERROR(
+      step_state_.instr_idx == 0 && step_state_.chain_idx == 0,
+      InvalidState,
+      "State can not be reset mid execution.");
+
+  for (size_t i = 0; i < n_value_; ++i) {
+    const auto* s_tensor = get_state_tensor(serialization_plan_, i);
+    if (s_tensor == nullptr) {
+      continue;
+    }
+    const auto& t = values_[i].toTensor();
+    if (s_tensor->data_buffer_idx() > 0) {
+      // Reload the initial value, like method load does.
+      Error err = program_->load_mutable_subsegment_into(
+          0, s_tensor->data_buffer_idx(), t.nbytes(), t.mutable_data_ptr());
+      if (err != Error::Ok) {
+        return err;
+      }
+    } else {
+      std::memset(t.mutable_data_ptr(), 0, t.nbytes());
+    }
+  }
+  return Error::Ok;
+}
+
+Error Method::save_state(void* buffer, size_t size) const {
+  ET_CHECK_OR_RETURN_ERROR(
+      initialized(),
+      InvalidState,
+      "State can not be saved until method has been initialized.");
+  const size_t nbytes = state_nbytes();
+  ET_CHECK_OR_RETURN_ERROR(
+      size >= nbytes,
+      InvalidArgument,
+      "buffer size: %zu is smaller than the state size: %zu",
+      size,
+      nbytes);
+
+  auto* out = static_cast<uint8_t*>(buffer);
+  for (size_t i = 0; i < n_value_; ++i) {
+    if (get_state_tensor(serialization_plan_, i) == nullptr) {
+      continue;
+    }
+    const auto& t = values_[i].toTensor();
+    std::memcpy(out, t.const_data_ptr(), t.nbytes());
+    out += t.nbytes();
+  }
+  return Error::Ok;
+}
+
+Error Method::restore_state(const void* buffer, size_t size) {
+  ET_CHECK_OR_RETURN_ERROR(
+      initialized(),
+      InvalidState,
+      "State can not be restored until method has been initialized.");
+  ET_CHECK_OR_RETURN_ERROR(
+      step_state_.instr_idx == 0 && step_state_.chain_idx == 0,
+      InvalidState,
+      "State can not be restored mid execution.");
+  const size_t nbytes = state_nbytes();
+  ET_CHECK_OR_RETURN_ERROR(
+      size == nbytes,
+      InvalidArgument,
+      "size: %zu does not match the state size: %zu",
+      size,
+      nbytes);
+
+  const auto* in = static_cast<const uint8_t*>(buffer);
+  for (size_t i = 0; i < n_value_; ++i) {
+    if (get_state_tensor(serialization_plan_, i) == nullptr) {
+      continue;
+    }
+    const auto& t = values_[i].toTensor();
+    std::memcpy(t.mutable_data_ptr(), in, t.nbytes());
+    in += t.nbytes();
+  }
+  return Error::Ok;
+}
+
 // Log all the outputs of this method to the event tracer.
 void Method::log_outputs() {
 #ifdef ET_EVENT_TRACER_ENABLED
@@ -1227,6 +2094,14 @@ Error Method::step() {
       InvalidState,
       "Cannot execute until method has been initialized.");
 
+  // Pick the memory plan before the first instruction, like execute().
+  if (step_state_.chain_idx == 0 && step_state_.instr_idx == 0) {
+    Error err = select_memory_plan();
+    if (err != Error::Ok) {
+      return err;
+    }
+  }
+
   // If chain_step_ is on n_chains_, then we have no instructions run.
   if (step_state_.chain_idx == n_chains_) {
     return Error::EndOfMethod;
@@ -1272,6 +2147,11 @@ Error Method::execute() {
       NotSupported,
       "Cannot execute until method has been initialized.");
 
+  Error err = select_memory_plan();
+  if (err != Error::Ok) {
+    return err;
+  }
+
   // Chains are executed sequentially today, but future async designs may
   // branch and run many in parallel or out of order.
   for (step_state_.chain_idx = 0; step_state_.chain_idx < n_chains_;
@@ -1375,15 +2255,38 @@ Method::~Method() {
   // Tensors needs to be decremented properly.
   if (values_ != nullptr) {
     for (int i = 0; i < n_value_; ++i) {
+#ifndef USE_ATEN_LIB
+      // Give the storage of unbounded tensors back to its allocator, which
+      // may outlive this Method.
+      if (values_[i].isTensor() &&
+          values_[i].toTensor().unsafeGetTensorImpl()->dynamic_allocator() !=
+              nullptr) {
+        internal::reset_data_ptr(values_[i].toTensor());
+      }
+#endif
       values_[i].~EValue();
     }
   }
+  // Release the external constant data that the values pointed to.
+  if (external_constants_ != nullptr) {
+    for (size_t i = 0; i < n_external_constants_; ++i) {
+      external_constants_[i].~NamedData();
+    }
+  }
   // Free any resources associated with delegate backends.
   if (delegates_ != nullptr) {
     for (int i = 0; i < n_delegate_; i++) {
       delegates_[i].~BackendDelegate();
     }
   }
+  // Release the arena owned by the default temp allocator, if we created one.
+  if (default_temp_allocator_ != nullptr) {
+    default_temp_allocator_->~MemoryAllocator();
+  }
+  // Likewise for the buffers of the default dynamic tensor allocator.
+  if (default_dynamic_tensor_allocator_ != nullptr) {
+    default_dynamic_tensor_allocator_->~DynamicTensorAllocator();
+  }
   // All other fields are trivially destructible.
 }
 } // namespace runtime
@@ -11,6 +11,7 @@
 #include <executorch/runtime/core/evalue.h>
 #include <executorch/runtime/core/event_tracer.h>
 #include <executorch/runtime/core/exec_aten/exec_aten.h>
+#include <executorch/runtime/core/named_data_map.h>
 #include <executorch/runtime/core/span.h>
 #include <executorch/runtime/executor/memory_manager.h>
 #include <executorch/runtime/executor/method_meta.h>
@@ -34,6 +35,9 @@ class Program;
 class BackendDelegate;
 struct Chain;
 class KernelRuntimeContext;
+namespace deserialization {
+struct NamedData;
+} // namespace deserialization
 using OpFunction = void (*)(KernelRuntimeContext&, EValue**);
 /// A list of pointers into the master values table that together compose the
 /// argument list for a single instruction
@@ -54,8 +58,15 @@ class Method final {
         program_(rhs.program_),
         memory_manager_(rhs.memory_manager_),
         temp_allocator_(rhs.temp_allocator_),
+        default_temp_allocator_(rhs.default_temp_allocator_),
+        dynamic_tensor_allocator_(rhs.dynamic_tensor_allocator_),
+        default_dynamic_tensor_allocator_(
+            rhs.default_dynamic_tensor_allocator_),
         serialization_plan_(rhs.serialization_plan_),
+        memory_plan_idx_(rhs.memory_plan_idx_),
         event_tracer_(rhs.event_tracer_),
+        n_external_constants_(rhs.n_external_constants_),
+        external_constants_(rhs.external_constants_),
         n_value_(rhs.n_value_),
         values_(rhs.values_),
         n_delegate_(rhs.n_delegate_),
@@ -65,10 +76,14 @@ class Method final {
         init_state_(rhs.init_state_) {
     // Required: clear out fields that the dtor looks at, so that we don't free
     // anything twice.
+    rhs.n_external_constants_ = 0;
+    rhs.external_constants_ = nullptr;
     rhs.n_value_ = 0;
     rhs.values_ = nullptr;
     rhs.n_delegate_ = 0;
     rhs.delegates_ = nullptr;
+    rhs.default_temp_allocator_ = nullptr;
+    rhs.default_dynamic_tensor_allocator_ = nullptr;
 
     // Helpful: Try to ensure that any other interactions with the old object
     // result in failures.
@@ -139,6 +154,93 @@ class Method final {
   ET_NODISCARD Error
   set_output_data_ptr(void* buffer, size_t size, size_t output_idx);
 
+  /**
+   * Sets the specified method input to the provided tensor without copying
+   * its data, even if the memory plan of the method allocated a buffer for
+   * the input.
+   *
+   * The Method keeps a pointer to the tensor's data until the input is set
+   * again or reset_io_bindings() is called, so the data must outlive every
+   * execution in between. Kernels and delegates read the input from that
+   * data directly, and write to it if the method mutates the input.
+   *
+   * @param[in] input_evalue The tensor to alias. Its dtype must match the
+   *     input, its sizes must be valid for the input, and its data must be
+   *     aligned to kIOBindingAlignment.
+   *
+   * @param[in] input_idx Zero-based index of the input to set. Must be less
+   *     than the value returned by inputs_size().
+   *
+   * @returns Error::Ok on success, non-Ok on failure.
+   */
+  ET_NODISCARD Error bind_input(const EValue& input_evalue, size_t input_idx);
+
+  /**
+   * Makes the method write the specified output directly into the provided
+   * buffer, even if the memory plan of the method allocated a buffer for the
+   * output.
+   *
+   * The Method keeps the pointer until this is called again for the output
+   * or reset_io_bindings() is called, so the buffer must outlive every
+   * execution in between.
+   *
+   * @param[in] buffer The block of memory to point the specified tensor at.
+   *     Must be aligned to kIOBindingAlignment.
+   *
+   * @param[in] size The length of buffer in bytes. For a memory-planned
+   *     output, must be at least the nbytes of the output at its largest
+   *     shape; otherwise must be at least the nbytes of the output tensor.
+   *
+   * @param[in] output_idx The index of the output to bind. Must correspond to
+   *     a tensor that the method does not compute as a view of another one,
+   *     and that is not a constant.
+   *
+   * @returns Error::Ok on success, non-Ok on failure.
+   */
+  ET_NODISCARD Error bind_output(void* buffer, size_t size, size_t output_idx);
+
+  /**
+   * Points the memory-planned inputs and outputs that bind_input() or
+   * bind_output() bound to caller memory back at their planned buffers.
+   * Constant outputs are left alone.
+   *
+   * @returns Error::Ok on success, non-Ok on failure.
+   */
+  ET_NODISCARD Error reset_io_bindings();
+
+  /// The alignment that bind_input() and bind_output() require of caller
+  /// memory, which matches the alignment of memory-planned tensors.
+  static constexpr size_t kIOBindingAlignment = 16;
+
+  /**
+   * Points the external constant tensors whose keys are in `data_map` at the
+   * data in it, without reloading the method. Constants whose keys are not in
+   * `data_map` keep their current data.
+   *
+   * This swaps weight sets like LoRA adapters: export the adapter matrices as
+   * external constants, keep a FlatTensorDataMap per adapter file, and bind
+   * the one a request needs before executing. With an MmapDataLoader, each
+   * adapter's pages stay in the page cache, so switching only remaps them.
+   *
+   * Delegates that copied or repacked their constants during init() do not see
+   * the new data.
+   *
+   * @param[in] data_map The source of the new constant data. Must outlive the
+   *     Method, or the next call to this method, since the Method holds the
+   *     buffers it returns.
+   *
+   * @retval Error::Ok on success.
+   * @retval Error::InvalidState if called mid execution.
+   * @retval Error::NotFound if `data_map` has none of the method's external
+   *     constants. Keys that belong to no constant of this method are
+   *     otherwise ignored, so one map can serve several methods.
+   * @retval Error::InvalidExternalData if a constant in `data_map` does not
+   *     match the tensor's type or size. The metadata of every constant is
+   *     checked before any is rebound; if loading data fails afterwards, the
+   *     constants rebound so far keep their new data.
+   */
+  ET_NODISCARD Error bind_external_constants(const NamedDataMap* data_map);
+
   /**
    * Copies the method's outputs into the provided array.
    *
@@ -180,6 +282,12 @@ class Method final {
    * NOTE: Will fail if the method has been partially executed using the
    * `step()` api.
    *
+   * If the program has shape-specialized memory plans for the method, this
+   * first moves the memory-planned tensors other than inputs to the plan with
+   * the smallest buffers that fits the current input shapes. The data of
+   * those tensors does not survive a change of plan, but outputs stay valid
+   * until the next execution.
+   *
    * @returns Error::Ok on success, non-Ok on failure.
    */
   ET_NODISCARD Error execute();
@@ -210,6 +318,51 @@ class Method final {
   /// DEPRECATED: Use `reset_execution()` instead.
   ET_DEPRECATED ET_NODISCARD Error experimental_reset_execution();
 
+  /**
+   * Returns the size in bytes of the state of the method.
+   *
+   * The state is the memory-planned tensors that keep their contents across
+   * executions: the mutable buffers of the model when it was exported with
+   * `ExecutorchBackendConfig(emit_mutable_buffer_state=True)`, and any other
+   * memory-planned tensors that have an initial value, like trainable
+   * weights. A streaming model can keep e.g. its encoder state there instead
+   * of passing it through its inputs and outputs on every call. The state
+   * only persists if no other Method shares its planned memory.
+   */
+  size_t state_nbytes() const;
+
+  /**
+   * Sets the state of the method back to its initial value, or to zeros for
+   * the tensors that have none.
+   *
+   * @retval Error::Ok on success.
+   * @retval Error::InvalidState if called mid execution.
+   */
+  ET_NODISCARD Error reset_state();
+
+  /**
+   * Copies the state of the method into the provided buffer.
+   *
+   * @param[in] buffer The buffer to copy the state into.
+   * @param[in] size The size of the buffer in bytes. Must be at least
+   *     state_nbytes().
+   *
+   * @returns Error::Ok on success, non-Ok on failure.
+   */
+  ET_NODISCARD Error save_state(void* buffer, size_t size) const;
+
+  /**
+   * Sets the state of the method to one saved by save_state().
+   *
+   * @param[in] buffer The state to restore.
+   * @param[in] size The size of the state in bytes. Must be equal to
+   *     state_nbytes().
+   *
+   * @retval Error::Ok on success.
+   * @retval Error::InvalidState if called mid execution.
+   */
+  ET_NODISCARD Error restore_state(const void* buffer, size_t size);
+
   /**
    * Returns the MethodMeta that corresponds to the calling Method.
    */
@@ -261,6 +414,9 @@ class Method final {
     InitializationFailed,
   };
 
+  /// Value of memory_plan_idx_ when the tensors use their own allocation_info.
+  static constexpr int32_t kDefaultMemoryPlan = -1;
+
   /// Tracks what step in program execution we are on
   struct StepState {
     size_t chain_idx;
@@ -276,8 +432,14 @@ class Method final {
         program_(program),
         memory_manager_(memory_manager),
         temp_allocator_(temp_allocator),
+        default_temp_allocator_(nullptr),
+        dynamic_tensor_allocator_(memory_manager->dynamic_tensor_allocator()),
+        default_dynamic_tensor_allocator_(nullptr),
         serialization_plan_(nullptr),
+        memory_plan_idx_(kDefaultMemoryPlan),
         event_tracer_(event_tracer),
+        n_external_constants_(0),
+        external_constants_(nullptr),
         n_value_(0),
         values_(nullptr),
         n_delegate_(0),
@@ -291,14 +453,19 @@ class Method final {
       executorch_flatbuffer::ExecutionPlan* s_plan,
       const Program* program,
       MemoryManager* memory_manager,
-      EventTracer* event_tracer);
+      EventTracer* event_tracer,
+      const NamedDataMap* named_data_map);
 
   /**
    * Initialize the method from its serialized representation.
    *
+   * @param[in] named_data_map Optional source of external constant tensors.
+   *
    * @returns Error::Ok on success, non-Ok on failure.
    */
-  ET_NODISCARD Error init(executorch_flatbuffer::ExecutionPlan* s_plan);
+  ET_NODISCARD Error init(
+      executorch_flatbuffer::ExecutionPlan* s_plan,
+      const NamedDataMap* named_data_map);
 
   /// Returns true if the Method was successfully initialized.
   inline bool initialized() const {
@@ -317,9 +484,25 @@ class Method final {
   const Program* program_;
   MemoryManager* memory_manager_;
   MemoryAllocator* temp_allocator_;
+  /// The temp allocator created by load() when the MemoryManager did not
+  /// provide one. Owned by this Method, which must destroy it.
+  MemoryAllocator* default_temp_allocator_;
+  DynamicTensorAllocator* dynamic_tensor_allocator_;
+  /// The DynamicTensorAllocator created by init() when the MemoryManager did
+  /// not provide one and the Method has unbounded tensors. Owned by this
+  /// Method, which must destroy it.
+  DynamicTensorAllocator* default_dynamic_tensor_allocator_;
   executorch_flatbuffer::ExecutionPlan* serialization_plan_;
+  /// Index of the shape-specialized memory plan that the memory-planned
+  /// tensors currently use, or kDefaultMemoryPlan.
+  int32_t memory_plan_idx_;
   EventTracer* event_tracer_;
 
+  /// The data of the constant tensors stored outside of the program, loaded
+  /// once per key and shared by every value that refers to it.
+  size_t n_external_constants_;
+  deserialization::NamedData* external_constants_;
+
   size_t n_value_;
   EValue* values_;
 
@@ -331,12 +514,51 @@ class Method final {
 
   InitializationState init_state_;
 
+  /**
+   * Loads the data of the constant tensors that are stored in
+   * `named_data_map` into external_constants_. On error,
+   * n_external_constants_ will be set to the number of loaded entries so that
+   * ~Method doesn't try to free uninitialized entries.
+   */
+  ET_NODISCARD Error
+  parse_external_constants(const NamedDataMap* named_data_map);
+
   /**
    * Parses the elements of the values_ array. On error, n_value_ will be set to
    * the number of successfully-initialized entries so that ~Method doesn't try
    * to clean up uninitialized entries.
    */
-  ET_NODISCARD Error parse_values();
+  ET_NODISCARD Error parse_values(const NamedDataMap* named_data_map);
+
+  /**
+   * Gives the DYNAMIC_UNBOUND tensors in values_ an allocator to get storage
+   * from when they are resized, creating one if necessary.
+   */
+  ET_NODISCARD Error init_dynamic_tensors();
+
+  /**
+   * Checks that the shape-specialized memory plans of the method fit its
+   * inputs and planned buffers.
+   */
+  ET_NODISCARD Error validate_memory_plans() const;
+
+  /**
+   * Switches to the shape-specialized memory plan with the smallest buffers
+   * that fits the current inputs, or to the default plan if none does.
+   */
+  ET_NODISCARD Error select_memory_plan();
+
+  /**
+   * Points the memory-planned tensors at their placement in the given memory
+   * plan.
+   */
+  ET_NODISCARD Error apply_memory_plan(int32_t memory_plan_idx);
+
+  /**
+   * Returns where the memory plan in use places the data of the
+   * memory-planned tensor at the given index in values_.
+   */
+  ET_NODISCARD Result<void*> get_planned_data_ptr(size_t value_index) const;
 
   ET_NODISCARD Error resolve_operator(
       int32_t op_index,
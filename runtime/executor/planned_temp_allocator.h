@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include <executorch/runtime/core/memory_allocator.h>
+#include <executorch/runtime/executor/platform_memory_allocator.h>
+#include <executorch/runtime/platform/log.h>
+#include <executorch/runtime/platform/platform.h>
+
+namespace executorch {
+namespace runtime {
+namespace internal {
+
+/**
+ * PlannedTempAllocator is the temp allocator that a Method uses when the
+ * MemoryManager does not provide one.
+ *
+ * Temp memory is only live while a single instruction executes, and the
+ * runtime calls reset() after every instruction. This allocator records the
+ * high-water mark of the temp memory requested by any one instruction and,
+ * at the next reset(), replaces its arena with a single pre-faulted buffer of
+ * that size. Once the arena covers every instruction's requests (typically
+ * after the first execution), allocations are simple pointer bumps into the
+ * arena and a kernel that requests the same scratch sizes on every call gets
+ * the same, already-faulted addresses each time, instead of a fresh
+ * `et_pal_allocate()`/`et_pal_free()` pair per request.
+ *
+ * Requests that do not fit in the current arena (e.g. the first execution, or
+ * a later execution with larger dynamic shapes) are served by a
+ * PlatformMemoryAllocator and grow the arena at the next reset().
+ */
+class PlannedTempAllocator final : public MemoryAllocator {
+ public:
+  PlannedTempAllocator() : MemoryAllocator(0, nullptr) {}
+
+  void* allocate(size_t size, size_t alignment = kDefaultAlignment) override {
+    if (!isPowerOf2(alignment)) {
+      ET_LOG(Error, "Alignment %zu is not a power of 2", alignment);
+      return nullptr;
+    }
+
+    // Plan for the worst-case alignment padding so that replaying the same
+    // sequence of requests always fits in an arena of the recorded size.
+    requested_ += size + alignment - 1;
+    if (requested_ > high_water_mark_) {
+      high_water_mark_ = requested_;
+    }
+
+    if (arena_begin_ != nullptr) {
+      uint8_t* start = alignPointer(arena_cur_, alignment);
+      if (start + size <= arena_end_) {
+        arena_cur_ = start + size;
+        return start;
+      }
+    }
+    return fallback_.allocate(size, alignment);
+  }
+
+  void reset() override {
+    fallback_.reset();
+    requested_ = 0;
+    if (high_water_mark_ > arena_capacity()) {
+      grow_arena();
+    }
+    arena_cur_ = arena_begin_;
+  }
+
+  /// Returns the largest amount of temp memory requested by one instruction.
+  size_t high_water_mark() const {
+    return high_water_mark_;
+  }
+
+  /// Returns the size of the current pre-planned arena.
+  size_t arena_capacity() const {
+    return static_cast<size_t>(arena_end_ - arena_begin_);
+  }
+
+  ~PlannedTempAllocator() override {
+    fallback_.reset();
+    if (arena_memory_ != nullptr) {
+      et_pal_free(arena_memory_);
+    }
+  }
+
+ private:
+  // Round arena sizes up to this many bytes to avoid regrowing the arena for
+  // every slightly-larger request while the high-water mark is being learned.
+  static constexpr size_t kArenaGranularity = 4096;
+
+  void grow_arena() {
+    const size_t capacity = (high_water_mark_ + kArenaGranularity - 1) /
+        kArenaGranularity * kArenaGranularity;
+    // Over-allocate so that the arena itself can start at a granularity
+    // boundary regardless of the alignment et_pal_allocate() provides.
+    void* memory = et_pal_allocate(capacity + kArenaGranularity);
+    if (memory == nullptr) {
+      // Keep the existing arena; oversized requests keep using the fallback.
+      ET_LOG(
+          Error,
+          "Failed to allocate %zu byte temp arena",
+          capacity + kArenaGranularity);
+      return;
+    }
+    if (arena_memory_ != nullptr) {
+      et_pal_free(arena_memory_);
+    }
+    arena_memory_ = memory;
+    arena_begin_ = alignPointer(memory, kArenaGranularity);
+    arena_end_ = arena_begin_ + capacity;
+    // Touch every page now so that kernels don't take page faults on their
+    // first use of the scratch memory.
+    memset(arena_begin_, 0, capacity);
+  }
+
+  PlatformMemoryAllocator fallback_;
+
+  // Unaligned pointer returned by et_pal_allocate(), if any.
+  void* arena_memory_ = nullptr;
+  uint8_t* arena_begin_ = nullptr;
+  uint8_t* arena_end_ = nullptr;
+  uint8_t* arena_cur_ = nullptr;
+
+  // Bytes requested since the last reset(), including worst-case padding.
+  size_t requested_ = 0;
+  // Largest value of requested_ seen so far.
+  size_t high_water_mark_ = 0;
+
+  // Disable copy and move.
+  PlannedTempAllocator(const PlannedTempAllocator&) = delete;
+  PlannedTempAllocator& operator=(const PlannedTempAllocator&) = delete;
+  PlannedTempAllocator(PlannedTempAllocator&&) noexcept = delete;
+  PlannedTempAllocator& operator=(PlannedTempAllocator&&) noexcept = delete;
+};
+
+} // namespace internal
+} // namespace runtime
+} // namespace executorch
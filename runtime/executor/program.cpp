@@ -58,6 +58,55 @@ Result<executorch_flatbuffer::ExecutionPlan*> get_execution_plan(
   return Error::InvalidArgument;
 }
 
+/**
+ * Loads the data of a segment. If the segment is compressed, describes the
+ * compression to the loader, which must decompress it.
+ */
+Result<FreeableBuffer> load_segment_data(
+    const DataLoader* loader,
+    size_t segment_base_offset,
+    const executorch_flatbuffer::DataSegment* segment,
+    DataLoader::SegmentInfo segment_info) {
+  DataLoader::SegmentInfo::Compression compression;
+  if (segment->compression() !=
+      executorch_flatbuffer::SegmentCompression::NONE) {
+    ET_CHECK_OR_RETURN_ERROR(
+        segment->compression() ==
+            executorch_flatbuffer::SegmentCompression::LZ4,
+        NotSupported,
+        "Segment %zu uses unknown compression %u",
+        segment_info.segment_index,
+        static_cast<unsigned int>(segment->compression()));
+    const auto* chunk_sizes = segment->compressed_chunk_sizes();
+    ET_CHECK_OR_RETURN_ERROR(
+        chunk_sizes != nullptr && segment->chunk_size() > 0,
+        InvalidProgram,
+        "Compressed segment %zu has no chunks",
+        segment_info.segment_index);
+    compression.codec = DataLoader::SegmentInfo::Compression::Codec::LZ4;
+    compression.uncompressed_size = segment->uncompressed_size();
+    compression.chunk_size = segment->chunk_size();
+    compression.compressed_chunk_sizes = chunk_sizes->data();
+    compression.num_chunks = chunk_sizes->size();
+    segment_info.compression = &compression;
+  }
+  // Could fail if offset and size are out of bound for the data, or if this
+  // is reading from a file and fails, or for many other reasons depending on
+  // the implementation of the loader.
+  Result<FreeableBuffer> data = loader->load(
+      segment_base_offset + segment->offset(), segment->size(), segment_info);
+  if (data.ok() && segment_info.compression != nullptr &&
+      data->size() != compression.uncompressed_size) {
+    ET_LOG(
+        Error,
+        "Segment %zu is compressed; load the program with a "
+        "DecompressingDataLoader",
+        segment_info.segment_index);
+    return Error::NotSupported;
+  }
+  return data;
+}
+
 } // namespace
 
 /* static */ Result<Program> Program::load(
@@ -182,9 +231,10 @@ Result<executorch_flatbuffer::ExecutionPlan*> get_execution_plan(
 
     const executorch_flatbuffer::DataSegment* data_segment =
         segments->Get(constant_segment->segment_index());
-    Result<FreeableBuffer> constant_segment_data = loader->load(
-        segment_base_offset + data_segment->offset(),
-        data_segment->size(),
+    Result<FreeableBuffer> constant_segment_data = load_segment_data(
+        loader,
+        segment_base_offset,
+        data_segment,
         DataLoader::SegmentInfo(
             DataLoader::SegmentInfo::Type::Constant,
             constant_segment->segment_index()));
@@ -240,7 +290,8 @@ Result<const char*> Program::get_method_name(size_t plan_index) const {
 Result<Method> Program::load_method(
     const char* method_name,
     MemoryManager* memory_manager,
-    EventTracer* event_tracer) const {
+    EventTracer* event_tracer,
+    const NamedDataMap* named_data_map) const {
   EXECUTORCH_SCOPE_PROF("Program::load_method");
   internal::event_tracer_create_event_block(event_tracer, "Default");
   internal::EventTracerProfileMethodScope event_tracer_scope =
@@ -257,7 +308,8 @@ Result<Method> Program::load_method(
   if (!plan.ok()) {
     return plan.error();
   }
-  return Method::load(plan.get(), this, memory_manager, event_tracer);
+  return Method::load(
+      plan.get(), this, memory_manager, event_tracer, named_data_map);
 }
 
 Result<MethodMeta> Program::method_meta(const char* method_name) const {
@@ -409,11 +461,7 @@ Result<FreeableBuffer> Program::LoadSegment(
   }
   const executorch_flatbuffer::DataSegment* segment =
       internal_program_->segments()->Get(index);
-  // Could fail if offset and size are out of bound for the data, or if this
-  // is reading from a file and fails, or for many other reasons depending on
-  // the implementation of the loader.
-  return loader_->load(
-      segment_base_offset_ + segment->offset(), segment->size(), segment_info);
+  return load_segment_data(loader_, segment_base_offset_, segment, segment_info);
 }
 
 Error Program::load_mutable_subsegment_into(
@@ -480,6 +528,14 @@ Error Program::load_mutable_subsegment_into(
   auto segment =
       internal_program_->segments()->Get(segment_offsets->segment_index());
 
+  // Mutable data is loaded piecewise, so it can't be compressed.
+  ET_CHECK_OR_RETURN_ERROR(
+      segment->compression() ==
+          executorch_flatbuffer::SegmentCompression::NONE,
+      NotSupported,
+      "Mutable data segment %u is compressed",
+      segment_offsets->segment_index());
+
   // Check size
   if (offset + size > segment->size()) {
     ET_LOG(
@@ -15,6 +15,7 @@
 #include <executorch/runtime/core/error.h>
 #include <executorch/runtime/core/event_tracer.h>
 #include <executorch/runtime/core/freeable_buffer.h>
+#include <executorch/runtime/core/named_data_map.h>
 #include <executorch/runtime/core/result.h>
 #include <executorch/runtime/executor/memory_manager.h>
 #include <executorch/runtime/executor/method.h>
@@ -124,15 +125,24 @@ class Program final {
    * @param[in] method_name The name of the method to load.
    * @param[in] memory_manager The allocators to use during initialization and
    *     execution of the loaded method. If `memory_manager.temp_allocator()` is
-   *     null, the runtime will allocate temp memory using `et_pal_allocate()`.
+   *     null, the runtime will allocate temp memory using `et_pal_allocate()`,
+   *     learning the largest per-instruction temp usage and serving later
+   *     requests from a single pre-allocated arena of that size.
    * @param[in] event_tracer The event tracer to use for this method run.
+   * @param[in] named_data_map The source of constant tensors that the program
+   *     stores outside of itself, e.g. a FlatTensorDataMap over a .ptd file.
+   *     Required if the method has such tensors. Must outlive the returned
+   *     Method, which holds the buffers it returns. With a mmap-backed map,
+   *     those are pages shared with any other Method or process that maps the
+   *     same file.
    *
    * @returns The loaded method on success, or an error on failure.
    */
   Result<Method> load_method(
       const char* method_name,
       MemoryManager* memory_manager,
-      EventTracer* event_tracer = nullptr) const;
+      EventTracer* event_tracer = nullptr,
+      const NamedDataMap* named_data_map = nullptr) const;
 
   /**
    * Gathers metadata for the named method.
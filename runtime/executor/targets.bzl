@@ -34,6 +34,7 @@ def define_common_targets():
             "memory_manager.h",
         ],
         exported_deps = [
+            "//executorch/runtime/core:dynamic_tensor_allocator",
             "//executorch/runtime/core:memory_allocator",
         ],
         visibility = [
@@ -42,6 +43,21 @@ def define_common_targets():
         ],
     )
 
+    runtime.cxx_library(
+        name = "caching_dynamic_tensor_allocator",
+        exported_headers = [
+            "caching_dynamic_tensor_allocator.h",
+        ],
+        exported_deps = [
+            "//executorch/runtime/core:dynamic_tensor_allocator",
+            "//executorch/runtime/platform:platform",
+        ],
+        visibility = [
+            "//executorch/...",
+            "@EXECUTORCH_CLIENTS",
+        ],
+    )
+
     for aten_mode in (True, False):
         aten_suffix = "_aten" if aten_mode else ""
         runtime.cxx_library(
@@ -66,6 +82,7 @@ def define_common_targets():
                 "tensor_parser{}.cpp".format(aten_suffix if aten_mode else "_portable"),
             ],
             headers = [
+                "planned_temp_allocator.h",
                 "platform_memory_allocator.h",
             ],
             exported_headers = [
@@ -76,11 +93,13 @@ def define_common_targets():
             ],
             preprocessor_flags = _program_preprocessor_flags(),
             exported_deps = [
+                ":caching_dynamic_tensor_allocator",
                 ":memory_manager",
                 "//executorch/runtime/backend:interface",
                 "//executorch/runtime/core:core",
                 "//executorch/runtime/core:evalue" + aten_suffix,
                 "//executorch/runtime/core:event_tracer" + aten_suffix,
+                "//executorch/runtime/core:named_data_map" + aten_suffix,
                 "//executorch/runtime/core/exec_aten:lib" + aten_suffix,
                 "//executorch/runtime/core/exec_aten/util:tensor_util" + aten_suffix,
                 "//executorch/runtime/kernel:kernel_runtime_context" + aten_suffix,
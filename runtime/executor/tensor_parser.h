@@ -10,6 +10,9 @@
 
 #include <executorch/runtime/core/evalue.h>
 #include <executorch/runtime/core/exec_aten/exec_aten.h>
+#include <executorch/runtime/core/freeable_buffer.h>
+#include <executorch/runtime/core/named_data_map.h>
+#include <executorch/runtime/core/span.h>
 #include <executorch/runtime/executor/memory_manager.h>
 #include <executorch/runtime/executor/program.h>
 #include <executorch/schema/program_generated.h>
@@ -18,10 +21,27 @@ namespace executorch {
 namespace runtime {
 namespace deserialization {
 
+/// The data of a constant tensor that lives outside of the program, keyed by
+/// its fully qualified name.
+struct NamedData {
+  const char* key;
+  FreeableBuffer buffer;
+};
+
+/**
+ * Deserializes `s_tensor`.
+ *
+ * @param[in] named_data_map The source of tensors whose data is stored outside
+ *     of the program. May be null if the program has no such tensors.
+ * @param[in] external_constants The already-loaded data of the constant
+ *     tensors in `named_data_map` that the tensor may refer to.
+ */
 ET_NODISCARD Result<executorch::aten::Tensor> parseTensor(
     const Program* program,
     MemoryManager* memory_manager,
-    const executorch_flatbuffer::Tensor* s_tensor);
+    const executorch_flatbuffer::Tensor* s_tensor,
+    const NamedDataMap* named_data_map = nullptr,
+    Span<NamedData> external_constants = {});
 
 ET_NODISCARD Result<BoxedEvalueList<executorch::aten::Tensor>> parseTensorList(
     const flatbuffers::Vector<int32_t>* tensor_indices,
@@ -89,10 +109,16 @@ parseListOptionalType(
  * - constant_buffer = 0, allocation_info = Non Null: Non-constant Tensor.
  * - constant_buffer = 0, allocation_info = Null: Input/placeholder Tensor.
  *
+ * A constant Tensor whose extra_tensor_info.location is EXTERNAL has its data
+ * in `named_data_map` instead of the program, under its fully qualified name.
+ *
  * @param[in] s_tensor The tensor to find the data pointer for.
  * @param[in] program The Program to use for constant buffer data.
  * @param[in] nbytes The amount of memory to get from the allocator.
  * @param[in] allocator The source of memory for non-constant tensors.
+ * @param[in] named_data_map The source of external tensor data. May be null.
+ * @param[in] external_constants The already-loaded data of the external
+ *     constant tensors, looked up by fully qualified name.
  *
  * @returns On success, the data pointer to use for the tensor. On failure, a
  *     non-Ok Error.
@@ -101,6 +127,22 @@ ET_NODISCARD Result<void*> getTensorDataPtr(
     const executorch_flatbuffer::Tensor* s_tensor,
     const Program* program,
     size_t nbytes,
+    HierarchicalAllocator* allocator,
+    const NamedDataMap* named_data_map = nullptr,
+    Span<NamedData> external_constants = {});
+
+/**
+ * Returns the address in the planned memory that `allocation_info` refers to.
+ *
+ * @param[in] allocation_info The memory id and offset of the data.
+ * @param[in] nbytes The number of bytes that must fit at that address.
+ * @param[in] allocator The planned memory.
+ *
+ * @returns On success, the address. On failure, a non-Ok Error.
+ */
+ET_NODISCARD Result<void*> getMemPlannedPtr(
+    const executorch_flatbuffer::AllocationDetails* allocation_info,
+    size_t nbytes,
     HierarchicalAllocator* allocator);
 
 } // namespace deserialization
@@ -8,6 +8,9 @@
 
 #include <executorch/runtime/executor/tensor_parser.h>
 
+#include <cinttypes>
+#include <cstring>
+
 #include <executorch/runtime/core/evalue.h>
 #include <executorch/runtime/core/exec_aten/exec_aten.h>
 #include <executorch/runtime/executor/memory_manager.h>
@@ -33,9 +36,6 @@ class TensorParser final {
   }
 };
 
-namespace {
-
-// Retrieve the buffer specified by the allocation_info
 ET_NODISCARD Result<void*> getMemPlannedPtr(
     const executorch_flatbuffer::AllocationDetails* allocation_info,
     size_t nbytes,
@@ -66,7 +66,6 @@ ET_NODISCARD Result<void*> getMemPlannedPtr(
   }
   return allocator->get_offset_address(memory_id, memory_offset, nbytes);
 }
-} // namespace
 
 ET_NODISCARD Result<BoxedEvalueList<exec_aten::Tensor>> parseTensorList(
     const flatbuffers::Vector<int32_t>* tensor_indices,
@@ -102,17 +101,96 @@ ET_NODISCARD Result<BoxedEvalueList<exec_aten::Tensor>> parseTensorList(
       evalp_list, tensor_list, tensor_indices->size());
 }
 
+namespace {
+
+/**
+ * Returns the data of the external constant `s_tensor`, after checking that
+ * the named data map agrees with the program about its type and size.
+ */
+Result<void*> getExternalConstantPtr(
+    const executorch_flatbuffer::Tensor* s_tensor,
+    size_t nbytes,
+    const NamedDataMap* named_data_map,
+    Span<NamedData> external_constants) {
+  const auto* fqn = s_tensor->extra_tensor_info()->fully_qualified_name();
+  ET_CHECK_OR_RETURN_ERROR(
+      fqn != nullptr,
+      InvalidProgram,
+      "External tensor is missing its fully qualified name");
+  const char* key = fqn->c_str();
+  ET_CHECK_OR_RETURN_ERROR(
+      named_data_map != nullptr,
+      InvalidArgument,
+      "Tensor %s is stored externally, but no NamedDataMap was provided",
+      key);
+
+  Result<TensorLayout> layout = named_data_map->get_metadata(key);
+  if (!layout.ok()) {
+    ET_LOG(Error, "No external data for tensor %s", key);
+    return layout.error();
+  }
+  ET_CHECK_OR_RETURN_ERROR(
+      static_cast<int8_t>(layout->scalar_type()) ==
+          static_cast<int8_t>(s_tensor->scalar_type()),
+      InvalidExternalData,
+      "Tensor %s: external scalar type %" PRId8 " != %" PRId8,
+      key,
+      static_cast<int8_t>(layout->scalar_type()),
+      static_cast<int8_t>(s_tensor->scalar_type()));
+  ET_CHECK_OR_RETURN_ERROR(
+      layout->nbytes() == nbytes,
+      InvalidExternalData,
+      "Tensor %s: external size %zu != %zu bytes",
+      key,
+      layout->nbytes(),
+      nbytes);
+
+  for (NamedData& named_data : external_constants) {
+    if (std::strcmp(named_data.key, key) == 0) {
+      ET_CHECK_OR_RETURN_ERROR(
+          named_data.buffer.size() >= nbytes,
+          InvalidExternalData,
+          "Tensor %s: loaded %zu bytes < %zu",
+          key,
+          named_data.buffer.size(),
+          nbytes);
+      // The const_cast is 'ok' here because the program and runtime should
+      // guarantee that this data is never modified.
+      return const_cast<void*>(named_data.buffer.data());
+    }
+  }
+  ET_LOG(Error, "External constant %s was not loaded", key);
+  return Error::NotFound;
+}
+
+} // namespace
+
 ET_NODISCARD Result<void*> getTensorDataPtr(
     const executorch_flatbuffer::Tensor* s_tensor,
     const Program* program,
     size_t nbytes,
-    HierarchicalAllocator* allocator) {
+    HierarchicalAllocator* allocator,
+    const NamedDataMap* named_data_map,
+    Span<NamedData> external_constants) {
   auto data_buffer_idx = s_tensor->data_buffer_idx();
   const executorch_flatbuffer::AllocationDetails* allocation_info =
       s_tensor->allocation_info();
+  const executorch_flatbuffer::ExtraTensorInfo* extra_info =
+      s_tensor->extra_tensor_info();
+
+  // External constant
+  if (extra_info != nullptr &&
+      extra_info->location() ==
+          executorch_flatbuffer::TensorDataLocation::EXTERNAL) {
+    ET_CHECK_OR_RETURN_ERROR(
+        allocation_info == nullptr && data_buffer_idx == 0,
+        NotSupported,
+        "External tensors must be constant");
+    return getExternalConstantPtr(
+        s_tensor, nbytes, named_data_map, external_constants);
 
-  // Memory Planned, with initial state
-  if (data_buffer_idx > 0 && allocation_info != nullptr) {
+    // Memory Planned, with initial state
+  } else if (data_buffer_idx > 0 && allocation_info != nullptr) {
     auto planned_ptr = getMemPlannedPtr(allocation_info, nbytes, allocator);
     if (!planned_ptr.ok()) {
       return planned_ptr.error();
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/runtime/executor/caching_dynamic_tensor_allocator.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include <executorch/runtime/core/exec_aten/exec_aten.h>
+#include <executorch/runtime/core/exec_aten/util/tensor_util.h>
+#include <executorch/runtime/platform/runtime.h>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+using exec_aten::ScalarType;
+using exec_aten::Tensor;
+using exec_aten::TensorImpl;
+using executorch::runtime::ArrayRef;
+using executorch::runtime::CachingDynamicTensorAllocator;
+using executorch::runtime::DynamicTensorAllocator;
+using executorch::runtime::Error;
+using executorch::runtime::resize_tensor;
+using executorch::runtime::TensorShapeDynamism;
+
+class CachingDynamicTensorAllocatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    executorch::runtime::runtime_init();
+  }
+};
+
+TEST_F(CachingDynamicTensorAllocatorTest, AlignsAndRoundsUpToSizeClasses) {
+  CachingDynamicTensorAllocator allocator;
+
+  void* small = allocator.allocate(1);
+  ASSERT_NE(small, nullptr);
+  EXPECT_EQ(
+      reinterpret_cast<uintptr_t>(small) % DynamicTensorAllocator::kAlignment,
+      0);
+  EXPECT_EQ(allocator.bytes_in_use(), 64);
+
+  // 1000 bytes is between 512 and 1024, which are split into classes of 128.
+  void* large = allocator.allocate(1000);
+  ASSERT_NE(large, nullptr);
+  EXPECT_EQ(
+      reinterpret_cast<uintptr_t>(large) % DynamicTensorAllocator::kAlignment,
+      0);
+  EXPECT_EQ(allocator.bytes_in_use(), 64 + 1024);
+
+  // The buffers are usable for the full requested size.
+  memset(small, 0xa5, 1);
+  memset(large, 0x5a, 1000);
+
+  allocator.release(small, 1);
+  allocator.release(large, 1000);
+  EXPECT_EQ(allocator.bytes_in_use(), 0);
+  EXPECT_EQ(allocator.peak_bytes_in_use(), 64 + 1024);
+}
+
+TEST_F(CachingDynamicTensorAllocatorTest, ReusesReleasedBuffers) {
+  CachingDynamicTensorAllocator allocator;
+
+  void* a = allocator.allocate(4000);
+  ASSERT_NE(a, nullptr);
+  const size_t reserved = allocator.bytes_reserved();
+  allocator.release(a, 4000);
+
+  // Same size class: gets the cached buffer back.
+  void* b = allocator.allocate(3900);
+  EXPECT_EQ(b, a);
+  EXPECT_EQ(allocator.bytes_reserved(), reserved);
+
+  // Different size class while b is in use: needs a new buffer.
+  void* c = allocator.allocate(100);
+  ASSERT_NE(c, nullptr);
+  EXPECT_NE(c, b);
+  EXPECT_GT(allocator.bytes_reserved(), reserved);
+
+  allocator.release(b, 3900);
+  allocator.release(c, 100);
+  EXPECT_EQ(allocator.bytes_in_use(), 0);
+}
+
+TEST_F(CachingDynamicTensorAllocatorTest, UnboundedTensorGrowsIntoAllocator) {
+  CachingDynamicTensorAllocator allocator;
+
+  TensorImpl::SizesType sizes[2] = {2, 3};
+  TensorImpl::DimOrderType dim_order[2] = {0, 1};
+  TensorImpl::StridesType strides[2] = {3, 1};
+  float data[6] = {1, 2, 3, 4, 5, 6};
+  TensorImpl impl(
+      ScalarType::Float,
+      2,
+      sizes,
+      data,
+      dim_order,
+      strides,
+      TensorShapeDynamism::DYNAMIC_UNBOUND);
+  impl.set_dynamic_allocator(&allocator);
+  Tensor t(&impl);
+
+  // Shrinking and growing back stays in the original buffer.
+  EXPECT_EQ(
+      resize_tensor(t, ArrayRef<TensorImpl::SizesType>({1, 3})), Error::Ok);
+  EXPECT_EQ(
+      resize_tensor(t, ArrayRef<TensorImpl::SizesType>({2, 3})), Error::Ok);
+  EXPECT_EQ(t.const_data_ptr<float>(), data);
+  EXPECT_EQ(allocator.bytes_in_use(), 0);
+
+  // Growing past it moves the tensor into the allocator, keeping its contents.
+  EXPECT_EQ(
+      resize_tensor(t, ArrayRef<TensorImpl::SizesType>({200, 3})), Error::Ok);
+  EXPECT_EQ(t.numel(), 600);
+  EXPECT_EQ(t.strides()[0], 3);
+  const float* grown = t.const_data_ptr<float>();
+  EXPECT_NE(grown, data);
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_EQ(grown[i], data[i]);
+  }
+  EXPECT_GE(allocator.bytes_in_use(), 600 * sizeof(float));
+
+  // Resetting the data, as a FreeCall does, gives the buffer back, and the
+  // next resize to the same size reuses it.
+  executorch::runtime::internal::reset_data_ptr(t);
+  EXPECT_EQ(t.const_data_ptr(), nullptr);
+  EXPECT_EQ(allocator.bytes_in_use(), 0);
+  EXPECT_EQ(
+      resize_tensor(t, ArrayRef<TensorImpl::SizesType>({1, 3})), Error::Ok);
+  EXPECT_EQ(
+      resize_tensor(t, ArrayRef<TensorImpl::SizesType>({200, 3})), Error::Ok);
+  EXPECT_EQ(t.const_data_ptr<float>(), grown);
+
+  t.unsafeGetTensorImpl()->set_data(nullptr);
+  EXPECT_EQ(allocator.bytes_in_use(), 0);
+}
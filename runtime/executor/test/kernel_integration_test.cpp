@@ -72,6 +72,9 @@ struct KernelControl {
   // The total size of all allocations.
   int total_allocated_size = 0;
 
+  // The temporary memory returned by the most recent allocation.
+  void* last_temp_memory = nullptr;
+
   void reset() {
     call_count = 0;
     call_context_fail = false;
@@ -80,6 +83,7 @@ struct KernelControl {
     simulate_temp_memory_allocation = false;
     temp_memory_size = 0;
     total_allocated_size = 0;
+    last_temp_memory = nullptr;
   }
 
   /**
@@ -141,6 +145,7 @@ struct KernelControl {
           context.allocate_temp(control->temp_memory_size);
       if (temp_mem_res.ok()) {
         control->total_allocated_size += control->temp_memory_size;
+        control->last_temp_memory = temp_mem_res.get();
         // We actually use the memory, to test default memory allocation was
         // successful.
         uint8_t* array = (uint8_t*)(temp_mem_res.get());
@@ -342,6 +347,38 @@ TEST_F(KernelIntegrationTest, DefaultPlatformMemoryAllocator) {
   EXPECT_EQ(control_->total_allocated_size, 12);
 }
 
+TEST_F(KernelIntegrationTest, DefaultTempMemoryIsStableAcrossExecutions) {
+  // The default temp allocator learns the temp memory high-water mark during
+  // the first execution and then serves the same requests from a single
+  // pre-planned arena, so later executions get the same address back.
+  control_->allocate_temp_memory = true;
+  control_->temp_memory_size = 64;
+
+  Error err = method_->execute();
+  EXPECT_EQ(err, Error::Ok);
+
+  err = method_->execute();
+  EXPECT_EQ(err, Error::Ok);
+  void* planned_temp_memory = control_->last_temp_memory;
+  ASSERT_NE(planned_temp_memory, nullptr);
+
+  err = method_->execute();
+  EXPECT_EQ(err, Error::Ok);
+  EXPECT_EQ(control_->last_temp_memory, planned_temp_memory);
+
+  // Larger requests still succeed, and the arena grows to cover them.
+  control_->temp_memory_size = 64 * 1024;
+  err = method_->execute();
+  EXPECT_EQ(err, Error::Ok);
+  err = method_->execute();
+  EXPECT_EQ(err, Error::Ok);
+  planned_temp_memory = control_->last_temp_memory;
+  err = method_->execute();
+  EXPECT_EQ(err, Error::Ok);
+  EXPECT_EQ(control_->last_temp_memory, planned_temp_memory);
+  EXPECT_EQ(control_->call_count, 6);
+}
+
 TEST_F(KernelTempMemoryAllocatorIntegrationTest, UsingTempMemoryAllocator) {
   // In this test we provide a temp allocator to the method, and tell the kernel
   // to allocate memory using it. We want to make sure that the kernel uses the
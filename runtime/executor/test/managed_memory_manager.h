@@ -11,6 +11,7 @@
 #include <memory>
 #include <vector>
 
+#include <executorch/runtime/core/dynamic_tensor_allocator.h>
 #include <executorch/runtime/core/hierarchical_allocator.h>
 #include <executorch/runtime/core/memory_allocator.h>
 #include <executorch/runtime/executor/memory_manager.h>
@@ -28,7 +29,8 @@ class ManagedMemoryManager {
   ManagedMemoryManager(
       size_t planned_memory_bytes,
       size_t method_allocator_bytes,
-      MemoryAllocator* temp_allocator = nullptr)
+      MemoryAllocator* temp_allocator = nullptr,
+      DynamicTensorAllocator* dynamic_tensor_allocator = nullptr)
       : planned_memory_buffer_(new uint8_t[planned_memory_bytes]),
         planned_memory_span_(
             planned_memory_buffer_.get(),
@@ -36,7 +38,11 @@ class ManagedMemoryManager {
         planned_memory_({&planned_memory_span_, 1}),
         method_allocator_pool_(new uint8_t[method_allocator_bytes]),
         method_allocator_(method_allocator_bytes, method_allocator_pool_.get()),
-        memory_manager_(&method_allocator_, &planned_memory_, temp_allocator) {}
+        memory_manager_(
+            &method_allocator_,
+            &planned_memory_,
+            temp_allocator,
+            dynamic_tensor_allocator) {}
 
   MemoryManager& get() {
     return memory_manager_;
@@ -9,11 +9,13 @@
 #include <executorch/runtime/executor/memory_manager.h>
 
 #include <executorch/runtime/core/memory_allocator.h>
+#include <executorch/runtime/executor/caching_dynamic_tensor_allocator.h>
 
 #include <executorch/test/utils/DeathTest.h>
 #include <gtest/gtest.h>
 
 using namespace ::testing;
+using executorch::runtime::CachingDynamicTensorAllocator;
 using executorch::runtime::HierarchicalAllocator;
 using executorch::runtime::MemoryAllocator;
 using executorch::runtime::MemoryManager;
@@ -26,6 +28,7 @@ TEST(MemoryManagerTest, MinimalCtor) {
   EXPECT_EQ(mm.method_allocator(), &method_allocator);
   EXPECT_EQ(mm.planned_memory(), nullptr);
   EXPECT_EQ(mm.temp_allocator(), nullptr);
+  EXPECT_EQ(mm.dynamic_tensor_allocator(), nullptr);
 }
 
 TEST(MemoryManagerTest, CtorWithPlannedMemory) {
@@ -51,6 +54,24 @@ TEST(MemoryManagerTest, CtorWithPlannedMemoryAndTemp) {
   EXPECT_EQ(mm.temp_allocator(), &temp_allocator);
 }
 
+TEST(MemoryManagerTest, CtorWithDynamicTensorAllocator) {
+  MemoryAllocator method_allocator(0, nullptr);
+  HierarchicalAllocator planned_memory({});
+  MemoryAllocator temp_allocator(0, nullptr);
+  CachingDynamicTensorAllocator dynamic_tensor_allocator;
+
+  MemoryManager mm(
+      &method_allocator,
+      &planned_memory,
+      &temp_allocator,
+      &dynamic_tensor_allocator);
+
+  EXPECT_EQ(mm.method_allocator(), &method_allocator);
+  EXPECT_EQ(mm.planned_memory(), &planned_memory);
+  EXPECT_EQ(mm.temp_allocator(), &temp_allocator);
+  EXPECT_EQ(mm.dynamic_tensor_allocator(), &dynamic_tensor_allocator);
+}
+
 TEST(MemoryManagerTest, DEPRECATEDCtor) {
   MemoryAllocator method_allocator(0, nullptr);
   HierarchicalAllocator planned_memory({});
@@ -7,11 +7,17 @@
  */
 
 #include <cstdlib>
+#include <cstring>
 #include <filesystem>
+#include <string>
+#include <vector>
 
 #include <executorch/extension/data_loader/file_data_loader.h>
+#include <executorch/extension/flat_tensor/flat_tensor_data_map.h>
 #include <executorch/extension/runner_util/inputs.h>
 #include <executorch/runtime/core/exec_aten/exec_aten.h>
+#include <executorch/runtime/core/named_data_map.h>
+#include <executorch/runtime/executor/caching_dynamic_tensor_allocator.h>
 #include <executorch/runtime/executor/method.h>
 #include <executorch/runtime/executor/program.h>
 #include <executorch/runtime/executor/test/managed_memory_manager.h>
@@ -21,16 +27,102 @@
 
 using namespace ::testing;
 using exec_aten::ArrayRef;
+using executorch::extension::FlatTensorDataMap;
 using executorch::extension::prepare_input_tensors;
+using executorch::runtime::CachingDynamicTensorAllocator;
 using executorch::runtime::Error;
+using executorch::aten::ScalarType;
 using executorch::runtime::EValue;
+using executorch::runtime::FreeableBuffer;
 using executorch::runtime::Method;
+using executorch::runtime::NamedDataMap;
 using executorch::runtime::Program;
 using executorch::runtime::Result;
+using executorch::runtime::Span;
+using executorch::runtime::TensorLayout;
 using executorch::runtime::testing::ManagedMemoryManager;
 using torch::executor::util::FileDataLoader;
 
 constexpr size_t kDefaultNonConstMemBytes = 32 * 1024U;
+
+namespace {
+
+/// Holds one contiguous tensor per key in memory.
+class InMemoryDataMap final : public NamedDataMap {
+ public:
+  struct Entry {
+    std::string key;
+    ScalarType type;
+    std::vector<int32_t> sizes;
+    std::vector<float> data;
+  };
+
+  explicit InMemoryDataMap(std::vector<Entry> entries)
+      : entries_(std::move(entries)) {}
+
+  Result<TensorLayout> get_metadata(const char* key) const override {
+    const Entry* entry = find(key);
+    if (entry == nullptr) {
+      return Error::NotFound;
+    }
+    return TensorLayout::create(
+        Span<const int32_t>(entry->sizes.data(), entry->sizes.size()),
+        Span<const uint8_t>(kDimOrder, entry->sizes.size()),
+        entry->type);
+  }
+
+  Result<FreeableBuffer> get_data(const char* key) const override {
+    const Entry* entry = find(key);
+    if (entry == nullptr) {
+      return Error::NotFound;
+    }
+    return FreeableBuffer(
+        entry->data.data(), entry->data.size() * sizeof(float), nullptr);
+  }
+
+  Error load_data_into(const char* key, void* buffer, size_t size)
+      const override {
+    const Entry* entry = find(key);
+    if (entry == nullptr) {
+      return Error::NotFound;
+    }
+    if (size < entry->data.size() * sizeof(float)) {
+      return Error::InvalidArgument;
+    }
+    std::memcpy(buffer, entry->data.data(), entry->data.size() * sizeof(float));
+    return Error::Ok;
+  }
+
+  Result<size_t> get_num_keys() const override {
+    return entries_.size();
+  }
+
+  Result<const char*> get_key(size_t index) const override {
+    if (index >= entries_.size()) {
+      return Error::InvalidArgument;
+    }
+    return entries_[index].key.c_str();
+  }
+
+ private:
+  static constexpr uint8_t kDimOrder[2] = {0, 1};
+
+  const Entry* find(const char* key) const {
+    for (const Entry& entry : entries_) {
+      if (entry.key == key) {
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+  std::vector<Entry> entries_;
+};
+
+constexpr uint8_t InMemoryDataMap::kDimOrder[2];
+
+} // namespace
+
 constexpr size_t kDefaultRuntimeMemBytes = 32 * 1024U;
 
 class MethodTest : public ::testing::Test {
@@ -56,10 +148,19 @@ class MethodTest : public ::testing::Test {
     executorch::runtime::runtime_init();
 
     load_program(std::getenv("ET_MODULE_ADD_PATH"), "add");
+    load_program(
+        std::getenv("ET_MODULE_ADD_CONST_RETURN_PATH"), "add_const_return");
+    load_program(std::getenv("ET_MODULE_ADD_EXTERNAL_PTE_PATH"), "add_external");
+    load_program(std::getenv("ET_MODULE_ADD_UNBOUND_PATH"), "add_unbound");
+    load_program(
+        std::getenv("ET_MODULE_ADD_UNDERSIZED_PLAN_PATH"), "undersized_plan");
     load_program(std::getenv("ET_MODULE_INDEX_PATH"), "index");
     load_program(
         std::getenv("ET_MODULE_DYNAMIC_CAT_UNALLOCATED_IO_PATH"), "cat");
+    load_program(
+        std::getenv("ET_MODULE_DYNAMIC_SHAPE_BUCKETS_PATH"), "shape_buckets");
     load_program(std::getenv("ET_MODULE_LINEAR_PATH"), "linear");
+    load_program(std::getenv("ET_MODULE_STATEFUL_PATH"), "stateful");
     load_program(
         std::getenv("DEPRECATED_ET_MODULE_LINEAR_CONSTANT_BUFFER_PATH"),
         "linear_constant_buffer");
@@ -268,6 +369,399 @@ TEST_F(MethodTest, AliasedIOTest) {
   }
 }
 
+TEST_F(MethodTest, BindInputsAndOutputsTest) {
+  ManagedMemoryManager mmm(kDefaultNonConstMemBytes, kDefaultRuntimeMemBytes);
+  Result<Method> method = programs_["add"]->load_method("forward", &mmm.get());
+  ASSERT_EQ(method.error(), Error::Ok);
+  // Sets alpha, which is not a tensor.
+  auto input_cleanup = prepare_input_tensors(*method);
+  ASSERT_EQ(input_cleanup.error(), Error::Ok);
+
+  alignas(Method::kIOBindingAlignment) float x[4] = {1, 2, 3, 4};
+  alignas(Method::kIOBindingAlignment) float y[4] = {10, 20, 30, 40};
+  alignas(Method::kIOBindingAlignment) float out[4] = {};
+  int32_t sizes[2] = {2, 2};
+  uint8_t dim_order[2] = {0, 1};
+  int32_t strides[2] = {2, 1};
+  exec_aten::TensorImpl x_impl(
+      exec_aten::ScalarType::Float, 2, sizes, x, dim_order, strides);
+  exec_aten::TensorImpl y_impl(
+      exec_aten::ScalarType::Float, 2, sizes, y, dim_order, strides);
+
+  // The inputs and output are memory-planned, but get aliased instead.
+  ASSERT_EQ(
+      method->bind_input(EValue(exec_aten::Tensor(&x_impl)), 0), Error::Ok);
+  ASSERT_EQ(
+      method->bind_input(EValue(exec_aten::Tensor(&y_impl)), 1), Error::Ok);
+  ASSERT_EQ(method->bind_output(out, sizeof(out), 0), Error::Ok);
+  EXPECT_EQ(method->get_output(0).toTensor().const_data_ptr(), out);
+
+  ASSERT_EQ(method->execute(), Error::Ok);
+  EXPECT_FLOAT_EQ(out[0], 11.f);
+  EXPECT_FLOAT_EQ(out[1], 22.f);
+  EXPECT_FLOAT_EQ(out[2], 33.f);
+  EXPECT_FLOAT_EQ(out[3], 44.f);
+
+  // Misaligned and short buffers are rejected.
+  EXPECT_EQ(
+      method->bind_output(out + 1, sizeof(out) - sizeof(float), 0),
+      Error::InvalidArgument);
+  EXPECT_EQ(
+      method->bind_output(out, sizeof(out) - sizeof(float), 0),
+      Error::InvalidArgument);
+
+  // set_input() copies into the planned buffer again, not into x.
+  float x2[4] = {5, 5, 5, 5};
+  exec_aten::TensorImpl x2_impl(
+      exec_aten::ScalarType::Float, 2, sizes, x2, dim_order, strides);
+  ASSERT_EQ(
+      method->set_input(EValue(exec_aten::Tensor(&x2_impl)), 0), Error::Ok);
+  EXPECT_FLOAT_EQ(x[0], 1.f);
+
+  // After resetting the bindings, the output no longer goes to out.
+  ASSERT_EQ(method->reset_io_bindings(), Error::Ok);
+  ASSERT_EQ(
+      method->set_input(EValue(exec_aten::Tensor(&y_impl)), 1), Error::Ok);
+  EXPECT_NE(method->get_output(0).toTensor().const_data_ptr(), out);
+  ASSERT_EQ(method->execute(), Error::Ok);
+  EXPECT_FLOAT_EQ(out[0], 11.f);
+  EXPECT_FLOAT_EQ(
+      method->get_output(0).toTensor().const_data_ptr<float>()[0], 15.f);
+}
+
+TEST_F(MethodTest, BindConstantOutputTest) {
+  // The model returns (x + c, c) for a constant c of ones.
+  ManagedMemoryManager mmm(kDefaultNonConstMemBytes, kDefaultRuntimeMemBytes);
+  Result<Method> method =
+      programs_["add_const_return"]->load_method("forward", &mmm.get());
+  ASSERT_EQ(method.error(), Error::Ok);
+  auto input_cleanup = prepare_input_tensors(*method);
+  ASSERT_EQ(input_cleanup.error(), Error::Ok);
+
+  auto method_meta = method->method_meta();
+  ASSERT_EQ(method_meta.num_outputs(), 2);
+  // Constants count as memory planned, but have no planned buffer to bind.
+  EXPECT_TRUE(method_meta.output_tensor_meta(1)->is_memory_planned());
+  const void* constant_data = method->get_output(1).toTensor().const_data_ptr();
+
+  alignas(Method::kIOBindingAlignment) float out[4] = {};
+  alignas(Method::kIOBindingAlignment) float const_out[4] = {};
+  EXPECT_EQ(
+      method->bind_output(const_out, sizeof(const_out), 1),
+      Error::InvalidArgument);
+  EXPECT_EQ(method->get_output(1).toTensor().const_data_ptr(), constant_data);
+  ASSERT_EQ(method->bind_output(out, sizeof(out), 0), Error::Ok);
+
+  ASSERT_EQ(method->execute(), Error::Ok);
+  EXPECT_FLOAT_EQ(out[0], 2.f);
+  EXPECT_FLOAT_EQ(const_out[0], 0.f);
+
+  // Resetting skips the constant output and still resets the other one.
+  ASSERT_EQ(method->reset_io_bindings(), Error::Ok);
+  EXPECT_NE(method->get_output(0).toTensor().const_data_ptr(), out);
+  EXPECT_EQ(method->get_output(1).toTensor().const_data_ptr(), constant_data);
+  ASSERT_EQ(method->execute(), Error::Ok);
+  EXPECT_FLOAT_EQ(
+      method->get_output(1).toTensor().const_data_ptr<float>()[0], 1.f);
+}
+
+TEST_F(MethodTest, ExternalConstantsTest) {
+  // The model returns x + w, where w is stored in a .ptd file under
+  // "add.weight" and holds {1, 2, 3, 4}.
+  Result<FileDataLoader> ptd_loader =
+      FileDataLoader::from(std::getenv("ET_MODULE_ADD_EXTERNAL_PTD_PATH"));
+  ASSERT_EQ(ptd_loader.error(), Error::Ok);
+  Result<FlatTensorDataMap> data_map =
+      FlatTensorDataMap::load(&ptd_loader.get());
+  ASSERT_EQ(data_map.error(), Error::Ok);
+
+  // The method can't be loaded without a map to find w in.
+  ManagedMemoryManager no_map_mmm(
+      kDefaultNonConstMemBytes, kDefaultRuntimeMemBytes);
+  EXPECT_EQ(
+      programs_["add_external"]
+          ->load_method("forward", &no_map_mmm.get())
+          .error(),
+      Error::InvalidArgument);
+
+  ManagedMemoryManager mmm(kDefaultNonConstMemBytes, kDefaultRuntimeMemBytes);
+  Result<Method> method = programs_["add_external"]->load_method(
+      "forward",
+      &mmm.get(),
+      /*event_tracer=*/nullptr,
+      &data_map.get());
+  ASSERT_EQ(method.error(), Error::Ok);
+  auto input_cleanup = prepare_input_tensors(*method);
+  ASSERT_EQ(input_cleanup.error(), Error::Ok);
+
+  ASSERT_EQ(method->execute(), Error::Ok);
+  const float* out = method->get_output(0).toTensor().const_data_ptr<float>();
+  EXPECT_FLOAT_EQ(out[0], 2.f);
+  EXPECT_FLOAT_EQ(out[1], 3.f);
+  EXPECT_FLOAT_EQ(out[2], 4.f);
+  EXPECT_FLOAT_EQ(out[3], 5.f);
+}
+
+TEST_F(MethodTest, BindExternalConstantsTest) {
+  Result<FileDataLoader> ptd_loader =
+      FileDataLoader::from(std::getenv("ET_MODULE_ADD_EXTERNAL_PTD_PATH"));
+  ASSERT_EQ(ptd_loader.error(), Error::Ok);
+  Result<FlatTensorDataMap> data_map =
+      FlatTensorDataMap::load(&ptd_loader.get());
+  ASSERT_EQ(data_map.error(), Error::Ok);
+
+  ManagedMemoryManager mmm(kDefaultNonConstMemBytes, kDefaultRuntimeMemBytes);
+  Result<Method> method = programs_["add_external"]->load_method(
+      "forward",
+      &mmm.get(),
+      /*event_tracer=*/nullptr,
+      &data_map.get());
+  ASSERT_EQ(method.error(), Error::Ok);
+  auto input_cleanup = prepare_input_tensors(*method);
+  ASSERT_EQ(input_cleanup.error(), Error::Ok);
+
+  // Maps that don't fit the 2x2 float weight are rejected.
+  InMemoryDataMap wrong_size(
+      {{"add.weight", ScalarType::Float, {2, 1}, {10.f, 20.f}}});
+  EXPECT_EQ(
+      method->bind_external_constants(&wrong_size),
+      Error::InvalidExternalData);
+  InMemoryDataMap wrong_type(
+      {{"add.weight", ScalarType::Int, {2, 2}, {0.f, 0.f, 0.f, 0.f}}});
+  EXPECT_EQ(
+      method->bind_external_constants(&wrong_type),
+      Error::InvalidExternalData);
+  InMemoryDataMap unknown_key(
+      {{"mul.weight", ScalarType::Float, {2, 2}, {0.f, 0.f, 0.f, 0.f}}});
+  EXPECT_EQ(method->bind_external_constants(&unknown_key), Error::NotFound);
+  EXPECT_EQ(method->bind_external_constants(nullptr), Error::InvalidArgument);
+
+  // None of the failed binds changed the weight.
+  ASSERT_EQ(method->execute(), Error::Ok);
+  const float* out = method->get_output(0).toTensor().const_data_ptr<float>();
+  EXPECT_FLOAT_EQ(out[0], 2.f);
+  EXPECT_FLOAT_EQ(out[3], 5.f);
+
+  // Keys the method doesn't use are ignored next to ones it does.
+  InMemoryDataMap new_weight(
+      {{"mul.weight", ScalarType::Float, {2, 2}, {0.f, 0.f, 0.f, 0.f}},
+       {"add.weight", ScalarType::Float, {2, 2}, {10.f, 20.f, 30.f, 40.f}}});
+  ASSERT_EQ(method->bind_external_constants(&new_weight), Error::Ok);
+  ASSERT_EQ(method->execute(), Error::Ok);
+  out = method->get_output(0).toTensor().const_data_ptr<float>();
+  EXPECT_FLOAT_EQ(out[0], 11.f);
+  EXPECT_FLOAT_EQ(out[1], 21.f);
+  EXPECT_FLOAT_EQ(out[2], 31.f);
+  EXPECT_FLOAT_EQ(out[3], 41.f);
+
+  // Binding the original file again restores the first result.
+  ASSERT_EQ(method->bind_external_constants(&data_map.get()), Error::Ok);
+  ASSERT_EQ(method->execute(), Error::Ok);
+  out = method->get_output(0).toTensor().const_data_ptr<float>();
+  EXPECT_FLOAT_EQ(out[0], 2.f);
+  EXPECT_FLOAT_EQ(out[3], 5.f);
+}
+
+TEST_F(MethodTest, ShapeSpecializedMemoryPlansTest) {
+  // The model computes cat((x * 2, x * 2)) + 1 for x of up to 64 rows, and
+  // has memory plans for x of up to 4 and 16 rows.
+  ManagedMemoryManager mmm(kDefaultNonConstMemBytes, kDefaultRuntimeMemBytes);
+  Result<Method> method =
+      programs_["shape_buckets"]->load_method("forward", &mmm.get());
+  ASSERT_EQ(method.error(), Error::Ok);
+
+  float input_data[64 * 8];
+  for (int i = 0; i < 64 * 8; ++i) {
+    input_data[i] = static_cast<float>(i);
+  }
+  int32_t sizes[2] = {0, 8};
+  uint8_t dim_order[2] = {0, 1};
+  int32_t strides[2] = {8, 1};
+
+  // Run with inputs that need the small plan, the default plan, the larger
+  // specialized plan and the small plan again. Switching plans must not affect
+  // the results.
+  int32_t rows_per_run[4] = {3, 40, 10, 3};
+  for (int run = 0; run < 4; ++run) {
+    const int32_t rows = rows_per_run[run];
+    sizes[0] = rows;
+    exec_aten::TensorImpl impl(
+        exec_aten::ScalarType::Float,
+        2,
+        sizes,
+        input_data,
+        dim_order,
+        strides);
+    ASSERT_EQ(
+        method->set_input(EValue(exec_aten::Tensor(&impl)), 0), Error::Ok);
+    ASSERT_EQ(method->execute(), Error::Ok);
+
+    const auto output = method->get_output(0).toTensor();
+    ASSERT_EQ(output.sizes()[0], 2 * rows);
+    ASSERT_EQ(output.sizes()[1], 8);
+    const float* data = output.const_data_ptr<float>();
+    for (int i = 0; i < 2 * rows * 8; ++i) {
+      EXPECT_FLOAT_EQ(data[i], input_data[i % (rows * 8)] * 2 + 1);
+    }
+  }
+}
+
+TEST_F(MethodTest, ResizePastShapeSpecializedMemoryPlanTest) {
+  // The model computes x + x for x of up to 8 rows. Its plan for x of up to 4
+  // rows puts the output in front of x, with only enough room for 2 rows.
+  ManagedMemoryManager mmm(kDefaultNonConstMemBytes, kDefaultRuntimeMemBytes);
+  Result<Method> method =
+      programs_["undersized_plan"]->load_method("forward", &mmm.get());
+  ASSERT_EQ(method.error(), Error::Ok);
+
+  float input_data[8 * 2];
+  for (int i = 0; i < 8 * 2; ++i) {
+    input_data[i] = static_cast<float>(i);
+  }
+  int32_t sizes[2] = {0, 2};
+  uint8_t dim_order[2] = {0, 1};
+  int32_t strides[2] = {2, 1};
+
+  // The output fits in its slot at 2 rows, but not at 4, where resizing it
+  // must fail instead of overwriting x. The default plan holds it at 8 rows.
+  int32_t rows_per_run[3] = {2, 4, 8};
+  Error expected_error[3] = {Error::Ok, Error::InvalidArgument, Error::Ok};
+  for (int run = 0; run < 3; ++run) {
+    const int32_t rows = rows_per_run[run];
+    sizes[0] = rows;
+    exec_aten::TensorImpl impl(
+        exec_aten::ScalarType::Float,
+        2,
+        sizes,
+        input_data,
+        dim_order,
+        strides);
+    ASSERT_EQ(
+        method->set_input(EValue(exec_aten::Tensor(&impl)), 0), Error::Ok);
+    const float* input =
+        method->get_input(0).toTensor().const_data_ptr<float>();
+    ASSERT_EQ(method->execute(), expected_error[run]);
+
+    for (int i = 0; i < rows * 2; ++i) {
+      EXPECT_FLOAT_EQ(input[i], input_data[i]);
+    }
+    if (expected_error[run] != Error::Ok) {
+      continue;
+    }
+    const auto output = method->get_output(0).toTensor();
+    ASSERT_EQ(output.sizes()[0], rows);
+    const float* data = output.const_data_ptr<float>();
+    for (int i = 0; i < rows * 2; ++i) {
+      EXPECT_FLOAT_EQ(data[i], input_data[i] * 2);
+    }
+  }
+}
+
+TEST_F(MethodTest, UnboundIntermediateTest) {
+  // The model computes (x + x) + x for x of up to 16 rows of 16 floats. The
+  // intermediate x + x is unbounded, so its storage comes from the allocator.
+  CachingDynamicTensorAllocator allocator;
+  constexpr size_t kRowBytes = 16 * sizeof(float);
+
+  float input_data[16 * 16];
+  for (int i = 0; i < 16 * 16; ++i) {
+    input_data[i] = static_cast<float>(i);
+  }
+  int32_t sizes[2] = {0, 16};
+  uint8_t dim_order[2] = {0, 1};
+  int32_t strides[2] = {16, 1};
+
+  {
+    ManagedMemoryManager mmm(
+        kDefaultNonConstMemBytes,
+        kDefaultRuntimeMemBytes,
+        /*temp_allocator=*/nullptr,
+        &allocator);
+    Result<Method> method =
+        programs_["add_unbound"]->load_method("forward", &mmm.get());
+    ASSERT_EQ(method.error(), Error::Ok);
+    EXPECT_EQ(allocator.bytes_reserved(), 0);
+
+    // The intermediate grows to 2 rows, then to 8, giving back the buffer for
+    // 2 rows. At 4 rows it fits in the buffer for 8, so nothing is allocated.
+    int32_t rows_per_run[3] = {2, 8, 4};
+    size_t bytes_in_use[3] = {2 * kRowBytes, 8 * kRowBytes, 8 * kRowBytes};
+    size_t bytes_reserved[3] = {
+        2 * kRowBytes, 10 * kRowBytes, 10 * kRowBytes};
+    for (int run = 0; run < 3; ++run) {
+      const int32_t rows = rows_per_run[run];
+      sizes[0] = rows;
+      exec_aten::TensorImpl impl(
+          exec_aten::ScalarType::Float,
+          2,
+          sizes,
+          input_data,
+          dim_order,
+          strides);
+      ASSERT_EQ(
+          method->set_input(EValue(exec_aten::Tensor(&impl)), 0), Error::Ok);
+      ASSERT_EQ(method->execute(), Error::Ok);
+
+      EXPECT_EQ(allocator.bytes_in_use(), bytes_in_use[run]);
+      EXPECT_EQ(allocator.bytes_reserved(), bytes_reserved[run]);
+
+      const auto output = method->get_output(0).toTensor();
+      ASSERT_EQ(output.sizes()[0], rows);
+      const float* data = output.const_data_ptr<float>();
+      for (int i = 0; i < rows * 16; ++i) {
+        EXPECT_FLOAT_EQ(data[i], input_data[i] * 3);
+      }
+    }
+  }
+
+  // Destroying the Method gives the intermediate's storage back. Growing to 8
+  // rows held both buffers while copying.
+  EXPECT_EQ(allocator.bytes_in_use(), 0);
+  EXPECT_EQ(allocator.peak_bytes_in_use(), 10 * kRowBytes);
+}
+
+TEST_F(MethodTest, StateTest) {
+  // The model adds its input to a 2x2 buffer that starts at one, and returns
+  // the new buffer plus the input.
+  ManagedMemoryManager mmm(kDefaultNonConstMemBytes, kDefaultRuntimeMemBytes);
+  Result<Method> method =
+      programs_["stateful"]->load_method("forward", &mmm.get());
+  ASSERT_EQ(method.error(), Error::Ok);
+  ASSERT_EQ(method->state_nbytes(), 4 * sizeof(float));
+
+  float x[4] = {1, 1, 1, 1};
+  int32_t sizes[2] = {2, 2};
+  uint8_t dim_order[2] = {0, 1};
+  int32_t strides[2] = {2, 1};
+  exec_aten::TensorImpl impl(
+      exec_aten::ScalarType::Float, 2, sizes, x, dim_order, strides);
+  ASSERT_EQ(method->set_input(EValue(exec_aten::Tensor(&impl)), 0), Error::Ok);
+
+  auto run = [&]() {
+    EXPECT_EQ(method->execute(), Error::Ok);
+    return method->get_output(0).toTensor().const_data_ptr<float>()[0];
+  };
+
+  // The state persists across executions.
+  EXPECT_FLOAT_EQ(run(), 3.f);
+  EXPECT_FLOAT_EQ(run(), 4.f);
+
+  float saved[4];
+  EXPECT_EQ(
+      method->save_state(saved, sizeof(saved) - 1), Error::InvalidArgument);
+  ASSERT_EQ(method->save_state(saved, sizeof(saved)), Error::Ok);
+  EXPECT_FLOAT_EQ(saved[0], 3.f);
+  EXPECT_FLOAT_EQ(run(), 5.f);
+
+  // Restoring goes back to the saved state.
+  ASSERT_EQ(method->restore_state(saved, sizeof(saved)), Error::Ok);
+  EXPECT_FLOAT_EQ(run(), 5.f);
+
+  // Resetting goes back to the initial state.
+  ASSERT_EQ(method->reset_state(), Error::Ok);
+  EXPECT_FLOAT_EQ(run(), 3.f);
+}
+
 TEST_F(MethodTest, ConstantSegmentTest) {
   // Execute model with constants stored in segment.
   ManagedMemoryManager mmm(kDefaultNonConstMemBytes, kDefaultRuntimeMemBytes);
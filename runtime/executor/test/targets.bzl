@@ -102,13 +102,24 @@ def define_common_targets(is_fbcode = False):
             # The tests use this var to find the program file to load. This uses
             # an fbcode target path because the authoring/export tools
             # intentionally don't work in xplat (since they're host-only tools).
+            "ET_MODULE_ADD_CONST_RETURN_PATH": "$(location fbcode//executorch/test/models:exported_programs[ModuleAddConstReturn.pte])",
+            # Checked in, since the exporter does not emit external constants yet.
+            "ET_MODULE_ADD_EXTERNAL_PTD_PATH": "$(location fbcode//executorch/test/models/external_constants:ModuleAddExternal.ptd)",
+            "ET_MODULE_ADD_EXTERNAL_PTE_PATH": "$(location fbcode//executorch/test/models/external_constants:ModuleAddExternal.pte)",
             "ET_MODULE_ADD_HALF_PATH": "$(location fbcode//executorch/test/models:exported_programs[ModuleAddHalf.pte])",
             "ET_MODULE_ADD_PATH": "$(location fbcode//executorch/test/models:exported_programs[ModuleAdd.pte])",
+            # Checked in, since the exporter only emits unbounded tensors for
+            # data-dependent shapes.
+            "ET_MODULE_ADD_UNBOUND_PATH": "$(location fbcode//executorch/test/models/unbound_tensors:ModuleAddUnbound.pte)",
+            # Checked in, since the exporter never writes an undersized plan.
+            "ET_MODULE_ADD_UNDERSIZED_PLAN_PATH": "$(location fbcode//executorch/test/models/memory_plans:ModuleAddUndersizedPlan.pte)",
             "ET_MODULE_DYNAMIC_CAT_UNALLOCATED_IO_PATH": "$(location fbcode//executorch/test/models:exported_programs[ModuleDynamicCatUnallocatedIO.pte])",
+            "ET_MODULE_DYNAMIC_SHAPE_BUCKETS_PATH": "$(location fbcode//executorch/test/models:exported_programs[ModuleDynamicShapeBuckets.pte])",
             "ET_MODULE_INDEX_PATH": "$(location fbcode//executorch/test/models:exported_programs[ModuleIndex.pte])",
             "ET_MODULE_LINEAR_PATH": "$(location fbcode//executorch/test/models:exported_programs[ModuleLinear.pte])",
             "ET_MODULE_MULTI_ENTRY_PATH": "$(location fbcode//executorch/test/models:exported_programs[ModuleMultipleEntry.pte])",
             "ET_MODULE_SIMPLE_TRAIN_PATH": "$(location fbcode//executorch/test/models:exported_programs[ModuleSimpleTrain.pte])",
+            "ET_MODULE_STATEFUL_PATH": "$(location fbcode//executorch/test/models:exported_programs[ModuleStateful.pte])",
         }
 
         runtime.cxx_test(
@@ -135,6 +146,7 @@ def define_common_targets(is_fbcode = False):
                 ":managed_memory_manager",
                 "//executorch/runtime/executor:program",
                 "//executorch/extension/data_loader:file_data_loader",
+                "//executorch/extension/flat_tensor:flat_tensor_data_map",
                 "//executorch/extension/runner_util:inputs",
                 "//executorch/kernels/portable:generated_lib",
             ],
@@ -230,10 +242,23 @@ def define_common_targets(is_fbcode = False):
             ],
             deps = [
                 "//executorch/runtime/core:memory_allocator",
+                "//executorch/runtime/executor:caching_dynamic_tensor_allocator",
                 "//executorch/runtime/executor:memory_manager",
             ],
         )
 
+        runtime.cxx_test(
+            name = "caching_dynamic_tensor_allocator_test",
+            srcs = [
+                "caching_dynamic_tensor_allocator_test.cpp",
+            ],
+            deps = [
+                "//executorch/runtime/core/exec_aten:lib",
+                "//executorch/runtime/core/exec_aten/util:tensor_util",
+                "//executorch/runtime/executor:caching_dynamic_tensor_allocator",
+            ],
+        )
+
         runtime.cxx_test(
             name = "tensor_parser_test",
             srcs = [
@@ -73,6 +73,15 @@ class KernelRuntimeContext {
     return event_tracer_;
   }
 
+  /**
+   * Returns true if the context has a temp allocator, i.e. if allocate_temp()
+   * can succeed. Kernels with a fallback that needs no scratch memory can use
+   * this to skip allocate_temp(), which logs an error when it fails.
+   */
+  bool has_temp_allocator() const {
+    return temp_allocator_ != nullptr;
+  }
+
   /**
    * Allocates temporary memory that will be freed when the kernel returns. This
    * returns a pointer to the allocated memory or an error if the allocation
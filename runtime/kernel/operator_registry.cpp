@@ -36,7 +36,7 @@ constexpr uint32_t kMaxRegisteredKernels = kMaxOperators * kMaxKernelsPerOp;
 // until we add each entry to the table, allocate static zeroed memory instead
 // and point the table at it.
 // @lint-ignore CLANGTIDY facebook-hte-CArray
-alignas(sizeof(Kernel)) uint8_t
+alignas(Kernel) uint8_t
     registered_kernels_data[kMaxRegisteredKernels * sizeof(Kernel)];
 
 /// Global table of registered kernels.
@@ -45,6 +45,35 @@ Kernel* registered_kernels = reinterpret_cast<Kernel*>(registered_kernels_data);
 /// The number of kernels registered in the table.
 size_t num_registered_kernels = 0;
 
+/// Reports which KernelIsa variants this CPU can run. Null until a kernel
+/// library installs one, in which case only KernelIsa::Default is eligible.
+KernelIsaSupportFn kernel_isa_support_fn = nullptr;
+
+/// The most capable KernelIsa lookups may choose.
+KernelIsa max_kernel_isa = KernelIsa::SVE256;
+
+const char* kernel_isa_name(KernelIsa isa) {
+  switch (isa) {
+    case KernelIsa::Default:
+      return "DEFAULT";
+    case KernelIsa::AVX2:
+      return "AVX2";
+    case KernelIsa::AVX512:
+      return "AVX512";
+    case KernelIsa::SVE256:
+      return "SVE256";
+  }
+  return "UNKNOWN";
+}
+
+bool kernel_isa_is_eligible(KernelIsa isa) {
+  if (isa == KernelIsa::Default) {
+    return true;
+  }
+  return isa <= max_kernel_isa && kernel_isa_support_fn != nullptr &&
+      kernel_isa_support_fn(isa);
+}
+
 // Registers the kernels, but may return an error.
 Error register_kernels_internal(const Span<const Kernel> kernels) {
   // Operator registration happens in static initialization time before or after
@@ -81,8 +110,13 @@ Error register_kernels_internal(const Span<const Kernel> kernels) {
     for (int32_t i = 0; i < num_registered_kernels; i++) {
       Kernel k = registered_kernels[i];
       if (strcmp(kernel.name_, k.name_) == 0 &&
-          kernel.kernel_key_ == k.kernel_key_) {
-        ET_LOG(Error, "Re-registering %s, from %s", k.name_, lib_name);
+          kernel.kernel_key_ == k.kernel_key_ && kernel.isa_ == k.isa_) {
+        ET_LOG(
+            Error,
+            "Re-registering %s (%s), from %s",
+            k.name_,
+            kernel_isa_name(k.isa_),
+            lib_name);
         ET_LOG_KERNEL_KEY(k.kernel_key_);
         return Error::InvalidArgument;
       }
@@ -168,25 +202,51 @@ Result<OpFunction> get_op_function_from_registry(
   internal::make_kernel_key_string(meta_list, buf);
   KernelKey kernel_key = KernelKey(buf);
 
+  // Among the ISA variants of the matching kernel, keep the most capable one
+  // this CPU can run.
+  int32_t exact_idx = -1;
   int32_t fallback_idx = -1;
   for (size_t idx = 0; idx < num_registered_kernels; idx++) {
-    if (strcmp(registered_kernels[idx].name_, name) == 0) {
-      if (registered_kernels[idx].kernel_key_ == kernel_key) {
-        return registered_kernels[idx].op_;
+    const Kernel& k = registered_kernels[idx];
+    if (strcmp(k.name_, name) != 0 || !kernel_isa_is_eligible(k.isa_)) {
+      continue;
+    }
+    if (k.kernel_key_ == kernel_key) {
+      if (exact_idx == -1 || registered_kernels[exact_idx].isa_ < k.isa_) {
+        exact_idx = idx;
       }
-      if (registered_kernels[idx].kernel_key_.is_fallback()) {
+    } else if (k.kernel_key_.is_fallback()) {
+      if (fallback_idx == -1 ||
+          registered_kernels[fallback_idx].isa_ < k.isa_) {
         fallback_idx = idx;
       }
     }
   }
-  if (fallback_idx != -1) {
-    return registered_kernels[fallback_idx].op_;
+  const int32_t found_idx = exact_idx != -1 ? exact_idx : fallback_idx;
+  if (found_idx != -1) {
+    const Kernel& k = registered_kernels[found_idx];
+    if (k.isa_ != KernelIsa::Default) {
+      ET_LOG(Debug, "Using %s kernel for '%s'", kernel_isa_name(k.isa_), name);
+    }
+    return k.op_;
   }
   ET_LOG(Error, "kernel '%s' not found.", name);
   ET_LOG_TENSOR_META(meta_list);
   return Error::OperatorMissing;
 }
 
+void set_kernel_isa_support_fn(KernelIsaSupportFn fn) {
+  kernel_isa_support_fn = fn;
+}
+
+void set_max_kernel_isa(KernelIsa isa) {
+  max_kernel_isa = isa;
+}
+
+KernelIsa get_max_kernel_isa() {
+  return max_kernel_isa;
+}
+
 Span<const Kernel> get_registered_kernels() {
   return {registered_kernels, num_registered_kernels};
 }
@@ -167,11 +167,29 @@ struct KernelKey {
   bool is_fallback_;
 };
 
+/**
+ * Instruction set a kernel was compiled for. A kernel library may register
+ * several variants of the same op and kernel key, one per instruction set;
+ * lookup returns the most capable variant the CPU supports, so the choice is
+ * made once when a Method binds its kernels and costs nothing per call.
+ *
+ * x86 and Arm values never both pass the support check on one CPU, so a
+ * larger value means "more capable" within each architecture.
+ */
+enum class KernelIsa : uint8_t {
+  /// Baseline build of the kernel. Always eligible.
+  Default = 0,
+  AVX2 = 1,
+  AVX512 = 2,
+  SVE256 = 3,
+};
+
 /**
  * Struct that bundles a kernel key, a function and an op name together. An
  * `Operator` may have more than one `Kernel` (maximum kMaxNumOfKernelPerOp) and
  * they should have the same op name and different kernel key. A "fallback"
- * kernel may or may not live in an `Operator`.
+ * kernel may or may not live in an `Operator`. Kernels that differ only in
+ * `isa_` are variants of one kernel; see KernelIsa.
  */
 struct Kernel {
   const char* name_;
@@ -180,6 +198,7 @@ struct Kernel {
   // Data is not owned by the Kernel struct.
   KernelKey kernel_key_;
   OpFunction op_;
+  KernelIsa isa_ = KernelIsa::Default;
   /**
    * We are doing a copy of the string pointer instead of duplicating the string
    * itself, we require the lifetime of the operator name to be at least as long
@@ -190,9 +209,49 @@ struct Kernel {
   explicit Kernel(const char* name, KernelKey key, OpFunction func)
       : name_(name), kernel_key_(key), op_(func) {}
 
+  explicit Kernel(const char* name, OpFunction func, KernelIsa isa)
+      : name_(name), op_(func), isa_(isa) {}
+
+  explicit Kernel(
+      const char* name,
+      KernelKey key,
+      OpFunction func,
+      KernelIsa isa)
+      : name_(name), kernel_key_(key), op_(func), isa_(isa) {}
+
   Kernel() {}
 };
 
+/**
+ * Reports whether the CPU the runtime is running on can execute kernels built
+ * for `isa`.
+ */
+using KernelIsaSupportFn = bool (*)(KernelIsa isa);
+
+/**
+ * Installs the CPU feature probe used to choose between ISA variants of a
+ * kernel. Until one is installed only KernelIsa::Default kernels are chosen,
+ * so the core runtime does no CPU detection of its own; kernel libraries that
+ * register ISA variants install a probe alongside them.
+ *
+ * Affects lookups made after the call, i.e. Methods loaded afterwards.
+ */
+void set_kernel_isa_support_fn(KernelIsaSupportFn fn);
+
+/**
+ * Limits variant selection to kernels built for `isa` or a less capable
+ * instruction set, e.g. to A/B benchmark a model with and without AVX512
+ * kernels. KernelIsa::Default restricts lookups to the baseline kernels.
+ *
+ * Affects lookups made after the call, i.e. Methods loaded afterwards.
+ */
+void set_max_kernel_isa(KernelIsa isa);
+
+/**
+ * Returns the limit set by set_max_kernel_isa(). Unlimited by default.
+ */
+KernelIsa get_max_kernel_isa();
+
 namespace internal {
 void make_kernel_key_string(Span<const TensorMeta> key, char* buf);
 } // namespace internal
@@ -207,7 +266,9 @@ bool registry_has_op_function(
     Span<const TensorMeta> meta_list = {});
 
 /**
- * Returns the operator with a given name and TensorMeta list, if present.
+ * Returns the operator with a given name and TensorMeta list, if present. If
+ * the matching kernel has ISA variants, returns the most capable one that the
+ * CPU supports and that set_max_kernel_isa() allows.
  */
 ::executorch::runtime::Result<OpFunction> get_op_function_from_registry(
     const char* name,
@@ -246,6 +307,7 @@ namespace executor {
 // TODO(T197294990): Remove these deprecated aliases once all users have moved
 // to the new `::executorch` namespaces.
 using ::executorch::runtime::Kernel;
+using ::executorch::runtime::KernelIsa;
 using ::executorch::runtime::KernelKey;
 using ::executorch::runtime::KernelRuntimeContext;
 using ::executorch::runtime::OpFunction;
@@ -67,6 +67,15 @@ TEST_F(KernelRuntimeContextTest, FailureNoMemoryAllocatorProvided) {
   EXPECT_EQ(allocated_memory.error(), Error::NotFound);
 }
 
+TEST_F(KernelRuntimeContextTest, HasTempAllocator) {
+  KernelRuntimeContext no_allocator_context;
+  EXPECT_FALSE(no_allocator_context.has_temp_allocator());
+
+  MemoryAllocator temp_allocator(0, nullptr);
+  KernelRuntimeContext context(nullptr, &temp_allocator);
+  EXPECT_TRUE(context.has_temp_allocator());
+}
+
 TEST_F(KernelRuntimeContextTest, SuccessfulMemoryAllocation) {
   constexpr size_t temp_memory_allocator_pool_size = 4;
   auto temp_memory_allocator_pool =
@@ -25,13 +25,17 @@ using exec_aten::Tensor;
 using executorch::runtime::Error;
 using executorch::runtime::EValue;
 using executorch::runtime::get_op_function_from_registry;
+using executorch::runtime::get_max_kernel_isa;
 using executorch::runtime::Kernel;
+using executorch::runtime::KernelIsa;
 using executorch::runtime::KernelKey;
 using executorch::runtime::KernelRuntimeContext;
 using executorch::runtime::OpFunction;
 using executorch::runtime::register_kernels;
 using executorch::runtime::registry_has_op_function;
 using executorch::runtime::Result;
+using executorch::runtime::set_kernel_isa_support_fn;
+using executorch::runtime::set_max_kernel_isa;
 using executorch::runtime::Span;
 using executorch::runtime::TensorMeta;
 using executorch::runtime::testing::make_kernel_key;
@@ -302,3 +306,115 @@ TEST_F(OperatorRegistryTest, ExecutorUsesFallbackKernel) {
   auto val = values[0].toScalar().to<int64_t>();
   ASSERT_EQ(val, 100);
 }
+
+namespace {
+int64_t call_and_get_int(OpFunction func) {
+  EValue values[1];
+  values[0] = Scalar(0);
+  EValue* stack[1];
+  stack[0] = &values[0];
+  KernelRuntimeContext context{};
+  func(context, stack);
+  return values[0].toScalar().to<int64_t>();
+}
+} // namespace
+
+TEST_F(OperatorRegistryTest, ExecutorUsesBestSupportedIsaVariant) {
+  char buf_float_contiguous[BUF_SIZE];
+  make_kernel_key({{ScalarType::Float, {0, 1}}}, buf_float_contiguous);
+  KernelKey key = KernelKey(buf_float_contiguous);
+
+  // Variants of one kernel differ only in ISA, so registering them together
+  // is not a duplicate registration.
+  Kernel kernels[] = {
+      Kernel(
+          "test::isa",
+          key,
+          [](KernelRuntimeContext& context, EValue** stack) {
+            (void)context;
+            *(stack[0]) = Scalar(1);
+          }),
+      Kernel(
+          "test::isa",
+          key,
+          [](KernelRuntimeContext& context, EValue** stack) {
+            (void)context;
+            *(stack[0]) = Scalar(2);
+          },
+          KernelIsa::AVX2),
+      Kernel(
+          "test::isa",
+          key,
+          [](KernelRuntimeContext& context, EValue** stack) {
+            (void)context;
+            *(stack[0]) = Scalar(3);
+          },
+          KernelIsa::AVX512),
+  };
+  EXPECT_EQ(register_kernels(kernels), Error::Ok);
+
+  Tensor::DimOrderType dims[] = {0, 1};
+  TensorMeta meta[] = {
+      TensorMeta(ScalarType::Float, Span<Tensor::DimOrderType>(dims, 2))};
+  Span<const TensorMeta> user_kernel_key(meta);
+
+  // Without a support function only the baseline kernel is eligible.
+  set_kernel_isa_support_fn(nullptr);
+  Result<OpFunction> baseline_func =
+      get_op_function_from_registry("test::isa", user_kernel_key);
+  ASSERT_EQ(baseline_func.error(), Error::Ok);
+  EXPECT_EQ(call_and_get_int(*baseline_func), 1);
+
+  // A CPU with AVX2 but not AVX512.
+  set_kernel_isa_support_fn(
+      [](KernelIsa isa) { return isa == KernelIsa::AVX2; });
+  Result<OpFunction> avx2_func =
+      get_op_function_from_registry("test::isa", user_kernel_key);
+  ASSERT_EQ(avx2_func.error(), Error::Ok);
+  EXPECT_EQ(call_and_get_int(*avx2_func), 2);
+
+  // A CPU with everything.
+  set_kernel_isa_support_fn([](KernelIsa) { return true; });
+  Result<OpFunction> avx512_func =
+      get_op_function_from_registry("test::isa", user_kernel_key);
+  ASSERT_EQ(avx512_func.error(), Error::Ok);
+  EXPECT_EQ(call_and_get_int(*avx512_func), 3);
+
+  // Capping the ISA overrides what the CPU supports.
+  const KernelIsa max_isa = get_max_kernel_isa();
+  set_max_kernel_isa(KernelIsa::AVX2);
+  Result<OpFunction> capped_func =
+      get_op_function_from_registry("test::isa", user_kernel_key);
+  ASSERT_EQ(capped_func.error(), Error::Ok);
+  EXPECT_EQ(call_and_get_int(*capped_func), 2);
+
+  set_max_kernel_isa(KernelIsa::Default);
+  Result<OpFunction> default_func =
+      get_op_function_from_registry("test::isa", user_kernel_key);
+  ASSERT_EQ(default_func.error(), Error::Ok);
+  EXPECT_EQ(call_and_get_int(*default_func), 1);
+
+  set_max_kernel_isa(max_isa);
+  set_kernel_isa_support_fn(nullptr);
+}
+
+TEST_F(OperatorRegistryTest, UnsupportedIsaVariantIsMissing) {
+  // An op registered only for an ISA the CPU lacks is not available.
+  Kernel kernel = Kernel(
+      "test::avx512_only",
+      [](KernelRuntimeContext& context, EValue** stack) {
+        (void)context;
+        *(stack[0]) = Scalar(1);
+      },
+      KernelIsa::AVX512);
+  EXPECT_EQ(register_kernels({&kernel, 1}), Error::Ok);
+
+  set_kernel_isa_support_fn(
+      [](KernelIsa isa) { return isa == KernelIsa::AVX2; });
+  EXPECT_FALSE(registry_has_op_function("test::avx512_only"));
+
+  set_kernel_isa_support_fn([](KernelIsa) { return true; });
+  EXPECT_TRUE(registry_has_op_function("test::avx512_only"));
+
+  set_kernel_isa_support_fn(nullptr);
+}
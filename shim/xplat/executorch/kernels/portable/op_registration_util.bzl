@@ -379,6 +379,7 @@ ATEN_OPS = (
         name = "op_cat",
         deps = [
             "//executorch/kernels/portable/cpu/util:copy_ops_util",
+            "//executorch/kernels/portable/cpu/util:parallel_util",
         ],
     ),
     op_target(
@@ -639,6 +640,7 @@ ATEN_OPS = (
         deps = [
             "//executorch/kernels/portable/cpu/util:advanced_index_util",
             "//executorch/kernels/portable/cpu/util:broadcast_util",
+            "//executorch/kernels/portable/cpu/util:parallel_util",
         ],
     ),
     op_target(
@@ -824,6 +826,7 @@ ATEN_OPS = (
             "//executorch/runtime/core/exec_aten/util:tensor_util",
             "//executorch/kernels/portable/cpu/util:kernel_ops_util",
             "//executorch/kernels/portable/cpu/util:reduce_util",
+            "//executorch/kernels/portable/cpu/util:parallel_util",
         ],
     ),
     op_target(
@@ -924,6 +927,7 @@ ATEN_OPS = (
         name = "op_permute_copy",
         deps = [
             "//executorch/kernels/portable/cpu/util:copy_ops_util",
+            "//executorch/kernels/portable/cpu/util:parallel_util",
         ],
     ),
     op_target(
@@ -1171,6 +1175,7 @@ ATEN_OPS = (
             "//executorch/runtime/core/exec_aten/util:scalar_type_util",
             "//executorch/runtime/core/exec_aten/util:tensor_util",
             "//executorch/kernels/portable/cpu/util:reduce_util",
+            "//executorch/kernels/portable/cpu/util:parallel_util",
         ],
     ),
     op_target(
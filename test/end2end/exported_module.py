@@ -69,6 +69,7 @@ class ExportedModule:
         capture_config=None,
         skip_type_promotion: bool = False,
         export_joint_graph: bool = False,
+        emit_mutable_buffer_state: bool = False,
     ) -> "ExportedModule":
         """
         Creates a new ExportedModule for the specified module class.
@@ -80,6 +81,8 @@ class ExportedModule:
                 functional op does not have an out variant.
             dynamic_memory_planning_mode: The dynamic memory planning mode to
                 use.
+            emit_mutable_buffer_state: Whether to emit the mutable buffers of
+                the module as method state.
         """
 
         def get_inputs_adapter(
@@ -211,6 +214,7 @@ class ExportedModule:
                 dynamic_memory_planning_mode=dynamic_memory_planning_mode,
                 memory_planning_pass=memory_planning_pass,
                 to_out_var_pass=ToOutVarPass(ignore_to_out_var_failure),
+                emit_mutable_buffer_state=emit_mutable_buffer_state,
             )
         )
 
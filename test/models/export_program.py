@@ -88,6 +88,19 @@ class ModuleAdd(nn.Module):
         return (torch.randn(2, 2), torch.randn(2, 2), 1.0)
 
 
+class ModuleAddConstReturn(nn.Module):
+    def __init__(self):
+        super(ModuleAddConstReturn, self).__init__()
+        self.state = torch.ones(2, 2)
+
+    def forward(self, x):
+        # The second output is a constant, so it has no planned buffer.
+        return x + self.state, self.state
+
+    def get_random_inputs(self):
+        return (torch.ones(2, 2),)
+
+
 class ModuleAddHalf(nn.Module):
     def __init__(self):
         super().__init__()
@@ -130,6 +143,48 @@ class ModuleDynamicCatUnallocatedIO(nn.Module):
         return {"capture_config": CaptureConfig(pt2_mode=True, enable_aot=True)}
 
 
+class ModuleDynamicShapeBuckets(nn.Module):
+    def __init__(self):
+        super(ModuleDynamicShapeBuckets, self).__init__()
+        self._inputs = (torch.randn(4, 8),)
+
+    def forward(self, x):
+        y = x * 2.0
+        z = torch.cat((y, y))
+        return z + 1.0
+
+    def get_random_inputs(self):
+        return self._inputs
+
+    def get_dynamic_shapes(self):
+        return ({0: Dim("dim0_x", max=64)},)
+
+    def get_memory_planning_pass(self):
+        return MemoryPlanningPass(shape_buckets=[{"x": [4, 8]}, {"x": [16, 8]}])
+
+    @staticmethod
+    def get_export_kwargs():
+        return {"capture_config": CaptureConfig(pt2_mode=True, enable_aot=True)}
+
+
+class ModuleStateful(nn.Module):
+    def __init__(self):
+        super(ModuleStateful, self).__init__()
+        self.register_buffer("state", torch.ones(2, 2))
+
+    def forward(self, x):
+        # Accumulates the inputs into a buffer that persists across calls.
+        self.state.add_(x)
+        return self.state + x
+
+    def get_random_inputs(self):
+        return (torch.ones(2, 2),)
+
+    @staticmethod
+    def get_export_kwargs():
+        return {"emit_mutable_buffer_state": True}
+
+
 class ModuleLinear(torch.nn.Module):
     def __init__(self):
         super().__init__()
@@ -0,0 +1,166 @@
+# Copyright (c) Meta Platforms, Inc. and affiliates.
+# All rights reserved.
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+"""
+Writes ModuleAddExternal.pte and ModuleAddExternal.ptd, a program that adds its
+input to a constant whose data lives in the .ptd file.
+
+The exporter does not emit external constants yet, so the program is written
+directly against schema/program.fbs. Only needs `flatc`. To update the files,
+run from the repo root:
+
+    python test/models/external_constants/generate.py
+
+Then commit the updated files.
+"""
+
+import argparse
+import json
+import os
+import struct
+import subprocess
+import tempfile
+from typing import Any, Dict
+
+_REPO_ROOT = os.path.normpath(os.path.join(os.path.dirname(__file__), "../../.."))
+
+# The key that the program and the .ptd file agree on.
+WEIGHT_KEY = "add.weight"
+WEIGHT_DATA = [1.0, 2.0, 3.0, 4.0]
+
+# Keep in sync with FlatTensorHeader in extension/flat_tensor/flat_tensor_header.h.
+_FLAT_TENSOR_HEADER_OFFSET = 8
+_FLAT_TENSOR_NUM_HEAD_BYTES = 64
+_FLAT_TENSOR_HEADER_LENGTH = 40
+_FLAT_TENSOR_ALIGNMENT = 16
+
+
+def _tensor(**kwargs: Any) -> Dict[str, Any]:
+    tensor = {"scalar_type": "FLOAT", "sizes": [2, 2], "dim_order": [0, 1]}
+    tensor.update(kwargs)
+    return {"val_type": "Tensor", "val": tensor}
+
+
+def _program() -> Dict[str, Any]:
+    """forward(x) = x + weight, where weight is stored externally."""
+    return {
+        "version": 0,
+        "execution_plan": [
+            {
+                "name": "forward",
+                "values": [
+                    _tensor(allocation_info={"memory_id": 1, "memory_offset_low": 0}),
+                    _tensor(
+                        extra_tensor_info={
+                            "fully_qualified_name": WEIGHT_KEY,
+                            "location": "EXTERNAL",
+                        }
+                    ),
+                    {"val_type": "Int", "val": {"int_val": 1}},
+                    _tensor(allocation_info={"memory_id": 1, "memory_offset_low": 16}),
+                ],
+                "inputs": [0],
+                "outputs": [3],
+                "chains": [
+                    {
+                        "inputs": [0],
+                        "outputs": [3],
+                        "instructions": [
+                            {
+                                "instr_args_type": "KernelCall",
+                                "instr_args": {"op_index": 0, "args": [0, 1, 2, 3, 3]},
+                            }
+                        ],
+                    }
+                ],
+                "operators": [{"name": "aten::add", "overload": "out"}],
+                "delegates": [],
+                "non_const_buffer_sizes": [0, 32],
+            }
+        ],
+        "constant_buffer": [{"storage": []}],
+    }
+
+
+def _flat_tensor() -> Dict[str, Any]:
+    return {
+        "version": 0,
+        "tensor_alignment": _FLAT_TENSOR_ALIGNMENT,
+        "tensors": [
+            {
+                "fully_qualified_name": WEIGHT_KEY,
+                "scalar_type": "FLOAT",
+                "dim_sizes": [2, 2],
+                "dim_order": [0, 1],
+                "segment_index": 0,
+                "offset": 0,
+            }
+        ],
+        "segments": [{"offset": 0, "size": 4 * len(WEIGHT_DATA)}],
+    }
+
+
+def _flatc(
+    flatc: str, schema: str, extension: str, data: Dict[str, Any], out_dir: str
+) -> bytes:
+    """Serializes `data` with `schema`, a path relative to the repo root whose
+    file_extension is `extension`.
+    """
+    json_path = os.path.join(out_dir, "data.json")
+    with open(json_path, "w") as f:
+        json.dump(data, f)
+    subprocess.run(
+        [flatc, "--binary", "-o", out_dir, os.path.join(_REPO_ROOT, schema), json_path],
+        check=True,
+    )
+    with open(os.path.join(out_dir, "data." + extension), "rb") as f:
+        return f.read()
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--outdir", default=os.path.dirname(os.path.abspath(__file__)))
+    parser.add_argument("--flatc", default="flatc")
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        pte = _flatc(args.flatc, "schema/program.fbs", "pte", _program(), temp_dir)
+        flat_tensor = _flatc(
+            args.flatc,
+            "extension/flat_tensor/flat_tensor.fbs",
+            "ptd",
+            _flat_tensor(),
+            temp_dir,
+        )
+
+    # A .ptd file is laid out as [head][flatbuffer][segment data], with the
+    # header in the head pointing at the other two parts.
+    segment_base_offset = _FLAT_TENSOR_NUM_HEAD_BYTES + len(flat_tensor)
+    segment_base_offset += -segment_base_offset % _FLAT_TENSOR_ALIGNMENT
+    segment_data = struct.pack(f"<{len(WEIGHT_DATA)}f", *WEIGHT_DATA)
+    head = bytearray(_FLAT_TENSOR_NUM_HEAD_BYTES)
+    struct.pack_into(
+        "<4sIQQQQ",
+        head,
+        _FLAT_TENSOR_HEADER_OFFSET,
+        b"FH01",
+        _FLAT_TENSOR_HEADER_LENGTH,
+        _FLAT_TENSOR_NUM_HEAD_BYTES,
+        len(flat_tensor),
+        segment_base_offset,
+        len(segment_data),
+    )
+    ptd = bytes(head) + flat_tensor
+    ptd += bytes(segment_base_offset - len(ptd)) + segment_data
+
+    with open(os.path.join(args.outdir, "ModuleAddExternal.pte"), "wb") as f:
+        f.write(pte)
+    with open(os.path.join(args.outdir, "ModuleAddExternal.ptd"), "wb") as f:
+        f.write(ptd)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,127 @@
+# Copyright (c) Meta Platforms, Inc. and affiliates.
+# All rights reserved.
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+"""
+Writes ModuleAddUndersizedPlan.pte, a program whose shape-specialized memory
+plan gives its output less memory than the output needs at the plan's largest
+input sizes.
+
+The exporter always sizes plans correctly, so the program is written directly
+against schema/program.fbs. Only needs `flatc`. To update the file, run from
+the repo root:
+
+    python test/models/memory_plans/generate.py
+
+Then commit the updated file.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import tempfile
+from typing import Any, Dict
+
+_REPO_ROOT = os.path.normpath(os.path.join(os.path.dirname(__file__), "../../.."))
+
+# Rows of x at the program's upper bound and at the specialized plan's.
+MAX_ROWS = 8
+PLAN_MAX_ROWS = 4
+COLS = 2
+_FLOAT_BYTES = 4
+
+
+def _tensor(rows: int, offset: int) -> Dict[str, Any]:
+    return {
+        "val_type": "Tensor",
+        "val": {
+            "scalar_type": "FLOAT",
+            "sizes": [rows, COLS],
+            "dim_order": [0, 1],
+            "shape_dynamism": "DYNAMIC_BOUND",
+            "allocation_info": {"memory_id": 1, "memory_offset_low": offset},
+        },
+    }
+
+
+def _program() -> Dict[str, Any]:
+    """forward(x) = x + x for x of up to MAX_ROWS rows.
+
+    By default x is at offset 16 and the output follows it. The plan for x of
+    up to PLAN_MAX_ROWS rows moves the output to offset 0, in front of x, and
+    gives it only 16 bytes, half of what it needs at PLAN_MAX_ROWS rows. An
+    output that overflows this slot would overwrite x.
+    """
+    x_offset = 16
+    x_nbytes = MAX_ROWS * COLS * _FLOAT_BYTES
+    out_offset = x_offset + x_nbytes
+    return {
+        "version": 0,
+        "execution_plan": [
+            {
+                "name": "forward",
+                "values": [
+                    _tensor(MAX_ROWS, x_offset),
+                    {"val_type": "Int", "val": {"int_val": 1}},
+                    _tensor(MAX_ROWS, out_offset),
+                ],
+                "inputs": [0],
+                "outputs": [2],
+                "chains": [
+                    {
+                        "inputs": [0],
+                        "outputs": [2],
+                        "instructions": [
+                            {
+                                "instr_args_type": "KernelCall",
+                                "instr_args": {"op_index": 0, "args": [0, 0, 1, 2, 2]},
+                            }
+                        ],
+                    }
+                ],
+                "operators": [{"name": "aten::add", "overload": "out"}],
+                "delegates": [],
+                "non_const_buffer_sizes": [0, out_offset + x_nbytes],
+                "shape_specialized_memory_plans": [
+                    {
+                        "input_max_sizes": [PLAN_MAX_ROWS, COLS],
+                        "non_const_buffer_sizes": [0, x_offset + x_nbytes],
+                        "value_indices": [2],
+                        "allocations": [{"memory_id": 1, "memory_offset_low": 0}],
+                        "allocation_nbytes": [x_offset],
+                    }
+                ],
+            }
+        ],
+        "constant_buffer": [{"storage": []}],
+    }
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--outdir", default=os.path.dirname(os.path.abspath(__file__)))
+    parser.add_argument("--flatc", default="flatc")
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        json_path = os.path.join(temp_dir, "ModuleAddUndersizedPlan.json")
+        with open(json_path, "w") as f:
+            json.dump(_program(), f)
+        subprocess.run(
+            [
+                args.flatc,
+                "--binary",
+                "-o",
+                args.outdir,
+                os.path.join(_REPO_ROOT, "schema/program.fbs"),
+                json_path,
+            ],
+            check=True,
+        )
+
+
+if __name__ == "__main__":
+    main()
@@ -60,12 +60,15 @@ def define_common_targets():
     # Class names of nn.Modules for :exported_programs to export.
     MODULES_TO_EXPORT = [
         "ModuleAdd",
+        "ModuleAddConstReturn",
         "ModuleAddHalf",
         "ModuleBasic",
         "ModuleLinear",
         "ModuleMultipleEntry",
         "ModuleIndex",
         "ModuleDynamicCatUnallocatedIO",
+        "ModuleDynamicShapeBuckets",
+        "ModuleStateful",
         "ModuleSimpleTrain",
     ]
 
@@ -0,0 +1,117 @@
+# Copyright (c) Meta Platforms, Inc. and affiliates.
+# All rights reserved.
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+"""
+Writes ModuleAddUnbound.pte, a program with a DYNAMIC_UNBOUND intermediate
+that the memory plan does not reserve space for.
+
+The exporter only makes a tensor unbounded when its shape is data-dependent,
+while this test needs one that simply follows the input's shape, so the
+program is written directly against schema/program.fbs. Only needs `flatc`. To update the file,
+run from the repo root:
+
+    python test/models/unbound_tensors/generate.py
+
+Then commit the updated file.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import tempfile
+from typing import Any, Dict
+
+_REPO_ROOT = os.path.normpath(os.path.join(os.path.dirname(__file__), "../../.."))
+
+# Rows of x at the program's upper bound.
+MAX_ROWS = 16
+COLS = 16
+_FLOAT_BYTES = 4
+
+
+def _tensor(dynamism: str, rows: int, offset: int = -1) -> Dict[str, Any]:
+    tensor = {
+        "scalar_type": "FLOAT",
+        "sizes": [rows, COLS],
+        "dim_order": [0, 1],
+        "shape_dynamism": dynamism,
+    }
+    if offset >= 0:
+        tensor["allocation_info"] = {"memory_id": 1, "memory_offset_low": offset}
+    return {"val_type": "Tensor", "val": tensor}
+
+
+def _add(a: int, b: int, out: int) -> Dict[str, Any]:
+    return {
+        "instr_args_type": "KernelCall",
+        # a, b, alpha, out, and out again as the return value.
+        "instr_args": {"op_index": 0, "args": [a, b, 2, out, out]},
+    }
+
+
+def _program() -> Dict[str, Any]:
+    """forward(x) = (x + x) + x for x of up to MAX_ROWS rows.
+
+    x and the output are DYNAMIC_BOUND and memory-planned. The intermediate
+    y = x + x is DYNAMIC_UNBOUND, has no allocation_info and starts with one
+    row, so the Method gets storage for it when it is first resized.
+    """
+    nbytes = MAX_ROWS * COLS * _FLOAT_BYTES
+    return {
+        "version": 0,
+        "execution_plan": [
+            {
+                "name": "forward",
+                "values": [
+                    _tensor("DYNAMIC_BOUND", MAX_ROWS, 0),
+                    _tensor("DYNAMIC_UNBOUND", 1),
+                    {"val_type": "Int", "val": {"int_val": 1}},
+                    _tensor("DYNAMIC_BOUND", MAX_ROWS, nbytes),
+                ],
+                "inputs": [0],
+                "outputs": [3],
+                "chains": [
+                    {
+                        "inputs": [0],
+                        "outputs": [3],
+                        "instructions": [_add(0, 0, 1), _add(1, 0, 3)],
+                    }
+                ],
+                "operators": [{"name": "aten::add", "overload": "out"}],
+                "delegates": [],
+                "non_const_buffer_sizes": [0, 2 * nbytes],
+            }
+        ],
+        "constant_buffer": [{"storage": []}],
+    }
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--outdir", default=os.path.dirname(os.path.abspath(__file__)))
+    parser.add_argument("--flatc", default="flatc")
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        json_path = os.path.join(temp_dir, "ModuleAddUnbound.json")
+        with open(json_path, "w") as f:
+            json.dump(_program(), f)
+        subprocess.run(
+            [
+                args.flatc,
+                "--binary",
+                "-o",
+                args.outdir,
+                os.path.join(_REPO_ROOT, "schema/program.fbs"),
+                json_path,
+            ],
+            check=True,
+        )
+
+
+if __name__ == "__main__":
+    main()
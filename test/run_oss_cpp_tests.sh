@@ -33,6 +33,7 @@ build_executorch() {
     -DEXECUTORCH_BUILD_KERNELS_OPTIMIZED=ON \
     -DEXECUTORCH_BUILD_KERNELS_QUANTIZED=ON \
     -DEXECUTORCH_BUILD_EXTENSION_DATA_LOADER=ON \
+    -DEXECUTORCH_BUILD_EXTENSION_FLAT_TENSOR=ON \
     -DEXECUTORCH_BUILD_EXTENSION_MODULE=ON \
     -DEXECUTORCH_BUILD_EXTENSION_RUNNER_UTIL=ON \
     -DEXECUTORCH_BUILD_EXTENSION_TENSOR=ON \
@@ -53,27 +54,41 @@ build_gtest() {
 }
 
 export_test_model() {
-  python3 -m test.models.export_program --modules "ModuleAdd,ModuleAddHalf,ModuleDynamicCatUnallocatedIO,ModuleIndex,ModuleLinear,ModuleMultipleEntry,ModuleSimpleTrain" --outdir "cmake-out" 2> /dev/null
+  python3 -m test.models.export_program --modules "ModuleAdd,ModuleAddConstReturn,ModuleAddHalf,ModuleDynamicCatUnallocatedIO,ModuleDynamicShapeBuckets,ModuleIndex,ModuleLinear,ModuleMultipleEntry,ModuleSimpleTrain,ModuleStateful" --outdir "cmake-out" 2> /dev/null
   python3 -m test.models.export_delegated_program --modules "ModuleAddMul" --backend_id "StubBackend" --outdir "cmake-out" || true
 
   DEPRECATED_ET_MODULE_LINEAR_CONSTANT_BUFFER_PATH="$(realpath test/models/deprecated/ModuleLinear-no-constant-segment.pte)"
+  ET_MODULE_ADD_CONST_RETURN_PATH="$(realpath cmake-out/ModuleAddConstReturn.pte)"
+  ET_MODULE_ADD_EXTERNAL_PTD_PATH="$(realpath test/models/external_constants/ModuleAddExternal.ptd)"
+  ET_MODULE_ADD_EXTERNAL_PTE_PATH="$(realpath test/models/external_constants/ModuleAddExternal.pte)"
   ET_MODULE_ADD_HALF_PATH="$(realpath cmake-out/ModuleAddHalf.pte)"
   ET_MODULE_ADD_PATH="$(realpath cmake-out/ModuleAdd.pte)"
+  ET_MODULE_ADD_UNBOUND_PATH="$(realpath test/models/unbound_tensors/ModuleAddUnbound.pte)"
+  ET_MODULE_ADD_UNDERSIZED_PLAN_PATH="$(realpath test/models/memory_plans/ModuleAddUndersizedPlan.pte)"
   ET_MODULE_DYNAMIC_CAT_UNALLOCATED_IO_PATH="$(realpath cmake-out/ModuleDynamicCatUnallocatedIO.pte)"
+  ET_MODULE_DYNAMIC_SHAPE_BUCKETS_PATH="$(realpath cmake-out/ModuleDynamicShapeBuckets.pte)"
   ET_MODULE_INDEX_PATH="$(realpath cmake-out/ModuleIndex.pte)"
   ET_MODULE_LINEAR_PATH="$(realpath cmake-out/ModuleLinear.pte)"
   ET_MODULE_MULTI_ENTRY_PATH="$(realpath cmake-out/ModuleMultipleEntry.pte)"
+  ET_MODULE_STATEFUL_PATH="$(realpath cmake-out/ModuleStateful.pte)"
   ET_MODULE_ADD_MUL_NOSEGMENTS_DA1024_PATH="$(realpath cmake-out/ModuleAddMul-nosegments-da1024.pte)"
   ET_MODULE_ADD_MUL_NOSEGMENTS_PATH="$(realpath cmake-out/ModuleAddMul-nosegments.pte)"
   ET_MODULE_ADD_MUL_PATH="$(realpath cmake-out/ModuleAddMul.pte)"
   ET_MODULE_SIMPLE_TRAIN_PATH="$(realpath cmake-out/ModuleSimpleTrain.pte)"
   export DEPRECATED_ET_MODULE_LINEAR_CONSTANT_BUFFER_PATH
+  export ET_MODULE_ADD_CONST_RETURN_PATH
+  export ET_MODULE_ADD_EXTERNAL_PTD_PATH
+  export ET_MODULE_ADD_EXTERNAL_PTE_PATH
   export ET_MODULE_ADD_HALF_PATH
   export ET_MODULE_ADD_PATH
+  export ET_MODULE_ADD_UNBOUND_PATH
+  export ET_MODULE_ADD_UNDERSIZED_PLAN_PATH
   export ET_MODULE_DYNAMIC_CAT_UNALLOCATED_IO_PATH
+  export ET_MODULE_DYNAMIC_SHAPE_BUCKETS_PATH
   export ET_MODULE_INDEX_PATH
   export ET_MODULE_LINEAR_PATH
   export ET_MODULE_MULTI_ENTRY_PATH
+  export ET_MODULE_STATEFUL_PATH
   export ET_MODULE_ADD_MUL_NOSEGMENTS_DA1024_PATH
   export ET_MODULE_ADD_MUL_NOSEGMENTS_PATH
   export ET_MODULE_ADD_MUL_PATH